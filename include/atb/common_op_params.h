@@ -10,6 +10,7 @@
 #ifndef ATB_COMMONOPPARAM_H
 #define ATB_COMMONOPPARAM_H
 #include <cstdint>
+#include <vector>
 #include <acl/acl.h>
 #include "atb/types.h"
 
@@ -100,6 +101,39 @@ struct IfCondParam {
     //!
     uint8_t rsv[32] = {0};
 };
+
+//!
+//! \struct SwitchParam
+//!
+//! \brief Switch Operation参数，setup阶段根据整数选择子从N个分支中选择执行的路径。
+//!
+//! 各分支的输入、输出个数须一致，输出shape以第0个分支的推导结果为准。各分支独立保留runner与tiling缓存，
+//! 切换分支不会重新创建；setup返回的workspaceSize为已setup或预热过的各分支所需大小的最大值，
+//! 首次切换到所需更大的分支时返回值会变大，调用方须按每次setup的返回值申请workspace。
+//! 预热（Warmup）时不读取选择子，而是依次预热全部分支，之后返回的workspaceSize覆盖所有分支。
+//!
+struct SwitchParam {
+    //!
+    //! \brief 传给回调的上下文指针（用户自定义数据）
+    //!
+    void *userData = nullptr;
+    //!
+    //! \brief 分支选择回调，返回待执行分支在branches中的下标。selectByTensor为true时不使用
+    //!
+    int32_t (*handle)(void *userData) = nullptr;
+    //!
+    //! \brief 为true时最后一个输入tensor作为选择子，须为hostData非空的单元素int32 tensor，不传给分支
+    //!
+    bool selectByTensor = false;
+    //!
+    //! \brief 分支Operation，由调用方创建与销毁
+    //!
+    std::vector<Operation *> branches;
+    //!
+    //! \brief 预留参数
+    //!
+    uint8_t rsv[32] = {0};
+};
 } // namespace common
 } // namespace atb
 #endif
\ No newline at end of file
@@ -47,6 +47,28 @@ enum LaunchMode : int {
     GRAPH_LAUNCH_MODE       //!< 整图下发模式
 };
 
+//!
+//! \brief HostTilingMemoryOptions::numaNode取值，表示不绑定NUMA节点，由操作系统决定内存位置
+//!
+constexpr int32_t NUMA_NODE_ANY = -1;
+
+//!
+//! \brief HostTilingMemoryOptions::numaNode取值，表示绑定到调用CreateContext的线程当前所在的NUMA节点
+//!
+constexpr int32_t NUMA_NODE_CURRENT = -2;
+
+//!
+//! \struct HostTilingMemoryOptions
+//!
+//! \brief Context内部Host侧Tiling内存的申请选项.
+//!
+//! 使用锁页内存时Tiling的H2D拷贝可以直接由DMA异步完成；绑定NUMA节点可以使下发线程与Tiling内存位于同一个socket.
+//!
+struct HostTilingMemoryOptions {
+    bool pinned = false;              //!< 是否使用aclrtMallocHost申请锁页内存
+    int32_t numaNode = NUMA_NODE_ANY; //!< 内存所在的NUMA节点，可取NUMA_NODE_ANY、NUMA_NODE_CURRENT或节点号
+};
+
 //!
 //! \class Context.
 //!
@@ -139,6 +161,25 @@ public:
     //!
     //! \return 当前的算子下发模式
     virtual LaunchMode GetLaunchMode() = 0;
+
+    //!
+    //! \brief 设置是否开启执行流共享workspace模式
+    //!
+    //! 开启后Operation::Setup返回的workspaceSize为0，Execute时无需传入workspace，由Context按执行流分配。
+    //! 同一条流上顺序执行的Operation共享同一块workspace，大小为其中所需的最大值。
+    //! 使用多条执行流的Operation不参与共享，仍按Setup返回的workspaceSize由调用方申请。
+    //! 关闭时会同步各执行流并释放共享的workspace。
+    //!
+    //! \param enable 是否开启
+    //!
+    //! \return 状态值，如果设置成功，返回NO_ERROR
+    virtual Status SetStreamArenaStatus(bool enable) = 0;
+
+    //!
+    //! \brief 获取是否开启执行流共享workspace模式
+    //!
+    //! \return 是否开启
+    virtual bool GetStreamArenaStatus() const = 0;
 };
 
 //!
@@ -182,6 +223,24 @@ Status CreateContext(Context **context, const std::function<void*(size_t)>& allo
 //!
 Status CreateContext(Context **context, uint32_t hostTilingBlockNum, uint32_t deviceTilingBlockNum);
 
+//!
+//! \brief 创建上下文.
+//!
+//! 在当前进程或线程中显式创建一个Context，并指定Host侧Tiling内存是否锁页以及所在的NUMA节点.
+//!
+//! \param context 传入的context
+//!
+//! \param hostTilingBlockNum Context内部HostTilingBuffer块数，可配置范围：最小128，最大1024
+//!
+//! \param deviceTilingBlockNum Context内部DeviceTilingBuffer块数，可配置范围：最小32，最大1024
+//!
+//! \param options Host侧Tiling内存的申请选项
+//!
+//! \return 状态值.如果设置成功，返回NO_ERROR.
+//!
+Status CreateContext(Context **context, uint32_t hostTilingBlockNum, uint32_t deviceTilingBlockNum,
+                     const HostTilingMemoryOptions &options);
+
 //!
 //! \brief 销毁上下文.
 //!
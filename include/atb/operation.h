@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <vector>
 #include "atb/types.h"
 #include "atb/svector.h"
 #include "atb/context.h"
@@ -157,5 +158,115 @@ Status SetExecuteStreamId(Operation *operation, uint32_t streamId);
 //! \return 该Operation当前使用的streamId
 //!
 uint32_t GetExecuteStreamId(Operation *operation);
+
+//!
+//! \brief 将图算子保存为版本化的序列化文件
+//!
+//! 保存内容包括各节点的算子参数、输入输出tensorId、reshape规则、chunk以及streamId，嵌套图算子递归保存。
+//!
+//! \param operation 通过GraphParam创建的图算子
+//! \param filePath 保存的文件路径
+//!
+//! \return 状态值，如果成功，返回NO_ERROR
+//!
+//! \note 节点的reshape函数需由声明式规则（torch_atb.ReshapeSpec）生成；带inferShapeFunc的图、插件算子以及train算子不支持保存。
+//!       hcclComm、event等进程内句柄不会保存，加载后为空。
+//!
+Status SaveGraphOperation(const Operation *operation, const std::string &filePath);
+
+//!
+//! \brief 从SaveGraphOperation保存的文件直接创建图算子
+//!
+//! \param filePath 图算子文件路径
+//! \param operation 创建的图算子，使用完后需调用DestroyOperation销毁
+//!
+//! \return 状态值，如果成功，返回NO_ERROR；文件版本高于当前支持的版本时返回ERROR_INVALID_PARAM
+//!
+Status LoadGraphOperation(const std::string &filePath, Operation **operation);
+
+//!
+//! \brief 复用上一次Setup的结果，仅更新tensor地址后执行Operation
+//!
+//! 跳过Setup中的参数校验、InferShape以及runner Setup，直接更新tensor地址、填充tiling并下发。
+//! 适用于tensor描述信息与上一次Setup完全一致、仅device地址变化的场景，如decode阶段的逐token执行。
+//!
+//! \param operation 已完成Setup的Operation指针
+//! \param variantPack 输入与输出Tensor
+//! \param workspace workspace地址
+//! \param workspaceSize workspace大小，不小于上一次Setup得到的workspaceSize
+//! \param context Operation执行所在的上下文，需与Setup时一致
+//!
+//! \return 状态值，如果成功，返回NO_ERROR；退化为Setup且所需workspace大于workspaceSize时返回ERROR_INVALID_PARAM
+//!
+//! \note 调用方需保证hostData内容与上一次Setup一致。tensor描述信息与上一次Setup不一致、Setup后调用过
+//!       UpdateOperationParam、整图下发模式或非加速库内置Operation时，退化为先Setup再Execute。
+//!
+Status ExecuteWithNewAddresses(Operation *operation, const VariantPack &variantPack, uint8_t *workspace,
+                               uint64_t workspaceSize, Context *context);
+
+//!
+//! \struct WarmupBucketResult
+//!
+//! \brief 单个shape档位的预热结果
+//!
+struct WarmupBucketResult {
+    //! \brief 该档位Setup得到的workspace大小
+    uint64_t workspaceSize = 0;
+    //! \brief 该档位的预热耗时，单位us
+    uint64_t costTimeUs = 0;
+};
+
+//!
+//! \brief 按声明的输入shape档位预热Operation
+//!
+//! 对每个档位依次执行InferShape以及Setup（runner创建与Setup、tiling计算），不下发kernel，
+//! 预先填充runner本地与全局的tiling缓存以及aclnn executor缓存，避免首个真实请求承担这部分开销。
+//!
+//! \param operation Operation指针
+//! \param buckets 各档位的输入tensor描述信息
+//! \param context Operation后续执行所在的上下文
+//! \param results 各档位的预热结果，与buckets一一对应
+//!
+//! \return 状态值，如果成功，返回NO_ERROR；任一档位失败时返回该档位的错误码，不再预热后续档位
+//!
+//! \note 预热只使用tensor描述信息，依赖hostData的Operation可能预热失败。预热后执行前仍需使用真实tensor调用Setup。
+//!
+Status Warmup(Operation *operation, const std::vector<SVector<TensorDesc>> &buckets, Context *context,
+              std::vector<WarmupBucketResult> &results);
+
+//!
+//! \struct ExecuteBatchItem
+//!
+//! \brief 批量执行时单个Operation的执行信息
+//!
+struct ExecuteBatchItem {
+    //! \brief 已完成Setup的Operation指针
+    Operation *operation = nullptr;
+    //! \brief 输入与输出Tensor，描述信息需与Setup时一致
+    VariantPack variantPack;
+    //! \brief 该Operation使用的workspace地址，可以是一块大内存中的一段
+    uint8_t *workspace = nullptr;
+    //! \brief 该Operation使用的workspace大小，不小于Setup得到的workspaceSize
+    uint64_t workspaceSize = 0;
+};
+
+//!
+//! \brief 批量执行一组已完成Setup的Operation
+//!
+//! 先对所有Operation统一校验，校验通过后将所有Operation的tiling合并到一块连续内存中一次拷贝到device，再依次下发。
+//! 任一Operation校验失败时不会下发任何Operation。
+//!
+//! \param items 按执行顺序排列的Operation执行信息
+//! \param context Operation执行所在的上下文，需与Setup时一致
+//!
+//! \return 状态值，如果成功，返回NO_ERROR
+//!
+//! \note 整图下发模式、非EXECUTE_NORMAL执行类型、非加速库内置Operation或Operation使用不同的stream时，退化为逐个调用Execute。
+//!       汇总tiling所需的连续内存会覆盖某个Operation的tiling时同样退化为逐个调用Execute。
+//!
+//! \note 每个Operation的Setup从Context的host tiling内存池中取一块内存，一批中的Operation个数需小于内存池块数，
+//!       否则先Setup的Operation的tiling已被覆盖，返回ERROR_INVALID_PARAM且不下发任何Operation。
+//!
+Status ExecuteBatch(const std::vector<ExecuteBatchItem> &items, Context *context);
 } // namespace atb
 #endif
\ No newline at end of file
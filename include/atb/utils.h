@@ -10,6 +10,8 @@
 #ifndef ATB_UTILS_H
 #define ATB_UTILS_H
 #include <cstdint>
+#include <string>
+#include <vector>
 #include "atb/types.h"
 
 //!
@@ -20,6 +22,52 @@
 
 namespace atb {
 
+//!
+//! \struct OpMemStatistic
+//!
+//! \brief 按算子名称汇总的device内存申请统计，单位字节
+//!
+struct OpMemStatistic {
+    //! \brief 算子名称
+    std::string opName;
+    //! \brief 执行次数
+    uint64_t executeCount = 0;
+    //! \brief 最近一次执行的workspace大小
+    uint64_t workspaceSize = 0;
+    //! \brief 最近一次执行的中间tensor内存大小
+    uint64_t intermediateSize = 0;
+    //! \brief 最近一次执行的tiling内存大小
+    uint64_t tilingSize = 0;
+    //! \brief 各次执行中workspace大小的最大值
+    uint64_t maxWorkspaceSize = 0;
+    //! \brief 各次执行中中间tensor内存大小的最大值
+    uint64_t maxIntermediateSize = 0;
+    //! \brief 各次执行中tiling内存大小的最大值
+    uint64_t maxTilingSize = 0;
+    //! \brief 单次执行三类内存之和的最大值
+    uint64_t maxTotalSize = 0;
+};
+
+//!
+//! \struct OpMemRecord
+//!
+//! \brief 单次执行的device内存申请记录，单位字节
+//!
+struct OpMemRecord {
+    //! \brief 进程内的执行序号，从0开始
+    uint64_t executeIndex = 0;
+    //! \brief 算子名称
+    std::string opName;
+    //! \brief workspace大小
+    uint64_t workspaceSize = 0;
+    //! \brief 中间tensor内存大小
+    uint64_t intermediateSize = 0;
+    //! \brief tiling内存大小
+    uint64_t tilingSize = 0;
+    //! \brief 截至本次执行，所有算子单次执行内存之和的最大值
+    uint64_t peakSize = 0;
+};
+
 //!
 //! \class Utils.
 //!
@@ -96,6 +144,57 @@ public:
     //! \return 状态值，如果设置成功，返回NO_ERROR.
     //!
     static Status ResetLogLevel();
+
+    //!
+    //! \brief 开启或关闭host侧trace事件记录，初始状态由环境变量ATB_TRACE_ENABLE决定
+    //!
+    //! \param enable 是否记录trace事件
+    //!
+    static void SetTraceEnable(bool enable);
+
+    //!
+    //! \brief 将各线程当前记录的trace事件导出为Chrome trace json文件，可用chrome://tracing或Perfetto打开
+    //!
+    //! \param filePath 导出文件路径
+    //!
+    //! \return 状态值，如果导出成功，返回NO_ERROR.
+    //!
+    static Status DumpTrace(const std::string &filePath);
+
+    //!
+    //! \brief 开启或关闭按算子的device内存记录，初始状态由环境变量ATB_MEM_ACCOUNTING_ENABLE决定
+    //!
+    //! \param enable 是否记录每次执行申请的workspace、中间tensor与tiling内存
+    //!
+    static void SetMemAccountingEnable(bool enable);
+
+    //!
+    //! \brief 获取按算子名称汇总的device内存统计
+    //!
+    //! \return 各算子的内存统计，按算子首次执行的顺序排列
+    //!
+    static std::vector<OpMemStatistic> GetOpMemStatistics();
+
+    //!
+    //! \brief 获取按执行顺序排列的内存记录，即内存高水位时间线
+    //!
+    //! \return 最近的内存记录，条数上限由环境变量ATB_MEM_ACCOUNTING_BUFFER_SIZE决定
+    //!
+    static std::vector<OpMemRecord> GetOpMemRecords();
+
+    //!
+    //! \brief 清空已记录的内存统计与记录
+    //!
+    static void ResetMemAccounting();
+
+    //!
+    //! \brief 导出内存统计与记录
+    //!
+    //! \param filePath 导出文件路径，以.csv结尾时导出按算子汇总的csv表格，否则导出包含汇总与时间线的json
+    //!
+    //! \return 状态值，如果导出成功，返回NO_ERROR.
+    //!
+    static Status DumpMemAccounting(const std::string &filePath);
 };
 } // namespace atb
 #endif
\ No newline at end of file
@@ -0,0 +1,473 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+"""
+离线生成PpMatmul tiling表：对声明的模型shape穷举(m0, n0)与swizzle组合，按代价模型或实测耗时选出最优切分，
+生成src/kernels/kernels/matmul/tiling/pp_matmul_tiling_table_data.cpp，运行时PpMatmulTiling先查表，未命中再走解析搜索。
+
+代价模型:
+  analytic  与运行时TilingFunc/Swizzl逐位一致(含float精度)，只省去冷启动时的搜索开销，不改变切分结果
+  roofline  按轮次、单核算力、swizzle窗口内的HBM/L2读写量估算耗时，需在目标芯片上实测确认收益
+--timings 指定实测耗时csv时，有实测数据的shape直接取耗时最小的切分，优先于代价模型
+"""
+import os
+import csv
+import math
+import stat
+import struct
+import logging
+import argparse
+
+CANN_COPYRIGHT = '''/*
+* Copyright (c) 2025 Huawei Technologies Co., Ltd.
+* This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+* CANN Open Software License Agreement Version 2.0 (the "License").
+* Please refer to the License for details. You may not use this file except in compliance with the License.
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+* INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+* See LICENSE in the root of the software repository for the full text of the License.
+*/
+'''
+
+# 与pp_matmul_tiling_table.h中的PP_TILING_FLAG_*一致
+FLAG_TRANS_A = 1
+FLAG_TRANS_B = 1 << 1
+FLAG_FORMAT_B_NZ = 1 << 2
+FLAG_WITH_BIAS = 1 << 3
+FLAG_IN_DTYPE_SHIFT = 4
+
+DTYPE_SIZE = {'int8': 1, 'float16': 2, 'bf16': 2, 'float': 4}
+
+# 芯片参数：platform/core_num/l0c_size/l2_size与PlatformInfo一致，带宽与单核算力只用于roofline模型
+SOC_PRESETS = {
+    'ascend910b1': {'platform': 'ASCEND_910B', 'core_num': 24, 'l0c_size': 131072, 'l2_size': 201326592,
+                    'hbm_bandwidth': 1.6e12, 'l2_bandwidth': 8.0e12, 'core_flops': 1.6e13},
+    'ascend910b2': {'platform': 'ASCEND_910B', 'core_num': 24, 'l0c_size': 131072, 'l2_size': 201326592,
+                    'hbm_bandwidth': 1.6e12, 'l2_bandwidth': 8.0e12, 'core_flops': 1.4e13},
+    'ascend910b3': {'platform': 'ASCEND_910B', 'core_num': 20, 'l0c_size': 131072, 'l2_size': 201326592,
+                    'hbm_bandwidth': 1.6e12, 'l2_bandwidth': 8.0e12, 'core_flops': 1.4e13},
+    'ascend910b4': {'platform': 'ASCEND_910B', 'core_num': 20, 'l0c_size': 131072, 'l2_size': 100663296,
+                    'hbm_bandwidth': 0.8e12, 'l2_bandwidth': 4.0e12, 'core_flops': 1.4e13},
+}
+
+# 以下常量与common_tiling.h、pp_matmul_tiling.cpp一致
+BLOCK_SIZE = 16
+BLOCK_SIZE_INT8_K = 32
+CUBE_BLOCK_SIZE = 256
+CUBE_BLOCK_SIZE_INT8 = 512
+AXES_ALIGN_SIZE = 512
+AXES_ALIGN_SIZE_INT8 = 256
+L1AB_PINGPONG_BUFFER_LEN = 262144
+L1_DESCALE_BUFFER_LEN_MAX = 6144
+FP32_SIZE = 4
+FP16_SIZE = 2
+HBM_BANDWIDTH = 1
+L2_BANDWIDTH = 5
+UINT32_MASK = 0xFFFFFFFF
+
+
+def _f32(value):
+    # 运行时代价计算使用float，逐次运算后舍入到float以保证选择结果一致
+    return struct.unpack('f', struct.pack('f', value))[0]
+
+
+def _ceil_div(dividend, divisor):
+    if divisor == 0:
+        return dividend
+    return (dividend + divisor - 1) // divisor
+
+
+def _round_up(num, rnd):
+    if rnd == 0:
+        return num
+    return (num + rnd - 1) // rnd * rnd
+
+
+class MatmulShape:
+    def __init__(self, row: dict):
+        self.batch = int(row['batch'])
+        self.m = int(row['m'])
+        self.k = int(row['k'])
+        self.n = int(row['n'])
+        self.trans_a = _parse_bool(row.get('trans_a', '0'))
+        self.trans_b = _parse_bool(row.get('trans_b', '0'))
+        self.dtype = row.get('dtype', 'float16').strip()
+        if self.dtype not in DTYPE_SIZE:
+            raise ValueError(f'unsupported dtype {self.dtype}')
+        self.format_b_nz = row.get('format_b', 'nd').strip().lower() == 'nz'
+        self.with_bias = _parse_bool(row.get('with_bias', '0'))
+        if min(self.batch, self.m, self.k, self.n) <= 0:
+            raise ValueError(f'invalid shape {row}')
+
+    @property
+    def in_dtype(self):
+        return DTYPE_SIZE[self.dtype]
+
+    @property
+    def is_int8(self):
+        return self.dtype == 'int8'
+
+    @property
+    def flags(self):
+        flags = FLAG_TRANS_A if self.trans_a else 0
+        flags |= FLAG_TRANS_B if self.trans_b else 0
+        flags |= FLAG_FORMAT_B_NZ if self.format_b_nz else 0
+        flags |= FLAG_WITH_BIAS if self.with_bias else 0
+        return flags | (self.in_dtype << FLAG_IN_DTYPE_SHIFT)
+
+    def key(self):
+        return self.flags, self.batch, self.m, self.k, self.n
+
+
+def _parse_bool(value):
+    return str(value).strip().lower() in ('1', 'true', 'yes')
+
+
+class Tiling:
+    def __init__(self):
+        self.m0 = 0
+        self.n0 = 0
+        self.m_loop = 1
+        self.n_loop = 1
+        self.core_loop = 1
+        self.block_dim = 1
+        self.swizzl_count = 1
+        self.swizzl_direct = 0
+
+
+def set_base_op(tiling: Tiling, hw: dict, shape: MatmulShape, m_base: int, n_base: int):
+    """PpTilingData::SetBaseOp"""
+    core_num = hw['core_num']
+    tiling.m0 = m_base
+    tiling.n0 = n_base
+    tiling.m_loop = _ceil_div(shape.m, tiling.m0)
+    tiling.n_loop = _ceil_div(shape.n, tiling.n0)
+    tiling.core_loop = (shape.batch * tiling.m_loop * tiling.n_loop) & UINT32_MASK
+    if tiling.m_loop == 1 and shape.trans_b and tiling.core_loop % core_num < core_num // 4 * 3:
+        m_base = _round_up(shape.m, BLOCK_SIZE)
+        tiling.m0 = m_base
+        max_n0 = hw['l0c_size'] // (m_base * FP32_SIZE)
+        if shape.is_int8 or shape.with_bias:
+            max_n0 = min(max_n0, 256)
+        x = _ceil_div(shape.n, core_num)
+        y = _ceil_div(x, max_n0)
+        n_base = _round_up(_ceil_div(x, y), BLOCK_SIZE)
+        if m_base * n_base * FP32_SIZE < hw['l0c_size'] and \
+                (m_base + n_base) * 256 * FP16_SIZE < L1AB_PINGPONG_BUFFER_LEN:
+            tiling.n0 = n_base
+            tiling.n_loop = _ceil_div(shape.n, tiling.n0)
+            tiling.core_loop = (shape.batch * tiling.n_loop) & UINT32_MASK
+    tiling.block_dim = min(tiling.core_loop, core_num)
+
+
+def analytic_cost(hw: dict, shape: MatmulShape, m0: int, n0: int):
+    """CostFunc"""
+    a_coef = 1.0
+    b_coef = 1.0
+    bw_coef = _f32(float(L2_BANDWIDTH) / float(HBM_BANDWIDTH))
+    m_loop = _ceil_div(shape.m, m0)
+    n_loop = _ceil_div(shape.n, n0)
+    if m_loop == 0 or n_loop == 0:
+        return 1.0
+    core_need = (shape.batch * m_loop * n_loop) & UINT32_MASK
+    block_dim = min(core_need, hw['core_num'])
+    m_once = m0 if block_dim < n_loop else block_dim // n_loop * m0
+    n_once = hw['core_num'] * n0 if block_dim < n_loop else shape.n
+    if m_once * shape.k * FP16_SIZE > hw['l2_size']:
+        a_coef = bw_coef
+    if n_once * shape.k * FP16_SIZE > hw['l2_size']:
+        b_coef = bw_coef
+    return _f32(_f32(1.0 / _f32(a_coef * n0)) + _f32(1.0 / _f32(b_coef * m0)))
+
+
+def _axes0_max(hw: dict, shape: MatmulShape):
+    axes0_max = _f32(float(AXES_ALIGN_SIZE) / shape.in_dtype)
+    if shape.is_int8 and hw['platform'] in ('ASCEND_310P', 'ASCEND_910A'):
+        axes0_max = _f32(axes0_max / 2.0)
+    return axes0_max
+
+
+def _is_valid_base_block(hw: dict, shape: MatmulShape, m0: int, n0: int):
+    basic_block_size = m0 * n0 * FP32_SIZE
+    if basic_block_size > hw['l0c_size']:
+        return False
+    if shape.is_int8:
+        n0_limit = AXES_ALIGN_SIZE if hw['platform'] in ('ASCEND_310P', 'ASCEND_910A') else AXES_ALIGN_SIZE_INT8
+        if n0 > n0_limit:
+            return False
+        if hw['platform'] == 'ASCEND_910A' and basic_block_size > 128 * 1024:
+            return False
+    return True
+
+
+def tiling_func(pri_flag: bool, tiling: Tiling, local: dict, hw: dict, shape: MatmulShape):
+    """TilingFunc，local对应调用方的opShape，记录最后一次尝试的m0/n0"""
+    cost_min = 1.0
+    round_base = int(math.pow(2, math.ceil(math.log(_ceil_div(shape.n if pri_flag else shape.m, 16)))) * 16)
+    pri_axes = _round_up(shape.m if pri_flag else shape.n, 16)
+    axes = _round_up(shape.n if pri_flag else shape.m, round_base)
+    axes0_max = _axes0_max(hw, shape)
+    pri_axes0 = BLOCK_SIZE
+    while pri_axes0 <= pri_axes and pri_axes0 <= axes0_max:
+        axes0 = BLOCK_SIZE
+        while axes0 <= axes and axes0 <= axes0_max:
+            m0, n0 = (pri_axes0, axes0) if pri_flag else (axes0, pri_axes0)
+            if _is_valid_base_block(hw, shape, m0, n0):
+                local['m0'], local['n0'] = m0, n0
+                cost = analytic_cost(hw, shape, m0, n0)
+                if cost < cost_min:
+                    cost_min = cost
+                    set_base_op(tiling, hw, shape, m0, n0)
+            axes0 *= 2
+        pri_axes0 *= 2
+
+
+def swizzl(tiling: Tiling, shape: MatmulShape):
+    """Swizzl，方向取最后一次循环的判断结果"""
+    swizzl_direct = 0
+    swizzl_count = 1
+    m0 = _f32(tiling.m0)
+    n0 = _f32(tiling.n0)
+    m = _f32(shape.m)
+    k = _f32(shape.k)
+    n = _f32(shape.n)
+    min_cost = _f32(_f32(m * k) + _f32(k * n))
+    for i in range(1, tiling.block_dim + 1):
+        c = _f32((tiling.block_dim + i - 1) // i)
+        fi = _f32(i)
+        if _f32(_f32(fi * n0) + m) < _f32(_f32(m0 * c) + n):
+            swizzl_direct = 1
+            cost = _f32(_f32(n0 * fi) + _f32(m0 * c))
+            if cost <= min_cost:
+                min_cost = cost
+                swizzl_count = i
+        else:
+            swizzl_direct = 0
+            cost = _f32(_f32(m0 * fi) + _f32(n0 * c))
+            if cost < min_cost:
+                min_cost = cost
+                swizzl_count = i
+    tiling.swizzl_direct = swizzl_direct
+    tiling.swizzl_count = swizzl_count
+
+
+def analytic_tiling(hw: dict, shape: MatmulShape):
+    """GetPpMatmulTiling中的解析搜索"""
+    tiling = Tiling()
+    local = {'m0': 0, 'n0': 0}
+    tiling_func(shape.m >= shape.n, tiling, local, hw, shape)
+    if shape.m == 1 and shape.n == 2048 and shape.format_b_nz and hw['platform'] != 'ASCEND_310P':
+        set_base_op(tiling, hw, shape, local['m0'], 128)
+    if tiling.m0 == 0 or tiling.n0 == 0:
+        return None
+    swizzl(tiling, shape)
+    return tiling
+
+
+def k0_of(shape: MatmulShape, m0: int, n0: int):
+    """PpTilingData::End中的k0，为0时切分不可用"""
+    cube_block_size = CUBE_BLOCK_SIZE_INT8 if shape.is_int8 else CUBE_BLOCK_SIZE
+    k_block_size = BLOCK_SIZE_INT8_K if shape.is_int8 else BLOCK_SIZE
+    scale_block_size = L1_DESCALE_BUFFER_LEN_MAX if shape.is_int8 else 0
+    shape_sum = m0 + n0
+    if shape.is_int8 and (shape.trans_a or not shape.trans_b):
+        shape_sum = _round_up(m0, 32) + _round_up(n0, 32)
+    k0_max = int((L1AB_PINGPONG_BUFFER_LEN - scale_block_size) / (shape_sum * shape.in_dtype))
+    if shape.with_bias:
+        k0_max = (L1AB_PINGPONG_BUFFER_LEN - n0 * FP32_SIZE) // (shape_sum * shape.in_dtype)
+    return k0_max // k_block_size * k_block_size if k0_max < cube_block_size else \
+        k0_max // cube_block_size * cube_block_size
+
+
+def _candidate_base_blocks(hw: dict, shape: MatmulShape):
+    """与解析搜索相同的基块空间，另加SetBaseOp对单行场景的调整结果"""
+    axes0_max = _axes0_max(hw, shape)
+    candidates = set()
+    m0 = BLOCK_SIZE
+    while m0 <= axes0_max and m0 <= _round_up(shape.m, BLOCK_SIZE) * 2:
+        n0 = BLOCK_SIZE
+        while n0 <= axes0_max and n0 <= _round_up(shape.n, BLOCK_SIZE) * 2:
+            if _is_valid_base_block(hw, shape, m0, n0):
+                tiling = Tiling()
+                set_base_op(tiling, hw, shape, m0, n0)
+                candidates.add((m0, n0))
+                candidates.add((tiling.m0, tiling.n0))
+            n0 *= 2
+        m0 *= 2
+    return sorted(c for c in candidates if c[0] * c[1] * FP32_SIZE <= hw['l0c_size'] and k0_of(shape, *c) > 0)
+
+
+def roofline_cost(hw: dict, shape: MatmulShape, m0: int, n0: int, swizzl_count: int, swizzl_direct: int):
+    m_loop = _ceil_div(shape.m, m0)
+    n_loop = _ceil_div(shape.n, n0)
+    core_loop = shape.batch * m_loop * n_loop
+    block_dim = min(core_loop, hw['core_num'])
+    rounds = _ceil_div(core_loop, block_dim)
+    flops_scale = 2.0 if shape.is_int8 else (0.5 if shape.in_dtype == 4 else 1.0)
+    compute_time = 2.0 * m0 * n0 * shape.k / (hw['core_flops'] * flops_scale)
+    # 同一轮并行的block按swizzle窗口排布，窗口内共享的A/B块只从HBM读一次，其余命中L2
+    if swizzl_direct == 0:
+        rows = min(swizzl_count, m_loop)
+        cols = min(_ceil_div(block_dim, rows), n_loop)
+    else:
+        cols = min(swizzl_count, n_loop)
+        rows = min(_ceil_div(block_dim, cols), m_loop)
+    bytes_a = m0 * shape.k * shape.in_dtype
+    bytes_b = n0 * shape.k * shape.in_dtype
+    hbm_bytes = rows * bytes_a + cols * bytes_b
+    l2_bytes = max(block_dim * (bytes_a + bytes_b) - hbm_bytes, 0)
+    out_bytes = block_dim * m0 * n0 * FP16_SIZE
+    memory_time = (hbm_bytes + out_bytes) / hw['hbm_bandwidth'] + l2_bytes / hw['l2_bandwidth']
+    return rounds * max(compute_time, memory_time)
+
+
+def roofline_tiling(hw: dict, shape: MatmulShape):
+    best = None
+    for m0, n0 in _candidate_base_blocks(hw, shape):
+        tiling = Tiling()
+        tiling.m0, tiling.n0 = m0, n0
+        tiling.m_loop = _ceil_div(shape.m, m0)
+        tiling.n_loop = _ceil_div(shape.n, n0)
+        tiling.core_loop = shape.batch * tiling.m_loop * tiling.n_loop
+        tiling.block_dim = min(tiling.core_loop, hw['core_num'])
+        if tiling.core_loop > UINT32_MASK:
+            continue
+        for swizzl_direct in (0, 1):
+            for swizzl_count in range(1, tiling.block_dim + 1):
+                cost = roofline_cost(hw, shape, m0, n0, swizzl_count, swizzl_direct)
+                # 代价相同时优先大基块与小窗口，保证结果稳定
+                rank = (cost, -m0 * n0, swizzl_count, swizzl_direct)
+                if best is None or rank < best[0]:
+                    best = (rank, m0, n0, swizzl_count, swizzl_direct)
+    if best is None:
+        return None
+    tiling = Tiling()
+    _, tiling.m0, tiling.n0, tiling.swizzl_count, tiling.swizzl_direct = best
+    return tiling
+
+
+def _load_csv(file_path: str):
+    with open(file_path) as fd:
+        lines = [line for line in fd if line.strip() and not line.lstrip().startswith('#')]
+    return list(csv.DictReader(lines, skipinitialspace=True))
+
+
+def load_timings(file_path: str):
+    """实测耗时csv：soc + shape列 + m0,n0,swizzl_count,swizzl_direct,time_us，同一shape取耗时最小的切分"""
+    timings = {}
+    for row in _load_csv(file_path):
+        shape = MatmulShape(row)
+        key = (row['soc'].strip(), shape.key())
+        config = (float(row['time_us']), int(row['m0']), int(row['n0']), int(row['swizzl_count']),
+                  int(row['swizzl_direct']))
+        if key not in timings or config < timings[key]:
+            timings[key] = config
+    return timings
+
+
+def _measured_tiling(hw: dict, shape: MatmulShape, config: tuple):
+    _, m0, n0, swizzl_count, swizzl_direct = config
+    core_loop = shape.batch * _ceil_div(shape.m, m0) * _ceil_div(shape.n, n0)
+    if m0 <= 0 or n0 <= 0 or m0 * n0 * FP32_SIZE > hw['l0c_size'] or k0_of(shape, m0, n0) <= 0 or \
+            not 1 <= swizzl_count <= min(core_loop, hw['core_num']) or swizzl_direct not in (0, 1):
+        logging.warning('ignore invalid measured tiling %s for shape %s', config, shape.key())
+        return None
+    tiling = Tiling()
+    tiling.m0, tiling.n0, tiling.swizzl_count, tiling.swizzl_direct = m0, n0, swizzl_count, swizzl_direct
+    return tiling
+
+
+def build_entries(socs: list, shapes: list, cost_model: str, timings: dict):
+    tables = {}
+    for soc in socs:
+        hw = SOC_PRESETS[soc]
+        entries = tables.setdefault(hw['platform'], {})
+        for shape in shapes:
+            tiling = None
+            config = timings.get((soc, shape.key()))
+            if config is not None:
+                tiling = _measured_tiling(hw, shape, config)
+            if tiling is None:
+                tiling = analytic_tiling(hw, shape) if cost_model == 'analytic' else roofline_tiling(hw, shape)
+            if tiling is None:
+                logging.warning('no valid tiling for %s shape %s', soc, shape.key())
+                continue
+            key = (hw['core_num'],) + shape.key()
+            value = (tiling.m0, tiling.n0, tiling.swizzl_count, tiling.swizzl_direct)
+            if key in entries and entries[key] != value:
+                logging.warning('%s shape %s conflicts with another soc of the same core num, keep the first one',
+                                soc, shape.key())
+                continue
+            entries[key] = value
+    return tables
+
+
+def write_table_cpp(tables: dict, dest_file_path: str, comment: str):
+    lines = [CANN_COPYRIGHT, '// generated by scripts/build_matmul_tiling_table.py, do not edit\n']
+    lines.append(f'// {comment}\n')
+    lines.append('#include "pp_matmul_tiling_table.h"\n\n')
+    lines.append('namespace AsdOps {\n')
+    table_names = []
+    non_empty = [(platform, entries) for platform, entries in sorted(tables.items()) if entries]
+    if non_empty:
+        lines.append('namespace {\n')
+        lines.append('// coreNum, flags, batchSize, m, k, n, m0, n0, swizzlCount, swizzlDirect\n')
+    for platform, entries in non_empty:
+        name = f'{platform}_ENTRIES'
+        table_names.append((platform, name))
+        lines.append(f'const PpMatmulTilingEntry {name}[] = {{\n')
+        for key in sorted(entries.keys()):
+            values = ', '.join(str(item) for item in key + entries[key])
+            lines.append(f'    {{{values}}},\n')
+        lines.append('};\n\n')
+    if non_empty:
+        lines.append('const PpMatmulTilingTable PP_MATMUL_TILING_TABLES[] = {\n')
+        for platform, name in table_names:
+            lines.append(f'    {{PlatformType::{platform}, {name}, sizeof({name}) / sizeof({name}[0])}},\n')
+        lines.append('};\n')
+        lines.append('} // namespace\n')
+    lines.append('\nconst PpMatmulTilingTable *GetPpMatmulTilingTables(size_t &tableNum)\n{\n')
+    if non_empty:
+        lines.append('    tableNum = sizeof(PP_MATMUL_TILING_TABLES) / sizeof(PP_MATMUL_TILING_TABLES[0]);\n')
+        lines.append('    return PP_MATMUL_TILING_TABLES;\n')
+    else:
+        lines.append('    tableNum = 0;\n')
+        lines.append('    return nullptr;\n')
+    lines.append('}\n')
+    lines.append('} // namespace AsdOps\n')
+    with os.fdopen(os.open(dest_file_path, os.O_WRONLY | os.O_CREAT | os.O_TRUNC, stat.S_IWUSR | stat.S_IRUSR),
+                   'w') as fd:
+        fd.write(''.join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--shapes', type=str, nargs='+', required=True,
+                        help='模型shape csv，列: batch,m,k,n,trans_a,trans_b,dtype,format_b,with_bias')
+    parser.add_argument('--socs', type=str, nargs='+', default=['ascend910b1', 'ascend910b3'],
+                        choices=sorted(SOC_PRESETS.keys()))
+    parser.add_argument('--cost_model', type=str, default='analytic', choices=['analytic', 'roofline'])
+    parser.add_argument('--timings', type=str, default='', help='实测耗时csv，可选')
+    parser.add_argument('--dest_file_path', type=str, required=True)
+    args = parser.parse_args()
+    shapes = []
+    for file_path in args.shapes:
+        shapes.extend(MatmulShape(row) for row in _load_csv(file_path))
+    timings = load_timings(args.timings) if args.timings else {}
+    tables = build_entries(args.socs, shapes, args.cost_model, timings)
+    comment = f'cost model: {args.cost_model}, socs: {" ".join(args.socs)}, shapes: ' + \
+        ' '.join(os.path.basename(path) for path in args.shapes) + \
+        (f', timings: {os.path.basename(args.timings)}' if args.timings else '')
+    write_table_cpp(tables, args.dest_file_path, comment)
+    logging.info('write %d entries to %s', sum(len(entries) for entries in tables.values()), args.dest_file_path)
+
+
+if __name__ == '__main__':
+    logging.basicConfig(level=logging.INFO)
+    main()
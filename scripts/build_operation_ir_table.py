@@ -0,0 +1,228 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+import os
+import re
+import sys
+import stat
+import logging
+import argparse
+
+CANN_COPYRIGHT = '''/*
+* Copyright (c) 2025 Huawei Technologies Co., Ltd.
+* This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+* CANN Open Software License Agreement Version 2.0 (the "License").
+* Please refer to the License for details. You may not use this file except in compliance with the License.
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+* INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+* See LICENSE in the root of the software repository for the full text of the License.
+*/
+'''
+
+DTYPE_MAP = {
+    'float': 'ACL_FLOAT',
+    'float16': 'ACL_FLOAT16',
+    'bf16': 'ACL_BF16',
+    'int8': 'ACL_INT8',
+    'int16': 'ACL_INT16',
+    'int32': 'ACL_INT32',
+    'int64': 'ACL_INT64',
+    'uint8': 'ACL_UINT8',
+    'uint16': 'ACL_UINT16',
+    'uint32': 'ACL_UINT32',
+    'uint64': 'ACL_UINT64',
+    'bool': 'ACL_BOOL',
+    'double': 'ACL_DOUBLE',
+    'complex64': 'ACL_COMPLEX64',
+    'complex128': 'ACL_COMPLEX128',
+    'float8_e4m3fn': 'ACL_FLOAT8_E4M3FN',
+    'float8_e5m2': 'ACL_FLOAT8_E5M2',
+    'float8_e8m0': 'ACL_FLOAT8_E8M0',
+    'hifloat8': 'ACL_HIFLOAT8',
+}
+
+FORMAT_MAP = {
+    'nd': 'ACL_FORMAT_ND',
+    'nchw': 'ACL_FORMAT_NCHW',
+    'nhwc': 'ACL_FORMAT_NHWC',
+    'nc1hwc0': 'ACL_FORMAT_NC1HWC0',
+    'fractal_z': 'ACL_FORMAT_FRACTAL_Z',
+    'fractal_nz': 'ACL_FORMAT_FRACTAL_NZ',
+    'ncdhw': 'ACL_FORMAT_NCDHW',
+    'ndc1hwc0': 'ACL_FORMAT_NDC1HWC0',
+}
+
+MAX_SUPPORT_SIZE = 64
+KEY_PATTERN = re.compile(r'^(input|output)(\d+)\.(name|dtype|format|optional)$')
+
+
+def _fatal(msg, *args):
+    logging.error(msg, *args)
+    sys.exit(1)
+
+
+def __parse_ini_file(ini_file_path: str):
+    op_irs = {}
+    op_key = None
+    with open(ini_file_path) as fd:
+        for line_no, org_line in enumerate(fd, 1):
+            line = org_line.strip()
+            if not line or line.startswith('#') or line.startswith(';'):
+                continue
+            if line.startswith('[') and line.endswith(']'):
+                op_key = line[1:-1].strip()
+                if op_key in op_irs:
+                    _fatal('%s:%d duplicate operation %s', ini_file_path, line_no, op_key)
+                op_irs[op_key] = {'input': {}, 'output': {}}
+                continue
+            if op_key is None or '=' not in line:
+                _fatal('%s:%d invalid line: %s', ini_file_path, line_no, line)
+            key, value = [item.strip() for item in line.split('=', 1)]
+            match = KEY_PATTERN.match(key)
+            if not match:
+                _fatal('%s:%d unknown key: %s', ini_file_path, line_no, key)
+            direction, index, field = match.group(1), int(match.group(2)), match.group(3)
+            tensor = op_irs[op_key][direction].setdefault(index, {'name': '', 'optional': False})
+            if field == 'name':
+                tensor['name'] = value
+            elif field == 'optional':
+                tensor['optional'] = (value.lower() == 'true')
+            else:
+                tensor[field] = [item.strip() for item in value.split(',')]
+    return op_irs
+
+
+def _check_operation_ir(op_key: str, op_ir: dict):
+    support_size = None
+    for direction in ('input', 'output'):
+        indexes = sorted(op_ir[direction].keys())
+        if indexes != list(range(len(indexes))):
+            _fatal('operation %s %s index is not continuous: %s', op_key, direction, indexes)
+        for index in indexes:
+            tensor = op_ir[direction][index]
+            if 'dtype' not in tensor or 'format' not in tensor:
+                _fatal('operation %s %s%d lacks dtype or format', op_key, direction, index)
+            for dtype in tensor['dtype']:
+                if dtype not in DTYPE_MAP:
+                    _fatal('operation %s %s%d unknown dtype %s', op_key, direction, index, dtype)
+            for tensor_format in tensor['format']:
+                if tensor_format not in FORMAT_MAP:
+                    _fatal('operation %s %s%d unknown format %s', op_key, direction, index, tensor_format)
+            if len(tensor['dtype']) != len(tensor['format']):
+                _fatal('operation %s %s%d dtype size is not equal to format size', op_key, direction, index)
+            if support_size is None:
+                support_size = len(tensor['dtype'])
+            elif support_size != len(tensor['dtype']):
+                _fatal('operation %s %s%d support size is not equal to others', op_key, direction, index)
+    if not support_size or support_size > MAX_SUPPORT_SIZE:
+        _fatal('operation %s support size %s is invalid, should be in [1, %d]', op_key, support_size,
+               MAX_SUPPORT_SIZE)
+    return support_size
+
+
+class TableWriter:
+    def __init__(self):
+        self.arrays = {}
+        self.lines = []
+
+    def intern_array(self, prefix: str, elem_type: str, elems: tuple):
+        # 内容相同的常量数组只生成一份
+        key = (elem_type, elems)
+        if key not in self.arrays:
+            name = f'{prefix}_{len(self.arrays)}'
+            self.arrays[key] = name
+            self.lines.append(f'const {elem_type} {name}[] = {{{", ".join(elems)}}};')
+        return self.arrays[key]
+
+    def tensor_info_ir(self, tensor: dict):
+        dtypes = tuple(DTYPE_MAP[item] for item in tensor['dtype'])
+        formats = tuple(FORMAT_MAP[item] for item in tensor['format'])
+        dtype_masks = {}
+        format_masks = {}
+        for support_idx, (dtype, tensor_format) in enumerate(zip(dtypes, formats)):
+            dtype_masks[dtype] = dtype_masks.get(dtype, 0) | (1 << support_idx)
+            format_masks[tensor_format] = format_masks.get(tensor_format, 0) | (1 << support_idx)
+        dtypes_name = self.intern_array('DTYPES', 'aclDataType', dtypes)
+        formats_name = self.intern_array('FORMATS', 'aclFormat', formats)
+        dtype_masks_name = self.intern_array('DTYPE_MASKS', 'IrDtypeMask',
+                                             tuple(f'{{{k}, 0x{v:x}ULL}}' for k, v in dtype_masks.items()))
+        format_masks_name = self.intern_array('FORMAT_MASKS', 'IrFormatMask',
+                                              tuple(f'{{{k}, 0x{v:x}ULL}}' for k, v in format_masks.items()))
+        optional = 'true' if tensor['optional'] else 'false'
+        return (f'{{"{tensor["name"]}", {optional}, {dtypes_name}, {formats_name}, '
+                f'{dtype_masks_name}, {len(dtype_masks)}, {format_masks_name}, {len(format_masks)}}}')
+
+    def tensor_info_irs(self, op_ir: dict, direction: str):
+        tensors = [op_ir[direction][index] for index in sorted(op_ir[direction].keys())]
+        if not tensors:
+            return 'nullptr', 0
+        name = self.intern_array('TENSOR_INFO_IRS', 'TensorInfoIr',
+                                 tuple(self.tensor_info_ir(tensor) for tensor in tensors))
+        return name, len(tensors)
+
+    def operation_irs(self, table_name: str, op_irs: dict):
+        entries = []
+        # 按opKey升序排列，运行时二分查找
+        for op_key in sorted(op_irs.keys()):
+            op_ir = op_irs[op_key]
+            support_size = _check_operation_ir(op_key, op_ir)
+            in_name, in_num = self.tensor_info_irs(op_ir, 'input')
+            out_name, out_num = self.tensor_info_irs(op_ir, 'output')
+            entries.append(f'    {{"{op_key}", {support_size}, {in_name}, {in_num}, {out_name}, {out_num}}},')
+        if not entries:
+            return None
+        self.lines.append(f'const OperationIr {table_name}[] = {{')
+        self.lines.extend(entries)
+        self.lines.append('};')
+        return table_name
+
+
+def __write_getter(fd, func_name: str, table_name):
+    fd.write(f'\nconst OperationIr *{func_name}(size_t &operationIrNum)\n')
+    fd.write('{\n')
+    if table_name is None:
+        fd.write('    operationIrNum = 0;\n')
+        fd.write('    return nullptr;\n')
+    else:
+        fd.write(f'    operationIrNum = sizeof({table_name}) / sizeof({table_name}[0]);\n')
+        fd.write(f'    return {table_name};\n')
+    fd.write('}\n')
+
+
+def __generate_table_cpp(atb_ini_path: str, customize_ini_path: str, dest_file_path: str):
+    atb_op_irs = __parse_ini_file(atb_ini_path)
+    customize_op_irs = {}
+    if customize_ini_path and os.path.exists(customize_ini_path):
+        customize_op_irs = __parse_ini_file(customize_ini_path)
+    writer = TableWriter()
+    atb_table = writer.operation_irs('ATB_OPERATION_IRS', atb_op_irs)
+    customize_table = writer.operation_irs('CUSTOMIZE_OPERATION_IRS', customize_op_irs)
+
+    with os.fdopen(os.open(dest_file_path, os.O_WRONLY | os.O_CREAT | os.O_TRUNC, stat.S_IWUSR | stat.S_IRUSR),
+                   'w') as fd:
+        fd.write(CANN_COPYRIGHT)
+        fd.write('// generated by scripts/build_operation_ir_table.py, do not edit\n')
+        fd.write('#include "atb/operation/operation_ir.h"\n\n')
+        fd.write('namespace atb {\n')
+        fd.write('namespace {\n')
+        for line in writer.lines:
+            fd.write(line + '\n')
+        fd.write('} // namespace\n')
+        __write_getter(fd, 'GetAtbOperationIrs', atb_table)
+        __write_getter(fd, 'GetCustomizeOperationIrs', customize_table)
+        fd.write('} // namespace atb\n')
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--atb_ini_path', type=str, required=True)
+    parser.add_argument('--customize_ini_path', type=str, default='')
+    parser.add_argument('--dest_file_path', type=str, required=True)
+    input_args = parser.parse_args()
+    __generate_table_cpp(input_args.atb_ini_path, input_args.customize_ini_path, input_args.dest_file_path)
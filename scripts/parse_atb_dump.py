@@ -0,0 +1,117 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+"""解析ATB_ASYNC_DUMP_ENABLE=1时生成的dump容器文件(.atbd)，列出记录或按原目录结构导出"""
+import os
+import sys
+import struct
+import logging
+import argparse
+
+FILE_MAGIC = b'ATBDUMP1'
+INDEX_MAGIC = b'ATBINDX1'
+RECORD_MAGIC = 0x44524341
+FILE_HEADER = struct.Struct('<8sII')
+RECORD_HEADER = struct.Struct('<IHHIIQQ')
+INDEX_FOOTER = struct.Struct('<QQ8s')
+COMPRESS_NONE = 0
+COMPRESS_ZERO_RUN = 1
+
+# aclDataType取值到numpy dtype名的映射，bf16等numpy不支持的类型按原始字节导出
+NUMPY_DTYPE_MAP = {
+    0: 'float32', 1: 'float16', 2: 'int8', 3: 'int32', 4: 'uint8', 6: 'int16', 7: 'uint16', 8: 'uint32',
+    9: 'int64', 10: 'uint64', 11: 'float64', 12: 'bool',
+}
+
+
+def _zero_run_decode(data: bytes, raw_size: int):
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        literal_len, = struct.unpack_from('<I', data, pos)
+        pos += 4
+        out += data[pos:pos + literal_len]
+        pos += literal_len
+        zero_len, = struct.unpack_from('<I', data, pos)
+        pos += 4
+        out += bytes(zero_len)
+    if len(out) != raw_size:
+        raise ValueError(f'decoded size {len(out)} is not equal to raw size {raw_size}')
+    return bytes(out)
+
+
+def iter_records(file_path: str):
+    """顺序扫描记录，索引缺失(进程异常退出)时同样可用"""
+    with open(file_path, 'rb') as fd:
+        content = fd.read()
+    magic, version, _ = FILE_HEADER.unpack_from(content, 0)
+    if magic != FILE_MAGIC:
+        raise ValueError(f'{file_path} is not an atb dump container')
+    index_offset = len(content)
+    if len(content) >= FILE_HEADER.size + INDEX_FOOTER.size:
+        offset, _, footer_magic = INDEX_FOOTER.unpack_from(content, len(content) - INDEX_FOOTER.size)
+        if footer_magic == INDEX_MAGIC:
+            index_offset = offset
+    pos = FILE_HEADER.size
+    while pos + RECORD_HEADER.size <= index_offset:
+        record_magic, compression, _, key_len, meta_len, raw_size, stored_size = \
+            RECORD_HEADER.unpack_from(content, pos)
+        if record_magic != RECORD_MAGIC:
+            logging.warning('invalid record magic at offset %d, stop scanning', pos)
+            break
+        begin = pos + RECORD_HEADER.size
+        key = content[begin:begin + key_len].decode('utf-8', 'replace')
+        meta = content[begin + key_len:begin + key_len + meta_len].decode('utf-8', 'replace')
+        payload_begin = begin + key_len + meta_len
+        payload = content[payload_begin:payload_begin + stored_size]
+        if len(payload) != stored_size:
+            logging.warning('record %s is truncated, stop scanning', key)
+            break
+        if compression == COMPRESS_ZERO_RUN:
+            payload = _zero_run_decode(payload, raw_size)
+        yield version, key, dict(item.split(':', 1) for item in meta.split(';') if ':' in item), payload
+        pos = payload_begin + stored_size
+
+
+def _export_record(out_dir: str, key: str, meta: dict, payload: bytes):
+    file_path = os.path.join(out_dir, key.lstrip('/'))
+    os.makedirs(os.path.dirname(file_path) or '.', exist_ok=True)
+    dtype = NUMPY_DTYPE_MAP.get(int(meta.get('dtype', -1)))
+    try:
+        import numpy as np
+    except ImportError:
+        np = None
+    dims = [int(dim) for dim in meta.get('dims', '').strip('[]').split(',') if dim.strip()]
+    if np is not None and dtype is not None and len(payload) == int(np.prod(dims or [0])) * np.dtype(dtype).itemsize:
+        np.save(os.path.splitext(file_path)[0] + '.npy', np.frombuffer(payload, dtype=dtype).reshape(dims))
+    else:
+        with open(file_path + '.raw', 'wb') as fd:
+            fd.write(payload)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('file_path', type=str)
+    parser.add_argument('--out_dir', type=str, default='', help='导出目录，为空时只列出记录')
+    args = parser.parse_args()
+    record_count = 0
+    for _, key, meta, payload in iter_records(args.file_path):
+        record_count += 1
+        if args.out_dir:
+            _export_record(args.out_dir, key, meta, payload)
+        else:
+            print(f'{key} format:{meta.get("format")} dtype:{meta.get("dtype")} dims:{meta.get("dims")} '
+                  f'size:{len(payload)}')
+    logging.info('%s record count: %d', args.file_path, record_count)
+    return 0
+
+
+if __name__ == '__main__':
+    logging.basicConfig(level=logging.INFO)
+    sys.exit(main())
@@ -55,11 +55,32 @@ if [[ -f "$set_env_path" ]] && [[ "$set_env_path" =~ (^|/)set_env\.sh$ ]];then
     export ATB_STREAM_SYNC_EVERY_RUNNER_ENABLE=0 #每个Runner的Execute时就做同步
     export ATB_STREAM_SYNC_EVERY_OPERATION_ENABLE=0 #每个Operation的Execute时就做同步
     export ATB_OPSRUNNER_KERNEL_CACHE_LOCAL_COUNT=1 #本地缓存个数，支持范围1~1024
-    export ATB_OPSRUNNER_KERNEL_CACHE_GLOABL_COUNT=5 #全局缓存个数，支持范围1~1024
+    export ATB_OPSRUNNER_KERNEL_CACHE_GLOABL_COUNT=5 #每个下发线程的全局缓存个数，支持范围1~1024
+    export ATB_OPSRUNNER_KERNEL_CACHE_SHARED_COUNT=4096 #所有下发线程共享的进程级缓存项上限，0表示关闭，最大1048576
     export ATB_WORKSPACE_MEM_ALLOC_ALG_TYPE=1 #0:暴力算法 1:block分配算法 2:有序heap算法 3:引入block合并(SOMAS算法退化版)
     export ATB_COMPARE_TILING_EVERY_KERNEL=0 #每个Kernel运行后，比较运行前和后的NPU上tiling内容是否变化
     export ATB_SHARE_MEMORY_NAME_SUFFIX="" #共享内存命名后缀，多用户同时使用通信算子时，需通过设置该值进行共享内存的区分
     export ATB_MATMUL_SHUFFLE_K_ENABLE=1 #Shuffle-K使能，默认开
+    export ATB_TILING_FILL_THREAD_NUM=0 #图算子并行填充tiling的线程数，0表示串行填充，支持范围0~32
+    export ATB_TILING_FILL_PARALLEL_MIN_NODE_NUM=16 #图节点数不小于该值时才并行填充tiling，支持范围2~2048
+    export ATB_TRACE_ENABLE=0 #是否记录host侧各阶段的trace事件，进程退出时导出为Chrome trace json，0关闭，1开启
+    export ATB_TRACE_BUFFER_SIZE=65536 #每个线程trace环形缓冲的事件个数，写满后覆盖最旧事件，支持范围1024~4194304
+    export ATB_TRACE_FILE_PATH="" #进程退出时trace的导出路径，为空时导出到当前目录的atb_trace_<pid>.json
+    export ATB_ASYNC_DUMP_ENABLE=0 #保存tensor时是否走异步dump：在stream上拷贝到pinned缓冲，由后台线程写入容器文件，不再同步stream，0关闭，1开启
+    export ATB_ASYNC_DUMP_BUFFER_SIZE=256 #异步dump的pinned环形缓冲大小，单位MB，写满后新的dump直接丢弃，支持范围1~16384
+    export ATB_ASYNC_DUMP_SAMPLE_RATE=1 #异步dump采样率，每N次保存取1次，支持范围1~1000000
+    export ATB_ASYNC_DUMP_COMPRESS=0 #异步dump是否对数据做零值游程压缩，0关闭，1开启
+    export ATB_ASYNC_DUMP_FILE_PATH="" #异步dump容器文件路径，为空时写到当前目录的atb_dump_<pid>.atbd
+    export ATB_MEM_ACCOUNTING_ENABLE=0 #是否按算子记录每次执行申请的workspace、中间tensor与tiling内存及峰值，0关闭，1开启
+    export ATB_MEM_ACCOUNTING_BUFFER_SIZE=65536 #按执行顺序保留的内存记录条数，写满后覆盖最旧记录，支持范围1024~4194304
+    export ATB_MEM_ACCOUNTING_FILE_PATH="" #进程退出时内存记录的导出路径，.csv后缀导出为csv，否则为json，为空时不导出
+    export ATB_DEFERRED_OVERFLOW_CHECK_ENABLE=0 #是否开启延迟溢出检测：每个Operation执行结束时异步读回累计的溢出状态，不再逐kernel同步检查，0关闭，1开启
+    export ATB_DEFERRED_OVERFLOW_CHECK_MAX_PENDING=16 #延迟溢出检测未读回结果的最大个数，达到后同步等待最旧的检测，支持范围1~1024
+    export ATB_ASYNC_LOG_ENABLE=0 #是否开启异步日志：TRACE/DEBUG/INFO日志写入线程本地缓冲，由后台线程格式化输出，0关闭，1开启
+    export ATB_ASYNC_LOG_BUFFER_SIZE=1024 #异步日志每个线程的缓冲大小，单位KB，写满时丢弃新日志，支持范围64~65536
+    export ATB_ASYNC_LOG_RATE_LIMIT=1000 #异步日志每个调用点每秒最多输出的条数，超出的日志被抑制并计数，0表示不限流
+    export ATB_INFER_SHAPE_CACHE_ENABLE=1 #是否缓存Operation的InferShape结果，输入描述与参数不变时跳过校验与推导，0关闭，1开启
+    export ATB_GRAPH_CAPTURE_CACHE_SIZE=8 #整图下发模式下每个Operation按shape保留的已捕获模型个数，超出时淘汰最久未使用的模型，支持范围1~64
     export LCCL_DETERMINISTIC=0 #LCCL确定性AllReduce(保序加)是否开启，0关闭，1开启。
     export LCCL_PARALLEL=0 #LCCL多通信域并行，0关闭，1开启。
 
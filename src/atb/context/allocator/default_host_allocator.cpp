@@ -10,9 +10,11 @@
 #include "default_host_allocator.h"
 #include "atb/utils/log.h"
 #include "atb/utils/tensor_util.h"
+#include "atb/utils/numa_util.h"
 namespace atb {
 const int ALIGN_INT = 32;
 DefaultHostAllocator::DefaultHostAllocator() {}
+DefaultHostAllocator::DefaultHostAllocator(int32_t numaNode) : numaNode_(numaNode) {}
 DefaultHostAllocator::~DefaultHostAllocator()
 {
     // 释放所有管理的host侧地址
@@ -43,6 +45,8 @@ void *DefaultHostAllocator::Allocate(size_t bufferSize)
     bufferSize = static_cast<size_t>(TensorUtil::AlignInt(bufferSize, ALIGN_INT));
     ATB_LOG(INFO) << "bufferSize should be 32-bit alignment, automate align upwards to " << bufferSize;
     // aclrtMallocHost会自动对于bufferSize+32，不论bufferSize是否是32的整数倍
+    // 锁页内存在申请时即分配物理页，因此只需在申请期间设置NUMA内存策略
+    ScopedNumaMemPolicy numaMemPolicy(numaNode_);
     Status st = aclrtMallocHost(&addr, bufferSize);
     if (st != 0) {
         ATB_LOG(ERROR) << "aclrtMallocHost host buffer failed!";
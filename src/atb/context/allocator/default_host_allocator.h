@@ -17,12 +17,14 @@ namespace atb {
 class DefaultHostAllocator : public Allocator {
 public:
     DefaultHostAllocator();
+    explicit DefaultHostAllocator(int32_t numaNode);
     ~DefaultHostAllocator() override;
     void *Allocate(size_t bufferSize) override;
     Status Deallocate(void *addr) override;
 private:
     std::map<void*, size_t> memMap;
     size_t currentAllocateSize_ = 0;
+    int32_t numaNode_ = -1; // 小于0时不绑定NUMA节点
 };
 } // namespace atb
 #endif
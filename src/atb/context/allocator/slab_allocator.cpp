@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/context/allocator/slab_allocator.h"
+#include <algorithm>
+#include <sstream>
+#include "atb/utils/log.h"
+
+namespace atb {
+static constexpr size_t MIN_CLASS_SHIFT = 6;  // 最小size class 64字节，满足args的32字节对齐
+static constexpr size_t MAX_CLASS_SHIFT = 16; // 最大size class 64KB，更大的申请直接走底层Allocator
+static constexpr size_t SIZE_CLASS_NUM = MAX_CLASS_SHIFT - MIN_CLASS_SHIFT + 1;
+static constexpr size_t LARGE_CLASS_INDEX = SIZE_CLASS_NUM;
+static constexpr size_t LIVE_SLOT_RESERVE_NUM = 4096;
+
+std::string SlabAllocatorStatistic::ToString() const
+{
+    std::stringstream ss;
+    ss << "chunkNum: " << chunkNum << ", chunkSize: " << chunkSize << ", usedSize: " << usedSize
+       << ", peakUsedSize: " << peakUsedSize << ", requestSize: " << requestSize << ", allocNum: " << allocNum
+       << ", reuseNum: " << reuseNum << ", largeAllocNum: " << largeAllocNum << ", liveNum: " << liveNum;
+    return ss.str();
+}
+
+SlabAllocator::SlabAllocator(std::unique_ptr<Allocator> chunkAllocator, size_t chunkSize)
+    : chunkAllocator_(std::move(chunkAllocator)),
+      chunkSize_(std::max(chunkSize, GetSizeClassSize(SIZE_CLASS_NUM - 1))), freeLists_(SIZE_CLASS_NUM)
+{
+    liveSlots_.reserve(LIVE_SLOT_RESERVE_NUM);
+}
+
+SlabAllocator::~SlabAllocator()
+{
+    ATB_LOG(INFO) << "SlabAllocator destroy, " << statistic_.ToString();
+    for (auto &it : liveSlots_) {
+        if (it.second.classIndex == LARGE_CLASS_INDEX) {
+            chunkAllocator_->Deallocate(it.first);
+        }
+    }
+    for (void *chunk : chunks_) {
+        chunkAllocator_->Deallocate(chunk);
+    }
+}
+
+size_t SlabAllocator::GetSizeClassIndex(size_t bufferSize)
+{
+    if (bufferSize <= (static_cast<size_t>(1) << MIN_CLASS_SHIFT)) {
+        return 0;
+    }
+    size_t shift = static_cast<size_t>(64 - __builtin_clzll(static_cast<unsigned long long>(bufferSize - 1)));
+    return std::min(shift - MIN_CLASS_SHIFT, LARGE_CLASS_INDEX);
+}
+
+size_t SlabAllocator::GetSizeClassSize(size_t classIndex)
+{
+    return static_cast<size_t>(1) << (classIndex + MIN_CLASS_SHIFT);
+}
+
+uint8_t *SlabAllocator::CarveSlot(size_t slotSize)
+{
+    if (chunkLeftSize_ < slotSize) {
+        // 当前chunk剩余空间按能放下的最大size class切分后挂入free list，避免浪费
+        for (size_t classIndex = SIZE_CLASS_NUM; classIndex > 0 && chunkLeftSize_ > 0; --classIndex) {
+            size_t classSize = GetSizeClassSize(classIndex - 1);
+            while (chunkLeftSize_ >= classSize) {
+                freeLists_.at(classIndex - 1).push_back(chunkCursor_);
+                chunkCursor_ += classSize;
+                chunkLeftSize_ -= classSize;
+            }
+        }
+        void *chunk = chunkAllocator_->Allocate(chunkSize_);
+        if (chunk == nullptr) {
+            ATB_LOG(ERROR) << "SlabAllocator allocate chunk fail, chunkSize: " << chunkSize_;
+            return nullptr;
+        }
+        chunks_.push_back(chunk);
+        chunkCursor_ = static_cast<uint8_t *>(chunk);
+        chunkLeftSize_ = chunkSize_;
+        statistic_.chunkNum++;
+        statistic_.chunkSize += chunkSize_;
+        ATB_LOG(INFO) << "SlabAllocator allocate new chunk, " << statistic_.ToString();
+    }
+    uint8_t *slot = chunkCursor_;
+    chunkCursor_ += slotSize;
+    chunkLeftSize_ -= slotSize;
+    return slot;
+}
+
+void *SlabAllocator::Allocate(size_t bufferSize)
+{
+    if (bufferSize == 0) {
+        ATB_LOG(WARN) << "bufferSize can not be 0, please check the bufferSize";
+        return nullptr;
+    }
+    size_t classIndex = GetSizeClassIndex(bufferSize);
+    void *addr = nullptr;
+    size_t slotSize = bufferSize;
+    if (classIndex == LARGE_CLASS_INDEX) {
+        addr = chunkAllocator_->Allocate(bufferSize);
+        statistic_.largeAllocNum++;
+    } else {
+        slotSize = GetSizeClassSize(classIndex);
+        std::vector<void *> &freeList = freeLists_.at(classIndex);
+        if (!freeList.empty()) {
+            addr = freeList.back();
+            freeList.pop_back();
+            statistic_.reuseNum++;
+        } else {
+            addr = CarveSlot(slotSize);
+        }
+    }
+    if (addr == nullptr) {
+        return nullptr;
+    }
+    liveSlots_[addr] = {classIndex, bufferSize};
+    statistic_.allocNum++;
+    statistic_.liveNum++;
+    statistic_.usedSize += slotSize;
+    statistic_.requestSize += bufferSize;
+    statistic_.peakUsedSize = std::max(statistic_.peakUsedSize, statistic_.usedSize);
+    return addr;
+}
+
+Status SlabAllocator::Deallocate(void *addr)
+{
+    if (addr == nullptr) {
+        ATB_LOG(INFO) << "the addr is nullptr, do not need to deallocate";
+        return NO_ERROR;
+    }
+    auto it = liveSlots_.find(addr);
+    if (it == liveSlots_.end()) {
+        ATB_LOG(ERROR) << "free fail, can not find the address please check the address is made by allocator";
+        return ERROR_INVALID_PARAM;
+    }
+    SlotInfo slotInfo = it->second;
+    liveSlots_.erase(it);
+    size_t slotSize = slotInfo.requestSize;
+    if (slotInfo.classIndex == LARGE_CLASS_INDEX) {
+        Status st = chunkAllocator_->Deallocate(addr);
+        if (st != NO_ERROR) {
+            return st;
+        }
+    } else {
+        slotSize = GetSizeClassSize(slotInfo.classIndex);
+        freeLists_.at(slotInfo.classIndex).push_back(addr);
+    }
+    statistic_.liveNum--;
+    statistic_.usedSize -= slotSize;
+    statistic_.requestSize -= slotInfo.requestSize;
+    return NO_ERROR;
+}
+
+const SlabAllocatorStatistic &SlabAllocator::GetStatistic() const
+{
+    return statistic_;
+}
+} // namespace atb
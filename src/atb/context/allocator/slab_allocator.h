@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_SLAB_ALLOCATOR_H
+#define ATB_SLAB_ALLOCATOR_H
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "atb/context/allocator/allocator.h"
+
+namespace atb {
+struct SlabAllocatorStatistic {
+    uint64_t chunkNum = 0;        // 从底层Allocator申请的chunk数
+    uint64_t chunkSize = 0;       // chunk总字节数
+    uint64_t usedSize = 0;        // 已分配出去的slot字节数(按size class向上取整)
+    uint64_t peakUsedSize = 0;
+    uint64_t requestSize = 0;     // 已分配出去的申请字节数
+    uint64_t allocNum = 0;        // 累计分配次数
+    uint64_t reuseNum = 0;        // 命中free list的分配次数
+    uint64_t largeAllocNum = 0;   // 超过最大size class、直接走底层Allocator的分配次数
+    uint64_t liveNum = 0;         // 尚未释放的分配数
+
+    std::string ToString() const;
+};
+
+// 按2的幂划分size class，从大块chunk中切出小块内存，释放的slot挂到对应size class的free list上复用。
+// 分配与释放均为O(1)；chunk在析构时统一归还底层Allocator。非线程安全，与ContextBase的使用方式一致。
+class SlabAllocator : public Allocator {
+public:
+    SlabAllocator(std::unique_ptr<Allocator> chunkAllocator, size_t chunkSize);
+    ~SlabAllocator() override;
+    SlabAllocator(const SlabAllocator &other) = delete;
+    SlabAllocator &operator=(const SlabAllocator &other) = delete;
+    void *Allocate(size_t bufferSize) override;
+    Status Deallocate(void *addr) override;
+    const SlabAllocatorStatistic &GetStatistic() const;
+    static size_t GetSizeClassIndex(size_t bufferSize);
+    static size_t GetSizeClassSize(size_t classIndex);
+
+private:
+    uint8_t *CarveSlot(size_t slotSize);
+
+private:
+    std::unique_ptr<Allocator> chunkAllocator_;
+    size_t chunkSize_ = 0;
+    std::vector<void *> chunks_;
+    uint8_t *chunkCursor_ = nullptr;
+    size_t chunkLeftSize_ = 0;
+    std::vector<std::vector<void *>> freeLists_;
+    struct SlotInfo {
+        size_t classIndex = 0; // 超过最大size class的大块分配记为size class个数
+        size_t requestSize = 0;
+    };
+    std::unordered_map<void *, SlotInfo> liveSlots_;
+    SlabAllocatorStatistic statistic_;
+};
+} // namespace atb
+#endif
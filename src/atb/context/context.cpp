@@ -64,6 +64,12 @@ Status CreateContext(Context **context, const std::function<void*(size_t)>& allo
 }
 
 Status CreateContext(Context **context, uint32_t hostTilingBlockNum, uint32_t deviceTilingBlockNum)
+{
+    return CreateContext(context, hostTilingBlockNum, deviceTilingBlockNum, HostTilingMemoryOptions());
+}
+
+Status CreateContext(Context **context, uint32_t hostTilingBlockNum, uint32_t deviceTilingBlockNum,
+                     const HostTilingMemoryOptions &options)
 {
     if (!context) {
         ATB_LOG(ERROR) << "param context is null, CreateContext fail";
@@ -86,7 +92,7 @@ Status CreateContext(Context **context, uint32_t hostTilingBlockNum, uint32_t de
         return ERROR_OUT_OF_HOST_MEMORY;
     }
 
-    Status st = contextBase->Init(nullptr, nullptr, hostTilingBlockNum, deviceTilingBlockNum);
+    Status st = contextBase->Init(nullptr, nullptr, hostTilingBlockNum, deviceTilingBlockNum, options);
     if (st != NO_ERROR) {
         ATB_LOG(ERROR) << "ContextBase init fail, CreateContext fail";
         delete contextBase;
@@ -18,20 +18,27 @@
 #include "atb/utils/config.h"
 #include "atb/utils.h"
 #include "atb/utils/probe.h"
+#include "atb/utils/numa_util.h"
 #include "atb/context/allocator/default_device_allocator.h"
 #include "atb/context/allocator/default_host_allocator.h"
 #include "atb/utils/operation_register.h"
+#include "atb/utils/singleton.h"
 
 namespace atb {
 static constexpr size_t MAX_COPY_EVENT_NUM = 10;
 static constexpr uint64_t TILING_BUFFER_BLOCK_SIZE = 1024 * 1024 * 3;
 static constexpr uint32_t DEFAULT_EXECUTE_STREAM_NUMBER = 1;
+static constexpr size_t ARGS_BUFFER_CHUNK_SIZE = 1024 * 1024 * 2;
 thread_local ExecuteType ContextBase::executeType_ = EXECUTE_NORMAL;
 
 ContextBase::ContextBase()
 {
     deviceAllocator_ = std::make_unique<DefaultDeviceAllocator>();
     hostAllocator_ = std::make_unique<DefaultHostAllocator>();
+    argsDeviceAllocator_ =
+        std::make_unique<SlabAllocator>(std::make_unique<DefaultDeviceAllocator>(), ARGS_BUFFER_CHUNK_SIZE);
+    argsHostAllocator_ =
+        std::make_unique<SlabAllocator>(std::make_unique<DefaultHostAllocator>(), ARGS_BUFFER_CHUNK_SIZE);
 }
 
 ContextBase::~ContextBase() noexcept
@@ -49,15 +56,28 @@ ContextBase::~ContextBase() noexcept
 }
 
 Status ContextBase::Init(const std::function<void *(size_t)> &alloc, const std::function<void(void *)> &dealloc,
-                         uint32_t hostTilingBlockNum, uint32_t deviceTilingBlockNum)
+                         uint32_t hostTilingBlockNum, uint32_t deviceTilingBlockNum,
+                         const HostTilingMemoryOptions &hostTilingMemoryOptions)
 {
     executeStreams_.resize(DEFAULT_EXECUTE_STREAM_NUMBER);
 
-    hostTilingBufferPool_ = std::make_unique<HostTilingBufferPool>(hostTilingBlockNum, TILING_BUFFER_BLOCK_SIZE);
+    int32_t numaNode = NUMA_NODE_ANY;
+    Status st = ResolveHostNumaNode(hostTilingMemoryOptions.numaNode, numaNode);
+    if (st != NO_ERROR) {
+        return st;
+    }
+    ATB_LOG(INFO) << "ContextBase host tiling memory pinned: " << hostTilingMemoryOptions.pinned
+                  << ", numaNode: " << numaNode;
+    if (numaNode != NUMA_NODE_ANY) {
+        argsHostAllocator_ = std::make_unique<SlabAllocator>(std::make_unique<DefaultHostAllocator>(numaNode),
+                                                             ARGS_BUFFER_CHUNK_SIZE);
+    }
+    hostTilingBufferPool_ = std::make_unique<HostTilingBufferPool>(hostTilingBlockNum, TILING_BUFFER_BLOCK_SIZE,
+                                                                   hostTilingMemoryOptions.pinned, numaNode);
     if (!hostTilingBufferPool_) {
         return ERROR_OUT_OF_HOST_MEMORY;
     }
-    Status st = hostTilingBufferPool_->Init();
+    st = hostTilingBufferPool_->Init();
     if (st != NO_ERROR) {
         ATB_LOG(ERROR) << "ContextBase host tiling buffer pool init fail";
         return st;
@@ -84,6 +104,10 @@ Status ContextBase::Init(const std::function<void *(size_t)> &alloc, const std::
     }
 
     runnerPools_.resize(RunnerTypeRegister::GetRunnerTypeMapSize());
+    uint32_t tilingFillThreadNum = GetSingleton<Config>().GetTilingFillThreadNum();
+    if (tilingFillThreadNum > 0) {
+        tilingFillThreadPool_ = std::make_unique<ThreadPool>(tilingFillThreadNum);
+    }
     if (Probe::IsOverflowCheck()) {
         st = CreateOverflowOutTensor();
         if (st != NO_ERROR) {
@@ -91,11 +115,41 @@ Status ContextBase::Init(const std::function<void *(size_t)> &alloc, const std::
             return st;
         }
     }
+    if (GetSingleton<Config>().IsDeferredOverflowCheckEnable()) {
+        overflowDetector_ = std::make_unique<OverflowDetector>();
+        st = overflowDetector_->Init(GetSingleton<Config>().GetDeferredOverflowCheckMaxPending());
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << "ContextBase overflow detector init fail";
+            overflowDetector_.reset();
+            return st;
+        }
+    }
 
     ATB_LOG(INFO) << "ContextBase init success";
     return NO_ERROR;
 }
 
+Status ContextBase::ResolveHostNumaNode(int32_t numaNode, int32_t &resolvedNode) const
+{
+    resolvedNode = NUMA_NODE_ANY;
+    if (numaNode == NUMA_NODE_ANY) {
+        return NO_ERROR;
+    }
+    if (numaNode == NUMA_NODE_CURRENT) {
+        int32_t currentNode = NumaUtil::GetCurrentNode();
+        // 获取失败时退化为不绑定
+        resolvedNode = currentNode < 0 ? NUMA_NODE_ANY : currentNode;
+        return NO_ERROR;
+    }
+    int32_t nodeNum = NumaUtil::GetNodeNum();
+    if (numaNode < 0 || numaNode >= nodeNum) {
+        ATB_LOG(ERROR) << "host tiling memory numaNode: " << numaNode << " is invalid, numa node num: " << nodeNum;
+        return ERROR_INVALID_PARAM;
+    }
+    resolvedNode = numaNode;
+    return NO_ERROR;
+}
+
 void ContextBase::Destroy()
 {
     if (hostTilingBufferPool_) {
@@ -105,12 +159,25 @@ void ContextBase::Destroy()
     if (deviceTilingBufferPool_) {
         deviceTilingBufferPool_->Destroy();
     }
+
+    tilingFillThreadPool_.reset();
+    ATB_LOG(INFO) << "ContextBase args device buffer statistic: " << argsDeviceAllocator_->GetStatistic().ToString();
+    ATB_LOG(INFO) << "ContextBase args host buffer statistic: " << argsHostAllocator_->GetStatistic().ToString();
+    if (streamArena_) {
+        ATB_LOG(INFO) << "ContextBase stream arena statistic: " << streamArena_->GetStatistic().ToString();
+        streamArena_.reset();
+    }
+    if (overflowDetector_) {
+        overflowDetector_->Destroy();
+        ATB_LOG(INFO) << "ContextBase overflow detector statistic: " << overflowDetector_->GetStatistic().ToString();
+        overflowDetector_.reset();
+    }
 }
 
 Status ContextBase::SetExecuteStream(aclrtStream stream)
 {
     executeStreams_.at(0) = stream;
-    if (Probe::IsOverflowCheck()) {
+    if (Probe::IsOverflowCheck() || overflowDetector_) {
         Status st = aclrtSetStreamOverflowSwitch(executeStreams_.at(0), 1);
         if (st != NO_ERROR) {
             ATB_LOG(ERROR) << "aclrtSetStreamOverflowSwitch error! ret:" << st;
@@ -190,6 +257,26 @@ uint8_t *ContextBase::GetDeviceTilingBuffer()
     return deviceTilingBufferPool_ ? deviceTilingBufferPool_->GetBuffer() : nullptr;
 }
 
+Status ContextBase::GatherContinuousHostTilingBuffer(
+    const std::vector<std::pair<const uint8_t *, uint64_t>> &srcBuffers, uint8_t *&dstBuffer)
+{
+    dstBuffer = nullptr;
+    return hostTilingBufferPool_ ? hostTilingBufferPool_->GatherContinuousBuffer(srcBuffers, dstBuffer) : NO_ERROR;
+}
+
+uint8_t *ContextBase::GetContinuousDeviceTilingBuffer(uint64_t bufferSize)
+{
+    return deviceTilingBufferPool_ ? deviceTilingBufferPool_->GetContinuousBuffer(bufferSize) : nullptr;
+}
+
+Status ContextBase::RecordHostTilingCopy(const uint8_t *hostTilingBuffer, uint64_t bufferSize, aclrtStream stream)
+{
+    if (mode_ == GRAPH_LAUNCH_MODE || !hostTilingBufferPool_) {
+        return NO_ERROR;
+    }
+    return hostTilingBufferPool_->RecordBufferCopy(hostTilingBuffer, bufferSize, stream);
+}
+
 uint64_t ContextBase::GetTilingBufferBlockSize() const
 {
     return TILING_BUFFER_BLOCK_SIZE;
@@ -332,26 +419,92 @@ LaunchMode ContextBase::GetLaunchMode()
 
 void *ContextBase::GetArgsDeviceBuffer(size_t bufferSize)
 {
-    return deviceAllocator_->Allocate(bufferSize);
+    return argsDeviceAllocator_->Allocate(bufferSize);
 }
 
 Status ContextBase::FreeArgsDeviceBuffer(void *addr)
 {
-    return deviceAllocator_->Deallocate(addr);
+    return argsDeviceAllocator_->Deallocate(addr);
 }
 
 void *ContextBase::GetArgsHostBuffer(size_t bufferSize)
 {
-    return hostAllocator_->Allocate(bufferSize);
+    return argsHostAllocator_->Allocate(bufferSize);
 }
 
 Status ContextBase::FreeArgsHostBuffer(void *addr)
 {
-    return hostAllocator_->Deallocate(addr);
+    return argsHostAllocator_->Deallocate(addr);
 }
+
+const SlabAllocatorStatistic &ContextBase::GetArgsDeviceBufferStatistic() const
+{
+    return argsDeviceAllocator_->GetStatistic();
+}
+
+const SlabAllocatorStatistic &ContextBase::GetArgsHostBufferStatistic() const
+{
+    return argsHostAllocator_->GetStatistic();
+}
+
+Status ContextBase::SetStreamArenaStatus(bool enable)
+{
+    if (enable == (streamArena_ != nullptr)) {
+        ATB_LOG(INFO) << "ContextBase SetStreamArenaStatus do nothing";
+        return NO_ERROR;
+    }
+    if (enable) {
+        streamArena_ = std::make_unique<StreamArena>(std::make_unique<DefaultDeviceAllocator>());
+    } else {
+        ATB_LOG(INFO) << "ContextBase stream arena statistic: " << streamArena_->GetStatistic().ToString();
+        streamArena_.reset();
+    }
+    ATB_LOG(INFO) << "ContextBase SetStreamArenaStatus: " << enable;
+    return NO_ERROR;
+}
+
+bool ContextBase::GetStreamArenaStatus() const
+{
+    return streamArena_ != nullptr;
+}
+
+uint8_t *ContextBase::GetStreamArenaBuffer(aclrtStream stream, uint64_t bufferSize)
+{
+    if (!streamArena_) {
+        ATB_LOG(ERROR) << "ContextBase stream arena is not enabled";
+        return nullptr;
+    }
+    // 分线程下发时扩容前的region可能已被第一段下发的任务引用，不能同步后立即释放
+    return streamArena_->GetBuffer(stream, bufferSize, executeType_ == EXECUTE_NORMAL);
+}
+
+const StreamArenaStatistic *ContextBase::GetStreamArenaStatistic() const
+{
+    return streamArena_ ? &streamArena_->GetStatistic() : nullptr;
+}
+
+OverflowDetector *ContextBase::GetOverflowDetector() const
+{
+    return overflowDetector_.get();
+}
+
 bool ContextBase::GetLaunchWithTilingStatus() const
 {
     return mode_ != GRAPH_LAUNCH_MODE;
 }
 
+ThreadPool *ContextBase::GetTilingFillThreadPool() const
+{
+    return tilingFillThreadPool_.get();
+}
+
+void ContextBase::SetTilingFillThreadNum(uint32_t threadNum)
+{
+    tilingFillThreadPool_.reset();
+    if (threadNum > 0) {
+        tilingFillThreadPool_ = std::make_unique<ThreadPool>(threadNum);
+    }
+    ATB_LOG(INFO) << "ContextBase set tiling fill thread num:" << threadNum;
+}
+
 } // namespace atb
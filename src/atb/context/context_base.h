@@ -13,8 +13,12 @@
 #include "atb/context.h"
 #include "atb/svector.h"
 #include "atb/context/allocator/allocator.h"
+#include "atb/context/allocator/slab_allocator.h"
 #include "atb/context/tiling_buffer_pool/tiling_buffer_pool.h"
 #include "atb/context/runner_pool.h"
+#include "atb/context/stream_arena.h"
+#include "atb/context/overflow_detector.h"
+#include "atb/utils/thread_pool.h"
 namespace atb {
 class ContextBase : public Context {
 public:
@@ -24,7 +28,8 @@ public:
     ContextBase &operator=(const ContextBase &other) = delete;
     Status Init(const std::function<void *(size_t)> &alloc = nullptr,
                 const std::function<void(void *)> &dealloc = nullptr, uint32_t hostTilingBlockNum = 128,
-                uint32_t deviceTilingBlockNum = 32);
+                uint32_t deviceTilingBlockNum = 32,
+                const HostTilingMemoryOptions &hostTilingMemoryOptions = HostTilingMemoryOptions());
     void Destroy();
     Status SetExecuteStream(aclrtStream stream) override;
     aclrtStream GetExecuteStream() const override;
@@ -36,6 +41,11 @@ public:
     aclrtEvent GetAsyncTilingCopyEvent();
     virtual uint8_t *GetHostTilingBuffer();
     virtual uint8_t *GetDeviceTilingBuffer();
+    Status GatherContinuousHostTilingBuffer(const std::vector<std::pair<const uint8_t *, uint64_t>> &srcBuffers,
+                                            uint8_t *&dstBuffer);
+    uint8_t *GetContinuousDeviceTilingBuffer(uint64_t bufferSize);
+    // host tiling异步拷贝下发后调用，保证拷贝执行前其源内存不被后续Setup覆盖
+    Status RecordHostTilingCopy(const uint8_t *hostTilingBuffer, uint64_t bufferSize, aclrtStream stream);
     uint64_t GetTilingBufferBlockSize() const;
     RunnerPool &GetRunnerPool(int64_t runnerTypeIdx);
     const Tensor &GetOverflowKernelOutTensor();
@@ -43,17 +53,28 @@ public:
     ExecuteType GetExecuteType() override;
     Status SetLaunchMode(LaunchMode mode) override;
     LaunchMode GetLaunchMode() override;
+    Status SetStreamArenaStatus(bool enable) override;
+    bool GetStreamArenaStatus() const override;
+    uint8_t *GetStreamArenaBuffer(aclrtStream stream, uint64_t bufferSize);
+    const StreamArenaStatistic *GetStreamArenaStatistic() const;
+    OverflowDetector *GetOverflowDetector() const;
     void *GetArgsDeviceBuffer(size_t bufferSize);
     void *GetArgsHostBuffer(size_t bufferSize);
     Status FreeArgsDeviceBuffer(void *addr);
     Status FreeArgsHostBuffer(void *addr);
+    const SlabAllocatorStatistic &GetArgsDeviceBufferStatistic() const;
+    const SlabAllocatorStatistic &GetArgsHostBufferStatistic() const;
     bool GetLaunchWithTilingStatus() const;
+    ThreadPool *GetTilingFillThreadPool() const;
+    // 覆盖ATB_TILING_FILL_THREAD_NUM指定的tiling填充线程数，为0时销毁线程池，tiling串行填充
+    void SetTilingFillThreadNum(uint32_t threadNum);
 
 private:
     Status CreateCopyStreamAndEvents();
     Status DestoryCopyStreamAndEvents();
     Status CreateOverflowOutTensor();
     Status FreeOverflowTensor();
+    Status ResolveHostNumaNode(int32_t numaNode, int32_t &resolvedNode) const;
 
 private:
     std::vector<aclrtStream> executeStreams_;
@@ -68,8 +89,13 @@ private:
     LaunchMode mode_ = KERNEL_LAUNCH_MODE;
     std::unique_ptr<Allocator> deviceAllocator_;      // 一开始就赋值为defaultDeviceAllocator
     std::unique_ptr<Allocator> hostAllocator_;        // 一开始就赋值为defaultHostAllocator
+    std::unique_ptr<SlabAllocator> argsDeviceAllocator_; // args device内存从大块chunk中按size class切分
+    std::unique_ptr<SlabAllocator> argsHostAllocator_;   // args host内存从大块pinned chunk中按size class切分
     std::function<void *(size_t size)> allocateFunc_; // 默认使用defaultDeviceAllocator中的Allocate方法
     std::function<void(void *)> deallocateFunc_;      // 默认使用defaultDeviceAllocator中的Deallocate方法
+    std::unique_ptr<ThreadPool> tilingFillThreadPool_; // ATB_TILING_FILL_THREAD_NUM为0时不创建
+    std::unique_ptr<StreamArena> streamArena_;         // SetStreamArenaStatus(true)时创建
+    std::unique_ptr<OverflowDetector> overflowDetector_; // ATB_DEFERRED_OVERFLOW_CHECK_ENABLE为1时创建
 };
 } // namespace atb
 #endif
@@ -0,0 +1,497 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/context/overflow_detector.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include "atb/utils.h"
+#include "atb/utils/acl_kernel.h"
+#include "atb/utils/log.h"
+#include "atb/utils/probe.h"
+
+namespace atb {
+static constexpr int32_t IS_OVERFLOW = 1;
+static constexpr uint32_t MAX_BISECT_MISS_COUNT = 8;                // 连续多次重新执行未复现溢出时放弃定位
+static constexpr uint64_t MAX_INFNAN_CHECK_SIZE = 64 * 1024 * 1024; // INF_NAN模式下每个step拷贝的输出上限
+static constexpr uint16_t FP16_EXP_MASK = 0x7C00;
+static constexpr uint16_t BF16_EXP_MASK = 0x7F80;
+static constexpr uint16_t HALF_ABS_MASK = 0x7FFF;
+
+static bool IsFloatDtype(aclDataType dtype)
+{
+    return dtype == ACL_FLOAT16 || dtype == ACL_BF16 || dtype == ACL_FLOAT;
+}
+
+static bool IsHalfInf(const uint8_t *data, uint64_t dataSize, uint16_t expMask)
+{
+    const size_t counter = dataSize / sizeof(uint16_t);
+    for (size_t i = 0; i < counter; i++) {
+        uint16_t value = 0;
+        (void)memcpy(&value, data + i * sizeof(uint16_t), sizeof(uint16_t));
+        if ((value & HALF_ABS_MASK) == expMask) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool IsInfData(aclDataType dtype, const uint8_t *data, uint64_t dataSize)
+{
+    if (dtype == ACL_FLOAT16) {
+        return IsHalfInf(data, dataSize, FP16_EXP_MASK);
+    }
+    if (dtype == ACL_BF16) {
+        return IsHalfInf(data, dataSize, BF16_EXP_MASK);
+    }
+    if (dtype == ACL_FLOAT) {
+        const size_t counter = dataSize / sizeof(float);
+        for (size_t i = 0; i < counter; i++) {
+            float value = 0;
+            (void)memcpy(&value, data + i * sizeof(float), sizeof(float));
+            if (std::isinf(value)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::string OverflowDetectorStatistic::ToString() const
+{
+    std::stringstream ss;
+    ss << "stepCount:" << stepCount << ", overflowStepCount:" << overflowStepCount << ", waitCount:" << waitCount
+       << ", bisectRunCount:" << bisectRunCount << ", locatedCount:" << locatedCount;
+    return ss.str();
+}
+
+OverflowDetector::OverflowDetector() {}
+
+OverflowDetector::~OverflowDetector()
+{
+    Destroy();
+}
+
+Status OverflowDetector::Init(uint32_t maxPending)
+{
+    aclrtFloatOverflowMode satMode = ACL_RT_OVERFLOW_MODE_UNDEF;
+    int ret = aclrtGetDeviceSatMode(&satMode);
+    if (ret != ACL_SUCCESS) {
+        ATB_LOG(ERROR) << "aclrtGetDeviceSatMode failed! ret:" << ret;
+        return ERROR_RT_FAIL;
+    }
+    isSaturationMode_ = satMode == ACL_RT_OVERFLOW_MODE_SATURATION;
+    if (isSaturationMode_) {
+        statusTensor_.desc.dtype = ACL_INT32;
+        statusTensor_.desc.format = ACL_FORMAT_ND;
+        statusTensor_.desc.shape.dimNum = 1;
+        statusTensor_.desc.shape.dims[0] = 1;
+        statusTensor_.dataSize = Utils::GetTensorSize(statusTensor_.desc);
+        ret = aclrtMalloc(&statusTensor_.deviceData, statusTensor_.dataSize, ACL_MEM_MALLOC_HUGE_FIRST);
+        if (ret != ACL_SUCCESS) {
+            ATB_LOG(ERROR) << "OverflowDetector malloc status tensor failed! ret:" << ret;
+            return ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+    }
+    slots_.resize(maxPending);
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        ret = aclrtCreateEvent(&slots_.at(i).event);
+        if (ret != ACL_SUCCESS) {
+            ATB_LOG(ERROR) << "OverflowDetector aclrtCreateEvent failed! ret:" << ret;
+            return ERROR_RT_FAIL;
+        }
+        freeSlots_.push_back(slots_.size() - 1 - i);
+    }
+    ATB_LOG(INFO) << "OverflowDetector init success, saturation mode: " << isSaturationMode_
+                  << ", max pending: " << maxPending;
+    return NO_ERROR;
+}
+
+void OverflowDetector::Destroy()
+{
+    Drain();
+    for (CheckSlot &slot : slots_) {
+        if (slot.event != nullptr) {
+            int ret = aclrtDestroyEvent(slot.event);
+            ATB_LOG_IF(ret != ACL_SUCCESS, ERROR) << "OverflowDetector aclrtDestroyEvent failed! ret:" << ret;
+        }
+        if (slot.hostBuffer != nullptr) {
+            int ret = aclrtFreeHost(slot.hostBuffer);
+            ATB_LOG_IF(ret != ACL_SUCCESS, ERROR) << "OverflowDetector aclrtFreeHost failed! ret:" << ret;
+        }
+    }
+    slots_.clear();
+    freeSlots_.clear();
+    if (statusTensor_.deviceData != nullptr) {
+        int ret = aclrtFree(statusTensor_.deviceData);
+        ATB_LOG_IF(ret != ACL_SUCCESS, ERROR) << "OverflowDetector free status tensor failed! ret:" << ret;
+        statusTensor_.deviceData = nullptr;
+    }
+}
+
+bool OverflowDetector::IsSaturationMode() const
+{
+    return isSaturationMode_;
+}
+
+void OverflowDetector::BeginStep(const std::string &opName, aclrtStream stream)
+{
+    if (stepDepth_++ != 0) {
+        return;
+    }
+    stepOpName_ = opName;
+    kernelIndex_ = 0;
+    isBisectRun_ = isBisecting_ && opName == bisectOpName_;
+    if (isBisectRun_) {
+        // 饱和模式探测区间中点之前的累计状态，INF_NAN模式从第一个kernel开始逐个检查输出
+        probeIndex_ = isSaturationMode_ ? bisectLow_ + (bisectHigh_ - bisectLow_) / 2 : 0;
+        probeOverflow_ = false;
+        locatedIndex_ = 0;
+        bisectKernelNames_.clear();
+        statistic_.bisectRunCount++;
+    }
+    if (isSaturationMode_) {
+        Status st = RunFloatStatusKernel("NPUClearFloatStatusV2", stream, false);
+        ATB_LOG_IF(st != NO_ERROR, ERROR) << "OverflowDetector clear float status failed! ret:" << st;
+    }
+}
+
+Status OverflowDetector::EndStep(aclrtStream stream, const SVector<Tensor> &outTensors)
+{
+    if (stepDepth_ == 0 || --stepDepth_ != 0) {
+        return NO_ERROR;
+    }
+    if (isBisectRun_) {
+        isBisectRun_ = false;
+        bool isStepOverflow = probeOverflow_;
+        if (isSaturationMode_) {
+            Status st = ReadStatusSync(stream, isStepOverflow);
+            ATB_LOG_IF(st != NO_ERROR, ERROR) << "OverflowDetector read step status failed! ret:" << st;
+        }
+        FinishBisectRun(isStepOverflow);
+    } else {
+        Status st = SubmitCheck(stream, outTensors);
+        ATB_LOG_IF(st != NO_ERROR, ERROR) << "OverflowDetector submit check of " << stepOpName_
+                                          << " failed! ret:" << st;
+    }
+    return Poll();
+}
+
+bool OverflowDetector::IsBisectRun() const
+{
+    return isBisectRun_;
+}
+
+void OverflowDetector::CountKernel()
+{
+    kernelIndex_++;
+}
+
+bool OverflowDetector::RecordKernel(const std::string &kernelName)
+{
+    uint64_t kernelIndex = kernelIndex_++;
+    bisectKernelNames_.push_back(kernelName);
+    if (isSaturationMode_) {
+        return bisectLow_ < bisectHigh_ && kernelIndex == probeIndex_;
+    }
+    return !probeOverflow_;
+}
+
+void OverflowDetector::ReportProbeResult(bool isOverflow)
+{
+    if (!isOverflow || probeOverflow_) {
+        return;
+    }
+    probeOverflow_ = true;
+    locatedIndex_ = kernelIndex_ == 0 ? 0 : kernelIndex_ - 1;
+}
+
+Status OverflowDetector::ReadStatusSync(aclrtStream stream, bool &isOverflow)
+{
+    isOverflow = false;
+    if (!isSaturationMode_) {
+        return ERROR_INVALID_PARAM;
+    }
+    Status st = RunFloatStatusKernel("NPUGetFloatStatusV2", stream, true);
+    if (st != NO_ERROR) {
+        return st;
+    }
+    int ret = aclrtSynchronizeStream(stream);
+    if (ret != ACL_SUCCESS) {
+        ATB_LOG(ERROR) << "aclrtSynchronizeStream failed! ret:" << ret;
+        return ERROR_RT_FAIL;
+    }
+    int32_t status = 0;
+    ret = aclrtMemcpy(&status, sizeof(int32_t), statusTensor_.deviceData, sizeof(int32_t),
+                      ACL_MEMCPY_DEVICE_TO_HOST);
+    if (ret != ACL_SUCCESS) {
+        ATB_LOG(ERROR) << "aclrtMemcpy failed! ret:" << ret;
+        return ERROR_RT_FAIL;
+    }
+    isOverflow = status == IS_OVERFLOW;
+    return NO_ERROR;
+}
+
+Status OverflowDetector::Poll()
+{
+    bool isOverflow = false;
+    while (!pendingChecks_.empty()) {
+        PendingCheck &check = pendingChecks_.front();
+        aclrtEventRecordedStatus status = ACL_EVENT_RECORDED_STATUS_NOT_READY;
+        int ret = aclrtQueryEventStatus(slots_.at(check.slotIndex).event, &status);
+        if (ret != ACL_SUCCESS) {
+            ATB_LOG(ERROR) << "OverflowDetector aclrtQueryEventStatus failed! ret:" << ret;
+            break;
+        }
+        if (status != ACL_EVENT_RECORDED_STATUS_COMPLETE) {
+            break;
+        }
+        isOverflow = ProcessCheck(check) || isOverflow;
+        freeSlots_.push_back(check.slotIndex);
+        pendingChecks_.pop_front();
+    }
+    if (isOverflow && Probe::IsOverflowStop()) {
+        ATB_LOG(WARN) << "stop because of overflow!";
+        return ERROR_RT_FAIL;
+    }
+    return NO_ERROR;
+}
+
+void OverflowDetector::Drain()
+{
+    while (!pendingChecks_.empty()) {
+        PendingCheck &check = pendingChecks_.front();
+        int ret = aclrtSynchronizeEvent(slots_.at(check.slotIndex).event);
+        if (ret == ACL_SUCCESS) {
+            ProcessCheck(check);
+        } else {
+            ATB_LOG(ERROR) << "OverflowDetector aclrtSynchronizeEvent failed! ret:" << ret;
+        }
+        freeSlots_.push_back(check.slotIndex);
+        pendingChecks_.pop_front();
+    }
+}
+
+const OverflowDetectorStatistic &OverflowDetector::GetStatistic() const
+{
+    return statistic_;
+}
+
+Status OverflowDetector::SubmitCheck(aclrtStream stream, const SVector<Tensor> &outTensors)
+{
+    if (freeSlots_.empty()) {
+        // 所有检测都未读回时同步等待最旧的一个，保证待处理的检测数有上限
+        statistic_.waitCount++;
+        PendingCheck &oldest = pendingChecks_.front();
+        int ret = aclrtSynchronizeEvent(slots_.at(oldest.slotIndex).event);
+        ATB_LOG_IF(ret != ACL_SUCCESS, ERROR) << "OverflowDetector aclrtSynchronizeEvent failed! ret:" << ret;
+        if (ret == ACL_SUCCESS) {
+            ProcessCheck(oldest);
+        }
+        freeSlots_.push_back(oldest.slotIndex);
+        pendingChecks_.pop_front();
+    }
+    PendingCheck check;
+    check.opName = stepOpName_;
+    check.kernelNum = kernelIndex_;
+    check.slotIndex = freeSlots_.back();
+    CheckSlot &slot = slots_.at(check.slotIndex);
+    Status st = isSaturationMode_ ? CopyStatus(stream, slot) : CopyOutTensors(stream, outTensors, slot, check);
+    if (st != NO_ERROR) {
+        return st;
+    }
+    int ret = aclrtRecordEvent(slot.event, stream);
+    if (ret != ACL_SUCCESS) {
+        ATB_LOG(ERROR) << "OverflowDetector aclrtRecordEvent failed! ret:" << ret;
+        return ERROR_RT_FAIL;
+    }
+    freeSlots_.pop_back();
+    pendingChecks_.push_back(std::move(check));
+    statistic_.stepCount++;
+    return NO_ERROR;
+}
+
+Status OverflowDetector::CopyStatus(aclrtStream stream, CheckSlot &slot) const
+{
+    if (slot.hostBuffer == nullptr) {
+        int ret = aclrtMallocHost(reinterpret_cast<void **>(&slot.hostBuffer), sizeof(int32_t));
+        if (ret != ACL_SUCCESS) {
+            ATB_LOG(ERROR) << "OverflowDetector aclrtMallocHost failed! ret:" << ret;
+            return ERROR_OUT_OF_HOST_MEMORY;
+        }
+        slot.bufferSize = sizeof(int32_t);
+    }
+    Status st = RunFloatStatusKernel("NPUGetFloatStatusV2", stream, true);
+    if (st != NO_ERROR) {
+        return st;
+    }
+    int ret = aclrtMemcpyAsync(slot.hostBuffer, sizeof(int32_t), statusTensor_.deviceData, sizeof(int32_t),
+                               ACL_MEMCPY_DEVICE_TO_HOST, stream);
+    if (ret != ACL_SUCCESS) {
+        ATB_LOG(ERROR) << "OverflowDetector aclrtMemcpyAsync status failed! ret:" << ret;
+        return ERROR_RT_FAIL;
+    }
+    return NO_ERROR;
+}
+
+Status OverflowDetector::CopyOutTensors(aclrtStream stream, const SVector<Tensor> &outTensors, CheckSlot &slot,
+                                        PendingCheck &check) const
+{
+    uint64_t totalSize = 0;
+    for (const Tensor &tensor : outTensors) {
+        if (!IsFloatDtype(tensor.desc.dtype) || tensor.deviceData == nullptr || tensor.dataSize == 0) {
+            continue;
+        }
+        if (totalSize + tensor.dataSize > MAX_INFNAN_CHECK_SIZE) {
+            ATB_LOG(DEBUG) << "OverflowDetector skip out tensor of " << check.opName << ", size: " << tensor.dataSize;
+            continue;
+        }
+        totalSize += tensor.dataSize;
+        check.dtypes.push_back(tensor.desc.dtype);
+        check.dataSizes.push_back(tensor.dataSize);
+    }
+    if (totalSize > slot.bufferSize) {
+        if (slot.hostBuffer != nullptr) {
+            int ret = aclrtFreeHost(slot.hostBuffer);
+            ATB_LOG_IF(ret != ACL_SUCCESS, ERROR) << "OverflowDetector aclrtFreeHost failed! ret:" << ret;
+            slot.hostBuffer = nullptr;
+            slot.bufferSize = 0;
+        }
+        int ret = aclrtMallocHost(reinterpret_cast<void **>(&slot.hostBuffer), totalSize);
+        if (ret != ACL_SUCCESS) {
+            ATB_LOG(ERROR) << "OverflowDetector aclrtMallocHost failed! size:" << totalSize << ", ret:" << ret;
+            return ERROR_OUT_OF_HOST_MEMORY;
+        }
+        slot.bufferSize = totalSize;
+    }
+    uint64_t offset = 0;
+    for (const Tensor &tensor : outTensors) {
+        if (!IsFloatDtype(tensor.desc.dtype) || tensor.deviceData == nullptr || tensor.dataSize == 0 ||
+            offset + tensor.dataSize > totalSize) {
+            continue;
+        }
+        int ret = aclrtMemcpyAsync(slot.hostBuffer + offset, tensor.dataSize, tensor.deviceData, tensor.dataSize,
+                                   ACL_MEMCPY_DEVICE_TO_HOST, stream);
+        if (ret != ACL_SUCCESS) {
+            ATB_LOG(ERROR) << "OverflowDetector aclrtMemcpyAsync out tensor failed! ret:" << ret;
+            return ERROR_RT_FAIL;
+        }
+        offset += tensor.dataSize;
+    }
+    return NO_ERROR;
+}
+
+bool OverflowDetector::IsCheckOverflow(const PendingCheck &check) const
+{
+    const CheckSlot &slot = slots_.at(check.slotIndex);
+    if (slot.hostBuffer == nullptr) {
+        return false;
+    }
+    if (isSaturationMode_) {
+        int32_t status = 0;
+        (void)memcpy(&status, slot.hostBuffer, sizeof(int32_t));
+        return status == IS_OVERFLOW;
+    }
+    uint64_t offset = 0;
+    for (size_t i = 0; i < check.dtypes.size(); ++i) {
+        if (IsInfData(check.dtypes.at(i), slot.hostBuffer + offset, check.dataSizes.at(i))) {
+            return true;
+        }
+        offset += check.dataSizes.at(i);
+    }
+    return false;
+}
+
+bool OverflowDetector::ProcessCheck(const PendingCheck &check)
+{
+    if (!IsCheckOverflow(check)) {
+        return false;
+    }
+    statistic_.overflowStepCount++;
+    ATB_LOG(ERROR) << check.opName << " overflow! kernel num: " << check.kernelNum;
+    if (isBisecting_ || check.kernelNum == 0) {
+        return true;
+    }
+    // 从该Operation的下一次执行开始二分定位溢出的kernel
+    isBisecting_ = true;
+    bisectOpName_ = check.opName;
+    bisectLow_ = 0;
+    bisectHigh_ = check.kernelNum - 1;
+    bisectMissCount_ = 0;
+    ATB_LOG(INFO) << "OverflowDetector start locating overflow kernel of " << bisectOpName_;
+    return true;
+}
+
+void OverflowDetector::FinishBisectRun(bool isStepOverflow)
+{
+    uint64_t kernelNum = kernelIndex_;
+    if (!isStepOverflow || kernelNum == 0) {
+        if (++bisectMissCount_ >= MAX_BISECT_MISS_COUNT) {
+            ATB_LOG(WARN) << "OverflowDetector give up locating overflow kernel of " << bisectOpName_
+                          << ", overflow not reproduced in " << bisectMissCount_ << " runs";
+            isBisecting_ = false;
+        }
+        return;
+    }
+    bisectMissCount_ = 0;
+    if (!isSaturationMode_) {
+        if (probeOverflow_) {
+            ReportLocatedKernel(locatedIndex_);
+        } else {
+            // 输出tensor存在inf但各kernel的输出都未检查到，可能溢出发生在未输出的中间结果上
+            ATB_LOG(WARN) << "OverflowDetector can not locate overflow kernel of " << bisectOpName_;
+            isBisecting_ = false;
+        }
+        return;
+    }
+    // kernel个数与首次检测时不同时，收缩区间到本次执行的范围
+    bisectHigh_ = std::min(bisectHigh_, kernelNum - 1);
+    bisectLow_ = std::min(bisectLow_, bisectHigh_);
+    if (bisectLow_ < bisectHigh_) {
+        if (probeOverflow_) {
+            bisectHigh_ = probeIndex_;
+        } else {
+            bisectLow_ = probeIndex_ + 1;
+        }
+    }
+    ATB_LOG(INFO) << "OverflowDetector locating overflow kernel of " << bisectOpName_ << " in [" << bisectLow_
+                  << ", " << bisectHigh_ << "]";
+    if (bisectLow_ == bisectHigh_) {
+        ReportLocatedKernel(bisectLow_);
+    }
+}
+
+void OverflowDetector::ReportLocatedKernel(uint64_t kernelIndex)
+{
+    std::string kernelName = kernelIndex < bisectKernelNames_.size() ? bisectKernelNames_.at(kernelIndex) : "";
+    std::string kernelPath = bisectOpName_ + ":" + kernelName;
+    ATB_LOG(ERROR) << kernelPath << " overflow! kernel index: " << kernelIndex;
+    Probe::ReportOverflowKernel(kernelPath);
+    statistic_.locatedCount++;
+    isBisecting_ = false;
+}
+
+Status OverflowDetector::RunFloatStatusKernel(const std::string &kernelName, aclrtStream stream,
+                                              bool withOutTensor) const
+{
+    AclKernel statusKernel;
+    SVector<Tensor> inTensors;
+    SVector<Tensor> outTensors;
+    if (withOutTensor) {
+        outTensors.push_back(statusTensor_);
+    }
+    aclError ret = statusKernel.Run(kernelName, inTensors, outTensors, stream);
+    if (ret != ACL_SUCCESS) {
+        ATB_LOG(ERROR) << kernelName << " run failed! ret:" << ret;
+        return ERROR_RT_FAIL;
+    }
+    return NO_ERROR;
+}
+} // namespace atb
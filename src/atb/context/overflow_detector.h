@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_OVERFLOW_DETECTOR_H
+#define ATB_OVERFLOW_DETECTOR_H
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+#include <acl/acl.h>
+#include "atb/types.h"
+#include "atb/svector.h"
+
+namespace atb {
+struct OverflowDetectorStatistic {
+    uint64_t stepCount = 0;         // 提交的延迟检测次数
+    uint64_t overflowStepCount = 0; // 检测到溢出的次数
+    uint64_t waitCount = 0;         // 待读回的检测数达到上限时同步等待的次数
+    uint64_t bisectRunCount = 0;    // 为二分定位溢出kernel而重新执行的次数
+    uint64_t locatedCount = 0;      // 定位到溢出kernel的次数
+
+    std::string ToString() const;
+};
+
+// 延迟溢出检测：不在每个kernel后同步检查，而是以顶层Operation的一次执行为一个step累计溢出状态。
+// 饱和模式下step开始时清零浮点状态寄存器，结束时将其读到device状态字；INF_NAN模式下检查step的输出tensor。
+// 检测结果通过aclrtMemcpyAsync拷贝到pinned内存并记录event，后续执行时非阻塞地查询event读取结果。
+// 检测到溢出后，该Operation后续的执行会在中间kernel处同步探测一次，按结果二分缩小范围直到定位到溢出kernel。
+// 非线程安全，与ContextBase的使用方式一致。
+class OverflowDetector {
+public:
+    OverflowDetector();
+    ~OverflowDetector();
+    OverflowDetector(const OverflowDetector &other) = delete;
+    OverflowDetector &operator=(const OverflowDetector &other) = delete;
+    Status Init(uint32_t maxPending);
+    void Destroy();
+    bool IsSaturationMode() const;
+    // 顶层Operation下发kernel前调用，嵌套调用只有最外层生效
+    void BeginStep(const std::string &opName, aclrtStream stream);
+    // 顶层Operation的kernel全部下发后调用，提交本step的延迟检测并处理已完成的检测结果，
+    // 检测到溢出且开启了溢出停止时返回ERROR_RT_FAIL
+    Status EndStep(aclrtStream stream, const SVector<Tensor> &outTensors);
+    // 当前执行是否为二分定位的重新执行，是时需对每个kernel调用RecordKernel，否则调用CountKernel
+    bool IsBisectRun() const;
+    void CountKernel();
+    // 记录下发的kernel，返回true表示该kernel为本次的探测点，调用方需同步探测后调用ReportProbeResult
+    bool RecordKernel(const std::string &kernelName);
+    void ReportProbeResult(bool isOverflow);
+    // 同步读取本step开始以来累计的溢出状态，仅饱和模式可用
+    Status ReadStatusSync(aclrtStream stream, bool &isOverflow);
+    // 非阻塞地处理已完成的检测结果
+    Status Poll();
+    // 同步等待并处理所有未完成的检测
+    void Drain();
+    const OverflowDetectorStatistic &GetStatistic() const;
+
+private:
+    struct CheckSlot {
+        uint8_t *hostBuffer = nullptr;
+        uint64_t bufferSize = 0;
+        aclrtEvent event = nullptr;
+    };
+    struct PendingCheck {
+        std::string opName;
+        size_t slotIndex = 0;
+        uint64_t kernelNum = 0;
+        SVector<aclDataType> dtypes; // INF_NAN模式下拷贝的输出tensor，按顺序排列在hostBuffer中
+        SVector<uint64_t> dataSizes;
+    };
+    Status SubmitCheck(aclrtStream stream, const SVector<Tensor> &outTensors);
+    Status CopyStatus(aclrtStream stream, CheckSlot &slot) const;
+    Status CopyOutTensors(aclrtStream stream, const SVector<Tensor> &outTensors, CheckSlot &slot,
+                          PendingCheck &check) const;
+    bool IsCheckOverflow(const PendingCheck &check) const;
+    bool ProcessCheck(const PendingCheck &check);
+    void FinishBisectRun(bool isStepOverflow);
+    void ReportLocatedKernel(uint64_t kernelIndex);
+    Status RunFloatStatusKernel(const std::string &kernelName, aclrtStream stream, bool withOutTensor) const;
+
+private:
+    bool isSaturationMode_ = false;
+    Tensor statusTensor_;
+    std::vector<CheckSlot> slots_;
+    std::vector<size_t> freeSlots_;
+    std::deque<PendingCheck> pendingChecks_;
+    uint32_t stepDepth_ = 0;
+    std::string stepOpName_;
+    uint64_t kernelIndex_ = 0;
+    // 二分定位状态：饱和模式下溢出kernel位于[bisectLow_, bisectHigh_]，INF_NAN模式下逐kernel检查输出
+    bool isBisecting_ = false;
+    bool isBisectRun_ = false;
+    std::string bisectOpName_;
+    uint64_t bisectLow_ = 0;
+    uint64_t bisectHigh_ = 0;
+    uint64_t probeIndex_ = 0;
+    bool probeOverflow_ = false;
+    uint64_t locatedIndex_ = 0;
+    uint32_t bisectMissCount_ = 0;
+    std::vector<std::string> bisectKernelNames_;
+    OverflowDetectorStatistic statistic_;
+};
+} // namespace atb
+#endif
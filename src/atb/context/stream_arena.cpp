@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/context/stream_arena.h"
+#include <algorithm>
+#include <sstream>
+#include "atb/utils/log.h"
+
+namespace atb {
+std::string StreamArenaStatistic::ToString() const
+{
+    std::stringstream ss;
+    ss << "streamNum: " << streamNum << ", requestNum: " << requestNum << ", growNum: " << growNum
+       << ", arenaSize: " << arenaSize << ", retiredSize: " << retiredSize << ", peakRequestSize: " << peakRequestSize
+       << ", totalRequestSize: " << totalRequestSize;
+    return ss.str();
+}
+
+StreamArena::StreamArena(std::unique_ptr<Allocator> allocator) : allocator_(std::move(allocator)) {}
+
+StreamArena::~StreamArena()
+{
+    Release();
+}
+
+uint8_t *StreamArena::GetBuffer(aclrtStream stream, uint64_t bufferSize, bool syncRelease)
+{
+    if (bufferSize == 0) {
+        return nullptr;
+    }
+    statistic_.requestNum++;
+    statistic_.totalRequestSize += bufferSize;
+    statistic_.peakRequestSize = std::max(statistic_.peakRequestSize, bufferSize);
+    Region *region = FindRegion(stream);
+    if (region != nullptr && region->size >= bufferSize) {
+        return region->buffer;
+    }
+    if (region == nullptr) {
+        regions_.push_back({stream, nullptr, 0});
+        region = &regions_.at(regions_.size() - 1);
+        statistic_.streamNum = regions_.size();
+    } else if (region->buffer != nullptr) {
+        statistic_.growNum++;
+        statistic_.arenaSize -= region->size;
+        if (syncRelease) {
+            // 先释放旧region再申请，降低扩容时的内存峰值
+            FreeRegionBuffer(stream, region->buffer);
+        } else {
+            retiredRegions_.push_back(*region);
+            statistic_.retiredSize += region->size;
+        }
+        region->buffer = nullptr;
+        region->size = 0;
+    }
+    uint8_t *buffer = static_cast<uint8_t *>(allocator_->Allocate(static_cast<size_t>(bufferSize)));
+    if (buffer == nullptr) {
+        ATB_LOG(ERROR) << "StreamArena allocate buffer fail, bufferSize: " << bufferSize;
+        return nullptr;
+    }
+    ATB_LOG(INFO) << "StreamArena stream: " << stream << " region grow to " << bufferSize;
+    region->buffer = buffer;
+    region->size = bufferSize;
+    statistic_.arenaSize += bufferSize;
+    return buffer;
+}
+
+void StreamArena::Release()
+{
+    for (auto &region : regions_) {
+        FreeRegionBuffer(region.stream, region.buffer);
+    }
+    for (auto &region : retiredRegions_) {
+        FreeRegionBuffer(region.stream, region.buffer);
+    }
+    regions_.clear();
+    retiredRegions_.clear();
+    statistic_.streamNum = 0;
+    statistic_.arenaSize = 0;
+    statistic_.retiredSize = 0;
+}
+
+const StreamArenaStatistic &StreamArena::GetStatistic() const
+{
+    return statistic_;
+}
+
+StreamArena::Region *StreamArena::FindRegion(aclrtStream stream)
+{
+    for (auto &region : regions_) {
+        if (region.stream == stream) {
+            return &region;
+        }
+    }
+    return nullptr;
+}
+
+void StreamArena::FreeRegionBuffer(aclrtStream stream, uint8_t *buffer)
+{
+    if (buffer == nullptr) {
+        return;
+    }
+    // 流上已下发的任务可能仍在使用该region
+    int ret = aclrtSynchronizeStream(stream);
+    ATB_LOG_IF(ret != ACL_SUCCESS, ERROR) << "StreamArena aclrtSynchronizeStream fail, ret:" << ret;
+    Status st = allocator_->Deallocate(buffer);
+    ATB_LOG_IF(st != NO_ERROR, ERROR) << "StreamArena deallocate buffer fail, ret:" << st;
+}
+} // namespace atb
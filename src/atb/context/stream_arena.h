@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_STREAM_ARENA_H
+#define ATB_STREAM_ARENA_H
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <acl/acl.h>
+#include "atb/context/allocator/allocator.h"
+
+namespace atb {
+struct StreamArenaStatistic {
+    uint64_t streamNum = 0;        // 持有region的执行流数
+    uint64_t requestNum = 0;       // 累计申请次数
+    uint64_t growNum = 0;          // region扩容次数
+    uint64_t arenaSize = 0;        // 当前各执行流region总字节数
+    uint64_t retiredSize = 0;      // 扩容后等待释放的旧region字节数
+    uint64_t peakRequestSize = 0;  // 单次申请的最大字节数
+    uint64_t totalRequestSize = 0; // 累计申请字节数，即各Operation独立申请workspace时的总量
+
+    std::string ToString() const;
+};
+
+// 按执行流管理一块共享的workspace region，同一条流上顺序执行的Operation复用同一块内存，
+// region大小为流上各Operation所需的最大值，申请更大时扩容。
+// 扩容时旧region可能仍被流上已下发的任务使用：syncRelease为true时先同步执行流再释放，
+// 否则挂到待释放列表，在Release时同步后统一释放。非线程安全，与ContextBase的使用方式一致。
+class StreamArena {
+public:
+    explicit StreamArena(std::unique_ptr<Allocator> allocator);
+    ~StreamArena();
+    StreamArena(const StreamArena &other) = delete;
+    StreamArena &operator=(const StreamArena &other) = delete;
+    uint8_t *GetBuffer(aclrtStream stream, uint64_t bufferSize, bool syncRelease);
+    void Release();
+    const StreamArenaStatistic &GetStatistic() const;
+
+private:
+    struct Region {
+        aclrtStream stream = nullptr;
+        uint8_t *buffer = nullptr;
+        uint64_t size = 0;
+    };
+    Region *FindRegion(aclrtStream stream);
+    void FreeRegionBuffer(aclrtStream stream, uint8_t *buffer);
+
+private:
+    std::unique_ptr<Allocator> allocator_;
+    std::vector<Region> regions_; // 执行流数很少，线性查找
+    std::vector<Region> retiredRegions_;
+    StreamArenaStatistic statistic_;
+};
+} // namespace atb
+#endif
@@ -8,25 +8,66 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 #include "host_tiling_buffer_pool.h"
+#include <cstring>
+#include <acl/acl.h>
 #include "atb/utils/log.h"
+#include "atb/utils/numa_util.h"
 
 namespace atb {
-HostTilingBufferPool::HostTilingBufferPool(uint64_t blockNum, uint64_t blockSize)
-    : TilingBufferPool(blockNum, blockSize)
+HostTilingBufferPool::HostTilingBufferPool(uint64_t blockNum, uint64_t blockSize, bool pinned, int32_t numaNode)
+    : TilingBufferPool(blockNum, blockSize), pinned_(pinned), numaNode_(numaNode)
 {
 }
 
-HostTilingBufferPool::~HostTilingBufferPool() {}
+HostTilingBufferPool::~HostTilingBufferPool()
+{
+    DestroyBlockEvents();
+}
 
 uint8_t *HostTilingBufferPool::MallocTotalBuffer(uint64_t bufferSize)
 {
-    ATB_LOG(INFO) << "malloc bufferSize:" << bufferSize;
-    return static_cast<uint8_t *>(malloc(bufferSize));
+    ATB_LOG(INFO) << "malloc bufferSize:" << bufferSize << ", pinned:" << pinned_ << ", numaNode:" << numaNode_;
+    ScopedNumaMemPolicy numaMemPolicy(numaNode_);
+    void *buffer = nullptr;
+    if (pinned_) {
+        int ret = aclrtMallocHost(&buffer, bufferSize);
+        if (ret != ACL_SUCCESS) {
+            ATB_LOG(ERROR) << "aclrtMallocHost host tiling buffer fail, bufferSize:" << bufferSize << ", ret:" << ret;
+            return nullptr;
+        }
+    } else {
+        buffer = malloc(bufferSize);
+    }
+    if (buffer != nullptr && numaMemPolicy.IsApplied()) {
+        // 首次写入触发缺页，使物理页在当前内存策略下落到目标NUMA节点
+        (void)memset(buffer, 0, bufferSize);
+    }
+    if (buffer != nullptr && pinned_) {
+        DestroyBlockEvents();
+        blockEvents_.resize(GetBlockNum(), nullptr);
+        blockEventRecorded_.resize(GetBlockNum(), false);
+        for (size_t i = 0; i < blockEvents_.size(); ++i) {
+            int ret = aclrtCreateEvent(&blockEvents_.at(i));
+            if (ret != ACL_SUCCESS) {
+                ATB_LOG(ERROR) << "aclrtCreateEvent for host tiling block fail, ret:" << ret;
+                DestroyBlockEvents();
+                (void)aclrtFreeHost(buffer);
+                return nullptr;
+            }
+        }
+    }
+    return static_cast<uint8_t *>(buffer);
 }
 
 void HostTilingBufferPool::FreeTotalBuffer(uint8_t *buffer)
 {
-    free(buffer);
+    if (pinned_) {
+        DestroyBlockEvents();
+        int ret = aclrtFreeHost(buffer);
+        ATB_LOG_IF(ret != ACL_SUCCESS, ERROR) << "aclrtFreeHost host tiling buffer fail, ret:" << ret;
+    } else {
+        free(buffer);
+    }
     buffer = nullptr;
 }
 
@@ -34,4 +75,56 @@ bool HostTilingBufferPool::IsDeviceBufferPool()
 {
     return false;
 }
+
+Status HostTilingBufferPool::RecordBufferCopy(const uint8_t *buffer, uint64_t bufferSize, aclrtStream stream)
+{
+    uint64_t beginIndex = GetBlockIndex(buffer);
+    if (blockEvents_.empty() || beginIndex >= blockEvents_.size()) {
+        return NO_ERROR;
+    }
+    uint64_t blockNum = bufferSize == 0 ? 1 : (bufferSize + GetBlockSize() - 1) / GetBlockSize();
+    for (uint64_t i = beginIndex; i < beginIndex + blockNum && i < blockEvents_.size(); ++i) {
+        int ret = aclrtRecordEvent(blockEvents_.at(i), stream);
+        if (ret != ACL_SUCCESS) {
+            ATB_LOG(ERROR) << "aclrtRecordEvent for host tiling block:" << i << " fail, ret:" << ret;
+            return ERROR_RT_FAIL;
+        }
+        blockEventRecorded_.at(i) = true;
+    }
+    return NO_ERROR;
+}
+
+void HostTilingBufferPool::WaitBlockReusable(uint64_t blockIndex)
+{
+    if (blockIndex >= blockEvents_.size() || !blockEventRecorded_.at(blockIndex)) {
+        return;
+    }
+    aclrtEvent event = blockEvents_.at(blockIndex);
+    aclrtEventRecordedStatus status = ACL_EVENT_RECORDED_STATUS_NOT_READY;
+    int ret = aclrtQueryEventStatus(event, &status);
+    if (ret != ACL_SUCCESS || status != ACL_EVENT_RECORDED_STATUS_COMPLETE) {
+        // 环形内存池已转满一圈而该块上次的拷贝仍未执行，等待其完成后再覆盖
+        ATB_LOG(DEBUG) << "host tiling block:" << blockIndex << " is still being copied, wait for it";
+        ret = aclrtSynchronizeEvent(event);
+        ATB_LOG_IF(ret != ACL_SUCCESS, ERROR) << "aclrtSynchronizeEvent for host tiling block fail, ret:" << ret;
+    }
+    blockEventRecorded_.at(blockIndex) = false;
+}
+
+void HostTilingBufferPool::DestroyBlockEvents()
+{
+    for (size_t i = 0; i < blockEvents_.size(); ++i) {
+        if (blockEvents_.at(i) == nullptr) {
+            continue;
+        }
+        if (blockEventRecorded_.at(i)) {
+            int ret = aclrtSynchronizeEvent(blockEvents_.at(i));
+            ATB_LOG_IF(ret != ACL_SUCCESS, ERROR) << "aclrtSynchronizeEvent fail, ret:" << ret;
+        }
+        int ret = aclrtDestroyEvent(blockEvents_.at(i));
+        ATB_LOG_IF(ret != ACL_SUCCESS, ERROR) << "aclrtDestroyEvent fail, ret:" << ret;
+    }
+    blockEvents_.clear();
+    blockEventRecorded_.clear();
+}
 } // namespace atb
\ No newline at end of file
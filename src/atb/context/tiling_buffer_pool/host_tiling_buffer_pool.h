@@ -9,18 +9,31 @@
  */
 #ifndef ATB_HOST_TILING_BUFFER_POOL_H
 #define ATB_HOST_TILING_BUFFER_POOL_H
+#include <vector>
 #include "atb/context/tiling_buffer_pool/tiling_buffer_pool.h"
 
 namespace atb {
 class HostTilingBufferPool : public TilingBufferPool {
 public:
-    HostTilingBufferPool(uint64_t blockNum, uint64_t blockSize);
+    HostTilingBufferPool(uint64_t blockNum, uint64_t blockSize, bool pinned = false, int32_t numaNode = -1);
     ~HostTilingBufferPool() override;
+    Status RecordBufferCopy(const uint8_t *buffer, uint64_t bufferSize, aclrtStream stream) override;
 
 protected:
     uint8_t *MallocTotalBuffer(uint64_t bufferSize) override;
     void FreeTotalBuffer(uint8_t *buffer) override;
     bool IsDeviceBufferPool() override;
+    void WaitBlockReusable(uint64_t blockIndex) override;
+
+private:
+    void DestroyBlockEvents();
+
+private:
+    bool pinned_ = false;   // 为true时使用aclrtMallocHost申请锁页内存
+    int32_t numaNode_ = -1; // 小于0时不绑定NUMA节点
+    // 锁页内存上的异步拷贝在流上执行时才读取源内存，每块记录最近一次拷贝的事件，块复用前等待其完成
+    std::vector<aclrtEvent> blockEvents_;
+    std::vector<bool> blockEventRecorded_;
 };
 } // namespace atb
 #endif
\ No newline at end of file
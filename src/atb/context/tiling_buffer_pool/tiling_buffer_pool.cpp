@@ -8,6 +8,8 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 #include "atb/context/tiling_buffer_pool/tiling_buffer_pool.h"
+#include <algorithm>
+#include <securec.h>
 #include "atb/utils/log.h"
 
 namespace atb {
@@ -50,6 +52,7 @@ void TilingBufferPool::Destroy()
 
 uint8_t *TilingBufferPool::GetBuffer()
 {
+    WaitBlockReusable(blockIndex_);
     uint8_t *nextBuffer = totalBuffer_ + blockSize_ * blockIndex_;
 
     blockIndex_++;
@@ -60,6 +63,118 @@ uint8_t *TilingBufferPool::GetBuffer()
     return nextBuffer;
 }
 
+uint8_t *TilingBufferPool::GetContinuousBuffer(uint64_t bufferSize)
+{
+    uint8_t *nextBuffer = PeekContinuousBuffer(bufferSize);
+    if (nextBuffer == nullptr) {
+        return nullptr;
+    }
+    uint64_t needBlockNum = bufferSize == 0 ? 1 : (bufferSize + blockSize_ - 1) / blockSize_;
+    uint64_t beginIndex = GetBlockIndex(nextBuffer);
+    for (uint64_t i = 0; i < needBlockNum; ++i) {
+        WaitBlockReusable(beginIndex + i);
+    }
+    blockIndex_ = beginIndex + needBlockNum;
+    if (blockIndex_ == blockNum_) {
+        blockIndex_ = 0;
+    }
+
+    return nextBuffer;
+}
+
+uint8_t *TilingBufferPool::PeekContinuousBuffer(uint64_t bufferSize) const
+{
+    if (blockSize_ == 0 || totalBuffer_ == nullptr) {
+        return nullptr;
+    }
+    uint64_t needBlockNum = bufferSize == 0 ? 1 : (bufferSize + blockSize_ - 1) / blockSize_;
+    if (needBlockNum > blockNum_) {
+        ATB_LOG(WARN) << "TilingBufferPool need block num:" << needBlockNum << " > total block num:" << blockNum_;
+        return nullptr;
+    }
+    // 剩余的块不足时从头开始分配，保证返回的内存连续
+    uint64_t blockIndex = blockIndex_ + needBlockNum > blockNum_ ? 0 : blockIndex_;
+    return totalBuffer_ + blockSize_ * blockIndex;
+}
+
+static bool IsBufferOverlap(const uint8_t *left, uint64_t leftSize, const uint8_t *right, uint64_t rightSize)
+{
+    uintptr_t leftBegin = reinterpret_cast<uintptr_t>(left);
+    uintptr_t rightBegin = reinterpret_cast<uintptr_t>(right);
+    return leftBegin < rightBegin + rightSize && rightBegin < leftBegin + leftSize;
+}
+
+Status TilingBufferPool::GatherContinuousBuffer(const std::vector<std::pair<const uint8_t *, uint64_t>> &srcBuffers,
+                                                uint8_t *&dstBuffer)
+{
+    dstBuffer = nullptr;
+    std::vector<std::pair<const uint8_t *, uint64_t>> sortedBuffers;
+    uint64_t totalSize = 0;
+    for (const auto &srcBuffer : srcBuffers) {
+        if (srcBuffer.second != 0) {
+            sortedBuffers.push_back(srcBuffer);
+            totalSize += srcBuffer.second;
+        }
+    }
+    // 源内存之间重叠说明先写入的内容已被后写入的覆盖
+    std::sort(sortedBuffers.begin(), sortedBuffers.end());
+    for (size_t i = 1; i < sortedBuffers.size(); ++i) {
+        if (IsBufferOverlap(sortedBuffers.at(i - 1).first, sortedBuffers.at(i - 1).second,
+                            sortedBuffers.at(i).first, sortedBuffers.at(i).second)) {
+            ATB_LOG(ERROR) << "TilingBufferPool gather source buffers overlap, buffer:"
+                           << static_cast<const void *>(sortedBuffers.at(i).first);
+            return ERROR_INVALID_PARAM;
+        }
+    }
+    uint8_t *buffer = PeekContinuousBuffer(totalSize);
+    if (buffer == nullptr) {
+        return NO_ERROR;
+    }
+    for (const auto &srcBuffer : sortedBuffers) {
+        if (IsBufferOverlap(buffer, totalSize, srcBuffer.first, srcBuffer.second)) {
+            ATB_LOG(INFO) << "TilingBufferPool gather buffer overlaps source buffer:"
+                          << static_cast<const void *>(srcBuffer.first);
+            return NO_ERROR;
+        }
+    }
+    (void)GetContinuousBuffer(totalSize);
+    uint64_t offset = 0;
+    for (const auto &srcBuffer : srcBuffers) {
+        if (srcBuffer.second == 0) {
+            continue;
+        }
+        int ret = memcpy_s(buffer + offset, totalSize - offset, srcBuffer.first, srcBuffer.second);
+        if (ret != EOK) {
+            ATB_LOG(ERROR) << "TilingBufferPool gather copy fail, ret:" << ret;
+            return ERROR_COPY_HOST_MEMORY_FAIL;
+        }
+        offset += srcBuffer.second;
+    }
+    dstBuffer = buffer;
+    return NO_ERROR;
+}
+
+Status TilingBufferPool::RecordBufferCopy(const uint8_t *buffer, uint64_t bufferSize, aclrtStream stream)
+{
+    (void)buffer;
+    (void)bufferSize;
+    (void)stream;
+    return NO_ERROR;
+}
+
+void TilingBufferPool::WaitBlockReusable(uint64_t blockIndex)
+{
+    (void)blockIndex;
+}
+
+uint64_t TilingBufferPool::GetBlockIndex(const uint8_t *buffer) const
+{
+    if (blockSize_ == 0 || buffer < totalBuffer_ || buffer >= totalBuffer_ + totalSize_) {
+        return blockNum_;
+    }
+    return static_cast<uint64_t>(buffer - totalBuffer_) / blockSize_;
+}
+
 uint64_t TilingBufferPool::GetBlockNum() const
 {
     return blockNum_;
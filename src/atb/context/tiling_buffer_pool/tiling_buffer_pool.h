@@ -10,6 +10,9 @@
 #ifndef ATB_TILING_BUFFER_POOL_H
 #define ATB_TILING_BUFFER_POOL_H
 #include <cstdint>
+#include <utility>
+#include <vector>
+#include <acl/acl.h>
 #include <atb/types.h>
 
 namespace atb {
@@ -22,13 +25,27 @@ public:
     Status Init();
     void Destroy();
     uint8_t *GetBuffer();
+    // 获取可容纳bufferSize的连续若干块内存，超过内存池总大小时返回nullptr
+    uint8_t *GetContinuousBuffer(uint64_t bufferSize);
+    // 返回GetContinuousBuffer将要分配的地址，不移动分配位置
+    uint8_t *PeekContinuousBuffer(uint64_t bufferSize) const;
+    // 将各段内存按顺序拷贝到一块连续内存。源内存之间重叠时返回错误；
+    // 连续内存会覆盖某段源内存或超过内存池总大小时不分配，dstBuffer为nullptr
+    Status GatherContinuousBuffer(const std::vector<std::pair<const uint8_t *, uint64_t>> &srcBuffers,
+                                  uint8_t *&dstBuffer);
     uint64_t GetBlockNum() const;
     uint64_t GetBlockSize() const;
+    // 以buffer开始、大小为bufferSize的内存已作为异步拷贝的源下发到stream，所在各块再次分配前需等待拷贝完成
+    virtual Status RecordBufferCopy(const uint8_t *buffer, uint64_t bufferSize, aclrtStream stream);
 
 protected:
     virtual uint8_t *MallocTotalBuffer(uint64_t bufferSize) = 0;
     virtual void FreeTotalBuffer(uint8_t *buffer) = 0;
     virtual bool IsDeviceBufferPool() = 0;
+    // 第blockIndex块即将再次分配，默认无需等待
+    virtual void WaitBlockReusable(uint64_t blockIndex);
+    // 返回buffer所在块的序号，buffer不在内存池内时返回块数
+    uint64_t GetBlockIndex(const uint8_t *buffer) const;
 
 private:
     uint64_t blockNum_ = 0;
@@ -17,43 +17,119 @@
 #include "atb/utils/tensor_util.h"
 #include "atb/utils/param_compare.h"
 #include "atb/utils/statistic.h"
+#include "atb/utils/singleton.h"
+#include "atb/kernel_cache/kernel_registry.h"
 
 namespace atb {
 constexpr uint64_t DEFAULT_TILING_SIZE = 10240;
+constexpr uint64_t FINGERPRINT_SEED = 0xcbf29ce484222325ULL;
+constexpr uint64_t FINGERPRINT_PRIME = 0x100000001b3ULL;
+
+static inline void HashCombine(uint64_t &seed, uint64_t value)
+{
+    seed = (seed ^ value) * FINGERPRINT_PRIME;
+}
+
+uint64_t LaunchParamKey::CalcFingerprint(const Mki::LaunchParam &launchParam)
+{
+    uint64_t fingerprint = FINGERPRINT_SEED;
+    const size_t inTensorCount = launchParam.GetInTensorCount();
+    HashCombine(fingerprint, inTensorCount);
+    for (size_t i = 0; i < inTensorCount; ++i) {
+        const Mki::TensorDesc &desc = launchParam.GetInTensor(i).desc;
+        HashCombine(fingerprint, static_cast<uint64_t>(desc.dtype));
+        HashCombine(fingerprint, static_cast<uint64_t>(desc.format));
+        HashCombine(fingerprint, desc.dims.size());
+        for (size_t j = 0; j < desc.dims.size(); ++j) {
+            HashCombine(fingerprint, static_cast<uint64_t>(desc.dims.at(j)));
+        }
+    }
+    HashCombine(fingerprint, launchParam.GetParam().Type().hash_code());
+    return fingerprint;
+}
+
+void LaunchParamKey::Init(const Mki::LaunchParam &launchParam, uint64_t launchParamFingerprint)
+{
+    fingerprint = launchParamFingerprint;
+    const size_t inTensorCount = launchParam.GetInTensorCount();
+    inTensorDescs.resize(inTensorCount);
+    for (size_t i = 0; i < inTensorCount; ++i) {
+        inTensorDescs.at(i) = launchParam.GetInTensor(i).desc;
+    }
+    specificParam = launchParam.GetParam();
+}
+
+bool LaunchParamKey::IsEqual(const Mki::LaunchParam &launchParam, uint64_t launchParamFingerprint) const
+{
+    if (fingerprint != launchParamFingerprint || inTensorDescs.size() != launchParam.GetInTensorCount()) {
+        return false;
+    }
+    for (size_t i = 0; i < inTensorDescs.size(); ++i) {
+        if (!TensorUtil::AsdOpsTensorDescEqual(inTensorDescs.at(i), launchParam.GetInTensor(i).desc)) {
+            return false;
+        }
+    }
+    return IsSpecificParamEqual(specificParam, launchParam.GetParam());
+}
+
+bool LaunchParamKey::IsEqual(const LaunchParamKey &other) const
+{
+    if (fingerprint != other.fingerprint || inTensorDescs.size() != other.inTensorDescs.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < inTensorDescs.size(); ++i) {
+        if (!TensorUtil::AsdOpsTensorDescEqual(inTensorDescs.at(i), other.inTensorDescs.at(i))) {
+            return false;
+        }
+    }
+    return IsSpecificParamEqual(specificParam, other.specificParam);
+}
+
+size_t CacheItem::GetMemorySize() const
+{
+    return sizeof(CacheItem) + tilingBuffer.capacity();
+}
+
 void CacheSlot::Init(uint32_t cacheItemCount)
 {
     cachedItems.resize(cacheItemCount);
+    memorySize = 0;
     for (auto &cacheItem : cachedItems) {
         cacheItem.tilingBuffer.reserve(DEFAULT_TILING_SIZE);
+        memorySize += cacheItem.GetMemorySize();
     }
 }
 
-void CacheSlot::AddTiling(uint8_t *tilingData, uint64_t tilingSize, const Mki::LaunchParam &launchParam,
+void CacheSlot::AddTiling(const uint8_t *tilingData, uint64_t tilingSize, const Mki::LaunchParam &launchParam,
                           const Mki::Kernel *kernel)
 {
     if (replacePos >= cachedItems.size()) {
         replacePos = 0;
     }
     auto &cachedItem = cachedItems.at(replacePos);
-    cachedItem.launchParam = launchParam;
+    memorySize -= cachedItem.GetMemorySize();
+    cachedItem.launchParamKey.Init(launchParam, LaunchParamKey::CalcFingerprint(launchParam));
     if (kernel != nullptr) {
-        cachedItem.kernel.reset(kernel->Clone());
+        cachedItem.kernel = GetSingleton<KernelRegistry>().Intern(kernel, cachedItem.launchParamKey);
+    } else {
+        cachedItem.kernel.reset();
     }
     cachedItem.tilingBuffer.resize(tilingSize);
     int ret = memcpy_s(cachedItem.tilingBuffer.data(), tilingSize, tilingData, tilingSize);
     ATB_LOG_IF(ret != EOK, ERROR) << "memcpy_s Error! Error Code: " << ret;
+    memorySize += cachedItem.GetMemorySize();
 
     replacePos++;
     validSize = replacePos > validSize ? replacePos : validSize;
 }
 
 TilingBufferPtr CacheSlot::GetTilingByIndex(const size_t index, const Mki::LaunchParam &launchParam,
-                                            const Mki::Kernel* &kernel)
+                                            uint64_t launchParamFingerprint, const Mki::Kernel* &kernel)
 {
     auto &cachedItem = cachedItems.at(index);
     Mki::Timer timer;
 
-    bool equal = IsLaunchParamEqual(cachedItem.launchParam, launchParam);
+    bool equal = cachedItem.launchParamKey.IsEqual(launchParam, launchParamFingerprint);
     GetOpSetupStatistic().kernelCacheCompareRunInfoTime += timer.ElapsedMicroSecond();
     if (equal) {
         Mki::Timer kernelCacheTimer;
@@ -70,14 +146,18 @@ TilingBufferPtr CacheSlot::GetTilingByIndex(const size_t index, const Mki::Launc
 TilingBufferPtr CacheSlot::GetTiling(const Mki::LaunchParam &launchParam, const Mki::Kernel* &kernel)
 {
     TilingBufferPtr tilingBuffeerAddr = nullptr;
+    if (validSize == 0) {
+        return tilingBuffeerAddr;
+    }
+    const uint64_t launchParamFingerprint = LaunchParamKey::CalcFingerprint(launchParam);
     for (size_t i = hitPos; i < validSize; i++) {
-        tilingBuffeerAddr = GetTilingByIndex(i, launchParam, kernel);
+        tilingBuffeerAddr = GetTilingByIndex(i, launchParam, launchParamFingerprint, kernel);
         if (tilingBuffeerAddr != nullptr) {
             return tilingBuffeerAddr;
         }
     }
     for (size_t i = 0; i < hitPos; i++) {
-        tilingBuffeerAddr = GetTilingByIndex(i, launchParam, kernel);
+        tilingBuffeerAddr = GetTilingByIndex(i, launchParam, launchParamFingerprint, kernel);
         if (tilingBuffeerAddr != nullptr) {
             return tilingBuffeerAddr;
         }
@@ -93,18 +173,22 @@ void KernelCache::Init(uint64_t kernelCount, uint32_t cacheItemCount)
 {
     if (cachedSlots_.empty()) {
         cachedSlots_.resize(kernelCount);
+        memorySize_ = 0;
         for (auto &cachedSlot : cachedSlots_) {
             cachedSlot.Init(cacheItemCount);
+            memorySize_ += cachedSlot.memorySize;
         }
     }
 }
 
-void KernelCache::AddTiling(size_t kernelIndex, uint8_t *tilingData, uint64_t tilingSize,
+void KernelCache::AddTiling(size_t kernelIndex, const uint8_t *tilingData, uint64_t tilingSize,
                             const Mki::LaunchParam &launchParam, const Mki::Kernel *kernel)
 {
     if (IsValid(kernelIndex)) {
         auto &cacheSlot = cachedSlots_.at(kernelIndex);
+        memorySize_ -= cacheSlot.memorySize;
         cacheSlot.AddTiling(tilingData, tilingSize, launchParam, kernel);
+        memorySize_ += cacheSlot.memorySize;
     }
 }
 
@@ -117,8 +201,13 @@ TilingBufferPtr KernelCache::GetTiling(size_t kernelIndex, const Mki::LaunchPara
     return nullptr;
 }
 
+size_t KernelCache::GetMemorySize() const
+{
+    return memorySize_;
+}
+
 bool KernelCache::IsValid(size_t kernelIndex) const
 {
     return static_cast<uint64_t>(kernelIndex) < cachedSlots_.size();
 }
-} // namespace atb
\ No newline at end of file
+} // namespace atb
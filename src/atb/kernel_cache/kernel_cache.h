@@ -13,14 +13,28 @@
 #include <memory>
 #include <mki/launch_param.h>
 #include <mki/kernel.h>
+#include <mki/utils/SVector/SVector.h>
 
 namespace atb {
 using TilingBuffer = std::vector<uint8_t>;
 using TilingBufferPtr = TilingBuffer const *;
+
+// LaunchParam中参与缓存比较的最小数据：输入tensor描述与算子参数，fingerprint用于快速排除不匹配项
+struct LaunchParamKey {
+    uint64_t fingerprint = 0;
+    Mki::SVector<Mki::TensorDesc> inTensorDescs;
+    Mki::Any specificParam;
+    static uint64_t CalcFingerprint(const Mki::LaunchParam &launchParam);
+    void Init(const Mki::LaunchParam &launchParam, uint64_t launchParamFingerprint);
+    bool IsEqual(const Mki::LaunchParam &launchParam, uint64_t launchParamFingerprint) const;
+    bool IsEqual(const LaunchParamKey &other) const;
+};
+
 struct CacheItem {
-    Mki::LaunchParam launchParam;
-    std::shared_ptr<Mki::Kernel> kernel = nullptr;
+    LaunchParamKey launchParamKey;
+    std::shared_ptr<const Mki::Kernel> kernel = nullptr;
     TilingBuffer tilingBuffer;
+    size_t GetMemorySize() const;
 };
 
 struct CacheSlot {
@@ -28,10 +42,12 @@ struct CacheSlot {
     size_t replacePos = 0;
     size_t hitPos = 0;
     size_t validSize = 0;
+    size_t memorySize = 0;
     void Init(uint32_t cacheItemCount);
-    void AddTiling(uint8_t *tilingData, uint64_t tilingSize, const Mki::LaunchParam &launchParam,
+    void AddTiling(const uint8_t *tilingData, uint64_t tilingSize, const Mki::LaunchParam &launchParam,
                    const Mki::Kernel *kernel);
-    TilingBufferPtr GetTilingByIndex(const size_t index, const Mki::LaunchParam &launchParam, const Mki::Kernel* &kernel);
+    TilingBufferPtr GetTilingByIndex(const size_t index, const Mki::LaunchParam &launchParam,
+                                     uint64_t launchParamFingerprint, const Mki::Kernel* &kernel);
     TilingBufferPtr GetTiling(const Mki::LaunchParam &launchParam, const Mki::Kernel* &kernel);
 };
 
@@ -40,15 +56,17 @@ public:
     KernelCache() noexcept;
     ~KernelCache();
     void Init(uint64_t kernelCount, uint32_t cacheItemCount = 1);
-    void AddTiling(size_t kernelIndex, uint8_t *tilingData, uint64_t tilingSize, const Mki::LaunchParam &launchParam,
-                   const Mki::Kernel *kernel);
+    void AddTiling(size_t kernelIndex, const uint8_t *tilingData, uint64_t tilingSize,
+                   const Mki::LaunchParam &launchParam, const Mki::Kernel *kernel);
     TilingBufferPtr GetTiling(size_t kernelIndex, const Mki::LaunchParam &launchParam, const Mki::Kernel* &kernel);
+    size_t GetMemorySize() const;
 
 private:
     bool IsValid(size_t kernelIndex) const;
 
 private:
     std::vector<CacheSlot> cachedSlots_;
+    size_t memorySize_ = 0; // 不含kernel对象，kernel由KernelRegistry统一管理
 };
 } // namespace atb
-#endif
\ No newline at end of file
+#endif
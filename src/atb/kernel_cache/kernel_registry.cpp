@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/kernel_cache/kernel_registry.h"
+#include <functional>
+#include "atb/utils/log.h"
+
+namespace atb {
+constexpr size_t PRUNE_INTERVAL = 1024;
+constexpr uint64_t HASH_MAGIC = 0x9e3779b97f4a7c15ULL;
+
+KernelRegistry::KernelRegistry() {}
+
+KernelRegistry::~KernelRegistry() {}
+
+std::shared_ptr<const Mki::Kernel> KernelRegistry::Intern(const Mki::Kernel *kernel,
+                                                          const LaunchParamKey &launchParamKey)
+{
+    if (kernel == nullptr) {
+        return nullptr;
+    }
+    const std::string kernelName = kernel->GetName();
+    const bool launchWithTiling = kernel->GetKernelInfo().GetLaunchWithTiling();
+    uint64_t bucketKey = launchParamKey.fingerprint ^
+                         (std::hash<std::string>()(kernelName) + HASH_MAGIC + (launchParamKey.fingerprint << 6) +
+                          (launchParamKey.fingerprint >> 2));
+    bucketKey ^= static_cast<uint64_t>(launchWithTiling);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Entry> &bucket = buckets_[bucketKey];
+    for (auto it = bucket.begin(); it != bucket.end();) {
+        std::shared_ptr<const Mki::Kernel> internedKernel = it->kernel.lock();
+        if (internedKernel == nullptr) {
+            it = bucket.erase(it);
+            entryCount_--;
+            continue;
+        }
+        if (it->launchWithTiling == launchWithTiling && it->kernelName == kernelName &&
+            it->launchParamKey.IsEqual(launchParamKey)) {
+            return internedKernel;
+        }
+        ++it;
+    }
+
+    std::shared_ptr<const Mki::Kernel> internedKernel(kernel->Clone());
+    if (internedKernel == nullptr) {
+        ATB_LOG(ERROR) << "KernelRegistry clone kernel " << kernelName << " fail";
+        return nullptr;
+    }
+    bucket.push_back({kernelName, launchWithTiling, launchParamKey, internedKernel});
+    entryCount_++;
+    if (++internCountSincePrune_ >= PRUNE_INTERVAL) {
+        PruneExpired();
+    }
+    return internedKernel;
+}
+
+size_t KernelRegistry::GetInternedKernelCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entryCount_;
+}
+
+void KernelRegistry::PruneExpired()
+{
+    internCountSincePrune_ = 0;
+    for (auto bucketIt = buckets_.begin(); bucketIt != buckets_.end();) {
+        std::vector<Entry> &bucket = bucketIt->second;
+        for (auto it = bucket.begin(); it != bucket.end();) {
+            if (it->kernel.expired()) {
+                it = bucket.erase(it);
+                entryCount_--;
+            } else {
+                ++it;
+            }
+        }
+        bucketIt = bucket.empty() ? buckets_.erase(bucketIt) : std::next(bucketIt);
+    }
+}
+} // namespace atb
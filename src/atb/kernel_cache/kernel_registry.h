@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_KERNEL_REGISTRY_H
+#define ATB_KERNEL_REGISTRY_H
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <mki/kernel.h>
+#include "atb/kernel_cache/kernel_cache.h"
+
+namespace atb {
+// 进程级kernel驻留表：同名、同LaunchParam、同下发方式的kernel只保留一份不可变副本，供所有KernelCache共享
+class KernelRegistry {
+public:
+    KernelRegistry();
+    ~KernelRegistry();
+    std::shared_ptr<const Mki::Kernel> Intern(const Mki::Kernel *kernel, const LaunchParamKey &launchParamKey);
+    size_t GetInternedKernelCount();
+
+private:
+    struct Entry {
+        std::string kernelName;
+        bool launchWithTiling = false;
+        LaunchParamKey launchParamKey;
+        std::weak_ptr<const Mki::Kernel> kernel;
+    };
+    void PruneExpired();
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<uint64_t, std::vector<Entry>> buckets_;
+    size_t entryCount_ = 0;
+    size_t internCountSincePrune_ = 0;
+};
+} // namespace atb
+#endif
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/kernel_cache/shared_kernel_cache.h"
+#include <sstream>
+#include "atb/kernel_cache/kernel_registry.h"
+#include "atb/utils/config.h"
+#include "atb/utils/singleton.h"
+
+namespace atb {
+constexpr uint64_t RUNNER_TYPE_HASH_MAGIC = 0x9e3779b97f4a7c15ULL;
+constexpr uint64_t KERNEL_INDEX_HASH_MAGIC = 0xc2b2ae3d27d4eb4fULL;
+constexpr uint32_t HASH_MIX_SHIFT = 29;
+
+std::string SharedKernelCacheStatistic::ToString() const
+{
+    std::stringstream ss;
+    ss << "capacity: " << capacity << ", hitCount: " << hitCount << ", missCount: " << missCount
+       << ", addCount: " << addCount << ", replaceCount: " << replaceCount;
+    return ss.str();
+}
+
+SharedKernelCache::SharedKernelCache()
+{
+    Init(GetSingleton<Config>().GetSharedKernelCacheCount());
+}
+
+SharedKernelCache::SharedKernelCache(size_t capacity)
+{
+    Init(capacity);
+}
+
+SharedKernelCache::~SharedKernelCache() {}
+
+void SharedKernelCache::Init(size_t capacity)
+{
+    if (capacity == 0) {
+        return;
+    }
+    size_t bucketNum = 1;
+    while (bucketNum * WAY_NUM < capacity) {
+        bucketNum <<= 1;
+    }
+    buckets_ = std::make_unique<Bucket[]>(bucketNum);
+    bucketMask_ = bucketNum - 1;
+    capacity_ = bucketNum * WAY_NUM;
+}
+
+bool SharedKernelCache::IsEnable() const
+{
+    return buckets_ != nullptr;
+}
+
+SharedKernelCache::Bucket &SharedKernelCache::GetBucket(uint32_t runnerTypeIdx, size_t kernelIndex,
+                                                        uint64_t fingerprint) const
+{
+    uint64_t hash = fingerprint ^ (static_cast<uint64_t>(runnerTypeIdx) * RUNNER_TYPE_HASH_MAGIC) ^
+                    (static_cast<uint64_t>(kernelIndex) * KERNEL_INDEX_HASH_MAGIC);
+    hash ^= hash >> HASH_MIX_SHIFT;
+    return buckets_[static_cast<size_t>(hash) & bucketMask_];
+}
+
+bool SharedKernelCache::IsEntryMatch(const EntryPtr &entry, uint32_t runnerTypeIdx, size_t kernelIndex,
+                                     const Mki::LaunchParam &launchParam, uint64_t fingerprint)
+{
+    return entry != nullptr && entry->runnerTypeIdx == runnerTypeIdx && entry->kernelIndex == kernelIndex &&
+           entry->launchParamKey.IsEqual(launchParam, fingerprint);
+}
+
+SharedKernelCache::EntryPtr SharedKernelCache::GetTiling(uint32_t runnerTypeIdx, size_t kernelIndex,
+                                                         const Mki::LaunchParam &launchParam)
+{
+    if (!IsEnable()) {
+        return nullptr;
+    }
+    const uint64_t fingerprint = LaunchParamKey::CalcFingerprint(launchParam);
+    Bucket &bucket = GetBucket(runnerTypeIdx, kernelIndex, fingerprint);
+    for (size_t i = 0; i < WAY_NUM; ++i) {
+        EntryPtr entry = std::atomic_load_explicit(&bucket.ways.at(i), std::memory_order_acquire);
+        if (IsEntryMatch(entry, runnerTypeIdx, kernelIndex, launchParam, fingerprint)) {
+            hitCount_.fetch_add(1, std::memory_order_relaxed);
+            return entry;
+        }
+    }
+    missCount_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+void SharedKernelCache::AddTiling(uint32_t runnerTypeIdx, size_t kernelIndex, const uint8_t *tilingData,
+                                  uint64_t tilingSize, const Mki::LaunchParam &launchParam, const Mki::Kernel *kernel)
+{
+    if (!IsEnable() || tilingData == nullptr) {
+        return;
+    }
+    const uint64_t fingerprint = LaunchParamKey::CalcFingerprint(launchParam);
+    Bucket &bucket = GetBucket(runnerTypeIdx, kernelIndex, fingerprint);
+    size_t emptyPos = WAY_NUM;
+    for (size_t i = 0; i < WAY_NUM; ++i) {
+        EntryPtr entry = std::atomic_load_explicit(&bucket.ways.at(i), std::memory_order_acquire);
+        if (IsEntryMatch(entry, runnerTypeIdx, kernelIndex, launchParam, fingerprint)) {
+            return; // 其他线程已写入
+        }
+        if (entry == nullptr && emptyPos == WAY_NUM) {
+            emptyPos = i;
+        }
+    }
+
+    auto entry = std::make_shared<Entry>();
+    entry->runnerTypeIdx = runnerTypeIdx;
+    entry->kernelIndex = kernelIndex;
+    entry->launchParamKey.Init(launchParam, fingerprint);
+    if (kernel != nullptr) {
+        entry->kernel = GetSingleton<KernelRegistry>().Intern(kernel, entry->launchParamKey);
+    }
+    entry->tilingBuffer.assign(tilingData, tilingData + tilingSize);
+
+    size_t pos = emptyPos;
+    if (pos == WAY_NUM) {
+        pos = bucket.replacePos.fetch_add(1, std::memory_order_relaxed) % WAY_NUM;
+        replaceCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::atomic_store_explicit(&bucket.ways.at(pos), EntryPtr(std::move(entry)), std::memory_order_release);
+    addCount_.fetch_add(1, std::memory_order_relaxed);
+}
+
+SharedKernelCacheStatistic SharedKernelCache::GetStatistic() const
+{
+    SharedKernelCacheStatistic statistic;
+    statistic.capacity = capacity_;
+    statistic.hitCount = hitCount_.load(std::memory_order_relaxed);
+    statistic.missCount = missCount_.load(std::memory_order_relaxed);
+    statistic.addCount = addCount_.load(std::memory_order_relaxed);
+    statistic.replaceCount = replaceCount_.load(std::memory_order_relaxed);
+    return statistic;
+}
+} // namespace atb
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_SHARED_KERNEL_CACHE_H
+#define ATB_SHARED_KERNEL_CACHE_H
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include "atb/kernel_cache/kernel_cache.h"
+
+namespace atb {
+struct SharedKernelCacheStatistic {
+    uint64_t capacity = 0;     // 缓存项上限
+    uint64_t hitCount = 0;     // 累计命中次数
+    uint64_t missCount = 0;    // 累计未命中次数
+    uint64_t addCount = 0;     // 累计写入次数
+    uint64_t replaceCount = 0; // bucket已满时替换旧缓存项的次数
+
+    std::string ToString() const;
+};
+
+// 进程级tiling缓存，所有下发线程共享，位于各线程自己的全局kernel cache(L1)之后。
+// 按(runner类型, kernel序号, LaunchParam指纹)散列到固定数量的bucket，每个bucket固定WAY_NUM路，容量有界。
+// 缓存项创建后不可变：读取时原子加载shared_ptr得到快照，不加锁；写入时构造新缓存项后原子替换，
+// 旧缓存项在最后一个持有快照的读者释放后回收。
+class SharedKernelCache {
+public:
+    struct Entry {
+        uint32_t runnerTypeIdx = 0;
+        size_t kernelIndex = 0;
+        LaunchParamKey launchParamKey;
+        std::shared_ptr<const Mki::Kernel> kernel;
+        TilingBuffer tilingBuffer;
+    };
+    using EntryPtr = std::shared_ptr<const Entry>;
+    static constexpr size_t WAY_NUM = 4;
+
+    SharedKernelCache();
+    explicit SharedKernelCache(size_t capacity);
+    ~SharedKernelCache();
+    SharedKernelCache(const SharedKernelCache &other) = delete;
+    SharedKernelCache &operator=(const SharedKernelCache &other) = delete;
+    bool IsEnable() const;
+    EntryPtr GetTiling(uint32_t runnerTypeIdx, size_t kernelIndex, const Mki::LaunchParam &launchParam);
+    void AddTiling(uint32_t runnerTypeIdx, size_t kernelIndex, const uint8_t *tilingData, uint64_t tilingSize,
+                   const Mki::LaunchParam &launchParam, const Mki::Kernel *kernel);
+    SharedKernelCacheStatistic GetStatistic() const;
+
+private:
+    struct Bucket {
+        std::array<EntryPtr, WAY_NUM> ways;
+        std::atomic<uint32_t> replacePos{0};
+    };
+    void Init(size_t capacity);
+    Bucket &GetBucket(uint32_t runnerTypeIdx, size_t kernelIndex, uint64_t fingerprint) const;
+    static bool IsEntryMatch(const EntryPtr &entry, uint32_t runnerTypeIdx, size_t kernelIndex,
+                             const Mki::LaunchParam &launchParam, uint64_t fingerprint);
+
+private:
+    std::unique_ptr<Bucket[]> buckets_;
+    size_t bucketMask_ = 0;
+    size_t capacity_ = 0;
+    std::atomic<uint64_t> hitCount_{0};
+    std::atomic<uint64_t> missCount_{0};
+    std::atomic<uint64_t> addCount_{0};
+    std::atomic<uint64_t> replaceCount_{0};
+};
+} // namespace atb
+#endif
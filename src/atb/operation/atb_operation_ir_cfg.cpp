@@ -9,12 +9,8 @@
  */
 #include "atb/operation/atb_operation_ir_cfg.h"
 
-#include <memory>
 #include <string>
-#include <mki/utils/status/status.h>
 #include "atb/utils/log.h"
-#include "atb/utils/config.h"
-#include "atb/utils/singleton.h"
 
 namespace atb {
 AtbOperationIrCfg::AtbOperationIrCfg()
@@ -26,17 +22,12 @@ AtbOperationIrCfg::~AtbOperationIrCfg() {}
 
 void AtbOperationIrCfg::InitOperationIrCfg()
 {
-    std::string iniFilePath = GetSingleton<Config>().GetAtbHomePath() + "/configs/ops_configs/atb_ops_info.ini";
-    Mki::Status status = opIrCfg_.Load(iniFilePath);
-    if (!status.Ok()) {
-        ATB_LOG(ERROR) << "Load atb_ops_info.ini failed!";
-        return;
-    }
-    ATB_LOG(INFO) << "Load atb_ops_info.ini success!";
+    operationIrs_ = GetAtbOperationIrs(operationIrNum_);
+    ATB_LOG(INFO) << "Init atb operation ir success, operation ir num: " << operationIrNum_;
 }
 
-Mki::OperationIr *AtbOperationIrCfg::GetOperationIr(const std::string &opKey)
+const OperationIr *AtbOperationIrCfg::GetOperationIr(const std::string &opKey) const
 {
-    return opIrCfg_.GetOperationIr(opKey);
+    return FindOperationIr(operationIrs_, operationIrNum_, opKey);
 }
 } //  namespace atb
\ No newline at end of file
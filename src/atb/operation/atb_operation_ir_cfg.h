@@ -11,21 +11,22 @@
 #define ATB_INI_CFG_MGMT_H
 
 #include <string>
-#include "mki/utils/operationir/operation_ir.h"
-#include "mki/utils/operationir/operation_ir_cfg.h"
+#include "atb/operation/operation_ir.h"
 
 namespace atb {
+// atb_ops_info.ini在编译期生成为常量表，运行时不再解析ini文件
 class AtbOperationIrCfg {
 public:
     AtbOperationIrCfg();
     ~AtbOperationIrCfg();
-    Mki::OperationIr *GetOperationIr(const std::string &opKey);
+    const OperationIr *GetOperationIr(const std::string &opKey) const;
 
 private:
     void InitOperationIrCfg();
 
 private:
-    Mki::OperationIrCfg opIrCfg_;
+    const OperationIr *operationIrs_ = nullptr;
+    size_t operationIrNum_ = 0;
 };
 } //  namespace atb
 #endif
@@ -9,14 +9,69 @@
  */
 #include "customize_operation_ir_cfg.h"
 
-#include <memory>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
 #include <string>
-#include <mki/utils/status/status.h>
-#include "atb/utils/log.h"
 #include "atb/utils/config.h"
+#include "atb/utils/log.h"
 #include "atb/utils/singleton.h"
 
 namespace atb {
+static const std::unordered_map<std::string, aclDataType> INI_DTYPE_MAP = {
+    {"float", ACL_FLOAT},   {"float16", ACL_FLOAT16}, {"bf16", ACL_BF16},     {"int8", ACL_INT8},
+    {"int16", ACL_INT16},   {"int32", ACL_INT32},     {"int64", ACL_INT64},   {"uint8", ACL_UINT8},
+    {"uint16", ACL_UINT16}, {"uint32", ACL_UINT32},   {"uint64", ACL_UINT64}, {"bool", ACL_BOOL},
+    {"double", ACL_DOUBLE}, {"complex64", ACL_COMPLEX64}, {"complex128", ACL_COMPLEX128},
+    {"float8_e4m3fn", ACL_FLOAT8_E4M3FN}, {"float8_e5m2", ACL_FLOAT8_E5M2}, {"float8_e8m0", ACL_FLOAT8_E8M0},
+    {"hifloat8", ACL_HIFLOAT8},
+};
+
+static const std::unordered_map<std::string, aclFormat> INI_FORMAT_MAP = {
+    {"nd", ACL_FORMAT_ND},           {"nchw", ACL_FORMAT_NCHW},         {"nhwc", ACL_FORMAT_NHWC},
+    {"nc1hwc0", ACL_FORMAT_NC1HWC0}, {"fractal_z", ACL_FORMAT_FRACTAL_Z}, {"fractal_nz", ACL_FORMAT_FRACTAL_NZ},
+    {"ncdhw", ACL_FORMAT_NCDHW},     {"ndc1hwc0", ACL_FORMAT_NDC1HWC0},
+};
+
+static std::string Trim(const std::string &str)
+{
+    size_t begin = str.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) {
+        return "";
+    }
+    size_t end = str.find_last_not_of(" \t\r");
+    return str.substr(begin, end - begin + 1);
+}
+
+static std::vector<std::string> SplitValue(const std::string &value)
+{
+    std::vector<std::string> items;
+    size_t begin = 0;
+    while (begin <= value.size()) {
+        size_t end = value.find(',', begin);
+        if (end == std::string::npos) {
+            end = value.size();
+        }
+        items.push_back(Trim(value.substr(begin, end - begin)));
+        begin = end + 1;
+    }
+    return items;
+}
+
+template <typename ValueType>
+static bool ParseValueList(const std::string &value, const std::unordered_map<std::string, ValueType> &valueMap,
+                           std::vector<ValueType> &values)
+{
+    for (const std::string &item : SplitValue(value)) {
+        auto it = valueMap.find(item);
+        if (it == valueMap.end()) {
+            ATB_LOG(ERROR) << "customize ops info ini has unknown value: " << item;
+            return false;
+        }
+        values.push_back(it->second);
+    }
+    return true;
+}
 CustomizeOperationIrCfg::CustomizeOperationIrCfg()
 {
     InitOperationIrCfg();
@@ -26,18 +81,139 @@ CustomizeOperationIrCfg::~CustomizeOperationIrCfg() {}
 
 void CustomizeOperationIrCfg::InitOperationIrCfg()
 {
-    std::string iniFilePath =
-        GetSingleton<Config>().GetAtbHomePath() + "/configs/customize_ops_configs/customize_ops_info.ini";
-    Mki::Status status = opIrCfg_.Load(iniFilePath);
-    if (!status.Ok()) {
-        ATB_LOG(ERROR) << "Load customize_ops_info.ini failed!";
-        return;
+    operationIrs_ = GetCustomizeOperationIrs(operationIrNum_);
+    ATB_LOG(INFO) << "Init customize operation ir success, operation ir num: " << operationIrNum_;
+}
+
+const OperationIr *CustomizeOperationIrCfg::GetOperationIr(const std::string &opKey)
+{
+    const OperationIr *operationIr = FindOperationIr(operationIrs_, operationIrNum_, opKey);
+    if (operationIr != nullptr) {
+        return operationIr;
+    }
+    std::call_once(loadIniFlag_, [this]() { LoadIniFile(); });
+    auto it = loadedOperationIrs_.find(opKey);
+    return it == loadedOperationIrs_.end() ? nullptr : &it->second->operationIr;
+}
+
+bool CustomizeOperationIrCfg::BuildLoadedOperationIr(LoadedOperationIr &loadedIr)
+{
+    size_t supportSize = 0;
+    for (auto *tensors : {&loadedIr.inTensors, &loadedIr.outTensors}) {
+        for (LoadedTensorInfoIr &tensor : *tensors) {
+            if (tensor.dtypes.size() != tensor.formats.size() || tensor.dtypes.empty() ||
+                tensor.dtypes.size() > MAX_OPERATION_IR_SUPPORT_SIZE ||
+                (supportSize != 0 && tensor.dtypes.size() != supportSize)) {
+                ATB_LOG(ERROR) << "customize operation " << loadedIr.opKey << " dtype or format size is invalid";
+                return false;
+            }
+            supportSize = tensor.dtypes.size();
+            for (size_t i = 0; i < supportSize; ++i) {
+                aclDataType dtype = tensor.dtypes[i];
+                aclFormat format = tensor.formats[i];
+                auto dtypeIt = std::find_if(tensor.dtypeMasks.begin(), tensor.dtypeMasks.end(),
+                                            [dtype](const IrDtypeMask &mask) { return mask.dtype == dtype; });
+                if (dtypeIt == tensor.dtypeMasks.end()) {
+                    dtypeIt = tensor.dtypeMasks.insert(dtypeIt, {dtype, 0});
+                }
+                dtypeIt->supportMask |= (1ULL << i);
+                auto formatIt = std::find_if(tensor.formatMasks.begin(), tensor.formatMasks.end(),
+                                             [format](const IrFormatMask &mask) { return mask.format == format; });
+                if (formatIt == tensor.formatMasks.end()) {
+                    formatIt = tensor.formatMasks.insert(formatIt, {format, 0});
+                }
+                formatIt->supportMask |= (1ULL << i);
+            }
+        }
     }
-    ATB_LOG(INFO) << "Load customize_ops_info.ini success!";
+    auto toTensorInfoIr = [](const LoadedTensorInfoIr &tensor) {
+        return TensorInfoIr{tensor.name.c_str(),
+                            tensor.isOptional,
+                            tensor.dtypes.data(),
+                            tensor.formats.data(),
+                            tensor.dtypeMasks.data(),
+                            static_cast<uint32_t>(tensor.dtypeMasks.size()),
+                            tensor.formatMasks.data(),
+                            static_cast<uint32_t>(tensor.formatMasks.size())};
+    };
+    for (const LoadedTensorInfoIr &tensor : loadedIr.inTensors) {
+        loadedIr.inTensorInfoIrs.push_back(toTensorInfoIr(tensor));
+    }
+    for (const LoadedTensorInfoIr &tensor : loadedIr.outTensors) {
+        loadedIr.outTensorInfoIrs.push_back(toTensorInfoIr(tensor));
+    }
+    loadedIr.operationIr = {loadedIr.opKey.c_str(),
+                            static_cast<uint32_t>(supportSize),
+                            loadedIr.inTensorInfoIrs.empty() ? nullptr : loadedIr.inTensorInfoIrs.data(),
+                            static_cast<uint32_t>(loadedIr.inTensorInfoIrs.size()),
+                            loadedIr.outTensorInfoIrs.empty() ? nullptr : loadedIr.outTensorInfoIrs.data(),
+                            static_cast<uint32_t>(loadedIr.outTensorInfoIrs.size())};
+    return true;
 }
 
-Mki::OperationIr *CustomizeOperationIrCfg::GetOperationIr(const std::string &opKey)
+void CustomizeOperationIrCfg::LoadIniFile()
 {
-    return opIrCfg_.GetOperationIr(opKey);
+    std::string iniFilePath =
+        GetSingleton<Config>().GetAtbHomePath() + "/configs/customize_ops_configs/customize_ops_info.ini";
+    std::ifstream ifs(iniFilePath);
+    if (!ifs.is_open()) {
+        ATB_LOG(WARN) << "open " << iniFilePath << " fail";
+        return;
+    }
+    std::vector<std::unique_ptr<LoadedOperationIr>> loadedIrs;
+    std::string line;
+    while (std::getline(ifs, line)) {
+        line = Trim(line);
+        if (line.empty() || line[0] == '#' || line[0] == ';') {
+            continue;
+        }
+        if (line.front() == '[' && line.back() == ']') {
+            loadedIrs.push_back(std::make_unique<LoadedOperationIr>());
+            loadedIrs.back()->opKey = Trim(line.substr(1, line.size() - 2));
+            continue;
+        }
+        size_t eqPos = line.find('=');
+        size_t dotPos = line.find('.');
+        if (loadedIrs.empty() || eqPos == std::string::npos || dotPos == std::string::npos || dotPos > eqPos) {
+            ATB_LOG(ERROR) << "customize ops info ini has invalid line: " << line;
+            return;
+        }
+        std::string tensorKey = Trim(line.substr(0, dotPos));
+        std::string field = Trim(line.substr(dotPos + 1, eqPos - dotPos - 1));
+        std::string value = Trim(line.substr(eqPos + 1));
+        bool isInput = tensorKey.compare(0, strlen("input"), "input") == 0;
+        std::string indexStr = tensorKey.substr(isInput ? strlen("input") : strlen("output"));
+        if ((!isInput && tensorKey.compare(0, strlen("output"), "output") != 0) || indexStr.empty() ||
+            indexStr.find_first_not_of("0123456789") != std::string::npos) {
+            ATB_LOG(ERROR) << "customize ops info ini has invalid key: " << tensorKey;
+            return;
+        }
+        size_t index = std::stoul(indexStr);
+        std::vector<LoadedTensorInfoIr> &tensors = isInput ? loadedIrs.back()->inTensors : loadedIrs.back()->outTensors;
+        if (index >= tensors.size()) {
+            tensors.resize(index + 1);
+        }
+        LoadedTensorInfoIr &tensor = tensors.at(index);
+        bool ret = true;
+        if (field == "name") {
+            tensor.name = value;
+        } else if (field == "optional") {
+            tensor.isOptional = (value == "true");
+        } else if (field == "dtype") {
+            ret = ParseValueList(value, INI_DTYPE_MAP, tensor.dtypes);
+        } else if (field == "format") {
+            ret = ParseValueList(value, INI_FORMAT_MAP, tensor.formats);
+        }
+        if (!ret) {
+            return;
+        }
+    }
+    for (auto &loadedIr : loadedIrs) {
+        if (BuildLoadedOperationIr(*loadedIr)) {
+            std::string opKey = loadedIr->opKey;
+            loadedOperationIrs_[opKey] = std::move(loadedIr);
+        }
+    }
+    ATB_LOG(INFO) << "Load " << iniFilePath << " success, operation ir num: " << loadedOperationIrs_.size();
 }
 } //  namespace atb
\ No newline at end of file
@@ -10,22 +10,48 @@
 #ifndef CUSTOMIZE_INI_CFG_MGMT_H
 #define CUSTOMIZE_INI_CFG_MGMT_H
 
+#include <memory>
+#include <mutex>
 #include <string>
-#include "mki/utils/operationir/operation_ir.h"
-#include "mki/utils/operationir/operation_ir_cfg.h"
+#include <unordered_map>
+#include <vector>
+#include "atb/operation/operation_ir.h"
 
 namespace atb {
+// customize_ops_info.ini在编译期生成为常量表；
+// 单独编译的自定义算子不在常量表中，首次查不到时才解析安装目录下的ini作为兜底
 class CustomizeOperationIrCfg {
 public:
     CustomizeOperationIrCfg();
     ~CustomizeOperationIrCfg();
-    Mki::OperationIr *GetOperationIr(const std::string &opKey);
+    const OperationIr *GetOperationIr(const std::string &opKey);
 
 private:
+    struct LoadedTensorInfoIr {
+        std::string name;
+        bool isOptional = false;
+        std::vector<aclDataType> dtypes;
+        std::vector<aclFormat> formats;
+        std::vector<IrDtypeMask> dtypeMasks;
+        std::vector<IrFormatMask> formatMasks;
+    };
+    struct LoadedOperationIr {
+        std::string opKey;
+        std::vector<LoadedTensorInfoIr> inTensors;
+        std::vector<LoadedTensorInfoIr> outTensors;
+        std::vector<TensorInfoIr> inTensorInfoIrs;
+        std::vector<TensorInfoIr> outTensorInfoIrs;
+        OperationIr operationIr = {};
+    };
     void InitOperationIrCfg();
+    void LoadIniFile();
+    static bool BuildLoadedOperationIr(LoadedOperationIr &loadedIr);
 
 private:
-    Mki::OperationIrCfg opIrCfg_;
+    const OperationIr *operationIrs_ = nullptr;
+    size_t operationIrNum_ = 0;
+    std::once_flag loadIniFlag_;
+    std::unordered_map<std::string, std::unique_ptr<LoadedOperationIr>> loadedOperationIrs_;
 };
 } //  namespace atb
 #endif
@@ -282,6 +282,12 @@ Status GraphOperation::InferShapeImpl(const SVector<TensorDesc> &inTensorDescs,
     return InferShapeImplDefault(inTensorDescs, outTensorDescs);
 }
 
+// 节点Operation的参数可被单独更新，图的推导结果不能只按图自身的参数缓存，由各节点Operation分别缓存
+bool GraphOperation::IsInferShapeCacheable() const
+{
+    return false;
+}
+
 std::shared_ptr<Runner> GraphOperation::CreateRunner(Context &context) const
 {
     std::shared_ptr<GraphRunner> runner = std::make_shared<GraphRunner>(GetName() + "Runner");
@@ -578,6 +584,11 @@ void GraphOperation::GetGraphInfoImpl(nlohmann::json &graphJson) const
     }
 }
 
+const GraphParam &GraphOperation::GetGraphParam() const
+{
+    return opGraph_;
+}
+
 void GraphOperation::SetExecuteStreamId(uint32_t streamId)
 {
     streamId_ = streamId;
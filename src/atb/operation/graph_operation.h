@@ -28,9 +28,11 @@ public:
     uint32_t GetInputNum() const override;
     uint32_t GetOutputNum() const override;
     void SetExecuteStreamId(uint32_t streamId) override;
+    const GraphParam &GetGraphParam() const;
 
 protected:
     Status InferShapeImpl(const SVector<TensorDesc> &inTensorDescs, SVector<TensorDesc> &outTensorDescs) const override;
+    bool IsInferShapeCacheable() const override;
     std::shared_ptr<Runner> CreateRunner(Context &context) const override;
     Status SetNodeOperationIds() override;
     void InitEmptyInTensorPerms();
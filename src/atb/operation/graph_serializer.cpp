@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/operation/graph_serializer.h"
+#include <fstream>
+#include <typeinfo>
+#include <vector>
+#include "atb/operation.h"
+#include "atb/infer_op_params.h"
+#include "atb/common_op_params.h"
+#include "atb/operation/graph_operation.h"
+#include "atb/utils/common_utils.h"
+#include "atb/utils/log.h"
+#include "atb/utils/param_from_json.h"
+#include "atb/utils/param_to_json.h"
+#include "atb/utils/reshape_spec.h"
+
+namespace atb {
+static const std::string GRAPH_FORMAT_NAME = "atb_graph";
+static const std::string GRAPH_PARAM_TYPE = "GraphParam";
+static constexpr int JSON_INDENT = 4;
+// 进程内句柄，保存时置0，加载后保持为空
+static const std::vector<std::string> PROCESS_LOCAL_HANDLE_KEYS = {"hcclComm", "event"};
+
+using CreateNodeOperationFunc = Status (*)(const nlohmann::json &paramJson, Operation **operation);
+using ParamJsonRoundTripFunc = nlohmann::json (*)(const nlohmann::json &paramJson);
+
+struct NodeOpCreator {
+    const char *paramType;
+    const char *opName;
+    CreateNodeOperationFunc createFunc;
+    ParamJsonRoundTripFunc roundTripFunc;
+};
+
+// 参数值初始化，EventParam::event等没有默认值的进程内句柄加载后为空
+template <typename OpParam> static Status CreateNodeOperation(const nlohmann::json &paramJson, Operation **operation)
+{
+    OpParam opParam{};
+    OpParamFromJson(paramJson, opParam);
+    return CreateOperation(opParam, operation);
+}
+
+template <typename OpParam> static nlohmann::json ParamJsonRoundTrip(const nlohmann::json &paramJson)
+{
+    OpParam opParam{};
+    OpParamFromJson(paramJson, opParam);
+    return OpParamToJson(opParam);
+}
+
+#define NODE_OP_CREATOR(OpParamType, opName)                                                                           \
+    {                                                                                                                  \
+        #OpParamType, opName, CreateNodeOperation<OpParamType>, ParamJsonRoundTrip<OpParamType>                        \
+    }
+
+// train算子编译在libatb_train中，不在此注册
+static const std::vector<NodeOpCreator> &GetNodeOpCreators()
+{
+    static const std::vector<NodeOpCreator> creators = {
+        NODE_OP_CREATOR(infer::ActivationParam, "ActivationOperation"),
+        NODE_OP_CREATOR(infer::AllGatherParam, "AllGatherOperation"),
+        NODE_OP_CREATOR(infer::AllGatherVParam, "AllGatherVOperation"),
+        NODE_OP_CREATOR(infer::AllReduceParam, "AllReduceOperation"),
+        NODE_OP_CREATOR(infer::AsStridedParam, "AsStridedOperation"),
+        NODE_OP_CREATOR(infer::BroadcastParam, "BroadcastOperation"),
+        NODE_OP_CREATOR(infer::ReduceScatterParam, "ReduceScatterOperation"),
+        NODE_OP_CREATOR(infer::ReduceScatterVParam, "ReduceScatterVOperation"),
+        NODE_OP_CREATOR(infer::ConcatParam, "ConcatOperation"),
+        NODE_OP_CREATOR(infer::CumsumParam, "CumsumOperation"),
+        NODE_OP_CREATOR(infer::DynamicNTKParam, "DynamicNTKOperation"),
+        NODE_OP_CREATOR(infer::ElewiseParam, "ElewiseOperation"),
+        NODE_OP_CREATOR(infer::FillParam, "FillOperation"),
+        NODE_OP_CREATOR(infer::GatherParam, "GatherOperation"),
+        NODE_OP_CREATOR(infer::GroupedMatmulInplaceAddParam, "GroupedMatmulInplaceAddOperation"),
+        NODE_OP_CREATOR(infer::LayerNormParam, "LayerNormOperation"),
+        NODE_OP_CREATOR(infer::LayerNormWithStrideParam, "LayerNormWithStrideOperation"),
+        NODE_OP_CREATOR(infer::LinearParam, "LinearOperation"),
+        NODE_OP_CREATOR(infer::LinearParallelParam, "LinearParallelOperation"),
+        NODE_OP_CREATOR(infer::LinearSparseParam, "LinearSparseOperation"),
+        NODE_OP_CREATOR(infer::SwigluQuantParam, "SwigluQuantOperation"),
+        NODE_OP_CREATOR(infer::MultinomialParam, "MultinomialOperation"),
+        NODE_OP_CREATOR(infer::OnehotParam, "OnehotOperation"),
+        NODE_OP_CREATOR(infer::IndexAddParam, "IndexAddOperation"),
+        NODE_OP_CREATOR(infer::PagedAttentionParam, "PagedAttentionOperation"),
+        NODE_OP_CREATOR(infer::ReduceParam, "ReduceOperation"),
+        NODE_OP_CREATOR(infer::RelayAttentionParam, "RelayAttentionOperation"),
+        NODE_OP_CREATOR(infer::RepeatParam, "RepeatOperation"),
+        NODE_OP_CREATOR(infer::RmsNormParam, "RmsNormOperation"),
+        NODE_OP_CREATOR(infer::RmsNormWithStrideParam, "RmsNormOperation"),
+        NODE_OP_CREATOR(infer::RopeParam, "RopeOperation"),
+        NODE_OP_CREATOR(infer::SelfAttentionParam, "SelfAttentionOperation"),
+        NODE_OP_CREATOR(infer::SetValueParam, "SetValueOperation"),
+        NODE_OP_CREATOR(infer::SliceParam, "SliceOperation"),
+        NODE_OP_CREATOR(infer::SoftmaxParam, "SoftmaxOperation"),
+        NODE_OP_CREATOR(infer::SortParam, "SortOperation"),
+        NODE_OP_CREATOR(infer::SplitParam, "SplitOperation"),
+        NODE_OP_CREATOR(infer::TopkToppSamplingParam, "TopkToppSamplingOperation"),
+        NODE_OP_CREATOR(infer::TransdataParam, "TransdataOperation"),
+        NODE_OP_CREATOR(infer::TransposeParam, "TransposeOperation"),
+        NODE_OP_CREATOR(infer::ReshapeAndCacheParam, "ReshapeAndCacheOperation"),
+        NODE_OP_CREATOR(infer::GatingParam, "GatingOperation"),
+        NODE_OP_CREATOR(infer::SendParam, "SendOperation"),
+        NODE_OP_CREATOR(infer::RecvParam, "RecvOperation"),
+        NODE_OP_CREATOR(infer::AllToAllParam, "AllToAllOperation"),
+        NODE_OP_CREATOR(infer::AllToAllVParam, "AllToAllVOperation"),
+        NODE_OP_CREATOR(infer::AllToAllVV2Param, "AllToAllVV2Operation"),
+        NODE_OP_CREATOR(infer::GroupTopkParam, "GroupTopkOperation"),
+        NODE_OP_CREATOR(infer::GroupedMatmulWithRoutingParam, "GroupedMatmulWithRoutingOperation"),
+        NODE_OP_CREATOR(infer::CohereLayerNormParam, "CohereLayerNormOperation"),
+        NODE_OP_CREATOR(infer::GatherPreRmsNormParam, "GatherPreRmsNormOperation"),
+        NODE_OP_CREATOR(infer::MlaPreprocessParam, "MlaPreprocessOperation"),
+        NODE_OP_CREATOR(infer::MultiLatentAttentionParam, "MultiLatentAttentionOperation"),
+        NODE_OP_CREATOR(common::EventParam, "EventOperation"),
+        NODE_OP_CREATOR(infer::NormRopeReshapeParam, "NormRopeReshapeOperation"),
+        NODE_OP_CREATOR(infer::RopeQConcatParam, "RopeQConcatOperation"),
+        NODE_OP_CREATOR(infer::FusedAddTopkDivParam, "FusedAddTopkDivOperation"),
+        NODE_OP_CREATOR(infer::ReshapeAndCacheWithStrideParam, "ReshapeAndCacheWithStrideOperation"),
+        NODE_OP_CREATOR(infer::RazorFusionAttentionParam, "RazorFusionAttentionOperation"),
+        NODE_OP_CREATOR(infer::FaUpdateParam, "FaUpdateOperation"),
+        NODE_OP_CREATOR(infer::ScatterElementsV2Param, "ScatterElementsV2Operation"),
+        NODE_OP_CREATOR(infer::GmmDeqSwigluQuantGmmDeqParam, "GmmDeqSwigluQuantGmmDeqOperation"),
+        NODE_OP_CREATOR(infer::MmDeqSwigluQuantMmDeqParam, "MmDeqSwigluQuantMmDeqOperation"),
+        NODE_OP_CREATOR(infer::RingMLAParam, "RingMLAOperation"),
+    };
+    return creators;
+}
+
+static const NodeOpCreator *FindCreatorByParamType(const std::string &paramType)
+{
+    for (const NodeOpCreator &creator : GetNodeOpCreators()) {
+        if (paramType == creator.paramType) {
+            return &creator;
+        }
+    }
+    return nullptr;
+}
+
+// 不同参数类型的算子可能同名且参数字段相同（如RmsNormWithStrideParam与RmsNormParam），
+// 同名时按各候选参数类型创建算子，取与原算子实现类相同的一个
+static const NodeOpCreator *FindCreatorByOperation(const OperationBase &opBase, const nlohmann::json &paramJson)
+{
+    std::vector<const NodeOpCreator *> candidates;
+    for (const NodeOpCreator &creator : GetNodeOpCreators()) {
+        if (opBase.GetName() == creator.opName) {
+            candidates.push_back(&creator);
+        }
+    }
+    if (candidates.size() <= 1) {
+        return candidates.empty() ? nullptr : candidates.at(0);
+    }
+    for (const NodeOpCreator *creator : candidates) {
+        Operation *probeOperation = nullptr;
+        try {
+            if (creator->createFunc(paramJson, &probeOperation) != NO_ERROR) {
+                continue;
+            }
+        } catch (const std::exception &e) {
+            ATB_LOG(DEBUG) << opBase.GetName() << " param does not match " << creator->paramType << ", " << e.what();
+            continue;
+        }
+        bool isSameType = typeid(*probeOperation) == typeid(opBase);
+        DestroyOperation(probeOperation);
+        if (isSameType) {
+            return creator;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<std::string> GraphSerializer::GetSupportedParamTypes()
+{
+    std::vector<std::string> paramTypes;
+    for (const NodeOpCreator &creator : GetNodeOpCreators()) {
+        paramTypes.push_back(creator.paramType);
+    }
+    return paramTypes;
+}
+
+Status GraphSerializer::ParamJsonRoundTrip(const std::string &paramType, const nlohmann::json &paramJson,
+                                           nlohmann::json &resultJson)
+{
+    const NodeOpCreator *creator = FindCreatorByParamType(paramType);
+    if (creator == nullptr) {
+        ATB_LOG(ERROR) << "unsupported paramType: " << paramType;
+        return ERROR_INVALID_PARAM;
+    }
+    try {
+        resultJson = creator->roundTripFunc(paramJson);
+    } catch (const std::exception &e) {
+        ATB_LOG(ERROR) << paramType << " param json is invalid, " << e.what();
+        return ERROR_INVALID_PARAM;
+    }
+    return NO_ERROR;
+}
+
+template <typename T> static void JsonToSVector(const nlohmann::json &json, SVector<T> &svector)
+{
+    std::vector<T> vec = json.get<std::vector<T>>();
+    svector.resize(vec.size());
+    for (size_t i = 0; i < vec.size(); ++i) {
+        svector.at(i) = vec.at(i);
+    }
+}
+
+Status GraphSerializer::NodeToJson(const Node &node, nlohmann::json &nodeJson)
+{
+    const OperationBase *opBase = dynamic_cast<const OperationBase *>(node.operation);
+    if (opBase == nullptr) {
+        ATB_LOG(ERROR) << "node operation is null or not an atb operation, can not serialize";
+        return ERROR_INVALID_PARAM;
+    }
+    nodeJson["streamId"] = opBase->GetExecuteStreamId();
+    const GraphOperation *graphOp = dynamic_cast<const GraphOperation *>(opBase);
+    if (graphOp != nullptr) {
+        nodeJson["paramType"] = GRAPH_PARAM_TYPE;
+        Status st = GraphParamToJson(graphOp->GetGraphParam(), nodeJson["graph"]);
+        if (st != NO_ERROR) {
+            return st;
+        }
+    } else {
+        nlohmann::json paramJson = opBase->GetParamJson();
+        const NodeOpCreator *creator = FindCreatorByOperation(*opBase, paramJson);
+        if (creator == nullptr) {
+            ATB_LOG(ERROR) << opBase->GetName() << " does not support graph serialization";
+            return ERROR_INVALID_PARAM;
+        }
+        for (const std::string &key : PROCESS_LOCAL_HANDLE_KEYS) {
+            auto it = paramJson.find(key);
+            if (it != paramJson.end() && *it != 0) {
+                ATB_LOG(WARN) << opBase->GetName() << " param " << key
+                              << " is a process local handle and will not be saved";
+                *it = 0;
+            }
+        }
+        // 加载时按json重建参数，重建结果与保存内容不一致说明有字段无法还原，拒绝保存
+        if (creator->roundTripFunc(paramJson) != paramJson) {
+            ATB_LOG(ERROR) << opBase->GetName() << " param of " << creator->paramType
+                           << " can not be saved without loss: " << paramJson.dump();
+            return ERROR_INVALID_PARAM;
+        }
+        nodeJson["paramType"] = creator->paramType;
+        nodeJson["param"] = paramJson;
+    }
+    nodeJson["inTensorIds"] = SVectorToVector(node.inTensorIds);
+    nodeJson["outTensorIds"] = SVectorToVector(node.outTensorIds);
+
+    nlohmann::json reshapesJson = nlohmann::json::array();
+    for (size_t i = 0; i < node.inTensorReshapeFuncs.size(); ++i) {
+        const ReshapeFunc &reshapeFunc = node.inTensorReshapeFuncs.at(i);
+        if (!reshapeFunc) {
+            reshapesJson.push_back(nullptr);
+            continue;
+        }
+        const ReshapeSpec *reshapeSpec = ReshapeSpec::FromReshapeFunc(reshapeFunc);
+        if (reshapeSpec == nullptr) {
+            ATB_LOG(ERROR) << opBase->GetName() << " inTensorReshapeFuncs[" << i
+                           << "] is not created by ReshapeSpec, can not serialize";
+            return ERROR_INVALID_PARAM;
+        }
+        reshapesJson.push_back(reshapeSpec->ToJson());
+    }
+    nodeJson["inTensorReshapes"] = reshapesJson;
+
+    nlohmann::json chunksJson = nlohmann::json::array();
+    for (const Chunk &chunk : node.inTensorChunks) {
+        chunksJson.push_back({{"chunkNum", chunk.chunkNum}, {"chunkIndex", chunk.chunkIndex}});
+    }
+    nodeJson["inTensorChunks"] = chunksJson;
+    return NO_ERROR;
+}
+
+Status GraphSerializer::GraphParamToJson(const GraphParam &graphParam, nlohmann::json &graphJson)
+{
+    if (graphParam.inferShapeFunc) {
+        ATB_LOG(ERROR) << "graph " << graphParam.name << " has inferShapeFunc, can not serialize";
+        return ERROR_INVALID_PARAM;
+    }
+    graphJson["name"] = graphParam.name;
+    graphJson["inTensorNum"] = graphParam.inTensorNum;
+    graphJson["outTensorNum"] = graphParam.outTensorNum;
+    graphJson["internalTensorNum"] = graphParam.internalTensorNum;
+    nlohmann::json nodesJson = nlohmann::json::array();
+    for (size_t i = 0; i < graphParam.nodes.size(); ++i) {
+        nlohmann::json nodeJson;
+        Status st = NodeToJson(graphParam.nodes.at(i), nodeJson);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << "graph " << graphParam.name << " node[" << i << "] serialize fail";
+            return st;
+        }
+        nodesJson.push_back(std::move(nodeJson));
+    }
+    graphJson["nodes"] = std::move(nodesJson);
+    return NO_ERROR;
+}
+
+Status GraphSerializer::NodeFromJson(const nlohmann::json &nodeJson, Node &node)
+{
+    // 先解析完所有字段再创建operation，解析抛出异常时不会泄漏operation
+    JsonToSVector(nodeJson.at("inTensorIds"), node.inTensorIds);
+    JsonToSVector(nodeJson.at("outTensorIds"), node.outTensorIds);
+    const nlohmann::json &reshapesJson = nodeJson.at("inTensorReshapes");
+    node.inTensorReshapeFuncs.resize(reshapesJson.size());
+    for (size_t i = 0; i < reshapesJson.size(); ++i) {
+        const nlohmann::json &specJson = reshapesJson.at(i);
+        if (!specJson.is_null()) {
+            node.inTensorReshapeFuncs.at(i) = ReshapeSpec::FromJson(specJson).ToReshapeFunc();
+        }
+    }
+    const nlohmann::json &chunksJson = nodeJson.at("inTensorChunks");
+    node.inTensorChunks.resize(chunksJson.size());
+    for (size_t i = 0; i < chunksJson.size(); ++i) {
+        node.inTensorChunks.at(i).chunkNum = chunksJson.at(i).at("chunkNum").get<uint32_t>();
+        node.inTensorChunks.at(i).chunkIndex = chunksJson.at(i).at("chunkIndex").get<uint32_t>();
+    }
+    uint32_t streamId = nodeJson.at("streamId").get<uint32_t>();
+    std::string paramType = nodeJson.at("paramType").get<std::string>();
+
+    Status st = NO_ERROR;
+    if (paramType == GRAPH_PARAM_TYPE) {
+        GraphParam subGraphParam;
+        st = GraphParamFromJson(nodeJson.at("graph"), subGraphParam);
+        if (st == NO_ERROR) {
+            st = CreateOperation(subGraphParam, &node.operation);
+            if (st != NO_ERROR) {
+                DestroyNodeOperations(subGraphParam);
+            }
+        }
+    } else {
+        const NodeOpCreator *creator = FindCreatorByParamType(paramType);
+        if (creator == nullptr) {
+            ATB_LOG(ERROR) << "unsupported node paramType: " << paramType;
+            return ERROR_INVALID_PARAM;
+        }
+        st = creator->createFunc(nodeJson.at("param"), &node.operation);
+    }
+    if (st != NO_ERROR) {
+        ATB_LOG(ERROR) << "create node operation of " << paramType << " fail, error: " << st;
+        node.operation = nullptr;
+        return st;
+    }
+    if (streamId != 0) {
+        SetExecuteStreamId(node.operation, streamId);
+    }
+    return NO_ERROR;
+}
+
+Status GraphSerializer::GraphParamFromJson(const nlohmann::json &graphJson, GraphParam &graphParam)
+{
+    try {
+        graphParam.name = graphJson.at("name").get<std::string>();
+        graphParam.inTensorNum = graphJson.at("inTensorNum").get<uint32_t>();
+        graphParam.outTensorNum = graphJson.at("outTensorNum").get<uint32_t>();
+        graphParam.internalTensorNum = graphJson.at("internalTensorNum").get<uint32_t>();
+        const nlohmann::json &nodesJson = graphJson.at("nodes");
+        graphParam.nodes.resize(nodesJson.size());
+        for (size_t i = 0; i < nodesJson.size(); ++i) {
+            Status st = NodeFromJson(nodesJson.at(i), graphParam.nodes.at(i));
+            if (st != NO_ERROR) {
+                ATB_LOG(ERROR) << "graph " << graphParam.name << " node[" << i << "] deserialize fail";
+                DestroyNodeOperations(graphParam);
+                return st;
+            }
+        }
+    } catch (const std::exception &e) {
+        ATB_LOG(ERROR) << "graph " << graphParam.name << " deserialize fail, " << e.what();
+        DestroyNodeOperations(graphParam);
+        return ERROR_INVALID_PARAM;
+    }
+    return NO_ERROR;
+}
+
+void GraphSerializer::DestroyNodeOperations(GraphParam &graphParam)
+{
+    for (Node &node : graphParam.nodes) {
+        if (node.operation != nullptr) {
+            DestroyOperation(node.operation);
+            node.operation = nullptr;
+        }
+    }
+}
+
+Status GraphSerializer::Save(const GraphParam &graphParam, uint32_t streamId, const std::string &filePath)
+{
+    nlohmann::json fileJson;
+    fileJson["format"] = GRAPH_FORMAT_NAME;
+    fileJson["version"] = FORMAT_VERSION;
+    fileJson["streamId"] = streamId;
+    Status st = GraphParamToJson(graphParam, fileJson["graph"]);
+    if (st != NO_ERROR) {
+        return st;
+    }
+    std::ofstream ofs(filePath, std::ios::out | std::ios::trunc);
+    if (!ofs.is_open()) {
+        ATB_LOG(ERROR) << "open graph file fail, filePath: " << filePath;
+        return ERROR_INVALID_PARAM;
+    }
+    ofs << fileJson.dump(JSON_INDENT);
+    if (!ofs.good()) {
+        ATB_LOG(ERROR) << "write graph file fail, filePath: " << filePath;
+        return ERROR_INTERNAL_ERROR;
+    }
+    ATB_LOG(INFO) << "save graph " << graphParam.name << " to " << filePath << ", nodeNum: " << graphParam.nodes.size();
+    return NO_ERROR;
+}
+
+Status GraphSerializer::Load(const std::string &filePath, Operation **operation)
+{
+    if (operation == nullptr) {
+        ATB_LOG(ERROR) << "invalid param, operation is null";
+        return ERROR_INVALID_PARAM;
+    }
+    std::ifstream ifs(filePath);
+    if (!ifs.is_open()) {
+        ATB_LOG(ERROR) << "open graph file fail, filePath: " << filePath;
+        return ERROR_INVALID_PARAM;
+    }
+    nlohmann::json fileJson = nlohmann::json::parse(ifs, nullptr, false);
+    if (fileJson.is_discarded() || !fileJson.is_object()) {
+        ATB_LOG(ERROR) << "graph file is not a valid json, filePath: " << filePath;
+        return ERROR_INVALID_PARAM;
+    }
+    if (fileJson.value("format", std::string()) != GRAPH_FORMAT_NAME || !fileJson.contains("graph")) {
+        ATB_LOG(ERROR) << "graph file format is not " << GRAPH_FORMAT_NAME << ", filePath: " << filePath;
+        return ERROR_INVALID_PARAM;
+    }
+    const nlohmann::json &versionJson = fileJson["version"];
+    if (!versionJson.is_number_unsigned() || versionJson.get<uint32_t>() == 0 ||
+        versionJson.get<uint32_t>() > FORMAT_VERSION) {
+        ATB_LOG(ERROR) << "graph file version " << versionJson.dump() << " is not supported, current version is "
+                       << FORMAT_VERSION << ", filePath: " << filePath;
+        return ERROR_INVALID_PARAM;
+    }
+
+    GraphParam graphParam;
+    Status st = GraphParamFromJson(fileJson["graph"], graphParam);
+    if (st != NO_ERROR) {
+        return st;
+    }
+    st = CreateOperation(graphParam, operation);
+    if (st != NO_ERROR) {
+        DestroyNodeOperations(graphParam);
+        return st;
+    }
+    const nlohmann::json &streamIdJson = fileJson["streamId"];
+    if (streamIdJson.is_number_unsigned() && streamIdJson.get<uint32_t>() != 0) {
+        SetExecuteStreamId(*operation, streamIdJson.get<uint32_t>());
+    }
+    ATB_LOG(INFO) << "load graph " << graphParam.name << " from " << filePath
+                  << ", nodeNum: " << graphParam.nodes.size();
+    return NO_ERROR;
+}
+
+Status SaveGraphOperation(const Operation *operation, const std::string &filePath)
+{
+    const GraphOperation *graphOp = dynamic_cast<const GraphOperation *>(operation);
+    if (graphOp == nullptr) {
+        ATB_LOG(ERROR) << "invalid param, operation is not a graph operation";
+        return ERROR_INVALID_PARAM;
+    }
+    return GraphSerializer::Save(graphOp->GetGraphParam(), graphOp->GetExecuteStreamId(), filePath);
+}
+
+Status LoadGraphOperation(const std::string &filePath, Operation **operation)
+{
+    return GraphSerializer::Load(filePath, operation);
+}
+} // namespace atb
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_GRAPH_SERIALIZER_H
+#define ATB_GRAPH_SERIALIZER_H
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "atb/types.h"
+
+namespace atb {
+// 图算子的版本化序列化格式：
+// {"format": "atb_graph", "version": 1, "streamId": 0, "graph": {name, inTensorNum, outTensorNum,
+//  internalTensorNum, nodes: [{paramType, param | graph, streamId, inTensorIds, outTensorIds,
+//  inTensorReshapes, inTensorChunks}]}}
+// paramType为算子参数类型名（如"infer::ElewiseParam"），嵌套图算子为"GraphParam"。
+// reshape函数只支持由ReshapeSpec生成的声明式规则，inferShapeFunc与插件算子无法序列化。
+class GraphSerializer {
+public:
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    static Status GraphParamToJson(const GraphParam &graphParam, nlohmann::json &graphJson);
+    // 按json创建所有节点的operation，成功时由调用方负责销毁节点operation
+    static Status GraphParamFromJson(const nlohmann::json &graphJson, GraphParam &graphParam);
+    static Status Save(const GraphParam &graphParam, uint32_t streamId, const std::string &filePath);
+    static Status Load(const std::string &filePath, Operation **operation);
+    static std::vector<std::string> GetSupportedParamTypes();
+    // 按paramType将json解析为参数后重新转为json，保存时据此校验参数能否无损还原
+    static Status ParamJsonRoundTrip(const std::string &paramType, const nlohmann::json &paramJson,
+                                     nlohmann::json &resultJson);
+
+private:
+    static Status NodeToJson(const Node &node, nlohmann::json &nodeJson);
+    static Status NodeFromJson(const nlohmann::json &nodeJson, Node &node);
+    static void DestroyNodeOperations(GraphParam &graphParam);
+};
+} // namespace atb
+#endif
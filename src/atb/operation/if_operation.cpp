@@ -154,6 +154,12 @@ Status IfOperation::InferShapeImpl(const SVector<TensorDesc> &inTensorDescs, SVe
     return param_.opA->InferShape(inTensorDescs, outTensorDescs);
 }
 
+// 推导结果由被选中的子Operation决定，子Operation自身带有缓存
+bool IfOperation::IsInferShapeCacheable() const
+{
+    return false;
+}
+
 std::shared_ptr<Runner> IfOperation::CreateRunner(Context &context) const
 {
     if (!opSelected_) {
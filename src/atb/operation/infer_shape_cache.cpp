@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/operation/infer_shape_cache.h"
+#include "atb/utils/tensor_util.h"
+
+namespace atb {
+constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ULL;
+constexpr uint64_t HASH_PRIME = 0x100000001b3ULL;
+
+static inline void HashCombine(uint64_t &seed, uint64_t value)
+{
+    seed = (seed ^ value) * HASH_PRIME;
+}
+
+uint64_t InferShapeCache::CalcHash(const SVector<TensorDesc> &inTensorDescs, uint64_t paramVersion)
+{
+    uint64_t hash = HASH_SEED;
+    HashCombine(hash, paramVersion);
+    HashCombine(hash, inTensorDescs.size());
+    for (size_t i = 0; i < inTensorDescs.size(); ++i) {
+        const TensorDesc &desc = inTensorDescs.at(i);
+        HashCombine(hash, static_cast<uint64_t>(desc.dtype));
+        HashCombine(hash, static_cast<uint64_t>(desc.format));
+        HashCombine(hash, desc.shape.dimNum);
+        for (size_t j = 0; j < desc.shape.dimNum && j < MAX_DIM; ++j) {
+            HashCombine(hash, static_cast<uint64_t>(desc.shape.dims[j]));
+        }
+    }
+    return hash;
+}
+
+bool InferShapeCache::IsMatch(const CacheItem &item, const SVector<TensorDesc> &inTensorDescs, uint64_t hash,
+                              uint64_t paramVersion) const
+{
+    if (item.hash != hash || item.paramVersion != paramVersion ||
+        item.inTensorDescs.size() != inTensorDescs.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < inTensorDescs.size(); ++i) {
+        if (!TensorUtil::TensorDescEqual(item.inTensorDescs.at(i), inTensorDescs.at(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool InferShapeCache::Get(const SVector<TensorDesc> &inTensorDescs, uint64_t paramVersion,
+                          SVector<TensorDesc> &outTensorDescs)
+{
+    if (items_.empty()) {
+        return false;
+    }
+    uint64_t hash = CalcHash(inTensorDescs, paramVersion);
+    // 从上次命中的位置开始查找，shape不变的连续调用一次比较即可命中
+    for (size_t i = 0; i < items_.size(); ++i) {
+        size_t pos = (hitPos_ + i) % items_.size();
+        const CacheItem &item = items_.at(pos);
+        if (IsMatch(item, inTensorDescs, hash, paramVersion)) {
+            hitPos_ = pos;
+            outTensorDescs = item.outTensorDescs;
+            return true;
+        }
+    }
+    return false;
+}
+
+void InferShapeCache::Add(const SVector<TensorDesc> &inTensorDescs, uint64_t paramVersion,
+                          const SVector<TensorDesc> &outTensorDescs)
+{
+    if (items_.size() < CACHE_ITEM_COUNT) {
+        items_.emplace_back();
+        replacePos_ = items_.size() - 1;
+    }
+    CacheItem &item = items_.at(replacePos_);
+    item.hash = CalcHash(inTensorDescs, paramVersion);
+    item.paramVersion = paramVersion;
+    item.inTensorDescs = inTensorDescs;
+    item.outTensorDescs = outTensorDescs;
+    hitPos_ = replacePos_;
+    replacePos_ = (replacePos_ + 1) % CACHE_ITEM_COUNT;
+}
+
+void InferShapeCache::Clear()
+{
+    items_.clear();
+    replacePos_ = 0;
+    hitPos_ = 0;
+}
+
+size_t InferShapeCache::GetSize() const
+{
+    return items_.size();
+}
+} // namespace atb
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_INFER_SHAPE_CACHE_H
+#define ATB_INFER_SHAPE_CACHE_H
+#include <cstdint>
+#include <vector>
+#include "atb/types.h"
+#include "atb/svector.h"
+
+namespace atb {
+// 单个Operation的InferShape结果缓存，以输入TensorDesc与参数版本为key，只缓存推导成功的结果。
+// 缓存项数很小，按轮转替换；hash只用于快速排除，命中前仍逐个比较输入描述。非线程安全，与Operation的使用方式一致。
+class InferShapeCache {
+public:
+    static constexpr size_t CACHE_ITEM_COUNT = 4;
+    static uint64_t CalcHash(const SVector<TensorDesc> &inTensorDescs, uint64_t paramVersion);
+    bool Get(const SVector<TensorDesc> &inTensorDescs, uint64_t paramVersion, SVector<TensorDesc> &outTensorDescs);
+    void Add(const SVector<TensorDesc> &inTensorDescs, uint64_t paramVersion,
+             const SVector<TensorDesc> &outTensorDescs);
+    void Clear();
+    size_t GetSize() const;
+
+private:
+    struct CacheItem {
+        uint64_t hash = 0;
+        uint64_t paramVersion = 0;
+        SVector<TensorDesc> inTensorDescs;
+        SVector<TensorDesc> outTensorDescs;
+    };
+    bool IsMatch(const CacheItem &item, const SVector<TensorDesc> &inTensorDescs, uint64_t hash,
+                 uint64_t paramVersion) const;
+
+private:
+    std::vector<CacheItem> items_;
+    size_t replacePos_ = 0;
+    size_t hitPos_ = 0;
+};
+} // namespace atb
+#endif
@@ -66,6 +66,7 @@
         }                                                                                                              \
         ATB_LOG(DEBUG) << "Param Changed!";                                                                            \
         op->SetParam(opParam);                                                                                         \
+        op->InvalidateInferShapeCache();                                                                               \
         return NO_ERROR;                                                                                               \
     }
 
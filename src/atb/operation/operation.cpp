@@ -8,8 +8,16 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 #include "atb/operation.h"
+#include <algorithm>
+#include <unordered_map>
+#include <acl/acl_rt.h>
+#include <mki/utils/time/timer.h>
 #include "atb/operation_infra.h"
 #include "atb/operation/operation_base.h"
+#include "atb/context/context_base.h"
+#include "atb/utils/log.h"
+#include "atb/utils/statistic.h"
+#include "atb/utils/trace_recorder.h"
 
 namespace atb {
 Status DestroyOperation(Operation *operation)
@@ -53,4 +61,258 @@ uint32_t GetExecuteStreamId(Operation *operation)
     ATB_LOG(ERROR) << "GetExecuteStreamId failed! operation invalid!";
     return 0;
 }
+
+Status ExecuteWithNewAddresses(Operation *operation, const VariantPack &variantPack, uint8_t *workspace,
+                               uint64_t workspaceSize, Context *context)
+{
+    if (operation == nullptr) {
+        ATB_LOG(ERROR) << "ExecuteWithNewAddresses operation is null";
+        return ERROR_INVALID_OPERATION_ADDR;
+    }
+    OperationBase *opBase = dynamic_cast<OperationBase *>(operation);
+    if (opBase) {
+        return opBase->ExecuteWithNewAddresses(variantPack, workspace, workspaceSize, context);
+    }
+    uint64_t setupWorkspaceSize = 0;
+    Status st = operation->Setup(variantPack, setupWorkspaceSize, context);
+    if (st != NO_ERROR) {
+        return st;
+    }
+    return operation->Execute(variantPack, workspace, workspaceSize, context);
+}
+
+Status Warmup(Operation *operation, const std::vector<SVector<TensorDesc>> &buckets, Context *context,
+              std::vector<WarmupBucketResult> &results)
+{
+    if (operation == nullptr) {
+        ATB_LOG(ERROR) << "Warmup operation is null";
+        return ERROR_INVALID_OPERATION_ADDR;
+    }
+    OperationBase *opBase = dynamic_cast<OperationBase *>(operation);
+    if (opBase) {
+        return opBase->Warmup(buckets, context, results);
+    }
+    results.clear();
+    results.resize(buckets.size());
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        Mki::Timer warmupTimer;
+        VariantPack variantPack;
+        Status st = OperationBase::BuildWarmupVariantPack(*operation, buckets.at(i), variantPack);
+        if (st != NO_ERROR) {
+            return st;
+        }
+        st = operation->Setup(variantPack, results.at(i).workspaceSize, context);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << operation->GetName() << " warmup bucket[" << i << "] setup fail, error code: " << st;
+            return st;
+        }
+        results.at(i).costTimeUs = warmupTimer.ElapsedMicroSecond();
+    }
+    return NO_ERROR;
+}
+
+static Status ExecuteBatchOneByOne(const std::vector<ExecuteBatchItem> &items, Context *context)
+{
+    for (size_t i = 0; i < items.size(); ++i) {
+        const ExecuteBatchItem &item = items.at(i);
+        Status st = item.operation->Execute(item.variantPack, item.workspace, item.workspaceSize, context);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << "ExecuteBatch item[" << i << "] " << item.operation->GetName()
+                           << " execute fail, error code: " << st;
+            return st;
+        }
+    }
+    return NO_ERROR;
+}
+
+static bool IsExecuteBatchFastPathEnable(const std::vector<ExecuteBatchItem> &items, Context *context,
+                                         std::vector<OperationBase *> &opBases, aclrtStream &stream)
+{
+    if (context->GetLaunchMode() != KERNEL_LAUNCH_MODE || context->GetExecuteType() != EXECUTE_NORMAL) {
+        return false;
+    }
+    opBases.resize(items.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+        opBases.at(i) = dynamic_cast<OperationBase *>(items.at(i).operation);
+        if (opBases.at(i) == nullptr) {
+            return false;
+        }
+        aclrtStream opStream = opBases.at(i)->GetExecuteStream(context);
+        if (i == 0) {
+            stream = opStream;
+        } else if (opStream != stream) {
+            return false;
+        }
+    }
+    return stream != nullptr;
+}
+
+// 同一Operation多次出现时只拷贝一份tiling，tilingOffsets记录每一项的tiling在连续内存中的偏移
+static uint64_t GetBatchTilingBuffers(const std::vector<OperationBase *> &opBases,
+                                      std::vector<std::pair<const uint8_t *, uint64_t>> &srcBuffers,
+                                      std::vector<uint64_t> &tilingOffsets)
+{
+    std::unordered_map<const OperationBase *, uint64_t> opTilingOffsets;
+    uint64_t totalTilingSize = 0;
+    tilingOffsets.resize(opBases.size());
+    for (size_t i = 0; i < opBases.size(); ++i) {
+        uint64_t tilingSize = opBases.at(i)->GetBatchTilingSize();
+        if (tilingSize == 0) {
+            continue;
+        }
+        auto it = opTilingOffsets.find(opBases.at(i));
+        if (it != opTilingOffsets.end()) {
+            tilingOffsets.at(i) = it->second;
+            continue;
+        }
+        opTilingOffsets.emplace(opBases.at(i), totalTilingSize);
+        tilingOffsets.at(i) = totalTilingSize;
+        srcBuffers.emplace_back(opBases.at(i)->GetHostTilingBuffer(), tilingSize);
+        totalTilingSize += tilingSize;
+    }
+    return totalTilingSize;
+}
+
+// 无法在不覆盖任一Operation的host tiling的前提下取得连续内存时，deviceTilingBuffer为nullptr，由调用方逐个下发
+static Status CopyBatchTilingToDevice(const std::vector<std::pair<const uint8_t *, uint64_t>> &srcBuffers,
+                                      uint64_t totalTilingSize, ContextBase *contextBase, aclrtStream stream,
+                                      uint8_t *&deviceTilingBuffer)
+{
+    TraceScope traceScope(TRACE_EVENT_TILING_COPY);
+    Mki::Timer timer;
+    deviceTilingBuffer = nullptr;
+    uint8_t *hostTilingBuffer = nullptr;
+    Status st = contextBase->GatherContinuousHostTilingBuffer(srcBuffers, hostTilingBuffer);
+    if (st != NO_ERROR) {
+        // 各Operation的host tiling取自同一个环形内存池，Setup的Operation数超过内存池块数时先Setup的会被覆盖
+        ATB_LOG(ERROR) << "ExecuteBatch host tiling of some operations has been overwritten by later setups, "
+                       << "setup and execute fewer operations per batch";
+        return st;
+    }
+    if (hostTilingBuffer == nullptr) {
+        ATB_LOG(WARN) << "ExecuteBatch get continuous host tiling buffer fail, totalTilingSize:" << totalTilingSize;
+        return NO_ERROR;
+    }
+    uint8_t *buffer = contextBase->GetContinuousDeviceTilingBuffer(totalTilingSize);
+    if (buffer == nullptr) {
+        ATB_LOG(WARN) << "ExecuteBatch get continuous device tiling buffer fail, totalTilingSize:" << totalTilingSize;
+        return NO_ERROR;
+    }
+    int ret = aclrtMemcpyAsync(buffer, totalTilingSize, hostTilingBuffer, totalTilingSize,
+                               ACL_MEMCPY_HOST_TO_DEVICE, stream);
+    if (ret == 0) {
+        ret = contextBase->RecordHostTilingCopy(hostTilingBuffer, totalTilingSize, stream);
+    }
+    GetOpExecuteStatistic().tillingCopyTime += timer.ElapsedMicroSecond();
+    if (ret != 0) {
+        ATB_LOG(ERROR) << "ExecuteBatch copy host tiling to device fail, ret:" << ret;
+        return ERROR_RT_FAIL;
+    }
+    deviceTilingBuffer = buffer;
+    return NO_ERROR;
+}
+
+static Status GetBatchWorkspaces(const std::vector<ExecuteBatchItem> &items,
+                                 const std::vector<OperationBase *> &opBases, ContextBase *contextBase,
+                                 aclrtStream stream, std::vector<uint8_t *> &workspaces,
+                                 std::vector<uint64_t> &workspaceSizes)
+{
+    uint64_t arenaSize = 0;
+    for (size_t i = 0; i < items.size(); ++i) {
+        workspaces.at(i) = items.at(i).workspace;
+        workspaceSizes.at(i) = items.at(i).workspaceSize;
+        arenaSize = std::max(arenaSize, opBases.at(i)->GetStreamArenaWorkspaceSize(items.at(i).workspaceSize));
+    }
+    if (arenaSize == 0) {
+        return NO_ERROR;
+    }
+    uint8_t *arenaBuffer = contextBase->GetStreamArenaBuffer(stream, arenaSize);
+    if (arenaBuffer == nullptr) {
+        ATB_LOG(ERROR) << "ExecuteBatch get stream arena workspace fail, workspaceSize:" << arenaSize;
+        return ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (opBases.at(i)->GetStreamArenaWorkspaceSize(items.at(i).workspaceSize) != 0) {
+            workspaces.at(i) = arenaBuffer;
+            workspaceSizes.at(i) = arenaSize;
+        }
+    }
+    return NO_ERROR;
+}
+
+Status ExecuteBatch(const std::vector<ExecuteBatchItem> &items, Context *context)
+{
+    ContextBase *contextBase = dynamic_cast<ContextBase *>(context);
+    if (contextBase == nullptr) {
+        ATB_LOG(ERROR) << "ExecuteBatch context is null or not ContextBase";
+        return ERROR_INVALID_CONTEXT_ADDR;
+    }
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (items.at(i).operation == nullptr) {
+            ATB_LOG(ERROR) << "ExecuteBatch item[" << i << "] operation is null";
+            return ERROR_INVALID_OPERATION_ADDR;
+        }
+    }
+    if (items.empty()) {
+        return NO_ERROR;
+    }
+
+    std::vector<OperationBase *> opBases;
+    aclrtStream stream = nullptr;
+    if (!IsExecuteBatchFastPathEnable(items, context, opBases, stream)) {
+        ATB_LOG(INFO) << "ExecuteBatch fast path is not enable, execute " << items.size() << " operations one by one";
+        return ExecuteBatchOneByOne(items, context);
+    }
+
+    // step0, 使用执行流共享workspace的Operation按其中最大值一次获取，避免下发过程中扩容
+    std::vector<uint8_t *> workspaces(items.size());
+    std::vector<uint64_t> workspaceSizes(items.size());
+    Status st = GetBatchWorkspaces(items, opBases, contextBase, stream, workspaces, workspaceSizes);
+    if (st != NO_ERROR) {
+        return st;
+    }
+
+    // step1, 统一校验，任一Operation不合法时不下发
+    for (size_t i = 0; i < items.size(); ++i) {
+        const ExecuteBatchItem &item = items.at(i);
+        st = opBases.at(i)->BatchExecuteCheck(item.variantPack, workspaces.at(i), workspaceSizes.at(i), context);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << "ExecuteBatch item[" << i << "] " << item.operation->GetName()
+                           << " check fail, error code: " << st;
+            return st;
+        }
+    }
+
+    // step2, 所有tiling汇总到一块连续内存，一次拷贝到device
+    std::vector<std::pair<const uint8_t *, uint64_t>> srcBuffers;
+    std::vector<uint64_t> tilingOffsets;
+    uint64_t totalTilingSize = GetBatchTilingBuffers(opBases, srcBuffers, tilingOffsets);
+    uint8_t *deviceTilingBuffer = nullptr;
+    if (totalTilingSize != 0) {
+        st = CopyBatchTilingToDevice(srcBuffers, totalTilingSize, contextBase, stream, deviceTilingBuffer);
+        if (st != NO_ERROR) {
+            return st;
+        }
+        if (deviceTilingBuffer == nullptr) {
+            ATB_LOG(WARN) << "ExecuteBatch can not gather tiling, execute " << items.size()
+                          << " operations one by one";
+            return ExecuteBatchOneByOne(items, context);
+        }
+    }
+
+    // step3, 依次下发
+    for (size_t i = 0; i < items.size(); ++i) {
+        const ExecuteBatchItem &item = items.at(i);
+        uint8_t *opDeviceTilingBuffer =
+            deviceTilingBuffer == nullptr ? nullptr : deviceTilingBuffer + tilingOffsets.at(i);
+        st = opBases.at(i)->BatchExecute(item.variantPack, workspaces.at(i), workspaceSizes.at(i),
+                                         opDeviceTilingBuffer);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << "ExecuteBatch item[" << i << "] " << item.operation->GetName()
+                           << " execute fail, error code: " << st;
+            return st;
+        }
+    }
+    return NO_ERROR;
+}
 } // namespace atb
\ No newline at end of file
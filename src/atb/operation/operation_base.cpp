@@ -30,10 +30,14 @@
 #include "atb/utils/common_utils.h"
 #include "atb/utils/singleton.h"
 #include "atb/utils/mstx_mem_register.h"
+#include "atb/utils/trace_recorder.h"
+#include "atb/utils/mem_accounting.h"
 
 namespace atb {
 static std::atomic_int64_t g_operationBaseId(0);
 constexpr size_t WORKSPACE_ALIGN = 512;
+constexpr uint64_t GRAPH_CAPTURE_HASH_SEED = 0xcbf29ce484222325ULL;
+constexpr uint64_t GRAPH_CAPTURE_HASH_PRIME = 0x100000001b3ULL;
 
 int64_t GetNewOperationBaseId()
 {
@@ -49,6 +53,19 @@ static uint32_t GetTypeIdFromHash(uint64_t hashId)
     return typeId;
 }
 
+static void HashTensorDescs(const SVector<Tensor> &tensors, uint64_t &hash)
+{
+    hash = (hash ^ tensors.size()) * GRAPH_CAPTURE_HASH_PRIME;
+    for (const Tensor &tensor : tensors) {
+        hash = (hash ^ static_cast<uint64_t>(tensor.desc.dtype)) * GRAPH_CAPTURE_HASH_PRIME;
+        hash = (hash ^ static_cast<uint64_t>(tensor.desc.format)) * GRAPH_CAPTURE_HASH_PRIME;
+        hash = (hash ^ tensor.desc.shape.dimNum) * GRAPH_CAPTURE_HASH_PRIME;
+        for (uint64_t i = 0; i < tensor.desc.shape.dimNum && i < MAX_DIM; ++i) {
+            hash = (hash ^ static_cast<uint64_t>(tensor.desc.shape.dims[i])) * GRAPH_CAPTURE_HASH_PRIME;
+        }
+    }
+}
+
 OperationBase::OperationBase(const std::string &name) : name_(name)
 {
     operationBaseIds_.clear();
@@ -63,10 +80,22 @@ OperationBase::~OperationBase()
         // 对于GraphOperation来说，里面的子Op都不会有runnerVariantPack_
         if (runnerVariantPack_.context) {
             ATB_LOG(INFO) << GetLogPrefix() << "will free deviceArgsBuffer_ and hostArgsBuffer_";
+            if (isModelOwner_ && model_ != nullptr && replayStream_ != nullptr) {
+                // 等待已下发的重放完成后再释放args内存与模型
+                int ret = aclrtSynchronizeStream(replayStream_);
+                ATB_LOG_IF(ret != 0, ERROR) << GetLogPrefix() << "stream sync fail, ret:" << ret;
+            }
             // 此处如果先destroy了context再destroy operation，里面调用aclrtFree接口会报错
             runnerVariantPack_.context->FreeArgsDeviceBuffer(deviceArgsBuffer_);
             runnerVariantPack_.context->FreeArgsHostBuffer(hostArgsBuffer_);
+            if (isModelOwner_ && model_ != nullptr) {
+                aclmdlRIDestroy(model_);
+            }
         }
+        for (GraphCaptureEntry &entry : graphCaptureEntries_) {
+            ReleaseGraphCaptureEntry(entry, true);
+        }
+        ATB_LOG(INFO) << GetLogPrefix() << "graph capture statistic:" << graphCaptureStatistic_.ToString();
     }
 }
 
@@ -100,16 +129,16 @@ void OperationBase::InitEmptyInTensorPerms() const
         return;
     }
     ATB_LOG(DEBUG) << GetLogPrefix() << "operationIr_ : " << operationIr_->ToString();
-    const Mki::SVector<Mki::TensorInfoIr> &inTensorInfoIrs = operationIr_->GetInTensorInfoIrs();
-    if (inTensorInfoIrs.size() != GetInputNum()) {
-        ATB_LOG(ERROR) << GetLogPrefix() << "GetInTensorInfoIrs size: " << inTensorInfoIrs.size()
+    size_t inTensorNum = operationIr_->GetInTensorNum();
+    if (inTensorNum != GetInputNum()) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "GetInTensorInfoIrs size: " << inTensorNum
                        << " is not equal with GetInputNum  : " << GetInputNum();
         return;
     }
     emptyInTensorPerms_.reserve(GetInputNum());
     emptyInTensorPerms_.resize(GetInputNum());
-    for (size_t inTensorId = 0; inTensorId < inTensorInfoIrs.size(); inTensorId++) {
-        if (inTensorInfoIrs[inTensorId].isOptional) {
+    for (size_t inTensorId = 0; inTensorId < inTensorNum; inTensorId++) {
+        if (operationIr_->GetInTensorInfoIr(inTensorId).isOptional) {
             emptyInTensorPerms_.at(inTensorId) = true;
             ATB_LOG(INFO) << GetLogPrefix() << "emptyInTensorPerms init inTensor[" << inTensorId << "] is isOptional";
         } else {
@@ -138,16 +167,16 @@ void OperationBase::InitEmptyOutTensorPerms() const
         return;
     }
     ATB_LOG(DEBUG) << GetLogPrefix() << "operationIr_ : " << operationIr_->ToString();
-    const Mki::SVector<Mki::TensorInfoIr> &outTensorInfoIrs = operationIr_->GetOutTensorInfoIrs();
-    if (GetOutputNum() != 0 && outTensorInfoIrs.size() != GetOutputNum()) {
-        ATB_LOG(ERROR) << GetLogPrefix() << "GetOutTensorInfoIrs size: " << outTensorInfoIrs.size()
+    size_t outTensorNum = operationIr_->GetOutTensorNum();
+    if (GetOutputNum() != 0 && outTensorNum != GetOutputNum()) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "GetOutTensorInfoIrs size: " << outTensorNum
                        << " which is not equals to GetOutputNum: " << GetOutputNum();
         return;
     }
-    emptyOutTensorPerms_.reserve(outTensorInfoIrs.size());
-    emptyOutTensorPerms_.resize(outTensorInfoIrs.size());
-    for (size_t outTensorId = 0; outTensorId < outTensorInfoIrs.size(); outTensorId++) {
-        if (outTensorInfoIrs[outTensorId].isOptional) {
+    emptyOutTensorPerms_.reserve(outTensorNum);
+    emptyOutTensorPerms_.resize(outTensorNum);
+    for (size_t outTensorId = 0; outTensorId < outTensorNum; outTensorId++) {
+        if (operationIr_->GetOutTensorInfoIr(outTensorId).isOptional) {
             emptyOutTensorPerms_.at(outTensorId) = true;
             ATB_LOG(INFO) << GetLogPrefix() << "emptyOutTensorPerms init outTensor[" << outTensorId
                           << "] is isOptional";
@@ -208,22 +237,9 @@ template <typename TensorType> Status OperationBase::CheckOutTensor(const SVecto
     return NO_ERROR;
 }
 
-template <typename TensorType>
-static bool CheckIniMatchSupportIdx(const SVector<TensorType> &tensors,
-                                    const Mki::SVector<Mki::TensorInfoIr> &tensorInfoIrs, const size_t &supportIdx)
+static size_t GetFirstSupportIdx(uint64_t supportMask)
 {
-    for (size_t tensorIdx = 0; tensorIdx < tensors.size(); tensorIdx++) {
-        if (TensorCheck::IsEmptyTensor(tensors[tensorIdx])) {
-            continue;
-        }
-        aclDataType tensorDType = static_cast<aclDataType>(tensorInfoIrs[tensorIdx].supportedDtypes[supportIdx]);
-        aclFormat tensorFormat = static_cast<aclFormat>(tensorInfoIrs[tensorIdx].supportedFormats[supportIdx]);
-        if ((!TensorCheck::IsTensorDType(tensors[tensorIdx], tensorDType)) ||
-            (!TensorCheck::IsTensorFormat(tensors[tensorIdx], tensorFormat))) {
-            return false;
-        }
-    }
-    return true;
+    return static_cast<size_t>(__builtin_ctzll(supportMask));
 }
 
 bool OperationBase::CheckIniMatch(const SVector<TensorDesc> &inTensorDescs) const
@@ -235,20 +251,18 @@ bool OperationBase::CheckIniMatch(const SVector<TensorDesc> &inTensorDescs) cons
         ATB_LOG(ERROR) << GetLogPrefix() << "operationIr_ is invalid";
         return false;
     }
-    const Mki::SVector<Mki::TensorInfoIr> &inTensorInfoIrs = operationIr_->GetInTensorInfoIrs();
-    if (inTensorDescs.size() != inTensorInfoIrs.size()) {
+    if (inTensorDescs.size() != operationIr_->GetInTensorNum()) {
         ATB_LOG(ERROR) << GetLogPrefix() << "inTensorDescs size: " << inTensorDescs.size() << " is not equal "
-                       << "inTensorInfoIrs size : " << inTensorInfoIrs.size();
+                       << "inTensorInfoIrs size : " << operationIr_->GetInTensorNum();
         return false;
     }
-    size_t supportSize = operationIr_->GetSupportSize();
-    for (size_t supportIdx = 0; supportIdx < supportSize; supportIdx++) {
-        if (CheckIniMatchSupportIdx(inTensorDescs, inTensorInfoIrs, supportIdx)) {
-            ATB_LOG(INFO) << GetLogPrefix() << "dType and format matched. index: " << supportIdx;
-            return true;
-        }
+    // 每个tensor按dtype、format查出可接受的支持组合位图，逐个相与，非0即匹配
+    uint64_t supportMask = operationIr_->MatchInTensors(inTensorDescs);
+    if (supportMask == 0) {
+        return false;
     }
-    return false;
+    ATB_LOG(INFO) << GetLogPrefix() << "dType and format matched. index: " << GetFirstSupportIdx(supportMask);
+    return true;
 }
 
 bool OperationBase::CheckIniMatch(const SVector<Tensor> &inTensors, const SVector<Tensor> &outTensors) const
@@ -260,27 +274,22 @@ bool OperationBase::CheckIniMatch(const SVector<Tensor> &inTensors, const SVecto
         ATB_LOG(ERROR) << GetLogPrefix() << "operationIr_ is invalid";
         return false;
     }
-    const Mki::SVector<Mki::TensorInfoIr> &inTensorInfoIrs = operationIr_->GetInTensorInfoIrs();
-    const Mki::SVector<Mki::TensorInfoIr> &outTensorInfoIrs = operationIr_->GetOutTensorInfoIrs();
-    if (inTensors.size() != inTensorInfoIrs.size()) {
+    if (inTensors.size() != operationIr_->GetInTensorNum()) {
         ATB_LOG(ERROR) << GetLogPrefix() << "inTensors size: " << inTensors.size() << " is not equal "
-                       << "inTensorInfoIrs size : " << inTensorInfoIrs.size();
+                       << "inTensorInfoIrs size : " << operationIr_->GetInTensorNum();
         return false;
     }
-    if (outTensors.size() != 0 && outTensors.size() != outTensorInfoIrs.size()) {
+    if (outTensors.size() != 0 && outTensors.size() != operationIr_->GetOutTensorNum()) {
         ATB_LOG(ERROR) << GetLogPrefix() << "outTensors size: " << outTensors.size() << " is not equal "
-                       << "outTensorInfoIrs size : " << outTensorInfoIrs.size();
+                       << "outTensorInfoIrs size : " << operationIr_->GetOutTensorNum();
         return false;
     }
-    size_t supportSize = operationIr_->GetSupportSize();
-    for (size_t supportIdx = 0; supportIdx < supportSize; supportIdx++) {
-        if (CheckIniMatchSupportIdx(inTensors, inTensorInfoIrs, supportIdx) &&
-            CheckIniMatchSupportIdx(outTensors, outTensorInfoIrs, supportIdx)) {
-            ATB_LOG(INFO) << GetLogPrefix() << "dType and format matched. index: " << supportIdx;
-            return true;
-        }
+    uint64_t supportMask = operationIr_->MatchInTensors(inTensors) & operationIr_->MatchOutTensors(outTensors);
+    if (supportMask == 0) {
+        return false;
     }
-    return false;
+    ATB_LOG(INFO) << GetLogPrefix() << "dType and format matched. index: " << GetFirstSupportIdx(supportMask);
+    return true;
 }
 
 Status OperationBase::InferShapeCheck(const SVector<TensorDesc> &inTensorDescs) const
@@ -342,6 +351,12 @@ Status OperationBase::InferShape(const SVector<TensorDesc> &inTensorDescs, SVect
 {
     Status st = NO_ERROR;
     try {
+        bool useCache = GetSingleton<Config>().IsInferShapeCacheEnable() && IsInferShapeCacheable();
+        if (useCache && inferShapeCache_.Get(inTensorDescs, paramVersion_, outTensorDescs)) {
+            GetOpSetupStatistic().inferShapeCacheHitCount++;
+            ATB_LOG(DEBUG) << GetLogPrefix() << "infer shape cache hit";
+            return NO_ERROR;
+        }
         st = InferShapeCheck(inTensorDescs);
         if (st != NO_ERROR) {
             ATB_LOG(ERROR) << GetLogPrefix() << "infer shape check fail, error code: " << st;
@@ -353,6 +368,10 @@ Status OperationBase::InferShape(const SVector<TensorDesc> &inTensorDescs, SVect
             ATB_LOG(ERROR) << GetLogPrefix() << "infer shape fail, error code: " << st;
             return st;
         }
+        if (useCache) {
+            GetOpSetupStatistic().inferShapeCacheMissCount++;
+            inferShapeCache_.Add(inTensorDescs, paramVersion_, outTensorDescs);
+        }
     } catch (const std::exception &e) {
         ATB_LOG(ERROR) << GetLogPrefix() << "infer shape throw an exception: " << e.what();
         return ERROR_OUT_OF_HOST_MEMORY;
@@ -366,6 +385,17 @@ Status OperationBase::InferShapeCheckImpl(const SVector<TensorDesc> &inTensorDes
     return NO_ERROR;
 }
 
+bool OperationBase::IsInferShapeCacheable() const
+{
+    return true;
+}
+
+void OperationBase::InvalidateInferShapeCache()
+{
+    paramVersion_++;
+    inferShapeCache_.Clear();
+}
+
 Status OperationBase::CheckVariantPack(const VariantPack &variantPack) const
 {
     if (variantPack.inTensors.size() != GetInputNum()) {
@@ -571,8 +601,15 @@ Status OperationBase::SetupThrow(const VariantPack &variantPack, uint64_t &works
 
     workspaceSize = runnerVariantPack_.workspaceBufferSize + runnerVariantPack_.intermediateBufferSize;
     workspaceSize_ = workspaceSize;
+    // 多流算子各流的workspace按偏移切分，并发使用，不参与执行流共享workspace
+    useStreamArena_ = workspaceSize_ != 0 && runnerVariantPack_.context->GetStreamArenaStatus() &&
+                      runner_->GetWorkspaceBufferSize().size() <= 1;
+    if (useStreamArena_) {
+        workspaceSize = 0;
+    }
 
-    ATB_LOG(INFO) << GetLogPrefix() << "setup success, workspaceSize:" << workspaceSize
+    ATB_LOG(INFO) << GetLogPrefix() << "setup success, workspaceSize:" << workspaceSize_
+                  << ", useStreamArena:" << useStreamArena_
                   << ", runner.tilingBufferSize:" << runnerVariantPack_.tilingBufferSize
                   << ", runner.workspaceBufferSize:" << runnerVariantPack_.workspaceBufferSize
                   << ", runner.intermediateBufferSize:" << runnerVariantPack_.intermediateBufferSize;
@@ -599,6 +636,7 @@ void OperationBase::ProfilingPrepare()
 
 Status OperationBase::Setup(const VariantPack &variantPack, uint64_t &workspaceSize, Context *context)
 {
+    TraceScope traceScope(TRACE_EVENT_OPERATION_SETUP, GetTraceNameId());
     Status st = NO_ERROR;
     ProfilingPrepare();
     const uint64_t beginTime = GetSingleton<Mki::ProfilingFuncs>().GetProfilingLevel0Status() ?
@@ -669,19 +707,154 @@ Status OperationBase::EagerModeSetup(const VariantPack &variantPack, uint64_t &w
 
 Status OperationBase::GraphModeSetup(const VariantPack &variantPack, uint64_t &workspaceSize, Context *context)
 {
-    if (!isCaptured_) {
+    uint64_t tick = ++graphCaptureTick_;
+    if (isCaptured_ && TensorUtil::IsRunnerVariantPackEqual(variantPack, runnerVariantPack_)) {
+        graphCaptureLastUseTick_ = tick;
+        InitRunnerVariantPack(variantPack);
+        workspaceSize = useStreamArena_ ? 0 : workspaceSize_;
+        return NO_ERROR;
+    }
+    // shape变化时按输入输出描述查找已捕获的档位，未找到时为新shape重新Setup，首次Launch时捕获
+    uint64_t hash = CalcGraphCaptureHash(variantPack);
+    size_t entryIndex = 0;
+    for (; entryIndex < graphCaptureEntries_.size(); ++entryIndex) {
+        const GraphCaptureEntry &entry = graphCaptureEntries_.at(entryIndex);
+        if (entry.hash == hash && TensorUtil::IsRunnerVariantPackEqual(variantPack, entry.runnerVariantPack)) {
+            break;
+        }
+    }
+    bool isEntryFound = entryIndex < graphCaptureEntries_.size();
+    if (!isCaptured_ && !isEntryFound) {
+        graphCaptureHash_ = hash;
+        graphCaptureLastUseTick_ = tick;
+        return EagerModeSetup(variantPack, workspaceSize, context);
+    }
+    GraphCaptureEntry entry;
+    if (isEntryFound) {
+        entry = std::move(graphCaptureEntries_.at(entryIndex));
+        graphCaptureEntries_.erase(graphCaptureEntries_.begin() + static_cast<std::ptrdiff_t>(entryIndex));
+    }
+    GraphCaptureEntry activeEntry;
+    bool isActiveCaptured = isCaptured_;
+    SaveGraphCaptureEntry(activeEntry);
+    if (isActiveCaptured) {
+        graphCaptureEntries_.push_back(std::move(activeEntry));
+    } else {
+        // 当前档位尚未捕获，直接丢弃
+        ReleaseGraphCaptureEntry(activeEntry, false);
+    }
+    graphCaptureLastUseTick_ = tick;
+    if (!isEntryFound) {
+        graphCaptureHash_ = hash;
         Status st = EagerModeSetup(variantPack, workspaceSize, context);
+        EvictGraphCaptureEntries();
         return st;
-    } else {
-        if (!TensorUtil::IsRunnerVariantPackEqual(variantPack, runnerVariantPack_)) {
-            ATB_LOG(ERROR) << "Tensor shape is not support to change in GRAPH_MODE";
-            return ERROR_INVALID_TENSOR_DIM;
+    }
+    ATB_LOG(INFO) << GetLogPrefix() << "switch to captured model of shape hash:" << hash;
+    LoadGraphCaptureEntry(entry);
+    InitRunnerVariantPack(variantPack);
+    workspaceSize = useStreamArena_ ? 0 : workspaceSize_;
+    return NO_ERROR;
+}
+
+uint64_t OperationBase::CalcGraphCaptureHash(const VariantPack &variantPack)
+{
+    uint64_t hash = GRAPH_CAPTURE_HASH_SEED;
+    HashTensorDescs(variantPack.inTensors, hash);
+    HashTensorDescs(variantPack.outTensors, hash);
+    return hash;
+}
+
+void OperationBase::SaveGraphCaptureEntry(GraphCaptureEntry &entry)
+{
+    entry.hash = graphCaptureHash_;
+    entry.lastUseTick = graphCaptureLastUseTick_;
+    entry.runner = std::move(runner_);
+    entry.runnerVariantPack = runnerVariantPack_;
+    entry.workspaceSize = workspaceSize_;
+    entry.useStreamArena = useStreamArena_;
+    entry.model = isCaptured_ ? model_ : nullptr;
+    entry.replayStream = isCaptured_ ? replayStream_ : nullptr;
+    entry.isModelOwner = isCaptured_ && isModelOwner_;
+    entry.argsBufferSize = argsBufferSize_;
+    entry.deviceArgsBuffer = deviceArgsBuffer_;
+    entry.hostArgsBuffer = hostArgsBuffer_;
+    entry.lastWorkspaceAddr = lastWorkspaceAddr_;
+    runner_ = nullptr;
+    model_ = nullptr;
+    replayStream_ = nullptr;
+    isModelOwner_ = false;
+    isCaptured_ = false;
+    streamStatus_ = ACL_MODEL_RI_CAPTURE_STATUS_INVALIDATED;
+    argsBufferSize_ = 0;
+    deviceArgsBuffer_ = nullptr;
+    hostArgsBuffer_ = nullptr;
+    lastWorkspaceAddr_ = nullptr;
+}
+
+void OperationBase::LoadGraphCaptureEntry(GraphCaptureEntry &entry)
+{
+    graphCaptureHash_ = entry.hash;
+    runner_ = std::move(entry.runner);
+    runnerVariantPack_ = entry.runnerVariantPack;
+    workspaceSize_ = entry.workspaceSize;
+    useStreamArena_ = entry.useStreamArena;
+    model_ = entry.model;
+    replayStream_ = entry.replayStream;
+    isModelOwner_ = entry.isModelOwner;
+    isCaptured_ = true;
+    argsBufferSize_ = entry.argsBufferSize;
+    deviceArgsBuffer_ = entry.deviceArgsBuffer;
+    hostArgsBuffer_ = entry.hostArgsBuffer;
+    lastWorkspaceAddr_ = entry.lastWorkspaceAddr;
+    setUpSuccess_ = true;
+}
+
+void OperationBase::ReleaseGraphCaptureEntry(GraphCaptureEntry &entry, bool syncStream)
+{
+    ContextBase *context = entry.runnerVariantPack.context;
+    if (context == nullptr) {
+        return;
+    }
+    if (syncStream && entry.model != nullptr && entry.replayStream != nullptr) {
+        // 等待已下发的重放完成后再释放模型与args内存
+        int ret = aclrtSynchronizeStream(entry.replayStream);
+        ATB_LOG_IF(ret != 0, ERROR) << GetLogPrefix() << "stream sync fail, ret:" << ret;
+    }
+    if (entry.isModelOwner && entry.model != nullptr) {
+        int ret = aclmdlRIDestroy(entry.model);
+        ATB_LOG_IF(ret != 0, ERROR) << GetLogPrefix() << "aclmdlRIDestroy failed! ret:" << ret;
+    }
+    context->FreeArgsDeviceBuffer(entry.deviceArgsBuffer);
+    context->FreeArgsHostBuffer(entry.hostArgsBuffer);
+    entry.model = nullptr;
+    entry.deviceArgsBuffer = nullptr;
+    entry.hostArgsBuffer = nullptr;
+}
+
+void OperationBase::EvictGraphCaptureEntries()
+{
+    // 当前档位占用一个名额
+    const size_t maxEntryNum = GetSingleton<Config>().GetGraphCaptureCacheSize() - 1;
+    while (graphCaptureEntries_.size() > maxEntryNum) {
+        auto lruIt = graphCaptureEntries_.begin();
+        for (auto it = graphCaptureEntries_.begin(); it != graphCaptureEntries_.end(); ++it) {
+            if (it->lastUseTick < lruIt->lastUseTick) {
+                lruIt = it;
+            }
         }
-        InitRunnerVariantPack(variantPack);
-        return NO_ERROR;
+        ATB_LOG(INFO) << GetLogPrefix() << "evict captured model of shape hash:" << lruIt->hash;
+        ReleaseGraphCaptureEntry(*lruIt, true);
+        graphCaptureEntries_.erase(lruIt);
+        graphCaptureStatistic_.evictCount++;
     }
 }
 
+const GraphCaptureStatistic &OperationBase::GetGraphCaptureStatistic() const
+{
+    return graphCaptureStatistic_;
+}
+
 void OperationBase::RegProfArray(ProfilingFuncName profFuncType, std::string profName)
 {
     if (profFuncType <= OPERATION_UNDEFINED || profFuncType >= OPERATION_MAX) {
@@ -869,13 +1042,22 @@ Status OperationBase::PreExecuteThrow(const VariantPack &variantPack, uint8_t *w
     ATB_LOG(INFO) << "workspace:" << static_cast<void *>(workspace);
 #endif
 
-    UpdateTensorData(variantPack, workspace);
-
     Status st = NO_ERROR;
-    if (!(runnerVariantPack_.context->GetLaunchWithTilingStatus())) {
-        st = CopyTilingToDevice();
-        if (st != 0) {
-            return st;
+    if (isBatchExecuting_) {
+        // 批量执行时tiling已拷贝到batchDeviceTilingBuffer_，只需更新地址
+        UpdateTensorData(variantPack, workspace, batchDeviceTilingBuffer_);
+        if (GetBatchTilingSize() != 0) {
+            UpdateCurrentOpTiling(runnerVariantPack_.tilingBuffer, runnerVariantPack_.tilingBufferSize);
+        } else if (!runnerVariantPack_.context->GetLaunchWithTilingStatus()) {
+            UpdateCurrentOpTiling(nullptr, 0);
+        }
+    } else {
+        UpdateTensorData(variantPack, workspace);
+        if (!(runnerVariantPack_.context->GetLaunchWithTilingStatus())) {
+            st = CopyTilingToDevice();
+            if (st != 0) {
+                return st;
+            }
         }
     }
 #ifdef _DEBUG
@@ -898,16 +1080,52 @@ Status OperationBase::PreExecuteThrow(const VariantPack &variantPack, uint8_t *w
 Status OperationBase::PreLaunch(const VariantPack &variantPack, uint8_t *workspace, uint64_t workspaceSize,
                                 Context *context)
 {
+    TraceScope traceScope(TRACE_EVENT_OPERATION_PRELAUNCH, GetTraceNameId());
     if (!context) {
         ATB_LOG(ERROR) << GetLogPrefix() << "context is null, PreLaunch fail";
         return ERROR_INVALID_PARAM;
     }
+    Status st = GetStreamArenaWorkspace(workspace, workspaceSize);
+    if (st != NO_ERROR) {
+        return st;
+    }
     if (context->GetLaunchMode() == GRAPH_LAUNCH_MODE) {
         isGraphLaunchMode_ = true;
-        return GraphModePreLaunch(variantPack, workspace, workspaceSize, context);
+        st = GraphModePreLaunch(variantPack, workspace, workspaceSize, context);
     } else {
-        return EagerModePreLaunch(variantPack, workspace, workspaceSize, context);
+        st = EagerModePreLaunch(variantPack, workspace, workspaceSize, context);
+    }
+    if (st == NO_ERROR) {
+        RecordMemAccounting();
     }
+    return st;
+}
+
+uint64_t OperationBase::GetStreamArenaWorkspaceSize(uint64_t workspaceSize) const
+{
+    // 调用方传入的workspace足够时优先使用调用方的workspace
+    if (!useStreamArena_ || workspaceSize >= workspaceSize_ || runnerVariantPack_.context == nullptr ||
+        !runnerVariantPack_.context->GetStreamArenaStatus()) {
+        return 0;
+    }
+    return workspaceSize_;
+}
+
+Status OperationBase::GetStreamArenaWorkspace(uint8_t *&workspace, uint64_t &workspaceSize)
+{
+    uint64_t arenaSize = GetStreamArenaWorkspaceSize(workspaceSize);
+    if (arenaSize == 0) {
+        return NO_ERROR;
+    }
+    uint8_t *buffer =
+        runnerVariantPack_.context->GetStreamArenaBuffer(GetExecuteStream(runnerVariantPack_.context), arenaSize);
+    if (buffer == nullptr) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "get stream arena workspace fail, workspaceSize:" << arenaSize;
+        return ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    workspace = buffer;
+    workspaceSize = arenaSize;
+    return NO_ERROR;
 }
 
 Status OperationBase::EagerModePreLaunch(const VariantPack &variantPack, uint8_t *workspace, uint64_t workspaceSize,
@@ -920,7 +1138,7 @@ Status OperationBase::EagerModePreLaunch(const VariantPack &variantPack, uint8_t
     Mki::Timer preLaunchTime;
     Status st = NO_ERROR;
     try {
-        st = ExecuteCheck(variantPack, workspace, workspaceSize, context);
+        st = isBatchExecuting_ ? NO_ERROR : ExecuteCheck(variantPack, workspace, workspaceSize, context);
         if (st != NO_ERROR) {
             ATB_LOG(ERROR) << GetLogPrefix() << "invalid param, execute check fail, error code: " << st;
             return st;
@@ -1012,6 +1230,7 @@ Status OperationBase::GraphModePreLaunch(const VariantPack &variantPack, uint8_t
 
 Status OperationBase::Launch()
 {
+    TraceScope traceScope(TRACE_EVENT_OPERATION_LAUNCH, GetTraceNameId());
     Status st = NO_ERROR;
     if (runnerVariantPack_.context->GetLaunchMode() == GRAPH_LAUNCH_MODE) {
         isGraphLaunchMode_ = true;
@@ -1037,6 +1256,12 @@ Status OperationBase::EagerModeLaunch()
 #else
     ATB_LOG(INFO) << GetLogPrefix() << "execute " << runner_->GetName() << " start";
 #endif
+    // 图下沉模式下kernel在捕获后由模型整体下发，不做延迟溢出检测
+    OverflowDetector *overflowDetector =
+        isGraphLaunchMode_ ? nullptr : runnerVariantPack_.context->GetOverflowDetector();
+    if (overflowDetector != nullptr) {
+        overflowDetector->BeginStep(GenerateOperationName(name_, operationBaseIds_), executeStream);
+    }
     Status st = NO_ERROR;
     try {
         st = runner_->Execute(runnerVariantPack_);
@@ -1049,6 +1274,9 @@ Status OperationBase::EagerModeLaunch()
         }
     } catch (const std::exception &e) {
         ATB_LOG(ERROR) << GetLogPrefix() << "execute throw an exception: " << e.what();
+        if (overflowDetector != nullptr) {
+            overflowDetector->EndStep(executeStream, runnerVariantPack_.outTensors);
+        }
         return ERROR_RT_FAIL;
     }
 #ifdef _DEBUG
@@ -1056,7 +1284,12 @@ Status OperationBase::EagerModeLaunch()
 #else
     ATB_LOG(INFO) << GetLogPrefix() << "execute " << runner_->GetName() << " success";
 #endif
+    if (overflowDetector != nullptr) {
+        Status overflowSt = overflowDetector->EndStep(executeStream, runnerVariantPack_.outTensors);
+        st = st == NO_ERROR ? overflowSt : st;
+    }
     if (GetSingleton<Config>().IsStreamSyncEveryOperationEnable()) {
+        TraceScope traceScope(TRACE_EVENT_STREAM_SYNC, GetTraceNameId());
         int ret = aclrtSynchronizeStream(executeStream);
         ATB_LOG_IF(ret != 0, ERROR) << GetLogPrefix() << "stream sync fail, ret:" << ret;
     }
@@ -1071,7 +1304,9 @@ Status OperationBase::GraphModeLaunch()
     Status st = NO_ERROR;
     aclrtStream executeStream = GetExecuteStream(runnerVariantPack_.context);
     if (streamStatus_ == ACL_MODEL_RI_CAPTURE_STATUS_ACTIVE) {
+        // 由调用方捕获，模型归调用方所有
         isCaptured_ = true;
+        isModelOwner_ = false;
         st = EagerModeLaunch();
         ATB_LOG_IF(st != 0, ERROR) << GetLogPrefix() << "EagerModeLaunch failed! ret:" << st;
         return st;
@@ -1084,9 +1319,17 @@ Status OperationBase::GraphModeLaunch()
         ATB_LOG_IF(st != 0, ERROR) << GetLogPrefix() << "EagerModeLaunch failed! ret:" << st;
         st = aclmdlRICaptureEnd(executeStream, &model_);
         ATB_LOG_IF(st != 0, ERROR) << GetLogPrefix() << "aclmdlRICaptureEnd failed! ret:" << st;
+        isModelOwner_ = true;
+        graphCaptureStatistic_.captureCount++;
+        ATB_LOG(INFO) << GetLogPrefix() << "capture model of shape hash:" << graphCaptureHash_
+                      << ", captured model num:" << graphCaptureEntries_.size() + 1
+                      << ", graph capture statistic:" << graphCaptureStatistic_.ToString();
+    } else {
+        graphCaptureStatistic_.replayCount++;
     }
 
     isCaptured_ = true;
+    replayStream_ = executeStream;
     st = aclmdlRIExecuteAsync(model_, executeStream);
     ATB_LOG_IF(st != 0, ERROR) << GetLogPrefix() << "aclmdlRIExecuteAsync failed! ret:" << st;
     return st;
@@ -1102,14 +1345,7 @@ Status OperationBase::Execute(const VariantPack &variantPack, uint8_t *workspace
     ProfilingFuncName profType = executeType == EXECUTE_NORMAL ?
                                      OPERATION_EXECUTE :
                                      (executeType == EXECUTE_PRELAUNCH ? OPERATION_PRELAUNCH : OPERATION_LAUNCH);
-    std::shared_ptr<MstxMemRegister> mstxMemRegister{nullptr};
-    if (workspaceSize != 0 && MstxMemRegister::IsMstxEnable()) {
-        mstxMemRegister = std::make_shared<MstxMemRegister>();
-        if (mstxMemRegister->MstxHeapRegister(workspace, workspaceSize) == NO_ERROR) {
-            runnerVariantPack_.mstxMemRegister = mstxMemRegister.get();
-            ATB_LOG(INFO) << GetLogPrefix() << "mstxMemHeapRegister success ";
-        }
-    }
+    std::shared_ptr<MstxMemRegister> mstxMemRegister = RegisterMstxWorkspace(workspace, workspaceSize);
     Status st = NO_ERROR;
     if (executeType == EXECUTE_NORMAL || executeType == EXECUTE_PRELAUNCH) {
         st = PreLaunch(variantPack, workspace, workspaceSize, context);
@@ -1132,9 +1368,125 @@ Status OperationBase::Execute(const VariantPack &variantPack, uint8_t *workspace
     return st;
 }
 
+std::shared_ptr<MstxMemRegister> OperationBase::RegisterMstxWorkspace(uint8_t *workspace, uint64_t workspaceSize)
+{
+    std::shared_ptr<MstxMemRegister> mstxMemRegister{nullptr};
+    if (workspaceSize != 0 && MstxMemRegister::IsMstxEnable()) {
+        mstxMemRegister = std::make_shared<MstxMemRegister>();
+        if (mstxMemRegister->MstxHeapRegister(workspace, workspaceSize) == NO_ERROR) {
+            runnerVariantPack_.mstxMemRegister = mstxMemRegister.get();
+            ATB_LOG(INFO) << GetLogPrefix() << "mstxMemHeapRegister success ";
+        }
+    }
+    return mstxMemRegister;
+}
+
+Status OperationBase::ExecuteWithNewAddresses(const VariantPack &variantPack, uint8_t *workspace,
+                                              uint64_t workspaceSize, Context *context)
+{
+    if (!context) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "context is null, execute with new addresses fail";
+        return ERROR_INVALID_PARAM;
+    }
+    // 参数更新后runner会被重建，整图下发模式的Setup本身只更新地址，tensor描述信息变化后需要重新推导，均走完整的Setup
+    bool needSetup = !runner_ || context->GetLaunchMode() == GRAPH_LAUNCH_MODE;
+    if (!needSetup && !setUpSuccess_) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "operation is not setup, execute with new addresses fail";
+        return ERROR_INVALID_PARAM;
+    }
+    if (!needSetup && !TensorUtil::IsRunnerVariantPackEqual(variantPack, runnerVariantPack_)) {
+        ATB_LOG(INFO) << GetLogPrefix() << "tensor descs are changed since last setup, setup again";
+        needSetup = true;
+    }
+    if (needSetup) {
+        uint64_t setupWorkspaceSize = 0;
+        Status st = Setup(variantPack, setupWorkspaceSize, context);
+        if (st != NO_ERROR) {
+            return st;
+        }
+        if (setupWorkspaceSize > workspaceSize) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "workspaceSize " << workspaceSize
+                           << " is less than the size required by setup again: " << setupWorkspaceSize;
+            return ERROR_INVALID_PARAM;
+        }
+        return Execute(variantPack, workspace, workspaceSize, context);
+    }
+    if (context->GetExecuteType() != EXECUTE_LAUNCH) {
+        // 上一次Setup取得的host tiling内存块可能已被其他Operation的Setup复用，重新取块并填充
+        hostTilingBuffer_ = runnerVariantPack_.context->GetHostTilingBuffer();
+        if (!hostTilingBuffer_) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "get host tiling buffer from contextbase is null";
+            return ERROR_OUT_OF_HOST_MEMORY;
+        }
+        runnerVariantPack_.hostTilingBuffer = hostTilingBuffer_;
+        FillHostTilingBuffer();
+    }
+    return Execute(variantPack, workspace, workspaceSize, context);
+}
+
+Status OperationBase::BuildWarmupVariantPack(const Operation &operation, const SVector<TensorDesc> &inTensorDescs,
+                                             VariantPack &variantPack)
+{
+    SVector<TensorDesc> outTensorDescs;
+    Status st = operation.InferShape(inTensorDescs, outTensorDescs);
+    if (st != NO_ERROR) {
+        ATB_LOG(ERROR) << operation.GetName() << " warmup infer shape fail, error code: " << st;
+        return st;
+    }
+    variantPack.inTensors.resize(inTensorDescs.size());
+    for (size_t i = 0; i < inTensorDescs.size(); ++i) {
+        variantPack.inTensors.at(i).desc = inTensorDescs.at(i);
+        variantPack.inTensors.at(i).dataSize = TensorUtil::CalcTensorDataSize(inTensorDescs.at(i));
+    }
+    variantPack.outTensors.resize(outTensorDescs.size());
+    for (size_t i = 0; i < outTensorDescs.size(); ++i) {
+        variantPack.outTensors.at(i).desc = outTensorDescs.at(i);
+        variantPack.outTensors.at(i).dataSize = TensorUtil::CalcTensorDataSize(outTensorDescs.at(i));
+    }
+    return NO_ERROR;
+}
+
+Status OperationBase::Warmup(const std::vector<SVector<TensorDesc>> &buckets, Context *context,
+                             std::vector<WarmupBucketResult> &results)
+{
+    results.clear();
+    results.resize(buckets.size());
+    Status st = NO_ERROR;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        Mki::Timer warmupTimer;
+        VariantPack variantPack;
+        st = BuildWarmupVariantPack(*this, buckets.at(i), variantPack);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "warmup bucket[" << i << "] infer shape fail";
+            break;
+        }
+        st = WarmupSetup(variantPack, context, results.at(i).workspaceSize);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "warmup bucket[" << i << "] setup fail, error code: " << st;
+            break;
+        }
+        results.at(i).costTimeUs = warmupTimer.ElapsedMicroSecond();
+        ATB_LOG(INFO) << GetLogPrefix() << "warmup bucket[" << i << "] success, workspaceSize:"
+                      << results.at(i).workspaceSize << ", cost:" << results.at(i).costTimeUs << "us";
+    }
+    // 预热使用的variantPack不带device地址，执行前必须使用真实tensor重新Setup
+    setUpSuccess_ = false;
+    return st;
+}
+
+Status OperationBase::WarmupSetup(const VariantPack &variantPack, Context *context, uint64_t &workspaceSize)
+{
+    uint64_t setupWorkspaceSize = 0;
+    Status st = Setup(variantPack, setupWorkspaceSize, context);
+    // 开启执行流共享workspace时Setup返回0，记录实际需要的大小
+    workspaceSize = workspaceSize_;
+    return st;
+}
+
 void OperationBase::Reset()
 {
     workspaceSize_ = 0;
+    useStreamArena_ = false;
     if (Probe::IsSaveTensorDesc()) {
         SetSaveTensorDir();
     }
@@ -1155,6 +1507,7 @@ Status OperationBase::CopyHostTilingToDevice(aclrtStream stream)
         ATB_LOG(DEBUG) << GetLogPrefix() << "copy host tiling to device start, totalTilingBufferSize:"
                        << runnerVariantPack_.tilingBufferSize;
         Mki::Timer timer;
+        TraceScope traceScope(TRACE_EVENT_TILING_COPY, GetTraceNameId());
         if (hostTilingBuffer_ == nullptr) {
             ATB_LOG(ERROR) << GetLogPrefix() << "host tiling buffer is null!";
             return ERROR_OUT_OF_HOST_MEMORY;
@@ -1167,6 +1520,10 @@ Status OperationBase::CopyHostTilingToDevice(aclrtStream stream)
             ret = aclrtMemcpyAsync(runnerVariantPack_.tilingBuffer, runnerVariantPack_.tilingBufferSize,
                                    hostTilingBuffer_, runnerVariantPack_.tilingBufferSize, ACL_MEMCPY_HOST_TO_DEVICE,
                                    stream);
+            if (ret == 0) {
+                ret = runnerVariantPack_.context->RecordHostTilingCopy(hostTilingBuffer_,
+                                                                       runnerVariantPack_.tilingBufferSize, stream);
+            }
         }
 
         GetOpExecuteStatistic().tillingCopyTime += timer.ElapsedMicroSecond();
@@ -1290,7 +1647,11 @@ void OperationBase::UpdateTensorData(const VariantPack &variantPack, uint8_t *wo
     ATB_LOG(INFO) << GetLogPrefix() << "get device tiling buffer from contextbase success, buffer:"
                   << static_cast<void *>(deviceTilingBuffer);
 #endif
+    UpdateTensorData(variantPack, workspace, deviceTilingBuffer);
+}
 
+void OperationBase::UpdateTensorData(const VariantPack &variantPack, uint8_t *workspace, uint8_t *deviceTilingBuffer)
+{
     runnerVariantPack_.tilingBuffer = deviceTilingBuffer;
     runnerVariantPack_.workspaceBuffer = workspace;
     runnerVariantPack_.intermediateBuffer = workspace + runnerVariantPack_.workspaceBufferSize;
@@ -1408,8 +1769,83 @@ Status OperationBase::CopyArgsToDevice(Context *context) const
     return st;
 }
 
-Mki::OperationIr* OperationBase::GetOperationIr() const
+const OperationIr *OperationBase::GetOperationIr() const
 {
     return operationIr_;
 }
+
+uint32_t OperationBase::GetTraceNameId()
+{
+    if (traceNameId_ == 0 && GetSingleton<TraceRecorder>().IsEnable()) {
+        traceNameId_ = GetSingleton<TraceRecorder>().RegisterName(name_);
+    }
+    return traceNameId_;
+}
+
+void OperationBase::RecordMemAccounting()
+{
+    MemAccounting &memAccounting = GetSingleton<MemAccounting>();
+    if (!memAccounting.IsEnable()) {
+        return;
+    }
+    if (memNameId_ == 0) {
+        memNameId_ = memAccounting.RegisterName(name_);
+    }
+    memAccounting.Record(memNameId_, runnerVariantPack_.workspaceBufferSize, runnerVariantPack_.intermediateBufferSize,
+                         runnerVariantPack_.tilingBufferSize);
+}
+
+Status OperationBase::BatchExecuteCheck(const VariantPack &variantPack, const uint8_t *workspace,
+                                        uint64_t workspaceSize, Context *context)
+{
+    if (!setUpSuccess_) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "setup failed, execute batch exit.";
+        return ERROR_INVALID_PARAM;
+    }
+    try {
+        Status st = ExecuteCheck(variantPack, workspace, workspaceSize, context);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "invalid param, execute batch check fail, error code: " << st;
+            return st;
+        }
+    } catch (const std::exception &e) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "execute batch check throw an exception: " << e.what();
+        return ERROR_RT_FAIL;
+    }
+    if (runnerVariantPack_.tilingBufferSize > runnerVariantPack_.context->GetTilingBufferBlockSize()) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "tilingSize is bigger than tilingBufferSize!";
+        return ERROR_OUT_OF_HOST_MEMORY;
+    }
+    if (GetBatchTilingSize() != 0 && hostTilingBuffer_ == nullptr) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "host tiling buffer is null!";
+        return ERROR_OUT_OF_HOST_MEMORY;
+    }
+    return NO_ERROR;
+}
+
+uint64_t OperationBase::GetBatchTilingSize() const
+{
+    // 带tiling下发时tiling随kernel参数一起下发，不需要拷贝
+    if (runnerVariantPack_.context == nullptr || runnerVariantPack_.context->GetLaunchWithTilingStatus()) {
+        return 0;
+    }
+    return runnerVariantPack_.tilingBufferSize;
+}
+
+const uint8_t *OperationBase::GetHostTilingBuffer() const
+{
+    return hostTilingBuffer_;
+}
+
+Status OperationBase::BatchExecute(const VariantPack &variantPack, uint8_t *workspace, uint64_t workspaceSize,
+                                   uint8_t *deviceTilingBuffer)
+{
+    // 复用Execute的PreLaunch与Launch流程，校验已在BatchExecuteCheck中完成，tiling已由ExecuteBatch统一拷贝
+    isBatchExecuting_ = true;
+    batchDeviceTilingBuffer_ = deviceTilingBuffer;
+    Status st = OperationBase::Execute(variantPack, workspace, workspaceSize, runnerVariantPack_.context);
+    isBatchExecuting_ = false;
+    batchDeviceTilingBuffer_ = nullptr;
+    return st;
+}
 } // namespace atb
@@ -17,8 +17,11 @@
 #include <acl/acl_mdl.h>
 #include "mki/utils/operationir/operation_ir_cfg.h"
 #include "atb/operation.h"
+#include "atb/operation/operation_ir.h"
+#include "atb/operation/infer_shape_cache.h"
 #include "atb/runner/runner.h"
 #include "atb/utils/runner_variant_pack.h"
+#include "atb/utils/statistic.h"
 #include "atb/context.h"
 
 namespace atb {
@@ -31,6 +34,8 @@ enum ProfilingFuncName : int {
     OPERATION_MAX
 };
 
+class MstxMemRegister;
+
 class OperationBase : public Operation {
 public:
     explicit OperationBase(const std::string &name);
@@ -40,6 +45,15 @@ public:
     Status Setup(const VariantPack &variantPack, uint64_t &workspaceSize, Context *context) override;
     Status Execute(const VariantPack &variantPack, uint8_t *workspace, uint64_t workspaceSize,
                    Context *context) override;
+    // 复用上一次Setup的结果，仅更新tensor地址后执行
+    Status ExecuteWithNewAddresses(const VariantPack &variantPack, uint8_t *workspace, uint64_t workspaceSize,
+                                   Context *context);
+    // 按各shape档位执行InferShape与Setup，不下发，用于预热runner与各级缓存
+    Status Warmup(const std::vector<SVector<TensorDesc>> &buckets, Context *context,
+                  std::vector<WarmupBucketResult> &results);
+    // 按输入描述信息推导输出，构造不带device地址的variantPack
+    static Status BuildWarmupVariantPack(const Operation &operation, const SVector<TensorDesc> &inTensorDescs,
+                                         VariantPack &variantPack);
     Status SetOperationBaseIds(const std::vector<int64_t> &operationBaseIds, const int64_t nodeId);
     virtual nlohmann::json GetParamJson() const;
     const std::vector<int64_t> &GetOperationBaseIds();
@@ -47,13 +61,29 @@ public:
     virtual void SetExecuteStreamId(uint32_t streamId);
     virtual uint32_t GetExecuteStreamId() const;
     aclrtStream GetExecuteStream(Context *context) const;
-    Mki::OperationIr* GetOperationIr() const;
+    const OperationIr *GetOperationIr() const;
+    // 以下接口供ExecuteBatch使用：先整体校验，再合并拷贝所有tiling，最后依次下发
+    Status BatchExecuteCheck(const VariantPack &variantPack, const uint8_t *workspace, uint64_t workspaceSize,
+                             Context *context);
+    uint64_t GetBatchTilingSize() const;
+    const uint8_t *GetHostTilingBuffer() const;
+    Status BatchExecute(const VariantPack &variantPack, uint8_t *workspace, uint64_t workspaceSize,
+                        uint8_t *deviceTilingBuffer);
+    // 开启执行流共享workspace且调用方传入的workspace不足时，返回需从Context获取的workspace大小，否则返回0
+    uint64_t GetStreamArenaWorkspaceSize(uint64_t workspaceSize) const;
+    // 参数更新后调用，使之前缓存的InferShape结果失效
+    void InvalidateInferShapeCache();
+    const GraphCaptureStatistic &GetGraphCaptureStatistic() const;
 
 protected:
     virtual Status InferShapeImpl(const SVector<TensorDesc> &inTensorDescs,
                                   SVector<TensorDesc> &outTensorDescs) const = 0;
     virtual Status InferShapeCheckImpl(const SVector<TensorDesc> &inTensorDescs) const;
     virtual Status SetupCheckImpl(const SVector<Tensor> &inTensors, const SVector<Tensor> &outTensors) const;
+    // 预热单个shape档位，返回该档位实际需要的workspace大小；Setup依赖hostData的组合类Operation可重写
+    virtual Status WarmupSetup(const VariantPack &variantPack, Context *context, uint64_t &workspaceSize);
+    // InferShape结果是否只由输入描述与本Operation的参数决定，嵌套其他Operation的组合类Operation需返回false
+    virtual bool IsInferShapeCacheable() const;
     void InitEmptyInTensorPerms() const;
     void InitEmptyOutTensorPerms() const;
     virtual SVector<bool> GetEmptyInTensorPermissions() const;
@@ -67,12 +97,30 @@ protected:
 protected:
     std::string name_;
     std::vector<int64_t> operationBaseIds_;
-    Mki::OperationIr *operationIr_ = nullptr;
+    const OperationIr *operationIr_ = nullptr;
     mutable SVector<bool> emptyInTensorPerms_;
     mutable SVector<bool> emptyOutTensorPerms_;
     RunnerVariantPack runnerVariantPack_;
     std::shared_ptr<Runner> runner_;
 
+private:
+    // 整图下发模式下一个shape档位的捕获状态，当前档位的状态保存在runner_、model_等成员中
+    struct GraphCaptureEntry {
+        uint64_t hash = 0;
+        uint64_t lastUseTick = 0;
+        std::shared_ptr<Runner> runner;
+        RunnerVariantPack runnerVariantPack;
+        uint64_t workspaceSize = 0;
+        bool useStreamArena = false;
+        aclmdlRI model = nullptr;
+        aclrtStream replayStream = nullptr;
+        bool isModelOwner = false; // 由本Operation捕获的模型才由本Operation销毁
+        uint64_t argsBufferSize = 0;
+        void *deviceArgsBuffer = nullptr;
+        void *hostArgsBuffer = nullptr;
+        void *lastWorkspaceAddr = nullptr;
+    };
+
 private:
     void Reset();
     Status InferShapeCheck(const SVector<TensorDesc> &inTensorDescs) const;
@@ -82,6 +130,7 @@ private:
     Status SetupThrowPrepare(uint64_t &workspaceSize, Context *context);
     Status PreExecuteThrow(const VariantPack &variantPack, uint8_t *workspace, uint64_t workspaceSize);
     Status PreLaunch(const VariantPack &variantPack, uint8_t *workspace, uint64_t workspaceSize, Context *context);
+    Status GetStreamArenaWorkspace(uint8_t *&workspace, uint64_t &workspaceSize);
     Status Launch();
     Status SetupThrow(const VariantPack &variantPack, uint64_t &workspaceSize);
     Status ExecuteCheck(const VariantPack &variantPack, const uint8_t *workspace, uint64_t workspaceSize,
@@ -103,6 +152,7 @@ private:
     bool CheckIniMatch(const SVector<Tensor> &inTensors, const SVector<Tensor> &outTensors) const;
     void SetSaveTensorDir();
     void UpdateTensorData(const VariantPack &variantPack, uint8_t *workspace);
+    void UpdateTensorData(const VariantPack &variantPack, uint8_t *workspace, uint8_t *deviceTilingBuffer);
     std::string VariantPackToString(const VariantPack &variantPack) const;
     Status CreateRunnerFunc(Context *context);
     void ResetLogPrefix();
@@ -116,8 +166,16 @@ private:
                                 Context *context);
     Status EagerModeLaunch();
     Status GraphModeLaunch();
+    static uint64_t CalcGraphCaptureHash(const VariantPack &variantPack);
+    void SaveGraphCaptureEntry(GraphCaptureEntry &entry);
+    void LoadGraphCaptureEntry(GraphCaptureEntry &entry);
+    void ReleaseGraphCaptureEntry(GraphCaptureEntry &entry, bool syncStream);
+    void EvictGraphCaptureEntries();
     void ProfilingPrepare();
     Status CopyArgsToDevice(Context *context) const;
+    uint32_t GetTraceNameId();
+    void RecordMemAccounting();
+    std::shared_ptr<MstxMemRegister> RegisterMstxWorkspace(uint8_t *workspace, uint64_t workspaceSize);
 
 private:
     std::string logPrefix_;
@@ -127,9 +185,13 @@ private:
     std::vector<uint32_t> typeIdArray_;
     size_t executeCount_ = 0;
     uint64_t workspaceSize_ = 0;
+    bool useStreamArena_ = false; // Setup返回0，Execute时从Context获取执行流共享的workspace
+    bool isBatchExecuting_ = false; // ExecuteBatch下发中，跳过已完成的校验与tiling拷贝
+    uint8_t *batchDeviceTilingBuffer_ = nullptr;
     bool isProfArrayInited_ = false;
     uint32_t streamId_ = 0;
     aclmdlRI model_ = nullptr;
+    aclrtStream replayStream_ = nullptr; // model_最近一次重放所在的流，销毁模型前需先同步
     uint64_t argsBufferSize_ = 0;
     void *deviceArgsBuffer_ = nullptr;
     void *hostArgsBuffer_ = nullptr;
@@ -137,6 +199,16 @@ private:
     void *lastWorkspaceAddr_ = nullptr;
     bool isCaptured_ = false;
     bool isGraphLaunchMode_ = false;  // 规避先调用DestroyContext再调用DestroyOperation的core问题
+    uint32_t traceNameId_ = 0;
+    uint32_t memNameId_ = 0;
+    uint64_t paramVersion_ = 0;
+    bool isModelOwner_ = false;
+    uint64_t graphCaptureHash_ = 0;
+    uint64_t graphCaptureTick_ = 0;
+    uint64_t graphCaptureLastUseTick_ = 0;
+    std::vector<GraphCaptureEntry> graphCaptureEntries_; // 非当前shape档位的已捕获模型
+    GraphCaptureStatistic graphCaptureStatistic_;
+    mutable InferShapeCache inferShapeCache_;
 };
 } // namespace atb
 #endif
\ No newline at end of file
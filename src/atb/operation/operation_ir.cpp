@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/operation/operation_ir.h"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include "atb/utils/tensor_check.h"
+
+namespace atb {
+uint64_t TensorInfoIr::GetSupportMask(aclDataType dtype, aclFormat format) const
+{
+    uint64_t dtypeMask = 0;
+    for (uint32_t i = 0; i < dtypeMaskNum; ++i) {
+        if (dtypeMasks[i].dtype == dtype) {
+            dtypeMask = dtypeMasks[i].supportMask;
+            break;
+        }
+    }
+    if (dtypeMask == 0) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < formatMaskNum; ++i) {
+        if (formatMasks[i].format == format) {
+            return dtypeMask & formatMasks[i].supportMask;
+        }
+    }
+    return 0;
+}
+
+bool OperationIr::IsValid() const
+{
+    if (supportSize == 0 || supportSize > MAX_OPERATION_IR_SUPPORT_SIZE) {
+        return false;
+    }
+    return (inTensorNum == 0 || inTensorInfoIrs != nullptr) && (outTensorNum == 0 || outTensorInfoIrs != nullptr);
+}
+
+size_t OperationIr::GetSupportSize() const
+{
+    return supportSize;
+}
+
+size_t OperationIr::GetInTensorNum() const
+{
+    return inTensorNum;
+}
+
+size_t OperationIr::GetOutTensorNum() const
+{
+    return outTensorNum;
+}
+
+const TensorInfoIr &OperationIr::GetInTensorInfoIr(size_t index) const
+{
+    return inTensorInfoIrs[index];
+}
+
+const TensorInfoIr &OperationIr::GetOutTensorInfoIr(size_t index) const
+{
+    return outTensorInfoIrs[index];
+}
+
+uint64_t OperationIr::GetAllSupportMask() const
+{
+    return supportSize >= MAX_OPERATION_IR_SUPPORT_SIZE ? UINT64_MAX : ((1ULL << supportSize) - 1);
+}
+
+static inline const TensorDesc &GetTensorDesc(const TensorDesc &tensorDesc)
+{
+    return tensorDesc;
+}
+
+static inline const TensorDesc &GetTensorDesc(const Tensor &tensor)
+{
+    return tensor.desc;
+}
+
+template <typename TensorType>
+static uint64_t MatchTensors(const SVector<TensorType> &tensors, const TensorInfoIr *tensorInfoIrs,
+                             uint64_t supportMask)
+{
+    for (size_t i = 0; i < tensors.size() && supportMask != 0; ++i) {
+        if (TensorCheck::IsEmptyTensor(tensors[i])) {
+            continue;
+        }
+        const TensorDesc &desc = GetTensorDesc(tensors[i]);
+        supportMask &= tensorInfoIrs[i].GetSupportMask(desc.dtype, desc.format);
+    }
+    return supportMask;
+}
+
+uint64_t OperationIr::MatchInTensors(const SVector<TensorDesc> &inTensorDescs) const
+{
+    return MatchTensors(inTensorDescs, inTensorInfoIrs, GetAllSupportMask());
+}
+
+uint64_t OperationIr::MatchInTensors(const SVector<Tensor> &inTensors) const
+{
+    return MatchTensors(inTensors, inTensorInfoIrs, GetAllSupportMask());
+}
+
+uint64_t OperationIr::MatchOutTensors(const SVector<Tensor> &outTensors) const
+{
+    return MatchTensors(outTensors, outTensorInfoIrs, GetAllSupportMask());
+}
+
+static void TensorInfoIrsToString(std::stringstream &ss, const char *prefix, const TensorInfoIr *tensorInfoIrs,
+                                  uint32_t tensorNum, uint32_t supportSize)
+{
+    for (uint32_t i = 0; i < tensorNum; ++i) {
+        const TensorInfoIr &tensorInfoIr = tensorInfoIrs[i];
+        ss << ", " << prefix << i << ": {name: " << tensorInfoIr.name << ", optional: " << tensorInfoIr.isOptional
+           << ", dtype: [";
+        for (uint32_t j = 0; j < supportSize; ++j) {
+            ss << (j == 0 ? "" : ",") << tensorInfoIr.supportedDtypes[j];
+        }
+        ss << "], format: [";
+        for (uint32_t j = 0; j < supportSize; ++j) {
+            ss << (j == 0 ? "" : ",") << tensorInfoIr.supportedFormats[j];
+        }
+        ss << "]}";
+    }
+}
+
+std::string OperationIr::ToString() const
+{
+    std::stringstream ss;
+    ss << "opKey: " << opKey << ", supportSize: " << supportSize;
+    TensorInfoIrsToString(ss, "input", inTensorInfoIrs, inTensorNum, supportSize);
+    TensorInfoIrsToString(ss, "output", outTensorInfoIrs, outTensorNum, supportSize);
+    return ss.str();
+}
+
+const OperationIr *FindOperationIr(const OperationIr *operationIrs, size_t operationIrNum, const std::string &opKey)
+{
+    if (operationIrs == nullptr || operationIrNum == 0) {
+        return nullptr;
+    }
+    const OperationIr *end = operationIrs + operationIrNum;
+    const OperationIr *it = std::lower_bound(operationIrs, end, opKey.c_str(),
+        [](const OperationIr &operationIr, const char *key) { return std::strcmp(operationIr.opKey, key) < 0; });
+    if (it == end || std::strcmp(it->opKey, opKey.c_str()) != 0) {
+        return nullptr;
+    }
+    return it;
+}
+} // namespace atb
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_OPERATION_IR_H
+#define ATB_OPERATION_IR_H
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <acl/acl.h>
+#include "atb/types.h"
+#include "atb/svector.h"
+
+namespace atb {
+// 单个支持组合的最大数量，支持组合序号按位存放在uint64_t中
+constexpr size_t MAX_OPERATION_IR_SUPPORT_SIZE = 64;
+
+struct IrDtypeMask {
+    aclDataType dtype;
+    uint64_t supportMask; // 第i位为1表示第i个支持组合接受该dtype
+};
+
+struct IrFormatMask {
+    aclFormat format;
+    uint64_t supportMask; // 第i位为1表示第i个支持组合接受该format
+};
+
+// 以下结构体由scripts/build_operation_ir_table.py在编译期根据ini生成，均为常量初始化，运行时无需解析
+struct TensorInfoIr {
+    const char *name;
+    bool isOptional;
+    const aclDataType *supportedDtypes; // 长度为supportSize
+    const aclFormat *supportedFormats;  // 长度为supportSize
+    const IrDtypeMask *dtypeMasks;
+    uint32_t dtypeMaskNum;
+    const IrFormatMask *formatMasks;
+    uint32_t formatMaskNum;
+
+    // 返回接受该dtype与format的支持组合位图
+    uint64_t GetSupportMask(aclDataType dtype, aclFormat format) const;
+};
+
+struct OperationIr {
+    const char *opKey;
+    uint32_t supportSize;
+    const TensorInfoIr *inTensorInfoIrs;
+    uint32_t inTensorNum;
+    const TensorInfoIr *outTensorInfoIrs;
+    uint32_t outTensorNum;
+
+    bool IsValid() const;
+    size_t GetSupportSize() const;
+    size_t GetInTensorNum() const;
+    size_t GetOutTensorNum() const;
+    const TensorInfoIr &GetInTensorInfoIr(size_t index) const;
+    const TensorInfoIr &GetOutTensorInfoIr(size_t index) const;
+    // 全部支持组合的位图
+    uint64_t GetAllSupportMask() const;
+    // 返回同时满足所有tensor的支持组合位图，空tensor不参与匹配，结果非0即匹配成功
+    uint64_t MatchInTensors(const SVector<TensorDesc> &inTensorDescs) const;
+    uint64_t MatchInTensors(const SVector<Tensor> &inTensors) const;
+    uint64_t MatchOutTensors(const SVector<Tensor> &outTensors) const;
+    std::string ToString() const;
+};
+
+// 按opKey升序排列的编译期IR表，opKey不存在时返回nullptr
+const OperationIr *FindOperationIr(const OperationIr *operationIrs, size_t operationIrNum, const std::string &opKey);
+const OperationIr *GetAtbOperationIrs(size_t &operationIrNum);
+const OperationIr *GetCustomizeOperationIrs(size_t &operationIrNum);
+} // namespace atb
+#endif
@@ -53,6 +53,12 @@ Status PluginOperation::InferShapeImpl(const SVector<TensorDesc> &inTensorDescs,
     return ERROR_INVALID_PARAM;
 }
 
+// 用户自定义Operation的推导可能依赖其内部状态，不做缓存
+bool PluginOperation::IsInferShapeCacheable() const
+{
+    return false;
+}
+
 std::shared_ptr<Runner> PluginOperation::CreateRunner(Context &context) const
 {
     (void)context;
@@ -28,6 +28,7 @@ public:
 
 protected:
     Status InferShapeImpl(const SVector<TensorDesc> &inTensorDescs, SVector<TensorDesc> &outTensorDescs) const override;
+    bool IsInferShapeCacheable() const override;
     std::shared_ptr<Runner> CreateRunner(Context &context) const override;
 
 private:
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/operation/switch_operation.h"
+#include <algorithm>
+#include "atb/types.h"
+#include "atb/utils/log.h"
+
+namespace atb {
+static Status ParamCheck(const common::SwitchParam &param)
+{
+    if (param.branches.empty()) {
+        ATB_LOG(ERROR) << "branches is empty, please check the param";
+        return ERROR_INVALID_PARAM;
+    }
+    if (!param.selectByTensor && !param.handle) {
+        ATB_LOG(ERROR) << "Handle is null and selectByTensor is false, please check the param";
+        return ERROR_INVALID_PARAM;
+    }
+    for (size_t i = 0; i < param.branches.size(); ++i) {
+        if (!param.branches.at(i)) {
+            ATB_LOG(ERROR) << "branches[" << i << "] is null, please check the param";
+            return ERROR_INVALID_PARAM;
+        }
+        if (param.branches.at(i)->GetInputNum() != param.branches.at(0)->GetInputNum()) {
+            ATB_LOG(ERROR) << "Input num of branches[" << i
+                           << "] and branches[0] are not equal, please check the param";
+            return ERROR_INVALID_PARAM;
+        }
+        if (param.branches.at(i)->GetOutputNum() != param.branches.at(0)->GetOutputNum()) {
+            ATB_LOG(ERROR) << "Output num of branches[" << i
+                           << "] and branches[0] are not equal, please check the param";
+            return ERROR_INVALID_PARAM;
+        }
+    }
+    return NO_ERROR;
+}
+
+template <> Status CreateOperation(const common::SwitchParam &opParam, Operation **operation)
+{
+    if (operation == nullptr) {
+        ATB_LOG(ERROR) << "Invalid param, operation is nullptr";
+        return ERROR_INVALID_PARAM;
+    }
+    Status st = ParamCheck(opParam);
+    if (st != NO_ERROR) {
+        return st;
+    }
+    *operation = new (std::nothrow) SwitchOperation(opParam);
+    if (*operation == nullptr) {
+        ATB_LOG(ERROR) << "Failed to new switch operation";
+        return ERROR_OUT_OF_HOST_MEMORY;
+    }
+    return NO_ERROR;
+}
+
+SwitchOperation::SwitchOperation(const common::SwitchParam &param)
+    : OperationBase("SwitchOperation"), param_(param), branchWorkspaceSizes_(param.branches.size(), 0)
+{
+}
+
+SwitchOperation::~SwitchOperation() {}
+
+std::string SwitchOperation::GetName() const
+{
+    return "SwitchOperation";
+}
+
+Status SwitchOperation::GetBranchIndexFromHandle(size_t &branchIndex) const
+{
+    int32_t index = -1;
+    try {
+        index = param_.handle(param_.userData);
+    } catch (const std::exception &e) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "Get branch index failed, please check handle function";
+        return ERROR_INVALID_PARAM;
+    }
+    if (index < 0 || static_cast<size_t>(index) >= param_.branches.size()) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "Branch index " << index << " is out of range [0, "
+                       << param_.branches.size() << ")";
+        return ERROR_INVALID_PARAM;
+    }
+    branchIndex = static_cast<size_t>(index);
+    return NO_ERROR;
+}
+
+Status SwitchOperation::GetBranchIndex(const VariantPack &variantPack, size_t &branchIndex) const
+{
+    if (!param_.selectByTensor) {
+        return GetBranchIndexFromHandle(branchIndex);
+    }
+    if (variantPack.inTensors.size() != GetInputNum()) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "inTensors size:" << variantPack.inTensors.size()
+                       << " is not equal to input num:" << GetInputNum();
+        return ERROR_INVALID_IN_TENSOR_NUM;
+    }
+    const Tensor &selector = variantPack.inTensors.at(variantPack.inTensors.size() - 1);
+    if (selector.hostData == nullptr || selector.desc.dtype != ACL_INT32 || selector.dataSize < sizeof(int32_t)) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "Selector tensor should be an int32 tensor with hostData, dtype:"
+                       << selector.desc.dtype << ", hostData:" << selector.hostData;
+        return ERROR_INVALID_PARAM;
+    }
+    int32_t index = *static_cast<const int32_t *>(selector.hostData);
+    if (index < 0 || static_cast<size_t>(index) >= param_.branches.size()) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "Branch index " << index << " is out of range [0, "
+                       << param_.branches.size() << ")";
+        return ERROR_INVALID_PARAM;
+    }
+    branchIndex = static_cast<size_t>(index);
+    return NO_ERROR;
+}
+
+void SwitchOperation::BuildBranchVariantPack(const VariantPack &variantPack, VariantPack &branchVariantPack) const
+{
+    branchVariantPack = variantPack;
+    if (param_.selectByTensor && !branchVariantPack.inTensors.empty()) {
+        branchVariantPack.inTensors.resize(branchVariantPack.inTensors.size() - 1);
+    }
+}
+
+Status SwitchOperation::Setup(const VariantPack &variantPack, uint64_t &workspaceSize, Context *context)
+{
+    size_t branchIndex = 0;
+    Status st = GetBranchIndex(variantPack, branchIndex);
+    if (st != NO_ERROR) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "Failed to select branch!";
+        return st;
+    }
+    if (selectedIndex_ != static_cast<int64_t>(branchIndex)) {
+        ATB_LOG(INFO) << GetLogPrefix() << "Switch branch from " << selectedIndex_ << " to " << branchIndex;
+        selectedIndex_ = static_cast<int64_t>(branchIndex);
+    }
+    VariantPack branchVariantPack;
+    BuildBranchVariantPack(variantPack, branchVariantPack);
+    uint64_t branchWorkspaceSize = 0;
+    st = param_.branches.at(branchIndex)->Setup(branchVariantPack, branchWorkspaceSize, context);
+    if (st != NO_ERROR) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "Setup branches[" << branchIndex << "] failed! ret:" << st;
+        return st;
+    }
+    // 返回当前分支与此前Setup或预热过的分支所需大小的最大值，未Setup过的分支不计入，
+    // 首次切换到所需更大的分支时返回值会变大，调用方须按每次Setup的返回值申请workspace
+    branchWorkspaceSizes_.at(branchIndex) = branchWorkspaceSize;
+    workspaceSize = *std::max_element(branchWorkspaceSizes_.begin(), branchWorkspaceSizes_.end());
+    ATB_LOG(INFO) << GetLogPrefix() << "Setup branches[" << branchIndex << "] success, branch workspaceSize:"
+                  << branchWorkspaceSize << ", workspaceSize:" << workspaceSize;
+    return NO_ERROR;
+}
+
+// 预热时选择子没有hostData，且之后任一分支都可能被选中，因此逐个预热全部分支
+Status SwitchOperation::WarmupSetup(const VariantPack &variantPack, Context *context, uint64_t &workspaceSize)
+{
+    VariantPack branchVariantPack;
+    BuildBranchVariantPack(variantPack, branchVariantPack);
+    std::vector<SVector<TensorDesc>> branchBuckets(1);
+    for (const Tensor &inTensor : branchVariantPack.inTensors) {
+        branchBuckets.at(0).push_back(inTensor.desc);
+    }
+    for (size_t i = 0; i < param_.branches.size(); ++i) {
+        std::vector<WarmupBucketResult> branchResults;
+        Status st = atb::Warmup(param_.branches.at(i), branchBuckets, context, branchResults);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "Warmup branches[" << i << "] failed! ret:" << st;
+            return st;
+        }
+        branchWorkspaceSizes_.at(i) = branchResults.at(0).workspaceSize;
+    }
+    workspaceSize = *std::max_element(branchWorkspaceSizes_.begin(), branchWorkspaceSizes_.end());
+    return NO_ERROR;
+}
+
+Status SwitchOperation::Execute(const VariantPack &variantPack, uint8_t *workspace, uint64_t workspaceSize,
+                                Context *context)
+{
+    if (selectedIndex_ < 0) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "Branch not selected, please call Setup before Execute";
+        return ERROR_INVALID_PARAM;
+    }
+    VariantPack branchVariantPack;
+    BuildBranchVariantPack(variantPack, branchVariantPack);
+    return param_.branches.at(static_cast<size_t>(selectedIndex_))
+        ->Execute(branchVariantPack, workspace, workspaceSize, context);
+}
+
+uint32_t SwitchOperation::GetInputNum() const
+{
+    return param_.branches.at(0)->GetInputNum() + (param_.selectByTensor ? 1 : 0);
+}
+
+uint32_t SwitchOperation::GetOutputNum() const
+{
+    return param_.branches.at(0)->GetOutputNum();
+}
+
+void SwitchOperation::SetExecuteStreamId(uint32_t streamId)
+{
+    for (size_t i = 0; i < param_.branches.size(); ++i) {
+        Status st = atb::SetExecuteStreamId(param_.branches.at(i), streamId);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "Calling SetExecuteStreamId for branches[" << i << "] failed!";
+            return;
+        }
+    }
+}
+
+Status SwitchOperation::InferShapeImpl(const SVector<TensorDesc> &inTensorDescs,
+                                       SVector<TensorDesc> &outTensorDescs) const
+{
+    if (!param_.selectByTensor) {
+        return param_.branches.at(0)->InferShape(inTensorDescs, outTensorDescs);
+    }
+    SVector<TensorDesc> branchInTensorDescs = inTensorDescs;
+    if (!branchInTensorDescs.empty()) {
+        branchInTensorDescs.resize(branchInTensorDescs.size() - 1);
+    }
+    return param_.branches.at(0)->InferShape(branchInTensorDescs, outTensorDescs);
+}
+
+// 推导结果由分支Operation决定，分支自身带有缓存
+bool SwitchOperation::IsInferShapeCacheable() const
+{
+    return false;
+}
+
+std::shared_ptr<Runner> SwitchOperation::CreateRunner(Context &context) const
+{
+    if (selectedIndex_ < 0) {
+        // 作为图的节点时在此处选择分支，此时没有tensor，只能通过回调选择
+        size_t branchIndex = 0;
+        if (param_.selectByTensor || GetBranchIndexFromHandle(branchIndex) != NO_ERROR) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "Failed to select branch when creating runner!";
+            return nullptr;
+        }
+        selectedIndex_ = static_cast<int64_t>(branchIndex);
+    }
+    OperationBase *opBase = dynamic_cast<OperationBase *>(param_.branches.at(static_cast<size_t>(selectedIndex_)));
+    if (!opBase) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "Failed to convert Operation to OperationBase";
+        return nullptr;
+    }
+    return opBase->CreateRunner(context);
+}
+} // namespace atb
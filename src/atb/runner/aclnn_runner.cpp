@@ -8,6 +8,7 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 #include "atb/runner/aclnn_runner.h"
+#include <set>
 #include "atb/kernel_cache/aclnn_executor_cache.h"
 #include "atb/utils/aclnn_util.h"
 #include "atb/utils/log.h"
@@ -15,6 +16,7 @@
 #include "atb/utils/operation_register.h"
 
 namespace atb {
+static constexpr size_t MAX_REUSABLE_ACLNN_VARIANT_PACK_NUM = 16;
 
 AclnnRunner::AclnnRunner(const std::string &name) : Runner(name)
 {
@@ -23,22 +25,25 @@ AclnnRunner::AclnnRunner(const std::string &name) : Runner(name)
 
 AclnnRunner::~AclnnRunner()
 {
-    for (size_t i = 0; i < aclnnVariantPack_.aclInTensorList.size(); i++) {
-        if (aclnnVariantPack_.aclInTensorList.at(i)) {
-            if (aclDestroyTensorList(aclnnVariantPack_.aclInTensorList.at(i)) != ACL_SUCCESS) {
-                ATB_LOG(ERROR) << "aclInTensorList[" << i << "] aclDestroyTensorList failed";
-            }
-            aclnnVariantPack_.aclInTensorList.at(i) = nullptr;
+    // 复用的variant pack与当前aclnnVariantPack_可能共用同一个aclTensorList，去重后再释放
+    std::set<aclTensorList *> aclTensorLists(aclnnVariantPack_.aclInTensorList.begin(),
+                                             aclnnVariantPack_.aclInTensorList.end());
+    aclTensorLists.insert(aclnnVariantPack_.aclOutTensorList.begin(), aclnnVariantPack_.aclOutTensorList.end());
+    for (const std::vector<ReusableAclnnVariantPack> *reusablePacks :
+         {&reusableAclnnVariantPacks_, &retiredAclnnVariantPacks_}) {
+        for (const ReusableAclnnVariantPack &reusablePack : *reusablePacks) {
+            const AclNNVariantPack &variantPack = reusablePack.variantPack;
+            aclTensorLists.insert(variantPack.aclInTensorList.begin(), variantPack.aclInTensorList.end());
+            aclTensorLists.insert(variantPack.aclOutTensorList.begin(), variantPack.aclOutTensorList.end());
         }
     }
-    for (size_t i = 0; i < aclnnVariantPack_.aclOutTensorList.size(); i++) {
-        if (aclnnVariantPack_.aclOutTensorList.at(i)) {
-            if (aclDestroyTensorList(aclnnVariantPack_.aclOutTensorList.at(i)) != ACL_SUCCESS) {
-                ATB_LOG(ERROR) << "aclOutTensorList[" << i << "] aclDestroyTensorList failed";
-            }
-            aclnnVariantPack_.aclOutTensorList.at(i) = nullptr;
+    for (aclTensorList *tensorList : aclTensorLists) {
+        if (tensorList && aclDestroyTensorList(tensorList) != ACL_SUCCESS) {
+            ATB_LOG(ERROR) << "aclTensorList aclDestroyTensorList failed";
         }
     }
+    reusableAclnnVariantPacks_.clear();
+    retiredAclnnVariantPacks_.clear();
     aclnnVariantPack_.aclInTensorList.clear();
     aclnnVariantPack_.aclOutTensorList.clear();
     aclnnVariantPack_.aclInTensors.clear();
@@ -59,11 +64,8 @@ Status AclnnRunner::SetupImpl(RunnerVariantPack &runnerVariantPack)
     if (executorRepeatable_ &&
         GetSingleton<AclnnExecutorCache>().FetchCacheSlot(opName, runnerVariantPack, aclnnCacheSlot) == NO_ERROR) {
         if (!IsAclnnRunnerVariankPackEqual(this->aclnnVariantPack_, runnerVariantPack)) {
-            ATB_LOG(INFO) << GetLogPrefix()
-                          << "fetched cached runnerVariantPack not same as aclnnVariantPack_, build again";
-            ret = BuildAclnnVariantPack(runnerVariantPack);
+            ret = PrepareAclnnVariantPack(runnerVariantPack, aclnnCacheSlot.executor);
             if (ret != NO_ERROR) {
-                ATB_LOG(ERROR) << GetLogPrefix() << "BuildAclnnVariantPack failed!";
                 return ret;
             }
         }
@@ -98,6 +100,9 @@ Status AclnnRunner::SetupImpl(RunnerVariantPack &runnerVariantPack)
         ATB_LOG(INFO) << this->GetName() << " call aclSetAclOpExecutorRepeatable success: ";
         this->executorRepeatable_ = true;
     }
+    if (this->executorRepeatable_) {
+        SaveReusableAclnnVariantPack(this->aclnnExecutor_);
+    }
     aclnnCacheSlot = {this->atbVariantPack_.workspaceBufferSize, aclnnExecutor_};
     ret = GetSingleton<AclnnExecutorCache>().AddCacheSlot(opName, runnerVariantPack, aclnnCacheSlot);
     if (ret != NO_ERROR) {
@@ -108,6 +113,100 @@ Status AclnnRunner::SetupImpl(RunnerVariantPack &runnerVariantPack)
     return ret;
 }
 
+Status AclnnRunner::PrepareAclnnVariantPack(const RunnerVariantPack &runnerVariantPack,
+                                            const std::shared_ptr<aclOpExecutor> &executor)
+{
+    Status ret = NO_ERROR;
+    if (FetchReusableAclnnVariantPack(runnerVariantPack)) {
+        ATB_LOG(INFO) << GetLogPrefix() << "reuse aclTensors of cached runnerVariantPack, only rebind tensor addr";
+        ret = ReuseAclnnVariantPack(runnerVariantPack);
+        if (ret != NO_ERROR) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "ReuseAclnnVariantPack failed!";
+        }
+        return ret;
+    }
+    ATB_LOG(INFO) << GetLogPrefix() << "fetched cached runnerVariantPack not same as aclnnVariantPack_, build again";
+    ret = BuildAclnnVariantPack(runnerVariantPack);
+    if (ret != NO_ERROR) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "BuildAclnnVariantPack failed!";
+        return ret;
+    }
+    SaveReusableAclnnVariantPack(executor);
+    return NO_ERROR;
+}
+
+bool AclnnRunner::FetchReusableAclnnVariantPack(const RunnerVariantPack &runnerVariantPack)
+{
+    if (!IsAclnnVariantPackReusable()) {
+        return false;
+    }
+    for (const ReusableAclnnVariantPack &reusablePack : reusableAclnnVariantPacks_) {
+        if (IsAclnnRunnerVariankPackEqual(reusablePack.variantPack, runnerVariantPack)) {
+            this->aclnnVariantPack_ = reusablePack.variantPack;
+            return true;
+        }
+    }
+    return false;
+}
+
+void AclnnRunner::SaveReusableAclnnVariantPack(const std::shared_ptr<aclOpExecutor> &executor)
+{
+    if (!IsAclnnVariantPackReusable()) {
+        return;
+    }
+    // 与AclnnExecutorCache保持一致：等长vector + FIFO淘汰
+    if (reusableAclnnVariantPacks_.size() < MAX_REUSABLE_ACLNN_VARIANT_PACK_NUM) {
+        reusableAclnnVariantPacks_.push_back({this->aclnnVariantPack_, executor});
+        return;
+    }
+    RetireAclnnVariantPack(std::move(reusableAclnnVariantPacks_.at(nextReplaceIndex_)));
+    reusableAclnnVariantPacks_.at(nextReplaceIndex_) = {this->aclnnVariantPack_, executor};
+    nextReplaceIndex_ = (nextReplaceIndex_ + 1) % MAX_REUSABLE_ACLNN_VARIANT_PACK_NUM;
+}
+
+void AclnnRunner::RetireAclnnVariantPack(ReusableAclnnVariantPack &&reusablePack)
+{
+    // 被淘汰的aclTensorList可能仍被AclnnExecutorCache或当前aclnnExecutor_中的executor引用，
+    // 先挂起，待executor只剩此处引用后再释放。挂起数量受AclnnExecutorCache容量约束
+    retiredAclnnVariantPacks_.push_back(std::move(reusablePack));
+    ReleaseRetiredAclnnVariantPacks();
+}
+
+void AclnnRunner::ReleaseRetiredAclnnVariantPacks()
+{
+    auto it = retiredAclnnVariantPacks_.begin();
+    while (it != retiredAclnnVariantPacks_.end()) {
+        if (it->executor != nullptr && it->executor.use_count() > 1) {
+            ++it;
+            continue;
+        }
+        DestroyAclTensorLists(it->variantPack);
+        it = retiredAclnnVariantPacks_.erase(it);
+    }
+}
+
+void AclnnRunner::DestroyAclTensorLists(const AclNNVariantPack &variantPack) const
+{
+    std::set<aclTensorList *> aclTensorLists(variantPack.aclInTensorList.begin(), variantPack.aclInTensorList.end());
+    aclTensorLists.insert(variantPack.aclOutTensorList.begin(), variantPack.aclOutTensorList.end());
+    for (aclTensorList *tensorList : aclTensorLists) {
+        if (tensorList && aclDestroyTensorList(tensorList) != ACL_SUCCESS) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "aclTensorList aclDestroyTensorList failed";
+        }
+    }
+}
+
+bool AclnnRunner::IsAclnnVariantPackReusable() const
+{
+    return true;
+}
+
+Status AclnnRunner::ReuseAclnnVariantPack(const RunnerVariantPack &runnerVariantPack)
+{
+    this->atbVariantPack_ = runnerVariantPack;
+    return NO_ERROR;
+}
+
 uint64_t AclnnRunner::GetWorkspaceBufferSizeImpl()
 {
     return this->atbVariantPack_.workspaceBufferSize;
@@ -10,6 +10,8 @@
 
 #ifndef ATB_ACLNN_RUNNER_H
 #define ATB_ACLNN_RUNNER_H
+#include <memory>
+#include <vector>
 #include "runner.h"
 
 namespace atb {
@@ -28,11 +30,35 @@ protected:
     uint64_t GetWorkspaceBufferSizeImpl() override;
     void UpdateWorkspace(const RunnerVariantPack &runnerVariantPack);
     virtual bool useCache();
+    // executor可复用时按variant pack签名保存已创建的aclTensor，签名命中后只需在PreExecute中刷新地址。
+    // BuildAclnnVariantPack中根据variant pack设置了额外成员的runner需重写ReuseAclnnVariantPack。
+    // 复用时不会再调用BuildAclnnVariantPack，因此在其中创建、且在Launch或下次Build时释放的
+    // aclnnVariantPack_之外的资源无法跟随签名保存，持有此类资源的runner需返回false关闭复用
+    virtual bool IsAclnnVariantPackReusable() const;
+    virtual Status ReuseAclnnVariantPack(const RunnerVariantPack &runnerVariantPack);
     int64_t runnerTypeIdx_ = -1;
     bool executorRepeatable_ = false;
     std::shared_ptr<aclOpExecutor> aclnnExecutor_ = nullptr;
     AclNNVariantPack aclnnVariantPack_;
     RunnerVariantPack atbVariantPack_;
+
+    bool FetchReusableAclnnVariantPack(const RunnerVariantPack &runnerVariantPack);
+    void SaveReusableAclnnVariantPack(const std::shared_ptr<aclOpExecutor> &executor);
+
+private:
+    // 保存的variant pack及用其创建的executor，executor仍被引用时其aclTensorList不能释放
+    struct ReusableAclnnVariantPack {
+        AclNNVariantPack variantPack;
+        std::shared_ptr<aclOpExecutor> executor;
+    };
+    Status PrepareAclnnVariantPack(const RunnerVariantPack &runnerVariantPack,
+                                   const std::shared_ptr<aclOpExecutor> &executor);
+    void RetireAclnnVariantPack(ReusableAclnnVariantPack &&reusablePack);
+    void ReleaseRetiredAclnnVariantPacks();
+    void DestroyAclTensorLists(const AclNNVariantPack &variantPack) const;
+    std::vector<ReusableAclnnVariantPack> reusableAclnnVariantPacks_;
+    std::vector<ReusableAclnnVariantPack> retiredAclnnVariantPacks_;
+    size_t nextReplaceIndex_ = 0;
 };
 } // namespace atb
 #endif
@@ -50,6 +50,12 @@ public:
                                  uint64_t maxTilingSize, uint64_t &tilingSizeFetched, bool launchWithTiling) = 0;
     virtual void AddTiling(KernelCache &kernelCache, size_t kernelIndex, uint8_t *hostTilingBuffer,
                            size_t tilingSize) const = 0;
+    // 从进程级共享缓存获取tiling，命中后回填到kernelCache
+    virtual bool GetSharedCachedTiling(KernelCache &kernelCache, uint32_t runnerTypeIdx, size_t kernelIndex,
+                                       uint8_t *kernelHostTilingBuffer, uint64_t maxTilingSize,
+                                       uint64_t &tilingSizeFetched, bool launchWithTiling) = 0;
+    virtual void AddSharedTiling(uint32_t runnerTypeIdx, size_t kernelIndex, uint8_t *hostTilingBuffer,
+                                 size_t tilingSize) const = 0;
     virtual void SetArgsDeviceBuffer(void *deviceBuffer) = 0;
     virtual void SetArgsHostBuffer(void *hostBuffer) = 0;
     virtual void *GetArgsDeviceBuffer() = 0;
@@ -60,7 +66,7 @@ public:
     // utils
     virtual Mki::SVector<Mki::Tensor> &GetInTensors() = 0;
     virtual Mki::SVector<Mki::Tensor> &GetOutTensors() = 0;
-    virtual void SaveLaunchParam(aclrtStream stream, const std::string &dirPath) const = 0;
+    virtual void SaveLaunchParam(aclrtStream stream, const std::string &dirPath, bool sampled) const = 0;
     virtual void *GetMsprofInfoKey() const = 0;
     virtual void GetReportTensors(Mki::SVector<std::pair<bool, Mki::Tensor>> &allTensors) const = 0;
     virtual uint32_t GetOpType() const = 0;
@@ -8,9 +8,12 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 #include "atb/runner/graph_runner.h"
+#include <algorithm>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <acl/acl_rt.h>
+#include <mki/utils/time/timer.h>
 #include "atb/utils/log.h"
 #include "atb/utils/mem_allocation_solver/mem_allocation_solver_creator.h"
 #include "atb/utils/tensor_util.h"
@@ -23,8 +26,6 @@
 
 namespace atb {
 const int ALIGN_INT = 512;
-constexpr uint64_t FREE_TENSOR_KEY = 65536;
-const int MAX_NODE_ID = 2048;
 
 std::string GraphRunner::Graph::ToString() const
 {
@@ -57,58 +58,80 @@ std::string GraphRunner::Graph::ToString() const
 
 void GraphRunner::Graph::Init()
 {
-    InitTensorMaxNodeMap();
+    InitTensorIds();
     InitTensorType();
-    // 临时方案，如果不是主流（streamId != 0）的node的inTensors的最大节点数全部设为2048不参与内存复用
+    InitTensorLastUseNodeIds();
+    // 临时方案，如果不是主流（streamId != 0）的node的inTensors全部不参与内存复用
     SetNonReuseTensors();
+    InitNodeLastUseTensors();
 }
 
-void GraphRunner::Graph::SetNonReuseTensors()
+size_t GraphRunner::Graph::GetTensorNum() const
 {
-    for (size_t nodeId = 0; nodeId < nodes.size(); ++nodeId) {
-        auto &node = nodes.at(nodeId);
-        uint32_t streamId = GetExecuteStreamId(node.op.get());
-        if (streamId == 0)
-            continue;
-        for (auto inTensorIt : node.inTensors) {
-            auto it = isInTensorCanFree.find(inTensorIt);
-            if (it != isInTensorCanFree.end()) {
-                // 该inTensor是大图的inTensor，不参与内存分配
-                continue; // 若intensor的isInTensorCanFree为false，不参与内存释放
-            }
-            maxNodeIdTensorMap[tensorMaxNodeIdMap[inTensorIt]].erase(inTensorIt);
-            tensorMaxNodeIdMap[inTensorIt] = MAX_NODE_ID;
-            maxNodeIdTensorMap[MAX_NODE_ID].insert(inTensorIt);
-        }
+    return inTensors.size() + outTensors.size() + internalTensors.size();
+}
+
+bool GraphRunner::Graph::IsOutTensorId(uint32_t tensorId) const
+{
+    return tensorId >= inTensors.size() && tensorId < inTensors.size() + outTensors.size();
+}
+
+bool GraphRunner::Graph::IsInternalTensorId(uint32_t tensorId) const
+{
+    return tensorId >= inTensors.size() + outTensors.size() && tensorId < GetTensorNum();
+}
+
+Tensor *GraphRunner::Graph::GetTensor(uint32_t tensorId)
+{
+    if (tensorId < inTensors.size()) {
+        return &inTensors.at(tensorId);
+    }
+    if (IsOutTensorId(tensorId)) {
+        return &outTensors.at(tensorId - inTensors.size());
     }
+    return &internalTensors.at(tensorId - inTensors.size() - outTensors.size());
 }
 
-void GraphRunner::Graph::SearchTensorInNodeInTensor(const Tensor *tensor, uint64_t &maxNodeId,
-                                                    uint64_t &dependNodeCount)
+void GraphRunner::Graph::InitTensorIds()
 {
-    for (size_t nodeId = 0; nodeId < nodes.size(); ++nodeId) {
-        auto &node = nodes.at(nodeId);
-        for (auto inTensorIt : node.inTensors) {
-            if (tensor == inTensorIt) {
-                maxNodeId = nodeId;
-                dependNodeCount++;
-            }
+    // 仅在初始化时按地址查找一次，之后setup中只按id访问数组
+    std::unordered_map<const Tensor *, uint32_t> tensorIdMap;
+    tensorIdMap.reserve(GetTensorNum());
+    for (uint32_t tensorId = 0; tensorId < GetTensorNum(); ++tensorId) {
+        tensorIdMap[GetTensor(tensorId)] = tensorId;
+    }
+    auto toTensorId = [&tensorIdMap](const Tensor *tensor) {
+        auto it = tensorIdMap.find(tensor);
+        return it == tensorIdMap.end() ? INVALID_TENSOR_ID : it->second;
+    };
+    for (auto &node : nodes) {
+        node.inTensorIds.resize(node.inTensors.size());
+        for (size_t i = 0; i < node.inTensors.size(); ++i) {
+            node.inTensorIds.at(i) = toTensorId(node.inTensors.at(i));
+        }
+        node.outTensorIds.resize(node.outTensors.size());
+        for (size_t i = 0; i < node.outTensors.size(); ++i) {
+            node.outTensorIds.at(i) = toTensorId(node.outTensors.at(i));
         }
     }
+    tensorMalloced.assign(GetTensorNum(), 0);
 }
 
-bool GraphRunner::Graph::SearchTensorInNodeOutTensor(const Tensor *tensor, uint64_t &maxNodeId)
+void GraphRunner::Graph::SetNonReuseTensors()
 {
     for (size_t nodeId = 0; nodeId < nodes.size(); ++nodeId) {
         auto &node = nodes.at(nodeId);
-        for (auto outTensorIt : node.outTensors) {
-            if (tensor == outTensorIt) {
-                maxNodeId = nodeId;
-                return true;
+        uint32_t streamId = GetExecuteStreamId(node.op.get());
+        if (streamId == 0)
+            continue;
+        for (uint32_t tensorId : node.inTensorIds) {
+            if (tensorId == INVALID_TENSOR_ID || tensorId < inTensors.size()) {
+                // 该inTensor是大图的inTensor，不参与内存分配
+                continue; // 若intensor的isInTensorCanFree为false，不参与内存释放
             }
+            tensorLastUseNodeIds.at(tensorId) = NO_FREE_NODE_ID;
         }
     }
-    return false;
 }
 
 void GraphRunner::ReserveSvector(GraphRunner::Node &node)
@@ -121,52 +144,72 @@ void GraphRunner::ReserveSvector(GraphRunner::Node &node)
     node.runnerVariantPack.isOutTensorNeedMalloc.reserve(node.outTensors.size());
 }
 
-void GraphRunner::Graph::InitTensorMaxNodeMap()
+void GraphRunner::Graph::InitTensorLastUseNodeIds()
 {
-    tensorMaxNodeIdMap.clear();
-    maxNodeIdTensorMap.clear();
+    // 一次遍历所有节点，统计每个tensor的最后读取节点、读取次数与首次写入节点
+    std::vector<uint64_t> lastReadNodeIds(GetTensorNum(), NO_FREE_NODE_ID);
+    std::vector<uint64_t> dependNodeCounts(GetTensorNum(), 0);
+    std::vector<uint64_t> firstWriteNodeIds(GetTensorNum(), NO_FREE_NODE_ID);
+    for (size_t nodeId = 0; nodeId < nodes.size(); ++nodeId) {
+        for (uint32_t tensorId : nodes.at(nodeId).inTensorIds) {
+            if (tensorId != INVALID_TENSOR_ID) {
+                lastReadNodeIds.at(tensorId) = nodeId;
+                dependNodeCounts.at(tensorId)++;
+            }
+        }
+        for (uint32_t tensorId : nodes.at(nodeId).outTensorIds) {
+            if (tensorId != INVALID_TENSOR_ID && firstWriteNodeIds.at(tensorId) == NO_FREE_NODE_ID) {
+                firstWriteNodeIds.at(tensorId) = nodeId;
+            }
+        }
+    }
+
+    tensorLastUseNodeIds.assign(GetTensorNum(), NO_FREE_NODE_ID);
+    uselessInTensors.clear();
     if (!GetSingleton<Config>().Is310PRC()) {
-        for (size_t i = 0; i < inTensors.size(); ++i) {
-            Tensor *tensor = &inTensors.at(i);
-            auto it = isInTensorCanFree.find(tensor);
-            if (it == isInTensorCanFree.end() || !it->second) {
+        for (uint32_t i = 0; i < inTensors.size(); ++i) {
+            if (i >= isInTensorCanFree.size() || !isInTensorCanFree.at(i)) {
                 continue; // 若intensor的isInTensorCanFree为false，不参与内存释放
             }
-            uint64_t maxNodeId = 0;
-            uint64_t dependNodeCount = 0;
-
-            SearchTensorInNodeInTensor(tensor, maxNodeId, dependNodeCount);
-            if (dependNodeCount == 0) {
+            if (dependNodeCounts.at(i) == 0) {
                 ATB_LOG(WARN) << "runner graph intensor[" << i << "] dependNodeCount is 0, graph wrong";
-                tensorMaxNodeIdMap[tensor] = FREE_TENSOR_KEY; // 当intensor在graph内未被使用时，setup开始时立即释放
-                maxNodeIdTensorMap[FREE_TENSOR_KEY].insert(tensor);
+                uselessInTensors.push_back(&inTensors.at(i)); // 当intensor在graph内未被使用时，setup开始时立即释放
             } else {
-                ATB_LOG(INFO) << "runner graph intensor[" << i << "] maxNodeId: " << maxNodeId
-                            << ", dependNodeCount: " << dependNodeCount;
-                tensorMaxNodeIdMap[tensor] = maxNodeId;
-                maxNodeIdTensorMap[maxNodeId].insert(tensor);
+                ATB_LOG(INFO) << "runner graph intensor[" << i << "] maxNodeId: " << lastReadNodeIds.at(i)
+                              << ", dependNodeCount: " << dependNodeCounts.at(i);
+                tensorLastUseNodeIds.at(i) = lastReadNodeIds.at(i);
             }
         }
     }
 
-    for (size_t i = 0; i < internalTensors.size(); ++i) {
-        Tensor *tensor = &internalTensors.at(i);
-        uint64_t maxNodeId = 0;
-        uint64_t dependNodeCount = 0;
-        SearchTensorInNodeInTensor(tensor, maxNodeId, dependNodeCount);
-        if (dependNodeCount == 0) {
+    const uint32_t internalTensorIdBase = inTensors.size() + outTensors.size();
+    for (uint32_t i = 0; i < internalTensors.size(); ++i) {
+        uint32_t tensorId = internalTensorIdBase + i;
+        if (dependNodeCounts.at(tensorId) == 0) {
             ATB_LOG(WARN) << "runner graph internal tensor[" << i << "] dependNodeCount is 0, graph wrong";
-
-            if (!SearchTensorInNodeOutTensor(tensor, maxNodeId)) {
+            if (firstWriteNodeIds.at(tensorId) == NO_FREE_NODE_ID) {
                 ATB_LOG(WARN) << "runner graph internal tensor[" << i << "] is not valued, graph wrong";
                 continue; // 当中间tensor未在graph内使用时，若有被赋值，则赋值结束立刻释放；若未被赋值，则无需释放
             }
+            tensorLastUseNodeIds.at(tensorId) = firstWriteNodeIds.at(tensorId);
         } else {
-            ATB_LOG(INFO) << "runner graph internal tensor[" << i << "] maxNodeId: " << maxNodeId
-                          << ", dependNodeCount: " << dependNodeCount;
+            ATB_LOG(INFO) << "runner graph internal tensor[" << i << "] maxNodeId: " << lastReadNodeIds.at(tensorId)
+                          << ", dependNodeCount: " << dependNodeCounts.at(tensorId);
+            tensorLastUseNodeIds.at(tensorId) = lastReadNodeIds.at(tensorId);
+        }
+    }
+}
+
+void GraphRunner::Graph::InitNodeLastUseTensors()
+{
+    for (auto &node : nodes) {
+        node.lastUseTensors.clear();
+    }
+    for (uint32_t tensorId = 0; tensorId < tensorLastUseNodeIds.size(); ++tensorId) {
+        uint64_t nodeId = tensorLastUseNodeIds.at(tensorId);
+        if (nodeId < nodes.size()) {
+            nodes.at(nodeId).lastUseTensors.push_back(GetTensor(tensorId));
         }
-        tensorMaxNodeIdMap[tensor] = maxNodeId;
-        maxNodeIdTensorMap[maxNodeId].insert(tensor);
     }
 }
 
@@ -178,24 +221,16 @@ void GraphRunner::Graph::InitTensorType()
         node.outTensorTypes.reserve(node.outTensors.size());
         node.outTensorTypes.resize(node.outTensors.size());
         for (size_t i = 0; i < node.inTensors.size(); ++i) {
-            node.inTensorTypes.at(i) = IsInternalTensor(node.inTensors.at(i)) ? GraphRunner::INTERMEDIATE_TENSOR :
-                                                                                GraphRunner::NOT_INTERMEDIATE_TENSOR;
+            node.inTensorTypes.at(i) = IsInternalTensorId(node.inTensorIds.at(i)) ?
+                                           GraphRunner::INTERMEDIATE_TENSOR :
+                                           GraphRunner::NOT_INTERMEDIATE_TENSOR;
         }
         for (size_t i = 0; i < node.outTensors.size(); ++i) {
-            node.outTensorTypes.at(i) = IsInternalTensor(node.outTensors.at(i)) ? GraphRunner::INTERMEDIATE_TENSOR :
-                                                                                  GraphRunner::NOT_INTERMEDIATE_TENSOR;
-        }
-    }
-}
-
-bool GraphRunner::Graph::IsInternalTensor(const Tensor *tensor)
-{
-    for (auto &internalTensor : internalTensors) {
-        if (&internalTensor == tensor) {
-            return true;
+            node.outTensorTypes.at(i) = IsInternalTensorId(node.outTensorIds.at(i)) ?
+                                            GraphRunner::INTERMEDIATE_TENSOR :
+                                            GraphRunner::NOT_INTERMEDIATE_TENSOR;
         }
     }
-    return false;
 }
 
 GraphRunner::GraphRunner(const std::string &name) : Runner(name)
@@ -232,13 +267,10 @@ Status GraphRunner::InitTensorFromRunnerVariantPack(RunnerVariantPack &runnerVar
             return ERROR_INVALID_PARAM;
         }
 
-        for (size_t i = 0; i < runnerGraph_.inTensors.size(); i++) {
-            runnerGraph_.isInTensorCanFree[&runnerGraph_.inTensors.at(i)] = runnerVariantPack.isInTensorCanFree.at(i);
-        }
-        for (size_t i = 0; i < runnerGraph_.outTensors.size(); i++) {
-            runnerGraph_.isOutTensorNeedMalloc[&runnerGraph_.outTensors.at(i)] =
-                runnerVariantPack.isOutTensorNeedMalloc.at(i);
-        }
+        runnerGraph_.isInTensorCanFree.assign(runnerVariantPack.isInTensorCanFree.begin(),
+                                              runnerVariantPack.isInTensorCanFree.end());
+        runnerGraph_.isOutTensorNeedMalloc.assign(runnerVariantPack.isOutTensorNeedMalloc.begin(),
+                                                  runnerVariantPack.isOutTensorNeedMalloc.end());
         runnerGraph_.Init();
     }
     return NO_ERROR;
@@ -248,13 +280,12 @@ void GraphRunner::UpdateOutTensorDeviceData(RunnerVariantPack &runnerVariantPack
 {
     for (size_t i = 0; i < runnerGraph_.outTensors.size(); i++) {
         Tensor *outTensor = &runnerGraph_.outTensors.at(i);
-        auto it = runnerGraph_.isOutTensorNeedMalloc.find(outTensor);
-        if (it == runnerGraph_.isOutTensorNeedMalloc.end()) {
+        if (i >= runnerGraph_.isOutTensorNeedMalloc.size()) {
             ATB_LOG(ERROR) << GetLogPrefix() << "outTensor[" << i << "] isOutTensorNeedMalloc not found";
             if (!runnerVariantPack.outTensors.at(i).deviceData) {
                 runnerVariantPack.outTensors.at(i).deviceData = outTensor->deviceData;
             }
-        } else if (it->second) {
+        } else if (runnerGraph_.isOutTensorNeedMalloc.at(i)) {
             runnerVariantPack.outTensors.at(i).deviceData = outTensor->deviceData;
         }
     }
@@ -262,10 +293,9 @@ void GraphRunner::UpdateOutTensorDeviceData(RunnerVariantPack &runnerVariantPack
 
 void GraphRunner::FreeUselessInTensor()
 {
-    auto it = runnerGraph_.maxNodeIdTensorMap.find(FREE_TENSOR_KEY);
-    if (it != runnerGraph_.maxNodeIdTensorMap.end()) {
+    if (!runnerGraph_.uselessInTensors.empty()) {
         ATB_LOG(INFO) << "free useless intensor at the beginning of setup";
-        for (auto tensorIt : it->second) {
+        for (auto tensorIt : runnerGraph_.uselessInTensors) {
             ATB_LOG(INFO) << GetLogPrefix() << "free tensor:" << tensorIt;
             memAllocationSolver_->Free((uint8_t *)tensorIt->deviceData);
         }
@@ -354,6 +384,17 @@ uint64_t GraphRunner::GetTilingBufferSizeImpl()
 Status GraphRunner::FillHostTilingBufferImpl(uint8_t *hostTilingBuffer, uint64_t tilingBufferSize,
                                              ContextBase *context)
 {
+    if (IsParallelTilingFillEnable(context, runnerGraph_.nodes.size())) {
+        Status ret = ParallelFillHostTilingBuffer(hostTilingBuffer, context, *context->GetTilingFillThreadPool());
+        if (ret != NO_ERROR) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "GraphRunner::FillHostTilingBufferImpl failed! error code:" << ret;
+            return ret;
+        }
+        ATB_LOG(INFO) << GetLogPrefix() << "parallel fill all node host tiling buffer, tilingBufferSize:"
+                      << tilingBufferSize;
+        return NO_ERROR;
+    }
+
     uint64_t tilingOffset = 0;
     for (size_t nodeId = 0; nodeId < runnerGraph_.nodes.size(); ++nodeId) {
         auto &node = runnerGraph_.nodes.at(nodeId);
@@ -369,6 +410,67 @@ Status GraphRunner::FillHostTilingBufferImpl(uint8_t *hostTilingBuffer, uint64_t
     return NO_ERROR;
 }
 
+Status GraphRunner::ParallelFillHostTilingBuffer(uint8_t *hostTilingBuffer, ContextBase *context,
+                                                 ThreadPool &threadPool)
+{
+    Mki::Timer parallelFillTimer;
+    const size_t nodeNum = runnerGraph_.nodes.size();
+    std::vector<uint64_t> tilingOffsets(nodeNum, 0);
+    uint64_t tilingOffset = 0;
+    for (size_t nodeId = 0; nodeId < nodeNum; ++nodeId) {
+        tilingOffsets.at(nodeId) = tilingOffset;
+        tilingOffset += tilingBufferSizes_.at(nodeId);
+    }
+
+    // 各节点写入互不重叠的tiling区间，填充结果与节点的执行顺序无关
+    std::vector<Status> nodeStatuses(nodeNum, NO_ERROR);
+    std::vector<uint64_t> nodeFillTimes(nodeNum, 0);
+    threadPool.ParallelFor(nodeNum, [&](size_t nodeId) {
+        Mki::Timer nodeFillTimer;
+        SetInParallelTilingFill(true);
+        try {
+            nodeStatuses.at(nodeId) = runnerGraph_.nodes.at(nodeId).runner->FillHostTilingBuffer(
+                hostTilingBuffer + tilingOffsets.at(nodeId), tilingBufferSizes_.at(nodeId), context);
+        } catch (const std::exception &e) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "node[" << nodeId << "] fill host tiling buffer throw an exception: "
+                           << e.what();
+            nodeStatuses.at(nodeId) = ERROR_INTERNAL_ERROR;
+        }
+        SetInParallelTilingFill(false);
+        nodeFillTimes.at(nodeId) = nodeFillTimer.ElapsedMicroSecond();
+    });
+
+    // kernel cache和统计信息按节点顺序在调用线程上统一提交
+    CommitParallelTilingFill();
+    uint64_t serialFillTime = 0;
+    for (size_t nodeId = 0; nodeId < nodeNum; ++nodeId) {
+        serialFillTime += nodeFillTimes.at(nodeId);
+    }
+    uint64_t parallelFillTime = parallelFillTimer.ElapsedMicroSecond();
+    GetOpSetupStatistic().tilingParallelFillCount += 1;
+    GetOpSetupStatistic().tilingParallelFillTime += parallelFillTime;
+    GetOpSetupStatistic().tilingParallelFillSerialTime += serialFillTime;
+    ATB_LOG(INFO) << GetLogPrefix() << "parallel fill tiling, nodeNum:" << nodeNum
+                  << ", threadNum:" << threadPool.GetThreadNum() << ", parallelFillTime:" << parallelFillTime
+                  << ", serialFillTime:" << serialFillTime;
+
+    for (size_t nodeId = 0; nodeId < nodeNum; ++nodeId) {
+        if (nodeStatuses.at(nodeId) != NO_ERROR) {
+            ATB_LOG(ERROR) << GetLogPrefix() << "node[" << nodeId
+                           << "] fill host tiling buffer fail, error code:" << nodeStatuses.at(nodeId);
+            return nodeStatuses.at(nodeId);
+        }
+    }
+    return NO_ERROR;
+}
+
+void GraphRunner::CommitParallelTilingFill()
+{
+    for (auto &node : runnerGraph_.nodes) {
+        node.runner->CommitParallelTilingFill();
+    }
+}
+
 std::vector<uint64_t> &GraphRunner::GetWorkspaceBufferSize()
 {
     for (size_t nodeId = 0; nodeId < runnerGraph_.nodes.size(); ++nodeId) {
@@ -447,7 +549,7 @@ void GraphRunner::Reset()
     for (auto &tensor : runnerGraph_.internalTensors) {
         tensor = {};
     }
-    runnerGraph_.tensorMalloced.clear();
+    std::fill(runnerGraph_.tensorMalloced.begin(), runnerGraph_.tensorMalloced.end(), 0);
     if (GetSingleton<Config>().Is310PRC()) {
         memAllocationSolver_->Reset();
     }
@@ -539,15 +641,13 @@ Status GraphRunner::PreparseViewNodeInTensorInferShape(Node &node) const
 
 Status GraphRunner::PreparseNodeInTensor(size_t nodeId, GraphRunner::Node &node)
 {
+    const bool canFree = !GetSingleton<Config>().Is310PRC();
     for (size_t i = 0; i < node.inTensors.size(); ++i) {
         node.runnerVariantPack.inTensors.at(i) = RunInTensorReshapeFuncs(nodeId, node, i);
 
-        auto it = runnerGraph_.tensorMaxNodeIdMap.find(node.inTensors.at(i));
-        if (!GetSingleton<Config>().Is310PRC() && it != runnerGraph_.tensorMaxNodeIdMap.end() && it->second == nodeId) {
-            node.runnerVariantPack.isInTensorCanFree.at(i) = true;
-        } else {
-            node.runnerVariantPack.isInTensorCanFree.at(i) = false;
-        }
+        uint32_t tensorId = node.inTensorIds.at(i);
+        node.runnerVariantPack.isInTensorCanFree.at(i) = canFree && tensorId != Graph::INVALID_TENSOR_ID &&
+                                                         runnerGraph_.tensorLastUseNodeIds.at(tensorId) == nodeId;
     }
     return NO_ERROR;
 }
@@ -589,30 +689,32 @@ void GraphRunner::NodeOutTensorGlobalMemAlloc(size_t nodeId, GraphRunner::Node &
     // 全局mem alloc solver时，tensor内存的申请释放全部下发至叶子节点完成
     for (size_t i = 0; i < node.outTensors.size(); ++i) {
         Tensor *outTensor = node.outTensors.at(i);
+        uint32_t tensorId = node.outTensorIds.at(i);
         outTensor->desc = outTensorDescs.at(i);
         if (node.outTensorTypes.at(i) == GraphRunner::INTERMEDIATE_TENSOR) {
             // 中间tensor已被malloc，原地写
-            if (runnerGraph_.tensorMalloced.find(outTensor) != runnerGraph_.tensorMalloced.end()) {
+            if (runnerGraph_.tensorMalloced.at(tensorId)) {
                 WriteInPlaceCheck(outTensor->desc, outTensorDescs.at(i), nodeId, i,
                                   std::string("graph internal tensor"));
                 node.runnerVariantPack.isOutTensorNeedMalloc.at(i) = false;
             } else {
-                runnerGraph_.tensorMalloced.insert(outTensor);
+                runnerGraph_.tensorMalloced.at(tensorId) = 1;
                 outTensor->dataSize = TensorUtil::CalcTensorDataSize(*outTensor);
                 node.runnerVariantPack.isOutTensorNeedMalloc.at(i) = true;
                 ATB_LOG(INFO) << GetLogPrefix() << "node[" << nodeId << "] outTensors[" << i << "] is internal tensor";
             }
         } else {
-            auto it = runnerGraph_.isOutTensorNeedMalloc.find(outTensor);
-            if (it == runnerGraph_.isOutTensorNeedMalloc.end()) { // outtensor为graph intensor，原地写
+            if (!runnerGraph_.IsOutTensorId(tensorId)) { // outtensor为graph intensor，原地写
                 WriteInPlaceCheck(outTensor->desc, outTensorDescs.at(i), nodeId, i, std::string("graph intensor"));
                 node.runnerVariantPack.isOutTensorNeedMalloc.at(i) = false;
             } else {
-                if (runnerGraph_.tensorMalloced.find(outTensor) == runnerGraph_.tensorMalloced.end()) {
-                    if (it->second) {
-                        runnerGraph_.tensorMalloced.insert(outTensor);
+                if (!runnerGraph_.tensorMalloced.at(tensorId)) {
+                    bool needMalloc =
+                        runnerGraph_.isOutTensorNeedMalloc.at(tensorId - runnerGraph_.inTensors.size()) != 0;
+                    if (needMalloc) {
+                        runnerGraph_.tensorMalloced.at(tensorId) = 1;
                     }
-                    node.runnerVariantPack.isOutTensorNeedMalloc.at(i) = it->second;
+                    node.runnerVariantPack.isOutTensorNeedMalloc.at(i) = needMalloc;
                     ATB_LOG(INFO) << GetLogPrefix() << "node[" << nodeId << "] outTensors[" << i
                                   << "] is graph outtensor, isOutTensorNeedMalloc: "
                                   << node.runnerVariantPack.isOutTensorNeedMalloc.at(i);
@@ -633,14 +735,15 @@ void GraphRunner::NodeOutTensorLocalMemAlloc(size_t nodeId, GraphRunner::Node &n
 {
     for (size_t i = 0; i < node.outTensors.size(); ++i) {
         Tensor *outTensor = node.outTensors.at(i);
+        uint32_t tensorId = node.outTensorIds.at(i);
         outTensor->desc = outTensorDescs.at(i);
         if (node.outTensorTypes.at(i) == GraphRunner::INTERMEDIATE_TENSOR) {
             // 中间tensor已被malloc，原地写
-            if (runnerGraph_.tensorMalloced.find(outTensor) != runnerGraph_.tensorMalloced.end()) {
+            if (runnerGraph_.tensorMalloced.at(tensorId)) {
                 WriteInPlaceCheck(outTensor->desc, outTensorDescs.at(i), nodeId, i,
                                   std::string("graph internal tensor"));
             } else {
-                runnerGraph_.tensorMalloced.insert(outTensor);
+                runnerGraph_.tensorMalloced.at(tensorId) = 1;
                 outTensor->dataSize = TensorUtil::CalcTensorDataSize(*outTensor);
                 outTensor->deviceData =
                     memAllocationSolver_->GetOffset(TensorUtil::AlignInt(outTensor->dataSize, ALIGN_INT));
@@ -659,13 +762,10 @@ void GraphRunner::NodeOutTensorLocalMemAlloc(size_t nodeId, GraphRunner::Node &n
                       << "] " << TensorUtil::TensorToString(*outTensor);
     }
 
-    auto it = runnerGraph_.maxNodeIdTensorMap.find(nodeId);
-    if (it != runnerGraph_.maxNodeIdTensorMap.end()) {
-        for (auto tensorIt : it->second) {
-            ATB_LOG(INFO) << GetLogPrefix() << " node[" << nodeId << "] " << node.runner->GetName()
-                          << " free tensor:" << tensorIt;
-            memAllocationSolver_->Free((uint8_t *)tensorIt->deviceData);
-        }
+    for (auto tensorIt : node.lastUseTensors) {
+        ATB_LOG(INFO) << GetLogPrefix() << " node[" << nodeId << "] " << node.runner->GetName()
+                      << " free tensor:" << tensorIt;
+        memAllocationSolver_->Free((uint8_t *)tensorIt->deviceData);
     }
 }
 
@@ -9,13 +9,14 @@
  */
 #ifndef ATB_GRAPH_RUNNER_H
 #define ATB_GRAPH_RUNNER_H
-#include <map>
-#include <set>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 #include "atb/svector.h"
 #include "atb/operation.h"
 #include "atb/utils/mem_allocation_solver/mem_allocation_solver.h"
+#include "atb/utils/thread_pool.h"
 #include "runner.h"
 
 namespace atb {
@@ -38,6 +39,9 @@ public:
         SVector<Chunk> inTensorChunks;
         SVector<TensorDesc> lastInTensorDescs;
         SVector<TensorDesc> lastOutTensorDescs;
+        SVector<uint32_t> inTensorIds;       // Graph::Init时分配的图内稠密tensor id
+        SVector<uint32_t> outTensorIds;
+        std::vector<Tensor *> lastUseTensors; // 以本节点为最后使用者的tensor，本节点setup后释放
     };
 
     struct Graph {
@@ -45,21 +49,27 @@ public:
         SVector<Tensor> outTensors;
         SVector<Tensor> internalTensors;
         std::vector<Node> nodes;
-        std::map<Tensor *, uint64_t> tensorMaxNodeIdMap;
-        std::map<uint64_t, std::set<Tensor *>> maxNodeIdTensorMap;
-        std::map<Tensor *, bool> isInTensorCanFree;
-        std::map<Tensor *, bool> isOutTensorNeedMalloc;
-        std::set<Tensor *> tensorMalloced;
+        // tensor id依次为inTensors、outTensors、internalTensors的下标，以下数组均在Init时按id定长分配
+        std::vector<uint64_t> tensorLastUseNodeIds; // 按tensor id索引，NO_FREE_NODE_ID表示图内不释放
+        std::vector<Tensor *> uselessInTensors;     // 图内未被使用的intensor，setup开始时立即释放
+        std::vector<uint8_t> isInTensorCanFree;     // 按inTensors下标索引
+        std::vector<uint8_t> isOutTensorNeedMalloc; // 按outTensors下标索引
+        std::vector<uint8_t> tensorMalloced;        // 按tensor id索引，每次setup前清零
+        static constexpr uint32_t INVALID_TENSOR_ID = UINT32_MAX;
+        static constexpr uint64_t NO_FREE_NODE_ID = UINT64_MAX;
         std::string ToString() const;
         void Init();
+        size_t GetTensorNum() const;
+        bool IsOutTensorId(uint32_t tensorId) const;
+        bool IsInternalTensorId(uint32_t tensorId) const;
 
     private:
-        void InitTensorMaxNodeMap();
+        void InitTensorIds();
+        void InitTensorLastUseNodeIds();
+        void InitNodeLastUseTensors();
         void InitTensorType();
         void SetNonReuseTensors();
-        bool IsInternalTensor(const Tensor *tensor);
-        void SearchTensorInNodeInTensor(const Tensor *tensor, uint64_t &maxNodeId, uint64_t &dependNodeCount);
-        bool SearchTensorInNodeOutTensor(const Tensor *tensor, uint64_t &maxNodeId);
+        Tensor *GetTensor(uint32_t tensorId);
     };
 
     explicit GraphRunner(const std::string &name);
@@ -83,6 +93,7 @@ protected:
     Status PreExecuteImpl(RunnerVariantPack &runnerVariantPack) override;
     void SetSaveTensorDir(const std::string &tensorDir) override;
     void ChangeWorkspaceBufferByExecuteStream(RunnerVariantPack &runnerVariantPack) override;
+    void CommitParallelTilingFill() override;
 
 private:
     void Reset();
@@ -112,6 +123,7 @@ private:
     void UpdateVariantPackTensorData(RunnerVariantPack &runnerVariantPack);
     Status ExecuteAllRunner(RunnerVariantPack &runnerVariantPack);
     Status PreExecuteAllRunner(RunnerVariantPack &runnerVariantPack);
+    Status ParallelFillHostTilingBuffer(uint8_t *hostTilingBuffer, ContextBase *context, ThreadPool &threadPool);
 
 private:
     Graph runnerGraph_;
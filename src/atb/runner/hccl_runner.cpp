@@ -8,6 +8,8 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 #include "atb/runner/hccl_runner.h"
+#include <algorithm>
+#include <sstream>
 #include <hccl/hccl.h>
 #include <mki/utils/file_system/file_system.h>
 #include <atb/utils/log.h>
@@ -21,6 +23,9 @@
 #include "atb/utils/operation_register.h"
 
 namespace atb {
+static constexpr uint64_t SHM_RENDEZVOUS_TIMEOUT_MS = 600000; // 600000: 10 minutes timeout
+static constexpr uint64_t NS_PER_US = 1000;
+
 HcclRunner::HcclRunner(const std::string &name, int rank, int rankSize, int rankRoot,
                        const std::string &commDomain)
     : Runner(name), rank_(rank), rankSize_(rankSize), rankRoot_(rankRoot),
@@ -162,9 +167,9 @@ HcclCommSharedPtr HcclRunner::CreateHcclCommInMulitProcessByRootInfo()
 bool HcclRunner::CreateHcclRootInfo()
 {
     std::string shmName = "hcclShareMem" + commDomain_;
-    Mki::ShareMemory shm(shmName, sizeof(atb::CommInitInfo) + rankSize_ * sizeof(bool));
-    auto *shmInfo = static_cast<atb::CommInitInfo *>(shm.GetShm());
-    if (!shmInfo) {
+    Mki::ShareMemory shm(shmName, ShmRendezvous::GetShmSize(rankSize_, sizeof(HcclRootInfo)));
+    void *shmAddr = shm.GetShm();
+    if (!shmAddr) {
         ATB_LOG(ERROR) << GetLogPrefix() << "create share memory fail, rank:" << rank_;
         return false;
     }
@@ -172,6 +177,7 @@ bool HcclRunner::CreateHcclRootInfo()
     // 主进程通过HcclGetRootInfo获取到hcclRootInfo_(包含HostIP信息), 写到共享内存，其他进程读取RoortInfo
     // 等所有的进程都准备好时，再一起往下执行CreateHcclComm
     ATB_LOG(INFO) << GetLogPrefix() << "create share memory success, rank:" << rank_;
+    ShmRendezvous rendezvous(shmAddr, rank_, rankSize_, sizeof(HcclRootInfo));
     if (rank_ == rankRoot_) {
         auto ret = HcclGetRootInfo(&hcclRootInfo_);
         if (ret != HCCL_SUCCESS) {
@@ -179,76 +185,48 @@ bool HcclRunner::CreateHcclRootInfo()
             return false;
         }
         ATB_LOG(INFO) << GetLogPrefix() << "HcclGetRootInfo success, write to share memory";
-        ShmSetHcclRootInfo(shm, *shmInfo);
+        ShmSetHcclRootInfo(rendezvous);
     } else {
         ATB_LOG(INFO) << GetLogPrefix() << "get root info from share memory";
-        ShmGetHcclRootInfo(shm, *shmInfo);
+        if (!ShmGetHcclRootInfo(rendezvous)) {
+            return false;
+        }
     }
 
-    return ShmBarrier(shm, *shmInfo);
+    return ShmBarrier(rendezvous);
 }
 
-void HcclRunner::ShmGetHcclRootInfo(Mki::ShareMemory &shm, const CommInitInfo &shmInfo)
+bool HcclRunner::ShmGetHcclRootInfo(ShmRendezvous &rendezvous)
 {
-    bool commIdReady = false;
-    while (true) {
-        shm.SemLock();
-        if (shmInfo.signal != 0) {
-            hcclRootInfo_ = shmInfo.hcclRootInfo;
-            commIdReady = true;
-        }
-        shm.SemUnLock();
-        if (commIdReady) {
-            break;
-        }
+    if (!rendezvous.WaitPublished(&hcclRootInfo_, SHM_RENDEZVOUS_TIMEOUT_MS)) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "get root info from share memory timeout, rank:" << rank_;
+        return false;
     }
+    return true;
 }
 
-void HcclRunner::ShmSetHcclRootInfo(Mki::ShareMemory &shm, CommInitInfo &shmInfo)
-{
-    shm.SemLock();
-    shmInfo.hcclRootInfo = hcclRootInfo_;
-    shmInfo.signal = 1;
-    shm.SemUnLock();
-}
-
-void HcclRunner::ShmSetReady(Mki::ShareMemory &shm, CommInitInfo &shmInfo) const
+void HcclRunner::ShmSetHcclRootInfo(ShmRendezvous &rendezvous) const
 {
-    shm.SemLock();
-    shmInfo.barrier[rank_] = true;
-    shm.SemUnLock();
+    rendezvous.Publish(&hcclRootInfo_);
 }
 
-bool HcclRunner::ShmBarrier(Mki::ShareMemory &shm, CommInitInfo &shmInfo)
+bool HcclRunner::ShmBarrier(ShmRendezvous &rendezvous) const
 {
-    ATB_LOG(INFO) << GetLogPrefix() << "barrier start, rank:" << rank_;
-    ShmSetReady(shm, shmInfo);
-
-    ATB_LOG(INFO) << GetLogPrefix() << "check all ready start";
-    const double timeout = 600; // 600: 10 minutes timeout
-    time_t startTime = time(nullptr);
-    while (true) {
-        time_t currentTime = time(nullptr);
-        if (difftime(currentTime, startTime) > timeout) {
-            ATB_LOG(ERROR) << GetLogPrefix() << "barrier fail, check all ready timeout";
-            return false;
-        }
-
-        bool allReady = true;
-        shm.SemLock();
-        for (int i = 0; i < rankSize_; i++) {
-            if (!shmInfo.barrier[i]) {
-                allReady = false;
-                break;
-            }
-        }
-        shm.SemUnLock();
-        if (allReady) {
-            ATB_LOG(INFO) << GetLogPrefix() << "check all ready success";
-            break;
+    ATB_LOG(INFO) << GetLogPrefix() << "barrier start, rank:" << rank_ << ", generation:" << rendezvous.GetGeneration();
+    if (!rendezvous.Barrier(SHM_RENDEZVOUS_TIMEOUT_MS)) {
+        ATB_LOG(ERROR) << GetLogPrefix() << "barrier fail, check all ready timeout";
+        return false;
+    }
+    if (rank_ == rankRoot_) {
+        // 记录各rank相对最早到达rank的延迟，用于定位拖慢建链的进程
+        std::vector<uint64_t> arrivalTimes = rendezvous.GetArrivalTimes();
+        uint64_t firstTime = *std::min_element(arrivalTimes.begin(), arrivalTimes.end());
+        std::stringstream ss;
+        for (size_t i = 0; i < arrivalTimes.size(); ++i) {
+            ss << (i == 0 ? "" : ", ") << i << ":" << (arrivalTimes.at(i) - firstTime) / NS_PER_US;
         }
+        ATB_LOG(INFO) << GetLogPrefix() << "barrier arrival delay(us) of ranks: " << ss.str();
     }
-
     ATB_LOG(INFO) << GetLogPrefix() << "barrier success, rank:" << rank_;
     return true;
 }
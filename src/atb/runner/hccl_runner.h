@@ -10,16 +10,11 @@
 #ifndef ATB_HCCL_RUNNER_H
 #define ATB_HCCL_RUNNER_H
 #include <hccl/hccl_types.h>
-#include <mki/utils/share_memory/share_memory.h>
 #include "atb/runner/runner.h"
 #include "atb/infer_op_params.h"
+#include "atb/utils/shm_rendezvous.h"
 
 namespace atb {
-struct CommInitInfo {
-    int signal = 0;
-    HcclRootInfo hcclRootInfo = {};
-    bool barrier[1]; // Flexible array member
-};
 
 using HcclCommSharedPtr = std::shared_ptr<void>;
 
@@ -55,10 +50,9 @@ private:
     HcclCommSharedPtr CreateHcclCommInMulitProcessByRootInfo();
     HcclCommSharedPtr CreateHcclCommInMulitProcessByRankFile() const;
     bool CreateHcclRootInfo();
-    void ShmGetHcclRootInfo(Mki::ShareMemory &shm, const CommInitInfo &shmInfo);
-    void ShmSetHcclRootInfo(Mki::ShareMemory &shm, CommInitInfo &shmInfo);
-    bool ShmBarrier(Mki::ShareMemory &shm, CommInitInfo &shmInfo);
-    void ShmSetReady(Mki::ShareMemory &shm, CommInitInfo &shmInfo) const;
+    bool ShmGetHcclRootInfo(ShmRendezvous &rendezvous);
+    void ShmSetHcclRootInfo(ShmRendezvous &rendezvous) const;
+    bool ShmBarrier(ShmRendezvous &rendezvous) const;
     HcclResult HcclExecute(RunnerVariantPack &runnerVariantPack);
 };
 } // namespace atb
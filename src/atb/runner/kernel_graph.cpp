@@ -8,6 +8,7 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 #include <sstream>
+#include <unordered_map>
 #include <mki/operation.h>
 #include <asdops/ops.h>
 #include <atbops/ops.h>
@@ -43,6 +44,7 @@ std::string KernelGraph::ToString() const
 
 void KernelGraph::Init()
 {
+    InitTensorIds();
     for (auto &node : nodes) {
         node.Reset();
         node.inTensorsType.reserve(node.inTensors.size());
@@ -51,8 +53,7 @@ void KernelGraph::Init()
         node.outTensorsType.resize(node.outTensors.size());
 
         for (size_t i = 0; i < node.inTensors.size(); i++) {
-            auto inTensor = node.inTensors.at(i);
-            if (IsInternalTensor(inTensor)) {
+            if (IsInternalTensorId(node.inTensorIds.at(i))) {
                 node.inTensorsType.at(i) = TensorType::INTERMEDIATE_TENSOR;
             } else {
                 node.inTensorsType.at(i) = TensorType::IN_TENSOR;
@@ -60,8 +61,7 @@ void KernelGraph::Init()
         }
 
         for (size_t i = 0; i < node.outTensors.size(); i++) {
-            auto outTensor = node.outTensors.at(i);
-            if (IsInternalTensor(outTensor)) {
+            if (IsInternalTensorId(node.outTensorIds.at(i))) {
                 node.outTensorsType.at(i) = TensorType::INTERMEDIATE_TENSOR;
             } else {
                 node.outTensorsType.at(i) = TensorType::OUT_TENSOR;
@@ -70,15 +70,53 @@ void KernelGraph::Init()
     }
 }
 
-bool KernelGraph::IsInternalTensor(const Mki::Tensor *tensor) const
+void KernelGraph::InitTensorIds()
 {
-    for (auto &internalTensor : internalTensors) {
-        if (tensor == &internalTensor) {
-            return true;
+    std::unordered_map<const Mki::Tensor *, uint32_t> tensorIdMap;
+    tensorIdMap.reserve(GetTensorNum());
+    for (uint32_t tensorId = 0; tensorId < GetTensorNum(); ++tensorId) {
+        tensorIdMap[GetTensor(tensorId)] = tensorId;
+    }
+    auto toTensorId = [&tensorIdMap](const Mki::Tensor *tensor) {
+        auto it = tensorIdMap.find(tensor);
+        return it == tensorIdMap.end() ? INVALID_TENSOR_ID : it->second;
+    };
+    for (auto &node : nodes) {
+        node.inTensorIds.resize(node.inTensors.size());
+        for (size_t i = 0; i < node.inTensors.size(); i++) {
+            node.inTensorIds.at(i) = toTensorId(node.inTensors.at(i));
+        }
+        node.outTensorIds.resize(node.outTensors.size());
+        for (size_t i = 0; i < node.outTensors.size(); i++) {
+            node.outTensorIds.at(i) = toTensorId(node.outTensors.at(i));
         }
     }
+}
+
+size_t KernelGraph::GetTensorNum() const
+{
+    return inTensors.size() + outTensors.size() + internalTensors.size();
+}
+
+Mki::Tensor *KernelGraph::GetTensor(uint32_t tensorId)
+{
+    if (tensorId < inTensors.size()) {
+        return &inTensors.at(tensorId);
+    }
+    if (IsOutTensorId(tensorId)) {
+        return &outTensors.at(tensorId - inTensors.size());
+    }
+    return &internalTensors.at(tensorId - inTensors.size() - outTensors.size());
+}
 
-    return false;
+bool KernelGraph::IsOutTensorId(uint32_t tensorId) const
+{
+    return tensorId >= inTensors.size() && tensorId < inTensors.size() + outTensors.size();
+}
+
+bool KernelGraph::IsInternalTensorId(uint32_t tensorId) const
+{
+    return tensorId >= inTensors.size() + outTensors.size() && tensorId < GetTensorNum();
 }
 
 void KernelGraphNode::Reset()
@@ -10,6 +10,7 @@
 #ifndef ATB_KERNEL_GRAPH_H
 #define ATB_KERNEL_GRAPH_H
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mki/op_desc.h>
@@ -29,6 +30,8 @@ struct KernelGraphNode {
     bool tilingCacheEnable = true;
     SVector<TensorType> inTensorsType;
     SVector<TensorType> outTensorsType;
+    SVector<uint32_t> inTensorIds; // KernelGraph::Init时分配的图内稠密tensor id
+    SVector<uint32_t> outTensorIds;
     std::shared_ptr<AtbKernelMethod> impl;
     bool CreateImplement();
     void Reset(); // reset runInfo
@@ -40,11 +43,17 @@ struct KernelGraph {
     SVector<Mki::Tensor> outTensors;
     SVector<Mki::Tensor> internalTensors;
     std::vector<KernelGraphNode> nodes;
+    static constexpr uint32_t INVALID_TENSOR_ID = UINT32_MAX;
     std::string ToString() const;
     void Init();
+    // tensor id依次为inTensors、outTensors、internalTensors的下标
+    size_t GetTensorNum() const;
+    Mki::Tensor *GetTensor(uint32_t tensorId);
+    bool IsOutTensorId(uint32_t tensorId) const;
 
 private:
-    bool IsInternalTensor(const Mki::Tensor *tensor) const;
+    void InitTensorIds();
+    bool IsInternalTensorId(uint32_t tensorId) const;
 };
 
 } // namespace atb
@@ -10,12 +10,14 @@
 #include "atb/runner/mki_node_implement.h"
 #include <securec.h>
 #include <mki/utils/time/timer.h>
+#include "atb/kernel_cache/shared_kernel_cache.h"
 #include "atb/utils/log.h"
 #include "atb/utils/config.h"
 #include "atb/utils/tensor_util.h"
 #include "atb/utils/statistic.h"
 #include "atb/utils/store_util.h"
 #include "atb/utils/probe.h"
+#include "atb/utils/singleton.h"
 
 namespace atb {
 MkiNodeImplement::MkiNodeImplement(Mki::Operation *op, MkiInferShapePreFunc func)
@@ -288,6 +290,29 @@ void MkiNodeImplement::AddTiling(KernelCache &kernelCache, size_t kernelIndex, u
     ATB_LOG(DEBUG) << GetLogPrefix() << " AddTiling end, runinfo\n:" << runInfo_.ToString();
 }
 
+bool MkiNodeImplement::GetSharedCachedTiling(KernelCache &kernelCache, uint32_t runnerTypeIdx, size_t kernelIndex,
+                                             uint8_t *kernelHostTilingBuffer, uint64_t maxTilingSize,
+                                             uint64_t &tilingSizeFetched, bool launchWithTiling)
+{
+    SharedKernelCache::EntryPtr entry =
+        GetSingleton<SharedKernelCache>().GetTiling(runnerTypeIdx, kernelIndex, launchParam_);
+    if (entry == nullptr) {
+        return false;
+    }
+    // 回填到当前线程的缓存后按原有流程取出，kernel下发方式等校验保持一致
+    kernelCache.AddTiling(kernelIndex, entry->tilingBuffer.data(), entry->tilingBuffer.size(), launchParam_,
+                          entry->kernel.get());
+    return GetCachedTiling(kernelCache, kernelIndex, kernelHostTilingBuffer, maxTilingSize, tilingSizeFetched,
+                           launchWithTiling);
+}
+
+void MkiNodeImplement::AddSharedTiling(uint32_t runnerTypeIdx, size_t kernelIndex, uint8_t *hostTilingBuffer,
+                                       size_t tilingSize) const
+{
+    GetSingleton<SharedKernelCache>().AddTiling(runnerTypeIdx, kernelIndex, hostTilingBuffer, tilingSize,
+                                                launchParam_, kernel_.get());
+}
+
 void MkiNodeImplement::ResetLogPrefix(const std::string &prefix, size_t kernelId)
 {
     std::stringstream ss;
@@ -310,9 +335,9 @@ std::string MkiNodeImplement::GetLogPrefix() const
     return logPrefix_;
 }
 
-void MkiNodeImplement::SaveLaunchParam(aclrtStream stream, const std::string &dirPath) const
+void MkiNodeImplement::SaveLaunchParam(aclrtStream stream, const std::string &dirPath, bool sampled) const
 {
-    StoreUtil::SaveLaunchParam(stream, launchParam_, dirPath);
+    StoreUtil::SaveLaunchParam(stream, launchParam_, dirPath, sampled);
 }
 
 void *MkiNodeImplement::GetMsprofInfoKey() const
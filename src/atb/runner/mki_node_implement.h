@@ -40,6 +40,11 @@ public:
                          uint64_t maxTilingSize, uint64_t &tilingSizeFetched, bool launchWithTiling) override;
     void AddTiling(KernelCache &kernelCache, size_t kernelIndex, uint8_t *hostTilingBuffer,
                    size_t tilingSize) const override;
+    bool GetSharedCachedTiling(KernelCache &kernelCache, uint32_t runnerTypeIdx, size_t kernelIndex,
+                               uint8_t *kernelHostTilingBuffer, uint64_t maxTilingSize, uint64_t &tilingSizeFetched,
+                               bool launchWithTiling) override;
+    void AddSharedTiling(uint32_t runnerTypeIdx, size_t kernelIndex, uint8_t *hostTilingBuffer,
+                         size_t tilingSize) const override;
     void SetArgsDeviceBuffer(void *deviceBuffer) override;
     void SetArgsHostBuffer(void *hostBuffer) override;
     void *GetArgsDeviceBuffer() override;
@@ -50,7 +55,7 @@ public:
     // utils
     Mki::SVector<Mki::Tensor> &GetInTensors() override;
     Mki::SVector<Mki::Tensor> &GetOutTensors() override;
-    void SaveLaunchParam(aclrtStream stream, const std::string &dirPath) const override;
+    void SaveLaunchParam(aclrtStream stream, const std::string &dirPath, bool sampled) const override;
     void *GetMsprofInfoKey() const override;
     void GetReportTensors(Mki::SVector<std::pair<bool, Mki::Tensor>> &allTensors) const override;
     uint32_t GetOpType() const override;
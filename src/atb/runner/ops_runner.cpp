@@ -26,6 +26,7 @@
 #include "atb/utils/config.h"
 #include "atb/utils/probe.h"
 #include "atb/kernel_cache/kernel_cache.h"
+#include "atb/kernel_cache/kernel_registry.h"
 #include "atb/utils/statistic.h"
 #include "atb/utils/tensor_util.h"
 #include "atb/utils/store_util.h"
@@ -38,9 +39,12 @@
 #include "atb/utils/singleton.h"
 #include "atb/utils/mstx_mem_register.h"
 #include "atb/utils/operation_register.h"
+#include "atb/utils/trace_recorder.h"
+#include "atb/utils/async_dumper.h"
 
 namespace atb {
 const int ALIGN_INT = 512;
+// 每个下发线程的全局kernel cache(L1)，未命中时再查询进程级的SharedKernelCache(L2)
 thread_local std::vector<KernelCache> g_globalKernelCaches;
 constexpr uint32_t K_TENSOR_INFO_BYTES = 44UL;
 constexpr uint32_t K_TENSOR_INFO_BYTES_WITH_CAP = 56U;
@@ -86,12 +90,14 @@ void OpsRunner::InitTensorFromRunnerPack(const RunnerVariantPack &runnerVariantP
     TensorUtil::FastCopyTensors(opsTensorPack_.inTensors, kernelGraph_.inTensors);
     TensorUtil::FastCopyTensors(opsTensorPack_.outTensors, kernelGraph_.outTensors);
     const size_t kernelGraphInTensorsSize = kernelGraph_.inTensors.size();
+    isInTensorCanFree_.resize(kernelGraphInTensorsSize);
     for (size_t i = 0; i < kernelGraphInTensorsSize; i++) {
-        isInTensorCanFree_[&kernelGraph_.inTensors.at(i)] = runnerVariantPack.isInTensorCanFree.at(i);
+        isInTensorCanFree_.at(i) = runnerVariantPack.isInTensorCanFree.at(i);
     }
     const size_t kernelGraphOutTensorsSize = kernelGraph_.outTensors.size();
+    isOutTensorNeedMalloc_.resize(kernelGraphOutTensorsSize);
     for (size_t i = 0; i < kernelGraphOutTensorsSize; i++) {
-        isOutTensorNeedMalloc_[&kernelGraph_.outTensors.at(i)] = runnerVariantPack.isOutTensorNeedMalloc.at(i);
+        isOutTensorNeedMalloc_.at(i) = runnerVariantPack.isOutTensorNeedMalloc.at(i);
     }
 }
 
@@ -100,13 +106,12 @@ void OpsRunner::UpdateOutTensorDeviceData(RunnerVariantPack &runnerVariantPack)
     const size_t kernelGraphOutTensorsSize = kernelGraph_.outTensors.size();
     for (size_t i = 0; i < kernelGraphOutTensorsSize; i++) {
         Mki::Tensor *outTensor = &kernelGraph_.outTensors.at(i);
-        auto it = isOutTensorNeedMalloc_.find(outTensor);
-        if (it == isOutTensorNeedMalloc_.end()) {
+        if (i >= isOutTensorNeedMalloc_.size()) {
             ATB_LOG(ERROR) << GetLogPrefix() << "outTensor[" << i << "] isOutTensorNeedMalloc not found";
             if (!runnerVariantPack.outTensors.at(i).deviceData) {
                 runnerVariantPack.outTensors.at(i).deviceData = outTensor->data;
             }
-        } else if (it->second) {
+        } else if (isOutTensorNeedMalloc_.at(i)) {
             runnerVariantPack.outTensors.at(i).deviceData = outTensor->data;
         }
     }
@@ -258,27 +263,104 @@ Status OpsRunner::FillHostTilingBufferImpl(uint8_t *hostTilingBuffer, uint64_t t
     ATB_LOG(DEBUG) << GetLogPrefix() << " FillHostTilingBufferImpl start,  tilingBufferSize:" << tilingBufferSize
                    << ", totalTilingSize:" << totalTilingSize_;
 
+    const size_t nodeNum = kernelGraph_.nodes.size();
+    std::vector<uint64_t> tilingOffsets(nodeNum, 0);
+    std::vector<size_t> fillNodeIds;
     uint64_t offset = 0;
-    for (size_t nodeId = 0; nodeId < kernelGraph_.nodes.size(); ++nodeId) {
-        KernelGraphNode &node = kernelGraph_.nodes.at(nodeId);
-
+    for (size_t nodeId = 0; nodeId < nodeNum; ++nodeId) {
         uint64_t tilingSize = nodeId < tilingSizes_.size() ? tilingSizes_.at(nodeId) : 0;
-        if (tilingSize == 0) {
-            continue;
+        tilingOffsets.at(nodeId) = offset;
+        offset += tilingSize;
+        if (tilingSize != 0) {
+            fillNodeIds.push_back(nodeId);
         }
+    }
 
-        uint8_t *kernelHostTilingBuffer = hostTilingBuffer + offset;
-        Status ret = FillSingleKernelHostTilingBuffer(node, nodeId, kernelHostTilingBuffer, tilingSize, *context);
+    Status ret = IsParallelTilingFillEnable(context, fillNodeIds.size()) ?
+                     ParallelFillKernelHostTilingBuffer(hostTilingBuffer, tilingOffsets, fillNodeIds, *context) :
+                     SerialFillKernelHostTilingBuffer(hostTilingBuffer, tilingOffsets, fillNodeIds, *context);
+    if (ret != NO_ERROR) {
+        return ret;
+    }
+
+    for (size_t nodeId : fillNodeIds) {
+        KernelGraphNode &node = kernelGraph_.nodes.at(nodeId);
+        if (nodesSaveTensorFlag_.at(nodeId) && Probe::IsExecuteCountInRange(executeCount_) && Probe::IsSaveTiling()
+            && Probe::IsSaveTensorInSpecificDir(GetSaveTensorDir() + "/" + std::to_string(nodeId) + "_" + node.GetName())) {
+            std::string fileDir = GetSaveTensorDir() + "/" + std::to_string(nodeId) + "_" + node.GetName();
+            Probe::SaveTiling(hostTilingBuffer + tilingOffsets.at(nodeId), tilingSizes_.at(nodeId),
+                              fileDir + "/kernel_tilingdata.bin");
+        }
+    }
+    return NO_ERROR;
+}
+
+Status OpsRunner::SerialFillKernelHostTilingBuffer(uint8_t *hostTilingBuffer,
+                                                   const std::vector<uint64_t> &tilingOffsets,
+                                                   const std::vector<size_t> &fillNodeIds, ContextBase &context)
+{
+    for (size_t nodeId : fillNodeIds) {
+        Status ret = FillSingleKernelHostTilingBuffer(kernelGraph_.nodes.at(nodeId), nodeId,
+                                                      hostTilingBuffer + tilingOffsets.at(nodeId),
+                                                      tilingSizes_.at(nodeId), context);
         if (ret != NO_ERROR) {
             ATB_LOG(ERROR) << GetLogPrefix() << " node[" << nodeId << "] fill tiling buffer fail, error code:" << ret;
             return ret;
         }
-        if (nodesSaveTensorFlag_.at(nodeId) && Probe::IsExecuteCountInRange(executeCount_) && Probe::IsSaveTiling()
-            && Probe::IsSaveTensorInSpecificDir(GetSaveTensorDir() + "/" + std::to_string(nodeId) + "_" + node.GetName())) {
-            std::string fileDir = GetSaveTensorDir() + "/" + std::to_string(nodeId) + "_" + node.GetName();
-            Probe::SaveTiling(kernelHostTilingBuffer + offset, tilingSize, fileDir + "/kernel_tilingdata.bin");
+    }
+    return NO_ERROR;
+}
+
+Status OpsRunner::ParallelFillKernelHostTilingBuffer(uint8_t *hostTilingBuffer,
+                                                     const std::vector<uint64_t> &tilingOffsets,
+                                                     const std::vector<size_t> &fillNodeIds, ContextBase &context)
+{
+    Mki::Timer parallelFillTimer;
+    ThreadPool &threadPool = *context.GetTilingFillThreadPool();
+    // 各kernel写入互不重叠的tiling区间，填充结果与kernel的执行顺序无关
+    std::vector<Status> nodeStatuses(fillNodeIds.size(), NO_ERROR);
+    std::vector<uint64_t> nodeFillTimes(fillNodeIds.size(), 0);
+    threadPool.ParallelFor(fillNodeIds.size(), [&](size_t index) {
+        Mki::Timer nodeFillTimer;
+        size_t nodeId = fillNodeIds.at(index);
+        SetInParallelTilingFill(true);
+        try {
+            nodeStatuses.at(index) = FillSingleKernelHostTilingBuffer(kernelGraph_.nodes.at(nodeId), nodeId,
+                                                                      hostTilingBuffer + tilingOffsets.at(nodeId),
+                                                                      tilingSizes_.at(nodeId), context);
+        } catch (const std::exception &e) {
+            ATB_LOG(ERROR) << GetLogPrefix() << " node[" << nodeId << "] fill tiling buffer throw an exception: "
+                           << e.what();
+            nodeStatuses.at(index) = ERROR_INTERNAL_ERROR;
+        }
+        SetInParallelTilingFill(false);
+        nodeFillTimes.at(index) = nodeFillTimer.ElapsedMicroSecond();
+    });
+
+    // 工作线程按完成顺序登记，提交前按节点排序，使kernel cache的写入顺序与串行填充一致
+    std::sort(pendingCacheTilings_.begin(), pendingCacheTilings_.end(),
+              [](const PendingCacheTiling &left, const PendingCacheTiling &right) {
+                  return left.nodeId < right.nodeId;
+              });
+    CommitParallelTilingFill();
+    uint64_t serialFillTime = 0;
+    for (uint64_t nodeFillTime : nodeFillTimes) {
+        serialFillTime += nodeFillTime;
+    }
+    uint64_t parallelFillTime = parallelFillTimer.ElapsedMicroSecond();
+    GetOpSetupStatistic().tilingParallelFillCount += 1;
+    GetOpSetupStatistic().tilingParallelFillTime += parallelFillTime;
+    GetOpSetupStatistic().tilingParallelFillSerialTime += serialFillTime;
+    ATB_LOG(INFO) << GetLogPrefix() << " parallel fill tiling, kernelNum:" << fillNodeIds.size()
+                  << ", threadNum:" << threadPool.GetThreadNum() << ", parallelFillTime:" << parallelFillTime
+                  << ", serialFillTime:" << serialFillTime;
+
+    for (size_t index = 0; index < fillNodeIds.size(); ++index) {
+        if (nodeStatuses.at(index) != NO_ERROR) {
+            ATB_LOG(ERROR) << GetLogPrefix() << " node[" << fillNodeIds.at(index)
+                           << "] fill tiling buffer fail, error code:" << nodeStatuses.at(index);
+            return nodeStatuses.at(index);
         }
-        offset += tilingSize;
     }
     return NO_ERROR;
 }
@@ -293,7 +375,8 @@ Status OpsRunner::FillSingleKernelHostTilingBuffer(KernelGraphNode &node, size_t
     }
 
     ATB_LOG(DEBUG) << GetLogPrefix() << " node[" << nodeId << "] InitHostLaunchBuffer start";
-    GetOpSetupStatistic().tilingCacheMissCount += 1;
+    // 并行填充时当前可能是工作线程，kernel cache和线程局部的统计信息均不能在此处更新
+    bool inParallelTilingFill = IsInParallelTilingFill();
     Mki::Timer fillTimer;
     bool launchWithTiling = context.GetLaunchWithTilingStatus();
     Status status = node.impl->InitKernelInfo(kernelHostTilingBuffer, tilingSize, launchWithTiling);
@@ -302,10 +385,19 @@ Status OpsRunner::FillSingleKernelHostTilingBuffer(KernelGraphNode &node, size_t
         return status;
     }
     uint64_t fillTime = fillTimer.ElapsedMicroSecond();
-    GetOpSetupStatistic().opsInitLuanchBufferTime += fillTime;
     ATB_LOG(DEBUG) << GetLogPrefix() << " node[" << nodeId << "] InitHostLaunchBuffer end, time:" << fillTime;
 
-    UpdateCacheTiling(node, nodeId, kernelHostTilingBuffer, tilingSize);
+    if (inParallelTilingFill) {
+        // 本Runner的kernel并行填充时多个工作线程同时登记
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pendingTilingCacheMissCount_ += 1;
+        pendingInitLaunchBufferTime_ += fillTime;
+        pendingCacheTilings_.push_back({nodeId, kernelHostTilingBuffer, tilingSize});
+    } else {
+        GetOpSetupStatistic().tilingCacheMissCount += 1;
+        GetOpSetupStatistic().opsInitLuanchBufferTime += fillTime;
+        UpdateCacheTiling(node, nodeId, kernelHostTilingBuffer, tilingSize);
+    }
     if (context.GetLaunchMode() == GRAPH_LAUNCH_MODE) {
         // 整图下发模式下绝大部分算子tiling只需计算一次，少部分需要多次计算的用needKernelGraphModify_进行标记
         node.impl->SetTilingFilledFlag(true);
@@ -313,6 +405,19 @@ Status OpsRunner::FillSingleKernelHostTilingBuffer(KernelGraphNode &node, size_t
     return NO_ERROR;
 }
 
+void OpsRunner::CommitParallelTilingFill()
+{
+    GetOpSetupStatistic().tilingCacheMissCount += pendingTilingCacheMissCount_;
+    GetOpSetupStatistic().opsInitLuanchBufferTime += pendingInitLaunchBufferTime_;
+    for (const PendingCacheTiling &pending : pendingCacheTilings_) {
+        UpdateCacheTiling(kernelGraph_.nodes.at(pending.nodeId), pending.nodeId, pending.kernelHostTilingBuffer,
+                          pending.tilingSize);
+    }
+    pendingCacheTilings_.clear();
+    pendingTilingCacheMissCount_ = 0;
+    pendingInitLaunchBufferTime_ = 0;
+}
+
 void OpsRunner::CalcKernelWorkspace()
 {
     uint64_t maxKernelWorkspaceSize = 0;
@@ -686,7 +791,11 @@ Status OpsRunner::RunKernel(KernelGraphNode &node, size_t nodeId, ContextBase *c
 
     ReportMsprofInfo(beginTime, node.GetName().c_str(), node, nodeId);
 
-    if (Probe::IsOverflowCheck()) {
+    OverflowDetector *overflowDetector = context->GetOverflowDetector();
+    if (overflowDetector != nullptr) {
+        // 延迟检测时溢出状态在Operation执行结束后统一读回，只在定位溢出kernel的重新执行中同步探测
+        ProbeDeferredOverflow(node, context, *overflowDetector);
+    } else if (Probe::IsOverflowCheck()) {
         bool isOverflow = CheckOverflow(node, context);
         if (isOverflow) {
             ATB_LOG(ERROR) << node.GetName() << " overflow!";
@@ -712,7 +821,6 @@ void OpsRunner::Reset()
         memAllocationSolver_->Reset();
     }
     mallocCache_.clear();
-    tensorMalloced_.clear();
 }
 
 Status OpsRunner::PlanKernelGraph(uint8_t *kernelHostTilingBuffer, uint64_t maxTilingSize, bool launchWithTiling)
@@ -798,24 +906,25 @@ Status OpsRunner::PlanKernel(size_t nodeId, uint8_t *kernelHostTilingBuffer, uin
 
 void OpsRunner::FreeInternalTensor(KernelGraphNode &node, size_t nodeId)
 {
-    auto it = maxNodeIdTensorMap_.find(nodeId);
-    if (it != maxNodeIdTensorMap_.end()) {
-        for (auto tensorIt : it->second) {
-            memAllocationSolver_->Free((uint8_t *)tensorIt->data);
-            mallocCache_.push_back({tensorIt, false});
-            ATB_LOG(INFO) << GetLogPrefix() << " node[" << nodeId << "] " << node.GetName() << " mem free.";
+    if (nodeId >= nodeLastUseTensors_.size()) {
+        return;
+    }
+    for (auto tensorIt : nodeLastUseTensors_.at(nodeId)) {
+        memAllocationSolver_->Free((uint8_t *)tensorIt->data);
+        mallocCache_.push_back({tensorIt, false});
+        ATB_LOG(INFO) << GetLogPrefix() << " node[" << nodeId << "] " << node.GetName() << " mem free.";
 #ifdef _DEBUG
-            ATB_LOG(INFO) << "data :" << tensorIt->data;
+        ATB_LOG(INFO) << "data :" << tensorIt->data;
 #endif
-        }
     }
 }
 
 void OpsRunner::MallocLocalInternalTensor(const KernelGraphNode &node, size_t nodeId, size_t tensorId,
                                           const Mki::Tensor &infershapedOutTensor, Mki::Tensor *outTensor)
 {
-    if (tensorMalloced_.find(outTensor) == tensorMalloced_.end()) {
-        tensorMalloced_.insert(outTensor);
+    uint32_t kernelTensorId = node.outTensorIds.at(tensorId);
+    if (!tensorMalloced_.at(kernelTensorId)) {
+        tensorMalloced_.at(kernelTensorId) = 1;
         if (infershapedOutTensor.desc.dims.size() != 0) {
             outTensor->desc = infershapedOutTensor.desc;
         } else {
@@ -839,10 +948,11 @@ void OpsRunner::MallocLocalInternalTensor(const KernelGraphNode &node, size_t no
 void OpsRunner::MallocGlobalInternalTensor(const KernelGraphNode &node, size_t nodeId, size_t tensorId,
                                            const Mki::Tensor &infershapedOutTensor, Mki::Tensor *outTensor)
 {
-    auto it = isOutTensorNeedMalloc_.find(outTensor);
-    if (it != isOutTensorNeedMalloc_.end()) {
-        if (it->second && tensorMalloced_.find(outTensor) == tensorMalloced_.end()) {
-            tensorMalloced_.insert(outTensor);
+    uint32_t kernelTensorId = node.outTensorIds.at(tensorId);
+    if (kernelGraph_.IsOutTensorId(kernelTensorId)) {
+        bool needMalloc = isOutTensorNeedMalloc_.at(kernelTensorId - kernelGraph_.inTensors.size()) != 0;
+        if (needMalloc && !tensorMalloced_.at(kernelTensorId)) {
+            tensorMalloced_.at(kernelTensorId) = 1;
             outTensor->data = memAllocationSolver_->GetOffset(TensorUtil::AlignInt(outTensor->dataSize, ALIGN_INT));
             mallocCache_.push_back({outTensor, true});
             ATB_LOG(INFO) << GetLogPrefix() << " node[" << nodeId << "] " << node.GetName() << " outTensors["
@@ -894,83 +1004,71 @@ size_t OpsRunner::GetNodeAlignedTilingBufferSize(const KernelGraphNode &node, si
     return tilingSize;
 }
 
-void OpsRunner::SearchTensorInNodeInTensor(const Mki::Tensor *tensor, uint64_t &maxNodeId, uint64_t &dependNodeCount)
+void OpsRunner::InitTensorMaxNodeMap()
 {
+    tensorMalloced_.assign(kernelGraph_.GetTensorNum(), 0); // kernel graph的tensor数量可能随setup变化
+    if (lastUseTensorNum_ != 0) {
+        ATB_LOG(INFO) << GetLogPrefix() << " InitTensorMaxNodeMap call once";
+        return;
+    }
+    // 一次遍历所有节点，统计每个tensor的最后读取节点、读取次数与首次写入节点
+    const size_t tensorNum = kernelGraph_.GetTensorNum();
+    std::vector<uint64_t> lastReadNodeIds(tensorNum, 0);
+    std::vector<uint64_t> dependNodeCounts(tensorNum, 0);
+    std::vector<uint64_t> firstWriteNodeIds(tensorNum, UINT64_MAX);
     for (size_t nodeId = 0; nodeId < kernelGraph_.nodes.size(); ++nodeId) {
-        auto &node = kernelGraph_.nodes.at(nodeId);
-        for (auto inTensorIt : node.inTensors) {
-            if (tensor == inTensorIt) {
-                maxNodeId = nodeId;
-                dependNodeCount++;
+        for (uint32_t tensorId : kernelGraph_.nodes.at(nodeId).inTensorIds) {
+            if (tensorId != KernelGraph::INVALID_TENSOR_ID) {
+                lastReadNodeIds.at(tensorId) = nodeId;
+                dependNodeCounts.at(tensorId)++;
             }
         }
-    }
-}
-
-bool OpsRunner::SearchTensorInNodeOutTensor(const Mki::Tensor *tensor, uint64_t &maxNodeId)
-{
-    for (size_t nodeId = 0; nodeId < kernelGraph_.nodes.size(); ++nodeId) {
-        auto &node = kernelGraph_.nodes.at(nodeId);
-        for (auto outTensorIt : node.outTensors) {
-            if (tensor == outTensorIt) {
-                maxNodeId = nodeId;
-                return true;
+        for (uint32_t tensorId : kernelGraph_.nodes.at(nodeId).outTensorIds) {
+            if (tensorId != KernelGraph::INVALID_TENSOR_ID && firstWriteNodeIds.at(tensorId) == UINT64_MAX) {
+                firstWriteNodeIds.at(tensorId) = nodeId;
             }
         }
     }
-    return false;
-}
+    nodeLastUseTensors_.assign(kernelGraph_.nodes.size(), {});
 
-void OpsRunner::InitTensorMaxNodeMap()
-{
-    if (!tensorMaxNodeIdMap_.empty()) {
-        ATB_LOG(INFO) << GetLogPrefix() << " InitTensorMaxNodeMap call once";
-        return;
-    }
     if (!GetSingleton<Config>().Is310PRC()) {
         const size_t kernelGraphInTensorsSize = kernelGraph_.inTensors.size();
-        for (size_t i = 0; i < kernelGraphInTensorsSize; ++i) {
+        for (uint32_t i = 0; i < kernelGraphInTensorsSize; ++i) {
             Mki::Tensor *tensor = &kernelGraph_.inTensors.at(i);
-            auto it = isInTensorCanFree_.find(tensor);
-            if (it == isInTensorCanFree_.end() || !it->second) {
+            if (i >= isInTensorCanFree_.size() || !isInTensorCanFree_.at(i)) {
                 continue; // 若intensor的isInTensorCanFree为false，不参与内存释放
             }
-            uint64_t maxNodeId = 0;
-            uint64_t dependNodeCount = 0;
-
-            SearchTensorInNodeInTensor(tensor, maxNodeId, dependNodeCount);
-            if (dependNodeCount == 0) {
+            if (dependNodeCounts.at(i) == 0) {
                 ATB_LOG(WARN) << GetLogPrefix() << "intensor[" << i << "] dependNodeCount is 0, graph wrong";
                 memAllocationSolver_->Free((uint8_t *)tensor->data); // 当intensor在graph内未被使用时，立即释放
                 mallocCache_.push_back({tensor, false});
             } else {
-                ATB_LOG(INFO) << GetLogPrefix() << "intensor[" << i << "] maxNodeId: " << maxNodeId
-                            << ", dependNodeCount: " << dependNodeCount;
-                tensorMaxNodeIdMap_[tensor] = maxNodeId;
-                maxNodeIdTensorMap_[maxNodeId].insert(tensor);
+                ATB_LOG(INFO) << GetLogPrefix() << "intensor[" << i << "] maxNodeId: " << lastReadNodeIds.at(i)
+                              << ", dependNodeCount: " << dependNodeCounts.at(i);
+                nodeLastUseTensors_.at(lastReadNodeIds.at(i)).push_back(tensor);
+                lastUseTensorNum_++;
             }
         }
     }
+    const uint32_t internalTensorIdBase = kernelGraph_.inTensors.size() + kernelGraph_.outTensors.size();
     const size_t kernelGraphInternalTensorsSize = kernelGraph_.internalTensors.size();
-    for (size_t i = 0; i < kernelGraphInternalTensorsSize; ++i) {
-        Mki::Tensor *tensor = &kernelGraph_.internalTensors[i];
-        uint64_t maxNodeId = 0;
-        uint64_t dependNodeCount = 0;
-
-        SearchTensorInNodeInTensor(tensor, maxNodeId, dependNodeCount);
-        if (dependNodeCount == 0) {
+    for (uint32_t i = 0; i < kernelGraphInternalTensorsSize; ++i) {
+        uint32_t tensorId = internalTensorIdBase + i;
+        uint64_t maxNodeId = lastReadNodeIds.at(tensorId);
+        if (dependNodeCounts.at(tensorId) == 0) {
             ATB_LOG(WARN) << GetLogPrefix() << "internal tensor[" << i << "] dependNodeCount is 0, graph wrong";
 
-            if (!SearchTensorInNodeOutTensor(tensor, maxNodeId)) {
+            if (firstWriteNodeIds.at(tensorId) == UINT64_MAX) {
                 ATB_LOG(WARN) << GetLogPrefix() << "internal tensor[" << i << "] is not valued, graph wrong";
                 continue; // 当中间tensor未在graph内使用时，若有被赋值，则赋值结束立刻释放；若未被赋值，则无需释放
             }
+            maxNodeId = firstWriteNodeIds.at(tensorId);
         } else {
             ATB_LOG(INFO) << GetLogPrefix() << "internal tensor[" << i << "] maxNodeId: " << maxNodeId
-                          << ", dependNodeCount: " << dependNodeCount;
+                          << ", dependNodeCount: " << dependNodeCounts.at(tensorId);
         }
-        tensorMaxNodeIdMap_[tensor] = maxNodeId;
-        maxNodeIdTensorMap_[maxNodeId].insert(tensor);
+        nodeLastUseTensors_.at(maxNodeId).push_back(&kernelGraph_.internalTensors[i]);
+        lastUseTensorNum_++;
     }
 }
 
@@ -1012,10 +1110,12 @@ void OpsRunner::RunKernelPreProcess(KernelGraphNode &node, size_t nodeId, aclrtS
     if (nodesSaveTensorFlag_.at(nodeId) && Probe::IsExecuteCountInRange(executeCount_) && Probe::IsSaveTensorBefore()
         && Probe::IsSaveTensorInSpecificDir(GetSaveTensorDir() + "/" + std::to_string(nodeId) + "_" + node.GetName())) {
         std::string dirPath = GetSaveTensorDir() + "/" + std::to_string(nodeId) + "_" + node.GetName() + "/before";
-        node.impl->SaveLaunchParam(stream, dirPath);
+        node.impl->SaveLaunchParam(stream, dirPath, IsDumpSampled());
         ATB_LOG(INFO) << GetLogPrefix() << " " << node.GetName() << " SaveRunInfo " << dirPath;
     }
-    if (GetSingleton<Config>().IsCompareTilingEveryKernelEnable()) {
+    if (GetSingleton<Config>().IsCompareTilingEveryKernelEnable() && GetSingleton<AsyncDumper>().IsEnable()) {
+        CompareGlobalDeviceTilingAsync(node, nodeId, stream, true);
+    } else if (GetSingleton<Config>().IsCompareTilingEveryKernelEnable()) {
         SyncStream(node, nodeId, stream);
         std::string dirPath = GetSaveTensorDir() + "/" + std::to_string(nodeId) + "_" + node.GetName() + "/before";
         SaveGlobalDeviceTiling(dirPath, globalTilingBeforeKernelRun_);
@@ -1030,10 +1130,12 @@ void OpsRunner::RunKernelPostProcess(KernelGraphNode &node, size_t nodeId, aclrt
     if (nodesSaveTensorFlag_.at(nodeId) && Probe::IsExecuteCountInRange(executeCount_) && Probe::IsSaveTensorAfter()
         && Probe::IsSaveTensorInSpecificDir(GetSaveTensorDir() + "/" + std::to_string(nodeId) + "_" + node.GetName())) {
         std::string dirPath = GetSaveTensorDir() + "/" + std::to_string(nodeId) + "_" + node.GetName() + "/after";
-        node.impl->SaveLaunchParam(stream, dirPath);
+        node.impl->SaveLaunchParam(stream, dirPath, IsDumpSampled());
         ATB_LOG(INFO) << GetLogPrefix() << " " << node.GetName() << " SaveLaunchParam " << dirPath;
     }
-    if (GetSingleton<Config>().IsCompareTilingEveryKernelEnable()) {
+    if (GetSingleton<Config>().IsCompareTilingEveryKernelEnable() && GetSingleton<AsyncDumper>().IsEnable()) {
+        CompareGlobalDeviceTilingAsync(node, nodeId, stream, false);
+    } else if (GetSingleton<Config>().IsCompareTilingEveryKernelEnable()) {
         SyncStream(node, nodeId, stream);
         std::string dirPath = GetSaveTensorDir() + "/" + std::to_string(nodeId) + "_" + node.GetName() + "/after";
         SaveGlobalDeviceTiling(dirPath, globalTilingAfterKernelRun_);
@@ -1046,11 +1148,49 @@ void OpsRunner::SyncStream(KernelGraphNode &node, size_t nodeId, aclrtStream str
 {
     Mki::Timer streamSyncTimer;
     ATB_LOG(INFO) << GetLogPrefix() << " node[" << nodeId << "] " << node.GetName() << " aclrtSynchronizeStream.";
-    int ret = aclrtSynchronizeStream(stream);
+    int ret = 0;
+    {
+        TraceScope traceScope(TRACE_EVENT_STREAM_SYNC, GetTraceNameId());
+        ret = aclrtSynchronizeStream(stream);
+    }
     GetOpExecuteStatistic().streamSyncTime += streamSyncTimer.ElapsedMicroSecond();
     ATB_LOG_IF(ret != 0, ERROR) << GetLogPrefix() << " node[" << nodeId << "] aclrtSynchronizeStream fail, ret:" << ret;
 }
 
+void OpsRunner::CompareGlobalDeviceTilingAsync(KernelGraphNode &node, size_t nodeId, aclrtStream stream,
+                                               bool beforeKernelRun)
+{
+    void *tilingDeviceBuffer = nullptr;
+    uint64_t tilingBufferSize = 0;
+    GetCurrentOpTiling(tilingDeviceBuffer, tilingBufferSize);
+    if (tilingDeviceBuffer == nullptr || tilingBufferSize == 0 || tilingBufferSize >= MAX_TILING_BUFFER_SIZE) {
+        asyncGlobalTilingBeforeKernelRun_.reset();
+        return;
+    }
+    // 运行前后的tiling都在stream上异步拷贝，由后台线程按提交顺序先保存运行前的内容，再与运行后的内容比较
+    if (beforeKernelRun) {
+        auto tilingBefore = std::make_shared<std::vector<uint8_t>>();
+        asyncGlobalTilingBeforeKernelRun_ = tilingBefore;
+        GetSingleton<AsyncDumper>().CopyAsync(stream, tilingDeviceBuffer, tilingBufferSize,
+            [tilingBefore](const uint8_t *data, uint64_t dataSize) { tilingBefore->assign(data, data + dataSize); });
+        return;
+    }
+    std::shared_ptr<std::vector<uint8_t>> tilingBefore = std::move(asyncGlobalTilingBeforeKernelRun_);
+    if (!tilingBefore) {
+        return;
+    }
+    std::string nodeInfo = GetLogPrefix() + " node[" + std::to_string(nodeId) + "] " + node.GetName();
+    GetSingleton<AsyncDumper>().CopyAsync(stream, tilingDeviceBuffer, tilingBufferSize,
+        [tilingBefore, nodeInfo](const uint8_t *data, uint64_t dataSize) {
+            // 运行前的拷贝被丢弃时无法比较
+            if (tilingBefore->empty()) {
+                return;
+            }
+            bool changed = tilingBefore->size() != dataSize || memcmp(tilingBefore->data(), data, dataSize) != 0;
+            ATB_LOG_IF(changed, FATAL) << nodeInfo << " change global device tiling";
+        });
+}
+
 void OpsRunner::SaveGlobalDeviceTiling(const std::string &dirPath, std::vector<uint8_t> &tilingData) const
 {
     void *tilingDeviceBuffer = nullptr;
@@ -1091,6 +1231,7 @@ bool OpsRunner::GetCachedTiling(KernelGraphNode &node, size_t nodeId, uint8_t *k
     if (!node.tilingCacheEnable) {
         return false;
     }
+    KernelCache *threadKernelCache = nullptr;
     const size_t kernelCachesSize = kernelCaches_.size();
     for (size_t i = 0; i < kernelCachesSize; ++i) {
         KernelCache *kernelCache = kernelCaches_.at(i).first;
@@ -1100,9 +1241,22 @@ bool OpsRunner::GetCachedTiling(KernelGraphNode &node, size_t nodeId, uint8_t *k
         if (getTilingSuccess) {
             ATB_LOG(INFO) << GetLogPrefix() << " node[" << nodeId << "] kernel cache get last tiling";
             IncreaseStatisticCacheHitCount(isLocalCache);
+            RecordTraceInstant(TRACE_EVENT_TILING_CACHE_HIT);
             return true;
         }
+        threadKernelCache = isLocalCache ? threadKernelCache : kernelCache;
+    }
+    if (threadKernelCache != nullptr &&
+        node.impl->GetSharedCachedTiling(*threadKernelCache, static_cast<uint32_t>(runnerTypeIdx_), nodeId,
+                                         kernelHostTilingBuffer, maxTilingSize, tilingSizeFetched,
+                                         launchWithTiling)) {
+        ATB_LOG(INFO) << GetLogPrefix() << " node[" << nodeId << "] shared kernel cache get tiling";
+        GetOpSetupStatistic().tilingCacheHitCount += 1;
+        GetOpSetupStatistic().tilingSharedCacheHitCount += 1;
+        RecordTraceInstant(TRACE_EVENT_TILING_CACHE_HIT);
+        return true;
     }
+    RecordTraceInstant(TRACE_EVENT_TILING_CACHE_MISS);
     return false;
 }
 
@@ -1113,11 +1267,19 @@ void OpsRunner::UpdateCacheTiling(KernelGraphNode &node, size_t nodeId, uint8_t
         return;
     }
 
+    uint64_t localMemorySize = 0;
+    uint64_t globalMemorySize = 0;
     const size_t kernelCachesSize = kernelCaches_.size();
     for (size_t i = 0; i < kernelCachesSize; ++i) {
         KernelCache *kernelCache = kernelCaches_.at(i).first;
         node.impl->AddTiling(*kernelCache, nodeId, kernelHostTilingBuffer, tilingSize);
+        uint64_t &memorySize = kernelCaches_.at(i).second ? localMemorySize : globalMemorySize;
+        memorySize += kernelCache->GetMemorySize();
     }
+    node.impl->AddSharedTiling(static_cast<uint32_t>(runnerTypeIdx_), nodeId, kernelHostTilingBuffer, tilingSize);
+    GetOpSetupStatistic().kernelCacheLocalMemorySize = localMemorySize;
+    GetOpSetupStatistic().kernelCacheGlobalMemorySize = globalMemorySize;
+    GetOpSetupStatistic().kernelCacheInternedKernelCount = GetSingleton<KernelRegistry>().GetInternedKernelCount();
 }
 
 void OpsRunner::BuildAdditionalInfo(
@@ -1313,13 +1475,21 @@ bool OpsRunner::JudgeOverflowTensor(const std::string &opName, const Mki::Tensor
         ATB_LOG(ERROR) << "HostBuffer of " << opName << " is nullptr!";
         return false;
     }
+    if (IsInfTensor(tensor, hostBuffer)) {
+        Probe::ReportOverflowKernel(opName);
+        return true;
+    }
+    return false;
+}
+
+bool OpsRunner::IsInfTensor(const Mki::Tensor &tensor, uint8_t *hostBuffer) const
+{
     if (tensor.desc.dtype == Mki::TensorDType::TENSOR_DTYPE_FLOAT16 ||
         tensor.desc.dtype == Mki::TensorDType::TENSOR_DTYPE_BF16) {
         Mki::fp16_t *bufferAddr = reinterpret_cast<Mki::fp16_t *>(hostBuffer);
         const size_t counter = tensor.dataSize / sizeof(Mki::fp16_t);
         for (size_t i = 0; i < counter; i++) {
             if (bufferAddr[i].IsInf()) {
-                Probe::ReportOverflowKernel(opName);
                 return true;
             }
         }
@@ -1330,7 +1500,6 @@ bool OpsRunner::JudgeOverflowTensor(const std::string &opName, const Mki::Tensor
         const size_t counter = tensor.dataSize / sizeof(float);
         for (size_t i = 0; i < counter; i++) {
             if (std::isinf(bufferAddr[i])) {
-                Probe::ReportOverflowKernel(opName);
                 return true;
             }
         }
@@ -1338,6 +1507,52 @@ bool OpsRunner::JudgeOverflowTensor(const std::string &opName, const Mki::Tensor
     return false;
 }
 
+void OpsRunner::ProbeDeferredOverflow(const KernelGraphNode &node, ContextBase *context,
+                                      OverflowDetector &detector) const
+{
+    if (!detector.IsBisectRun()) {
+        detector.CountKernel();
+        return;
+    }
+    if (!detector.RecordKernel(node.GetName())) {
+        return;
+    }
+    aclrtStream stream = GetExecuteStream(context);
+    bool isOverflow = false;
+    if (detector.IsSaturationMode()) {
+        Status st = detector.ReadStatusSync(stream, isOverflow);
+        ATB_LOG_IF(st != NO_ERROR, ERROR) << GetLogPrefix() << "read overflow status failed! ret:" << st;
+    } else {
+        isOverflow = IsKernelOutTensorOverflow(node, stream);
+    }
+    detector.ReportProbeResult(isOverflow);
+}
+
+bool OpsRunner::IsKernelOutTensorOverflow(const KernelGraphNode &node, aclrtStream stream) const
+{
+    Status st = aclrtSynchronizeStream(stream);
+    if (st != NO_ERROR) {
+        ATB_LOG(ERROR) << "aclrtSynchronizeStream failed! ret:" << st;
+        return false;
+    }
+    for (const Mki::Tensor *tensor : node.outTensors) {
+        if (tensor == nullptr || tensor->data == nullptr || tensor->dataSize == 0) {
+            continue;
+        }
+        std::vector<uint8_t> hostBuffer(tensor->dataSize);
+        st = aclrtMemcpy(hostBuffer.data(), tensor->dataSize, tensor->data, tensor->dataSize,
+                         ACL_MEMCPY_DEVICE_TO_HOST);
+        if (st != NO_ERROR) {
+            ATB_LOG(ERROR) << "aclrtMemcpy failed! ret:" << st;
+            return false;
+        }
+        if (IsInfTensor(*tensor, hostBuffer.data())) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void OpsRunner::InitOpsTensorPack(const RunnerVariantPack &runnerPack)
 {
     size_t opsTensorPackInTensorsSize = runnerPack.inTensors.size();
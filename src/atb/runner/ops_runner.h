@@ -11,9 +11,9 @@
 #define ATB_OPS_RUNNER_H
 
 #include <functional>
-#include <map>
-#include <set>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <mki/utils/profiling/profiling_funcs.h>
 #include <mki/op_desc.h>
 #include <mki/launch_param.h>
@@ -56,6 +56,7 @@ protected:
     uint64_t GetIntermediateBufferSizeImpl() override;
     Status ExecuteImpl(RunnerVariantPack &runnerVariantPack) override;
     Status PreExecuteImpl(RunnerVariantPack &runnerVariantPack) override;
+    void CommitParallelTilingFill() override;
     virtual Status ModifyKernelGraph(const OpsTensorPack &opsTensorPack);
 
 protected:
@@ -74,10 +75,7 @@ private:
     void RunMallocCache(RunnerVariantPack &runnerVariantPack);
     void UpdateOutTensorDeviceData(RunnerVariantPack &runnerVariantPack);
     size_t GetNodeAlignedTilingBufferSize(const KernelGraphNode &node, size_t nodeId) const;
-    void SearchTensorInNodeInTensor(const Mki::Tensor *tensor, uint64_t &maxNodeId, uint64_t &dependNodeCount);
-    bool SearchTensorInNodeOutTensor(const Mki::Tensor *tensor, uint64_t &maxNodeId);
     void InitTensorMaxNodeMap();
-    bool IsInternalTensor(const Mki::Tensor *tensor);
     void WriteTilingData(const uint8_t *tilingData, size_t len, const std::string &filePath) const;
     void UpdateRunInfoTensorData(KernelGraphNode &node, size_t nodeId, uint8_t *deviceIntermediateBuffer) const;
     Status UpdateRunInfoTiling(RunnerVariantPack &runnerVariantPack);
@@ -98,6 +96,10 @@ private:
     Status RunKernel(KernelGraphNode &node, size_t nodeId, ContextBase *context) const;
     Status FillSingleKernelHostTilingBuffer(KernelGraphNode &node, size_t nodeId, uint8_t *kernelHostTilingBuffer,
                                             size_t tilingSize, ContextBase &context);
+    Status SerialFillKernelHostTilingBuffer(uint8_t *hostTilingBuffer, const std::vector<uint64_t> &tilingOffsets,
+                                            const std::vector<size_t> &fillNodeIds, ContextBase &context);
+    Status ParallelFillKernelHostTilingBuffer(uint8_t *hostTilingBuffer, const std::vector<uint64_t> &tilingOffsets,
+                                              const std::vector<size_t> &fillNodeIds, ContextBase &context);
     void MallocLocalInternalTensor(const KernelGraphNode &node, size_t nodeId, size_t tensorId,
                                    const Mki::Tensor &infershapedOutTensor, Mki::Tensor *outTensor);
     void MallocGlobalInternalTensor(const KernelGraphNode &node, size_t nodeId, size_t tensorId,
@@ -109,6 +111,8 @@ private:
     void RunKernelPreProcess(KernelGraphNode &node, size_t nodeId, aclrtStream stream);
     void RunKernelPostProcess(KernelGraphNode &node, size_t nodeId, aclrtStream stream);
     void SyncStream(KernelGraphNode &node, size_t nodeId, aclrtStream stream) const;
+    void CompareGlobalDeviceTilingAsync(KernelGraphNode &node, size_t nodeId, aclrtStream stream,
+                                        bool beforeKernelRun);
     void SaveGlobalDeviceTiling(const std::string &dirPath, std::vector<char> &tilingData) const;
     void IncreaseStatisticCacheHitCount(bool localCache) const;
     bool GetCachedTiling(KernelGraphNode &node, size_t nodeId, uint8_t *kernelHostTilingBuffer, uint64_t maxTilingSize,
@@ -121,6 +125,9 @@ private:
     bool ExecuteOverFlowCheckKernel(const std::string &opName, ContextBase *context) const;
     bool CheckOverFlowByTensor(const std::string &opName) const;
     bool JudgeOverflowTensor(const std::string &opName, const Mki::Tensor &tensor, uint8_t *hostBuffer) const;
+    bool IsInfTensor(const Mki::Tensor &tensor, uint8_t *hostBuffer) const;
+    void ProbeDeferredOverflow(const KernelGraphNode &node, ContextBase *context, OverflowDetector &detector) const;
+    bool IsKernelOutTensorOverflow(const KernelGraphNode &node, aclrtStream stream) const;
     void InitOpsTensorPack(const RunnerVariantPack &runnerPack);
 
 private:
@@ -136,11 +143,11 @@ private:
     SVector<uint64_t> tilingSizes_;
     uint64_t workspaceSize_ = 0;
     uint64_t intermediateSize_ = 0;
-    std::map<Mki::Tensor *, uint64_t> tensorMaxNodeIdMap_;
-    std::map<uint64_t, std::set<Mki::Tensor *>> maxNodeIdTensorMap_;
-    std::map<Mki::Tensor *, bool> isInTensorCanFree_;
-    std::map<Mki::Tensor *, bool> isOutTensorNeedMalloc_;
-    std::set<Mki::Tensor *> tensorMalloced_;
+    std::vector<std::vector<Mki::Tensor *>> nodeLastUseTensors_; // 按nodeId索引，该节点setup后释放的tensor
+    size_t lastUseTensorNum_ = 0;
+    std::vector<uint8_t> isInTensorCanFree_;     // 按kernelGraph_.inTensors下标索引
+    std::vector<uint8_t> isOutTensorNeedMalloc_; // 按kernelGraph_.outTensors下标索引
+    std::vector<uint8_t> tensorMalloced_;        // 按kernelGraph_ tensor id索引
     std::shared_ptr<MemAllocationSolver> memAllocationSolver_;
     int64_t runnerTypeIdx_ = -1; // 默认值为-1
     RunnerVariantPack lastRunnerVariantPack_;
@@ -151,10 +158,20 @@ private:
     bool kernelCacheInited_ = false;
     std::vector<uint8_t> globalTilingBeforeKernelRun_;
     std::vector<uint8_t> globalTilingAfterKernelRun_;
+    std::shared_ptr<std::vector<uint8_t>> asyncGlobalTilingBeforeKernelRun_;
     std::vector<std::pair<KernelCache *, bool>> kernelCaches_;
     std::vector<bool> nodesSaveTensorFlag_;
     bool isVariantPackEqual_ = false;
     bool overrideModifyGraph_ = true;
+    struct PendingCacheTiling {
+        size_t nodeId = 0;
+        uint8_t *kernelHostTilingBuffer = nullptr;
+        size_t tilingSize = 0;
+    };
+    std::vector<PendingCacheTiling> pendingCacheTilings_; // 并行填充tiling时待写入kernel cache的节点
+    uint64_t pendingTilingCacheMissCount_ = 0;
+    uint64_t pendingInitLaunchBufferTime_ = 0;
+    std::mutex pendingMutex_;
 };
 } // namespace atb
 #endif
@@ -11,6 +11,7 @@
 #include <sstream>
 #include <mki/utils/file_system/file_system.h>
 #include <mki/utils/time/timer.h>
+#include "atb/utils/async_dumper.h"
 #include "atb/utils/config.h"
 #include "atb/utils/store_util.h"
 #include "atb/utils/tensor_util.h"
@@ -26,6 +27,7 @@
 namespace atb {
 static const char *TENSOR_FILE_NAME_EXT = ".bin";
 constexpr size_t WORKSPACE_ALIGN = 512;
+static thread_local bool g_inParallelTilingFill = false;
 
 Runner::Runner(const std::string &name) : name_(name)
 {
@@ -49,6 +51,7 @@ std::string Runner::GetOperationName() const
 
 Status Runner::Setup(RunnerVariantPack &runnerVariantPack)
 {
+    TraceScope traceScope(TRACE_EVENT_RUNNER_SETUP, GetTraceNameId());
     multiStreamWorkspaceSizes_.clear();
     multiStreamWorkspaceSizes_.resize(runnerVariantPack.context->GetExecuteStreams().size());
     Status st = SetupImpl(runnerVariantPack);
@@ -69,6 +72,7 @@ uint64_t Runner::GetTilingBufferSize()
 
 Status Runner::FillHostTilingBuffer(uint8_t *hostTilingBuffer, uint64_t tilingBufferSize, ContextBase *context)
 {
+    TraceScope traceScope(TRACE_EVENT_TILING_FILL, GetTraceNameId());
     return FillHostTilingBufferImpl(hostTilingBuffer, tilingBufferSize, context);
 }
 
@@ -102,17 +106,21 @@ Status Runner::PreExecute(RunnerVariantPack &runnerVariantPack)
 Status Runner::Execute(RunnerVariantPack &runnerVariantPack)
 {
     OperationBase *opBase = dynamic_cast<OperationBase *>(operation_);
-    Mki::OperationIr* operationIr = nullptr;
+    const OperationIr *operationIr = nullptr;
     if (opBase) {
         operationIr = opBase->GetOperationIr();
     }
+    // 异步dump的采样按整次执行判断，执行前后的variant pack及各kernel的launch param保存共用该结果
+    dumpSampled_ = !Probe::IsExecuteCountInRange(executeCount_) || GetSingleton<AsyncDumper>().Sample();
 
     if (IsSaveTensor() && Probe::IsSaveTensorBefore()) {
         std::string tensorDir = tensorDir_ + "/before";
         if (operationIr) {
-            StoreUtil::SaveVariantPack(GetExecuteStream(runnerVariantPack.context), runnerVariantPack, tensorDir, operationIr);
+            StoreUtil::SaveVariantPack(GetExecuteStream(runnerVariantPack.context), runnerVariantPack, tensorDir,
+                                       operationIr, dumpSampled_);
         } else {
-            StoreUtil::SaveVariantPack(GetExecuteStream(runnerVariantPack.context), runnerVariantPack, tensorDir);
+            StoreUtil::SaveVariantPack(GetExecuteStream(runnerVariantPack.context), runnerVariantPack, tensorDir,
+                                       dumpSampled_);
         }
         ATB_LOG(INFO) << GetLogPrefix() << " save variant pack at " << tensorDir;
     }
@@ -120,9 +128,11 @@ Status Runner::Execute(RunnerVariantPack &runnerVariantPack)
     if (IsSaveTensor() && Probe::IsSaveTensorAfter()) {
         std::string tensorDir = tensorDir_ + "/after";
         if (operationIr) {
-            StoreUtil::SaveVariantPack(GetExecuteStream(runnerVariantPack.context), runnerVariantPack, tensorDir, operationIr);
+            StoreUtil::SaveVariantPack(GetExecuteStream(runnerVariantPack.context), runnerVariantPack, tensorDir,
+                                       operationIr, dumpSampled_);
         } else {
-            StoreUtil::SaveVariantPack(GetExecuteStream(runnerVariantPack.context), runnerVariantPack, tensorDir);
+            StoreUtil::SaveVariantPack(GetExecuteStream(runnerVariantPack.context), runnerVariantPack, tensorDir,
+                                       dumpSampled_);
         }
         ATB_LOG(INFO) << GetLogPrefix() << " save variant pack at " << tensorDir;
     }
@@ -148,7 +158,11 @@ Status Runner::Execute(RunnerVariantPack &runnerVariantPack)
     }
     if (GetSingleton<Config>().IsStreamSyncEveryRunnerEnable()) {
         Mki::Timer streamSyncTimer;
-        int retCode = aclrtSynchronizeStream(GetExecuteStream(runnerVariantPack.context));
+        int retCode = 0;
+        {
+            TraceScope traceScope(TRACE_EVENT_STREAM_SYNC, GetTraceNameId());
+            retCode = aclrtSynchronizeStream(GetExecuteStream(runnerVariantPack.context));
+        }
         GetOpExecuteStatistic().streamSyncTime += streamSyncTimer.ElapsedMicroSecond();
         ATB_LOG_IF(retCode != 0, ERROR) << GetLogPrefix() << "stream sync fail, ret:" << retCode;
     }
@@ -188,6 +202,27 @@ Status Runner::FillHostTilingBufferImpl(uint8_t *hostTilingBuffer, uint64_t tili
     return NO_ERROR;
 }
 
+bool Runner::IsInParallelTilingFill()
+{
+    return g_inParallelTilingFill;
+}
+
+void Runner::SetInParallelTilingFill(bool flag)
+{
+    g_inParallelTilingFill = flag;
+}
+
+void Runner::CommitParallelTilingFill() {}
+
+bool Runner::IsParallelTilingFillEnable(const ContextBase *context, size_t nodeNum)
+{
+    // 嵌套的Runner在工作线程中串行填充，避免工作线程等待线程池自身造成死锁
+    if (context == nullptr || context->GetTilingFillThreadPool() == nullptr || IsInParallelTilingFill()) {
+        return false;
+    }
+    return nodeNum >= GetSingleton<Config>().GetTilingFillParallelMinNodeNum();
+}
+
 uint64_t Runner::GetWorkspaceBufferSizeImpl()
 {
     return 0;
@@ -210,6 +245,11 @@ void Runner::SetSaveTensorDir(const std::string &tensorDir)
     tensorDir_ = tensorDir;
 }
 
+bool Runner::IsDumpSampled() const
+{
+    return dumpSampled_;
+}
+
 bool Runner::IsSaveTensor() const
 {
     return Probe::IsExecuteCountInRange(executeCount_) && saveTensorFlag_ && Probe::IsSaveTensorInSpecificDir(tensorDir_);
@@ -322,4 +362,20 @@ Status Runner::UpdateWorkspaceBuffer(RunnerVariantPack &runnerVariantPack)
     (void)runnerVariantPack;
     return NO_ERROR;
 }
+
+uint32_t Runner::GetTraceNameId() const
+{
+    if (traceNameId_ == 0 && GetSingleton<TraceRecorder>().IsEnable()) {
+        traceNameId_ = GetSingleton<TraceRecorder>().RegisterName(name_);
+    }
+    return traceNameId_;
+}
+
+void Runner::RecordTraceInstant(TraceEventType type) const
+{
+    TraceRecorder &traceRecorder = GetSingleton<TraceRecorder>();
+    if (traceRecorder.IsEnable()) {
+        traceRecorder.RecordInstant(type, GetTraceNameId());
+    }
+}
 } // namespace atb
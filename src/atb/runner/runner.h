@@ -12,6 +12,7 @@
 #include <string>
 #include <mki/utils/any/any.h>
 #include "atb/utils/runner_variant_pack.h"
+#include "atb/utils/trace_recorder.h"
 
 namespace atb {
 class Runner {
@@ -41,8 +42,18 @@ protected:
     virtual void SetSaveTensorDir(const std::string &tensorDir);
     std::string GetSaveTensorDir() const;
     bool IsSaveTensor() const;
+    // 本次Execute的异步dump采样结果，未开启异步dump时恒为true
+    bool IsDumpSampled() const;
     std::string GetLogPrefix() const;
     virtual void ChangeWorkspaceBufferByExecuteStream(RunnerVariantPack &runnerVariantPack);
+    // 并行填充tiling时，kernel cache和统计信息的更新需延迟到调用线程上提交
+    static bool IsInParallelTilingFill();
+    static void SetInParallelTilingFill(bool flag);
+    virtual void CommitParallelTilingFill();
+    // Context开启了tiling填充线程池、当前不在工作线程中且待填充的节点数达到阈值时并行填充
+    static bool IsParallelTilingFillEnable(const ContextBase *context, size_t nodeNum);
+    uint32_t GetTraceNameId() const;
+    void RecordTraceInstant(TraceEventType type) const;
     friend class GraphRunner;
     friend class OperationBase;
 
@@ -51,6 +62,7 @@ protected:
     size_t executeCount_ = 0;
     size_t setupCount_ = 0;
     std::string tensorDir_;
+    bool dumpSampled_ = true;
     bool isParamUpdated_ = false;
     Operation *operation_ = nullptr;
     std::string logPrefix_;
@@ -71,6 +83,7 @@ private:
     std::string name_;
     std::string operationName_;
     bool saveTensorFlag_ = false;
+    mutable uint32_t traceNameId_ = 0;
 };
 } // namespace atb
 #endif
\ No newline at end of file
@@ -0,0 +1,546 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/utils/async_dumper.h"
+#include <algorithm>
+#include <cstring>
+#include <unistd.h>
+#include <acl/acl_rt.h>
+#include "atb/utils/config.h"
+#include "atb/utils/log.h"
+#include "atb/utils/singleton.h"
+
+namespace atb {
+static const char DUMP_FILE_MAGIC[8] = {'A', 'T', 'B', 'D', 'U', 'M', 'P', '1'};
+static const char DUMP_INDEX_MAGIC[8] = {'A', 'T', 'B', 'I', 'N', 'D', 'X', '1'};
+constexpr uint32_t DUMP_FILE_VERSION = 1;
+constexpr uint32_t DUMP_RECORD_MAGIC = 0x44524341; // "ACRD"
+constexpr uint16_t DUMP_COMPRESS_NONE = 0;
+constexpr uint16_t DUMP_COMPRESS_ZERO_RUN = 1;
+constexpr uint64_t DUMP_BUFFER_ALIGN = 64;
+constexpr uint64_t MIN_ZERO_RUN_LEN = 16;
+constexpr uint64_t MAX_ZERO_RUN_TOKEN_LEN = UINT32_MAX;
+constexpr size_t MAX_PENDING_RECORD_NUM = 65536;
+constexpr uint64_t MB_SIZE = 1024 * 1024;
+
+struct DumpFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+};
+
+// 每条记录依次为：记录头、key、meta、数据
+struct DumpRecordHeader {
+    uint32_t magic;
+    uint16_t compression;
+    uint16_t reserved;
+    uint32_t keyLen;
+    uint32_t metaLen;
+    uint64_t rawSize;
+    uint64_t storedSize;
+};
+
+// 文件末尾：索引项(uint64 记录偏移, uint32 key长度, key)数组，之后为本结构
+struct DumpIndexFooter {
+    uint64_t indexOffset;
+    uint64_t recordCount;
+    char magic[8];
+};
+
+static uint64_t AlignDumpSize(uint64_t size)
+{
+    return (size + DUMP_BUFFER_ALIGN - 1) / DUMP_BUFFER_ALIGN * DUMP_BUFFER_ALIGN;
+}
+
+DumpRing::DumpRing(uint64_t capacity) : capacity_(capacity / DUMP_BUFFER_ALIGN * DUMP_BUFFER_ALIGN) {}
+
+bool DumpRing::Reserve(uint64_t size, uint64_t &offset, uint64_t &padding)
+{
+    uint64_t alignedSize = AlignDumpSize(size);
+    if (size == 0 || alignedSize > capacity_) {
+        return false;
+    }
+    if (used_ == 0) {
+        head_ = 0;
+        tail_ = 0;
+    }
+    padding = 0;
+    if (used_ == 0 || head_ > tail_) {
+        if (capacity_ - head_ >= alignedSize) {
+            offset = head_;
+        } else if (tail_ >= alignedSize) {
+            padding = capacity_ - head_;
+            offset = 0;
+        } else {
+            return false;
+        }
+    } else if (head_ < tail_ && tail_ - head_ >= alignedSize) {
+        offset = head_;
+    } else {
+        return false;
+    }
+    head_ = offset + alignedSize;
+    used_ += alignedSize + padding;
+    return true;
+}
+
+void DumpRing::Release(uint64_t offset, uint64_t size, uint64_t padding)
+{
+    uint64_t alignedSize = AlignDumpSize(size);
+    tail_ = offset + alignedSize;
+    used_ -= alignedSize + padding;
+    if (used_ == 0) {
+        head_ = 0;
+        tail_ = 0;
+    }
+}
+
+void DumpRing::Rollback(uint64_t offset, uint64_t size, uint64_t padding)
+{
+    uint64_t alignedSize = AlignDumpSize(size);
+    head_ = padding > 0 ? capacity_ - padding : offset;
+    used_ -= alignedSize + padding;
+    if (used_ == 0) {
+        head_ = 0;
+        tail_ = 0;
+    }
+}
+
+uint64_t DumpRing::GetCapacity() const
+{
+    return capacity_;
+}
+
+uint64_t DumpRing::GetUsedSize() const
+{
+    return used_;
+}
+
+DumpContainerWriter::~DumpContainerWriter()
+{
+    if (IsOpen()) {
+        Close();
+    }
+}
+
+Status DumpContainerWriter::Open(const std::string &filePath, bool compress)
+{
+    if (IsOpen()) {
+        ATB_LOG(ERROR) << "dump container " << filePath_ << " is already open";
+        return ERROR_INVALID_PARAM;
+    }
+    ofs_.open(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!ofs_.is_open()) {
+        ATB_LOG(ERROR) << "open dump container " << filePath << " fail";
+        return ERROR_INVALID_PARAM;
+    }
+    DumpFileHeader header = {};
+    memcpy(header.magic, DUMP_FILE_MAGIC, sizeof(header.magic));
+    header.version = DUMP_FILE_VERSION;
+    ofs_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    filePath_ = filePath;
+    compress_ = compress;
+    offset_ = sizeof(header);
+    index_.clear();
+    ATB_LOG(INFO) << "open dump container " << filePath << " success, compress: " << compress;
+    return NO_ERROR;
+}
+
+bool DumpContainerWriter::IsOpen() const
+{
+    return ofs_.is_open();
+}
+
+Status DumpContainerWriter::Append(const std::string &key, const std::string &meta, const uint8_t *data,
+                                   uint64_t dataSize)
+{
+    if (!IsOpen()) {
+        ATB_LOG(ERROR) << "dump container is not open";
+        return ERROR_INVALID_PARAM;
+    }
+    if (data == nullptr) {
+        dataSize = 0;
+    }
+    DumpRecordHeader header = {};
+    header.magic = DUMP_RECORD_MAGIC;
+    header.compression = DUMP_COMPRESS_NONE;
+    header.keyLen = static_cast<uint32_t>(key.size());
+    header.metaLen = static_cast<uint32_t>(meta.size());
+    header.rawSize = dataSize;
+    header.storedSize = dataSize;
+    const uint8_t *payload = data;
+    if (compress_ && dataSize > 0) {
+        ZeroRunEncode(data, dataSize, encodeBuffer_);
+        // 压缩后没有变小时按原数据存储
+        if (encodeBuffer_.size() < dataSize) {
+            header.compression = DUMP_COMPRESS_ZERO_RUN;
+            header.storedSize = encodeBuffer_.size();
+            payload = encodeBuffer_.data();
+        }
+    }
+    ofs_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    ofs_.write(key.data(), static_cast<std::streamsize>(key.size()));
+    ofs_.write(meta.data(), static_cast<std::streamsize>(meta.size()));
+    if (header.storedSize > 0) {
+        ofs_.write(reinterpret_cast<const char *>(payload), static_cast<std::streamsize>(header.storedSize));
+    }
+    if (ofs_.fail()) {
+        ATB_LOG(ERROR) << "write dump container " << filePath_ << " fail, key: " << key;
+        return ERROR_INTERNAL_ERROR;
+    }
+    index_.push_back({offset_, key});
+    offset_ += sizeof(header) + key.size() + meta.size() + header.storedSize;
+    return NO_ERROR;
+}
+
+Status DumpContainerWriter::Close()
+{
+    if (!IsOpen()) {
+        return NO_ERROR;
+    }
+    DumpIndexFooter footer = {};
+    footer.indexOffset = offset_;
+    footer.recordCount = index_.size();
+    memcpy(footer.magic, DUMP_INDEX_MAGIC, sizeof(footer.magic));
+    for (const IndexEntry &entry : index_) {
+        uint32_t keyLen = static_cast<uint32_t>(entry.key.size());
+        ofs_.write(reinterpret_cast<const char *>(&entry.offset), sizeof(entry.offset));
+        ofs_.write(reinterpret_cast<const char *>(&keyLen), sizeof(keyLen));
+        ofs_.write(entry.key.data(), static_cast<std::streamsize>(entry.key.size()));
+    }
+    ofs_.write(reinterpret_cast<const char *>(&footer), sizeof(footer));
+    ofs_.close();
+    if (ofs_.fail()) {
+        ATB_LOG(ERROR) << "write dump container " << filePath_ << " index fail";
+        return ERROR_INTERNAL_ERROR;
+    }
+    ATB_LOG(INFO) << "close dump container " << filePath_ << " success, record count: " << index_.size();
+    return NO_ERROR;
+}
+
+uint64_t DumpContainerWriter::GetRecordCount() const
+{
+    return index_.size();
+}
+
+static void AppendUint32(std::vector<uint8_t> &buffer, uint64_t value)
+{
+    uint32_t value32 = static_cast<uint32_t>(value);
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value32);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(value32));
+}
+
+void DumpContainerWriter::ZeroRunEncode(const uint8_t *data, uint64_t dataSize, std::vector<uint8_t> &encoded)
+{
+    encoded.clear();
+    uint64_t pos = 0;
+    while (pos < dataSize) {
+        // 找到下一段足够长的零值，较短的零值并入字面量，避免token开销超过收益
+        uint64_t zeroBegin = dataSize;
+        uint64_t zeroEnd = dataSize;
+        uint64_t scan = pos;
+        while (scan < dataSize) {
+            if (data[scan] != 0) {
+                ++scan;
+                continue;
+            }
+            uint64_t runEnd = scan;
+            while (runEnd < dataSize && data[runEnd] == 0) {
+                ++runEnd;
+            }
+            if (runEnd - scan >= MIN_ZERO_RUN_LEN || runEnd == dataSize) {
+                zeroBegin = scan;
+                zeroEnd = runEnd;
+                break;
+            }
+            scan = runEnd;
+        }
+        uint64_t literalLen = zeroBegin - pos;
+        uint64_t zeroLen = zeroEnd - zeroBegin;
+        if (literalLen > MAX_ZERO_RUN_TOKEN_LEN) {
+            literalLen = MAX_ZERO_RUN_TOKEN_LEN;
+            zeroLen = 0;
+        }
+        zeroLen = std::min(zeroLen, MAX_ZERO_RUN_TOKEN_LEN);
+        AppendUint32(encoded, literalLen);
+        encoded.insert(encoded.end(), data + pos, data + pos + literalLen);
+        AppendUint32(encoded, zeroLen);
+        pos += literalLen + zeroLen;
+    }
+}
+
+bool DumpContainerWriter::ZeroRunDecode(const uint8_t *data, uint64_t dataSize, uint64_t rawSize,
+                                        std::vector<uint8_t> &decoded)
+{
+    decoded.clear();
+    decoded.reserve(rawSize);
+    uint64_t pos = 0;
+    while (pos < dataSize) {
+        uint32_t literalLen = 0;
+        uint32_t zeroLen = 0;
+        if (dataSize - pos < sizeof(literalLen)) {
+            return false;
+        }
+        memcpy(&literalLen, data + pos, sizeof(literalLen));
+        pos += sizeof(literalLen);
+        if (dataSize - pos < static_cast<uint64_t>(literalLen) + sizeof(zeroLen)) {
+            return false;
+        }
+        decoded.insert(decoded.end(), data + pos, data + pos + literalLen);
+        pos += literalLen;
+        memcpy(&zeroLen, data + pos, sizeof(zeroLen));
+        pos += sizeof(zeroLen);
+        if (decoded.size() + zeroLen > rawSize) {
+            return false;
+        }
+        decoded.resize(decoded.size() + zeroLen, 0);
+    }
+    return decoded.size() == rawSize;
+}
+
+AsyncDumper::AsyncDumper()
+    : ring_(static_cast<uint64_t>(GetSingleton<Config>().GetAsyncDumpBufferSize()) * MB_SIZE)
+{
+    const Config &config = GetSingleton<Config>();
+    enable_ = config.IsAsyncDumpEnable();
+    sampleRate_ = config.GetAsyncDumpSampleRate() > 0 ? config.GetAsyncDumpSampleRate() : 1;
+    compress_ = config.IsAsyncDumpCompressEnable();
+    filePath_ = config.GetAsyncDumpFilePath();
+    if (filePath_.empty()) {
+        filePath_ = "atb_dump_" + std::to_string(getpid()) + ".atbd";
+    }
+}
+
+AsyncDumper::~AsyncDumper()
+{
+    Stop();
+}
+
+bool AsyncDumper::IsEnable() const
+{
+    return enable_;
+}
+
+bool AsyncDumper::Sample()
+{
+    if (!enable_ || sampleRate_ <= 1) {
+        return true;
+    }
+    return sampleCount_.fetch_add(1, std::memory_order_relaxed) % sampleRate_ == 0;
+}
+
+void AsyncDumper::DumpTensor(aclrtStream stream, const std::string &key, const std::string &meta,
+                             const void *deviceData, uint64_t dataSize)
+{
+    if (!enable_) {
+        return;
+    }
+    DumpRecord record;
+    record.key = key;
+    record.meta = meta;
+    record.size = deviceData != nullptr ? dataSize : 0;
+    Submit(stream, deviceData, record);
+}
+
+void AsyncDumper::CopyAsync(aclrtStream stream, const void *deviceData, uint64_t dataSize, ReadyCallback callback)
+{
+    if (!enable_ || !callback) {
+        return;
+    }
+    DumpRecord record;
+    record.size = deviceData != nullptr ? dataSize : 0;
+    record.callback = std::move(callback);
+    Submit(stream, deviceData, record);
+}
+
+bool AsyncDumper::InitBuffer()
+{
+    if (hostBuffer_ != nullptr) {
+        return true;
+    }
+    if (initFailed_) {
+        return false;
+    }
+    void *hostBuffer = nullptr;
+    int ret = aclrtMallocHost(&hostBuffer, ring_.GetCapacity());
+    if (ret != 0 || hostBuffer == nullptr) {
+        ATB_LOG(ERROR) << "aclrtMallocHost async dump buffer fail, size: " << ring_.GetCapacity() << ", ret: " << ret;
+        initFailed_ = true;
+        return false;
+    }
+    hostBuffer_ = static_cast<uint8_t *>(hostBuffer);
+    writerThread_ = std::thread([this]() { WriterLoop(); });
+    ATB_LOG(INFO) << "async dump start, buffer size: " << ring_.GetCapacity() << ", sample rate: " << sampleRate_
+                  << ", file: " << filePath_;
+    return true;
+}
+
+aclrtEvent AsyncDumper::AcquireEvent()
+{
+    if (!freeEvents_.empty()) {
+        aclrtEvent event = freeEvents_.back();
+        freeEvents_.pop_back();
+        return event;
+    }
+    aclrtEvent event = nullptr;
+    int ret = aclrtCreateEvent(&event);
+    if (ret != 0) {
+        ATB_LOG(ERROR) << "aclrtCreateEvent for async dump fail, ret: " << ret;
+        return nullptr;
+    }
+    return event;
+}
+
+void AsyncDumper::Submit(aclrtStream stream, const void *deviceData, DumpRecord &record)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 调用线程不等待后台写盘，缓冲或队列满时直接丢弃
+    if (stop_ || !InitBuffer() || pendingRecords_.size() >= MAX_PENDING_RECORD_NUM) {
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (record.size > 0 && !ring_.Reserve(record.size, record.offset, record.padding)) {
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    record.event = AcquireEvent();
+    int ret = record.event != nullptr ? 0 : ACL_ERROR_INVALID_PARAM;
+    if (ret == 0 && record.size > 0) {
+        ret = aclrtMemcpyAsync(hostBuffer_ + record.offset, record.size, deviceData, record.size,
+                               ACL_MEMCPY_DEVICE_TO_HOST, stream);
+        ATB_LOG_IF(ret != 0, ERROR) << "aclrtMemcpyAsync for async dump fail, ret: " << ret;
+    }
+    if (ret != 0) {
+        if (record.size > 0) {
+            ring_.Rollback(record.offset, record.size, record.padding);
+        }
+        if (record.event != nullptr) {
+            freeEvents_.push_back(record.event);
+        }
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    ret = aclrtRecordEvent(record.event, stream);
+    if (ret != 0) {
+        // 拷贝已下发，无法撤回，只能同步等待拷贝完成后再交给后台线程
+        ATB_LOG(WARN) << "aclrtRecordEvent for async dump fail, ret: " << ret << ", synchronize stream instead";
+        ret = aclrtSynchronizeStream(stream);
+        ATB_LOG_IF(ret != 0, ERROR) << "aclrtSynchronizeStream fail, ret: " << ret;
+        freeEvents_.push_back(record.event);
+        record.event = nullptr;
+    }
+    ret = aclrtGetCurrentContext(&record.context);
+    ATB_LOG_IF(ret != 0, WARN) << "aclrtGetCurrentContext for async dump fail, ret: " << ret;
+    pendingRecords_.push_back(std::move(record));
+    pendingCond_.notify_one();
+}
+
+void AsyncDumper::WriterLoop()
+{
+    while (true) {
+        DumpRecord record;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            pendingCond_.wait(lock, [this]() { return stop_ || !pendingRecords_.empty(); });
+            if (pendingRecords_.empty()) {
+                break;
+            }
+            record = std::move(pendingRecords_.front());
+            pendingRecords_.pop_front();
+            busy_ = true;
+        }
+        ProcessRecord(record);
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (record.size > 0) {
+            ring_.Release(record.offset, record.size, record.padding);
+        }
+        if (record.event != nullptr) {
+            freeEvents_.push_back(record.event);
+        }
+        busy_ = false;
+        if (pendingRecords_.empty()) {
+            drainCond_.notify_all();
+        }
+    }
+}
+
+void AsyncDumper::ProcessRecord(DumpRecord &record)
+{
+    if (record.context != nullptr && record.context != writerContext_) {
+        int ret = aclrtSetCurrentContext(record.context);
+        ATB_LOG_IF(ret != 0, ERROR) << "aclrtSetCurrentContext for async dump fail, ret: " << ret;
+        writerContext_ = record.context;
+    }
+    if (record.event != nullptr) {
+        int ret = aclrtSynchronizeEvent(record.event);
+        if (ret != 0) {
+            ATB_LOG(ERROR) << "aclrtSynchronizeEvent for async dump fail, ret: " << ret << ", key: " << record.key;
+            droppedCount_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    const uint8_t *data = record.size > 0 ? hostBuffer_ + record.offset : nullptr;
+    if (record.callback) {
+        try {
+            record.callback(data, record.size);
+        } catch (const std::exception &e) {
+            ATB_LOG(ERROR) << "async dump callback throw an error: " << e.what();
+        }
+        return;
+    }
+    if (!containerWriter_.IsOpen() && containerWriter_.Open(filePath_, compress_) != NO_ERROR) {
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (containerWriter_.Append(record.key, record.meta, data, record.size) == NO_ERROR) {
+        dumpedCount_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void AsyncDumper::Flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    drainCond_.wait(lock, [this]() { return pendingRecords_.empty() && !busy_; });
+}
+
+uint64_t AsyncDumper::GetDumpedCount() const
+{
+    return dumpedCount_.load(std::memory_order_relaxed);
+}
+
+uint64_t AsyncDumper::GetDroppedCount() const
+{
+    return droppedCount_.load(std::memory_order_relaxed);
+}
+
+void AsyncDumper::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    pendingCond_.notify_all();
+    if (writerThread_.joinable()) {
+        writerThread_.join();
+    }
+    containerWriter_.Close();
+    for (aclrtEvent event : freeEvents_) {
+        aclrtDestroyEvent(event);
+    }
+    freeEvents_.clear();
+    if (hostBuffer_ != nullptr) {
+        aclrtFreeHost(hostBuffer_);
+        hostBuffer_ = nullptr;
+        ATB_LOG(INFO) << "async dump stop, dumped count: " << GetDumpedCount()
+                      << ", dropped count: " << GetDroppedCount();
+    }
+}
+} // namespace atb
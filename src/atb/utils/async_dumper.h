@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_ASYNC_DUMPER_H
+#define ATB_ASYNC_DUMPER_H
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <acl/acl.h>
+#include "atb/types.h"
+
+namespace atb {
+// 环形缓冲的空间管理，只做偏移计算，空间按申请顺序先进先出释放
+class DumpRing {
+public:
+    explicit DumpRing(uint64_t capacity);
+    // 申请size字节(内部按64字节对齐)的连续空间，空间不足时返回false
+    // 尾部剩余空间不够时绕回头部，padding为跳过的尾部字节数
+    bool Reserve(uint64_t size, uint64_t &offset, uint64_t &padding);
+    // 释放最早申请且尚未释放的空间，参数为Reserve的入参与返回值
+    void Release(uint64_t offset, uint64_t size, uint64_t padding);
+    // 撤销最近一次申请，用于申请后下发拷贝失败的场景
+    void Rollback(uint64_t offset, uint64_t size, uint64_t padding);
+    uint64_t GetCapacity() const;
+    uint64_t GetUsedSize() const;
+
+private:
+    uint64_t capacity_ = 0;
+    uint64_t head_ = 0;
+    uint64_t tail_ = 0;
+    uint64_t used_ = 0;
+};
+
+// dump容器文件：文件头 + 顺序追加的记录 + 关闭时写入的索引
+// 进程异常退出导致索引缺失时，仍可从文件头开始按记录头顺序扫描
+class DumpContainerWriter {
+public:
+    DumpContainerWriter() = default;
+    ~DumpContainerWriter();
+    DumpContainerWriter(const DumpContainerWriter &) = delete;
+    DumpContainerWriter &operator=(const DumpContainerWriter &) = delete;
+    Status Open(const std::string &filePath, bool compress);
+    bool IsOpen() const;
+    // key为同步dump模式下的文件路径，meta为format/dtype/dims描述
+    Status Append(const std::string &key, const std::string &meta, const uint8_t *data, uint64_t dataSize);
+    Status Close();
+    uint64_t GetRecordCount() const;
+    // 零值游程编码：[uint32 字面量长度][字面量][uint32 零值长度]循环，适合稀疏或大量置零的tensor
+    static void ZeroRunEncode(const uint8_t *data, uint64_t dataSize, std::vector<uint8_t> &encoded);
+    static bool ZeroRunDecode(const uint8_t *data, uint64_t dataSize, uint64_t rawSize, std::vector<uint8_t> &decoded);
+
+private:
+    struct IndexEntry {
+        uint64_t offset = 0;
+        std::string key;
+    };
+    std::ofstream ofs_;
+    std::string filePath_;
+    bool compress_ = false;
+    uint64_t offset_ = 0;
+    std::vector<IndexEntry> index_;
+    std::vector<uint8_t> encodeBuffer_;
+};
+
+// 异步tensor dump：调用线程只在stream上下发device到pinned环形缓冲的异步拷贝并记录event，
+// 后台线程等待event完成后写入容器文件，全程不同步stream；缓冲写满或积压过多时直接丢弃并计数
+class AsyncDumper {
+public:
+    // 拷贝完成后在后台线程调用，data指向pinned缓冲，仅在回调内有效
+    using ReadyCallback = std::function<void(const uint8_t *data, uint64_t dataSize)>;
+
+    AsyncDumper();
+    ~AsyncDumper();
+    bool IsEnable() const;
+    // 按采样率判断本次执行是否保存，由Runner::Execute每次执行调用一次，未开启时恒为true
+    bool Sample();
+    void DumpTensor(aclrtStream stream, const std::string &key, const std::string &meta, const void *deviceData,
+                    uint64_t dataSize);
+    // 与DumpTensor相同的异步拷贝，完成后只调用callback，不写入容器文件
+    void CopyAsync(aclrtStream stream, const void *deviceData, uint64_t dataSize, ReadyCallback callback);
+    // 等待已提交的记录全部处理完
+    void Flush();
+    uint64_t GetDumpedCount() const;
+    uint64_t GetDroppedCount() const;
+
+private:
+    struct DumpRecord {
+        std::string key;
+        std::string meta;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint64_t padding = 0;
+        aclrtEvent event = nullptr;
+        aclrtContext context = nullptr;
+        ReadyCallback callback;
+    };
+    void Submit(aclrtStream stream, const void *deviceData, DumpRecord &record);
+    bool InitBuffer();
+    aclrtEvent AcquireEvent();
+    void WriterLoop();
+    void ProcessRecord(DumpRecord &record);
+    void Stop();
+
+private:
+    bool enable_ = false;
+    uint64_t sampleRate_ = 1;
+    bool compress_ = false;
+    std::string filePath_;
+    std::atomic<uint64_t> sampleCount_{0};
+    std::atomic<uint64_t> dumpedCount_{0};
+    std::atomic<uint64_t> droppedCount_{0};
+    std::mutex mutex_;
+    std::condition_variable pendingCond_;
+    std::condition_variable drainCond_;
+    bool stop_ = false;
+    bool busy_ = false;
+    bool initFailed_ = false;
+    aclrtContext writerContext_ = nullptr; // 仅后台线程访问
+    uint8_t *hostBuffer_ = nullptr;
+    DumpRing ring_;
+    std::deque<DumpRecord> pendingRecords_;
+    std::vector<aclrtEvent> freeEvents_;
+    std::thread writerThread_;
+    DumpContainerWriter containerWriter_;
+};
+} // namespace atb
+#endif
@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/utils/async_logger.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <mki/utils/log/log_entity.h>
+
+namespace atb {
+constexpr uint64_t RECORD_ALIGN = 8;
+constexpr uint64_t RECORD_PADDING_FLAG = 1;
+constexpr uint64_t KB = 1024;
+constexpr int64_t NS_PER_SECOND = 1000000000;
+constexpr int DECIMAL = 10;
+constexpr std::chrono::milliseconds WRITER_WAIT_TIME(10);
+
+enum AsyncLogWriterState : int {
+    WRITER_INIT = 0,
+    WRITER_RUNNING,
+    WRITER_STOPPED,
+};
+
+struct AsyncLogConfig {
+    bool enable = false;
+    uint64_t ringCapacity = 1024 * KB;
+    uint32_t rateLimit = 1000;
+};
+
+static std::atomic<int> g_writerState{WRITER_INIT};
+
+static uint32_t GetEnvValue(const char *envName, uint32_t minValue, uint32_t maxValue, uint32_t defaultValue)
+{
+    const char *env = std::getenv(envName);
+    if (env == nullptr) {
+        return defaultValue;
+    }
+    long long value = strtoll(env, nullptr, DECIMAL);
+    if (value < static_cast<long long>(minValue)) {
+        return minValue;
+    }
+    if (value > static_cast<long long>(maxValue)) {
+        return maxValue;
+    }
+    return static_cast<uint32_t>(value);
+}
+
+// Config构造时本身会打印日志，异步日志的配置不能依赖Config，直接读取环境变量
+static AsyncLogConfig LoadAsyncLogConfig()
+{
+    const uint32_t minBufferSizeKb = 64;
+    const uint32_t maxBufferSizeKb = 65536;
+    const uint32_t defaultBufferSizeKb = 1024;
+    const uint32_t maxRateLimit = 1000000;
+    const uint32_t defaultRateLimit = 1000;
+    AsyncLogConfig config;
+    const char *enableEnv = std::getenv("ATB_ASYNC_LOG_ENABLE");
+    config.enable = enableEnv != nullptr && std::string(enableEnv) == "1";
+    uint64_t bufferSize =
+        GetEnvValue("ATB_ASYNC_LOG_BUFFER_SIZE", minBufferSizeKb, maxBufferSizeKb, defaultBufferSizeKb) * KB;
+    // 环形缓冲按2的幂取模
+    config.ringCapacity = minBufferSizeKb * KB;
+    while (config.ringCapacity < bufferSize) {
+        config.ringCapacity <<= 1;
+    }
+    config.rateLimit = GetEnvValue("ATB_ASYNC_LOG_RATE_LIMIT", 0, maxRateLimit, defaultRateLimit);
+    return config;
+}
+
+static const AsyncLogConfig &GetAsyncLogConfig()
+{
+    static const AsyncLogConfig config = LoadAsyncLogConfig();
+    return config;
+}
+
+static int32_t GetThreadId()
+{
+    static thread_local int32_t threadId = static_cast<int32_t>(syscall(SYS_gettid));
+    return threadId;
+}
+
+static const char *GetFileName(const char *filePath)
+{
+    const char *fileName = filePath == nullptr ? nullptr : strrchr(filePath, '/');
+    return fileName == nullptr ? filePath : fileName + 1;
+}
+
+static void OutputRecord(const LogRecordHeader &header, const uint8_t *payload)
+{
+    std::ostringstream ss;
+    LogArgBuffer::Format(payload, header.payloadSize, ss);
+    if (header.truncated != 0) {
+        ss << "...(truncated)";
+    }
+    if (header.suppressedCount != 0) {
+        ss << " [" << header.suppressedCount << " logs of this site suppressed by rate limit]";
+    }
+    Mki::LogEntity logEntity;
+    logEntity.time = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(header.timeNs)));
+    logEntity.processId = static_cast<int32_t>(getpid());
+    logEntity.threadId = header.threadId;
+    logEntity.level = header.site->level;
+    logEntity.fileName = GetFileName(header.site->fileName);
+    logEntity.line = header.site->line;
+    logEntity.funcName = header.funcName;
+    logEntity.content = ss.str();
+    Mki::LogCore::Instance().Log(logEntity);
+}
+
+// 后台写日志线程，首次异步写日志时创建，进程退出时写完剩余日志后退出
+class AsyncLogWriter {
+public:
+    explicit AsyncLogWriter(uint64_t ringCapacity) : ringCapacity_(ringCapacity)
+    {
+        thread_ = std::thread([this]() { ThreadMain(); });
+        g_writerState.store(WRITER_RUNNING, std::memory_order_release);
+    }
+
+    ~AsyncLogWriter()
+    {
+        // 之后的日志退化为同步输出
+        g_writerState.store(WRITER_STOPPED, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cond_.notify_all();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        DrainRings();
+    }
+
+    LogRing &GetThreadRing()
+    {
+        // 线程退出后缓冲由rings_继续持有，写完其中的日志后释放
+        static thread_local std::shared_ptr<LogRing> threadRing;
+        if (!threadRing) {
+            threadRing = std::make_shared<LogRing>(ringCapacity_);
+            std::lock_guard<std::mutex> lock(mutex_);
+            rings_.push_back(threadRing);
+        }
+        return *threadRing;
+    }
+
+    void Notify()
+    {
+        cond_.notify_one();
+    }
+
+    size_t DrainRings()
+    {
+        std::lock_guard<std::mutex> drainLock(drainMutex_);
+        std::vector<std::shared_ptr<LogRing>> rings;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            rings = rings_;
+        }
+        size_t count = 0;
+        for (const std::shared_ptr<LogRing> &ring : rings) {
+            count += ring->Read(OutputRecord);
+            uint64_t droppedCount = ring->TakeDroppedCount();
+            if (droppedCount != 0) {
+                Mki::LogStream(__FILE__, __LINE__, __FUNCTION__, Mki::LogLevel::WARN)
+                    << "async log buffer is full, " << droppedCount << " logs dropped";
+            }
+        }
+        rings.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = rings_.begin(); it != rings_.end();) {
+            if (it->use_count() == 1 && (*it)->GetUsedSize() == 0) {
+                it = rings_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return count;
+    }
+
+private:
+    void ThreadMain()
+    {
+        while (true) {
+            size_t count = DrainRings();
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (stop_) {
+                break;
+            }
+            if (count == 0) {
+                cond_.wait_for(lock, WRITER_WAIT_TIME, [this]() { return stop_; });
+            }
+        }
+    }
+
+private:
+    uint64_t ringCapacity_ = 0;
+    std::mutex mutex_;
+    std::mutex drainMutex_;
+    std::condition_variable cond_;
+    bool stop_ = false;
+    std::vector<std::shared_ptr<LogRing>> rings_;
+    std::thread thread_;
+};
+
+static AsyncLogWriter &GetAsyncLogWriter()
+{
+    static AsyncLogWriter writer(GetAsyncLogConfig().ringCapacity);
+    return writer;
+}
+
+void LogArgBuffer::AppendValue(LogArgType type, const void *value, uint32_t size)
+{
+    if (size_ + sizeof(uint8_t) + size > MAX_SIZE) {
+        truncated_ = true;
+        return;
+    }
+    data_[size_] = type;
+    (void)memcpy(data_ + size_ + sizeof(uint8_t), value, size);
+    size_ += sizeof(uint8_t) + size;
+}
+
+void LogArgBuffer::AppendString(const char *str, size_t len)
+{
+    const uint32_t headSize = sizeof(uint8_t) + sizeof(uint32_t);
+    if (size_ + headSize >= MAX_SIZE) {
+        truncated_ = true;
+        return;
+    }
+    uint32_t strLen = static_cast<uint32_t>(len);
+    if (len > MAX_SIZE - size_ - headSize) {
+        strLen = MAX_SIZE - size_ - headSize;
+        truncated_ = true;
+    }
+    data_[size_] = LOG_ARG_STRING;
+    (void)memcpy(data_ + size_ + sizeof(uint8_t), &strLen, sizeof(uint32_t));
+    (void)memcpy(data_ + size_ + headSize, str, strLen);
+    size_ += headSize + strLen;
+}
+
+const uint8_t *LogArgBuffer::GetData() const
+{
+    return data_;
+}
+
+uint32_t LogArgBuffer::GetSize() const
+{
+    return size_;
+}
+
+bool LogArgBuffer::IsTruncated() const
+{
+    return truncated_;
+}
+
+template <typename V> static bool ReadValue(const uint8_t *data, uint32_t size, uint32_t &pos, V &value)
+{
+    if (pos + sizeof(V) > size) {
+        return false;
+    }
+    (void)memcpy(&value, data + pos, sizeof(V));
+    pos += sizeof(V);
+    return true;
+}
+
+void LogArgBuffer::Format(const uint8_t *data, uint32_t size, std::ostream &os)
+{
+    uint32_t pos = 0;
+    while (pos < size) {
+        uint8_t type = data[pos++];
+        int64_t intValue = 0;
+        uint64_t uintValue = 0;
+        double doubleValue = 0;
+        uint32_t strLen = 0;
+        std::ostream &(*manipulator)(std::ostream &) = nullptr;
+        std::ios_base &(*baseManipulator)(std::ios_base &) = nullptr;
+        bool isValid = true;
+        switch (type) {
+            case LOG_ARG_INT:
+                isValid = ReadValue(data, size, pos, intValue) && (os << intValue);
+                break;
+            case LOG_ARG_UINT:
+                isValid = ReadValue(data, size, pos, uintValue) && (os << uintValue);
+                break;
+            case LOG_ARG_DOUBLE:
+                isValid = ReadValue(data, size, pos, doubleValue) && (os << doubleValue);
+                break;
+            case LOG_ARG_BOOL:
+                isValid = ReadValue(data, size, pos, uintValue) && (os << (uintValue != 0));
+                break;
+            case LOG_ARG_CHAR:
+                isValid = ReadValue(data, size, pos, uintValue) && (os << static_cast<char>(uintValue));
+                break;
+            case LOG_ARG_STRING:
+                isValid = ReadValue(data, size, pos, strLen) && pos + strLen <= size;
+                if (isValid) {
+                    os.write(reinterpret_cast<const char *>(data + pos), strLen);
+                    pos += strLen;
+                }
+                break;
+            case LOG_ARG_POINTER:
+                isValid = ReadValue(data, size, pos, uintValue) && (os << reinterpret_cast<const void *>(uintValue));
+                break;
+            case LOG_ARG_MANIPULATOR:
+                isValid = ReadValue(data, size, pos, manipulator) && manipulator != nullptr;
+                if (isValid) {
+                    manipulator(os);
+                }
+                break;
+            case LOG_ARG_BASE_MANIPULATOR:
+                isValid = ReadValue(data, size, pos, baseManipulator) && baseManipulator != nullptr;
+                if (isValid) {
+                    baseManipulator(os);
+                }
+                break;
+            default:
+                isValid = false;
+                break;
+        }
+        if (!isValid) {
+            return;
+        }
+    }
+}
+
+LogRing::LogRing(uint64_t capacity) : buffer_(std::make_unique<uint8_t[]>(capacity)), capacity_(capacity) {}
+
+bool LogRing::Write(const LogRecordHeader &header, const uint8_t *payload)
+{
+    uint64_t recordSize = sizeof(uint64_t) + sizeof(LogRecordHeader) + header.payloadSize;
+    recordSize = (recordSize + RECORD_ALIGN - 1) / RECORD_ALIGN * RECORD_ALIGN;
+    uint64_t writePos = writePos_.load(std::memory_order_relaxed);
+    uint64_t readPos = readPos_.load(std::memory_order_acquire);
+    uint64_t offset = writePos & (capacity_ - 1);
+    // 尾部剩余空间放不下整条记录时填充到缓冲末尾，从头开始写
+    uint64_t paddingSize = capacity_ - offset < recordSize ? capacity_ - offset : 0;
+    if (writePos - readPos + paddingSize + recordSize > capacity_) {
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (paddingSize != 0) {
+        uint64_t paddingMark = paddingSize | RECORD_PADDING_FLAG;
+        (void)memcpy(buffer_.get() + offset, &paddingMark, sizeof(paddingMark));
+        writePos += paddingSize;
+        offset = 0;
+    }
+    uint8_t *record = buffer_.get() + offset;
+    (void)memcpy(record, &recordSize, sizeof(recordSize));
+    (void)memcpy(record + sizeof(recordSize), &header, sizeof(header));
+    if (header.payloadSize != 0) {
+        (void)memcpy(record + sizeof(recordSize) + sizeof(header), payload, header.payloadSize);
+    }
+    writePos_.store(writePos + recordSize, std::memory_order_release);
+    return true;
+}
+
+uint64_t LogRing::GetUsedSize() const
+{
+    return writePos_.load(std::memory_order_acquire) - readPos_.load(std::memory_order_acquire);
+}
+
+uint64_t LogRing::GetCapacity() const
+{
+    return capacity_;
+}
+
+uint64_t LogRing::TakeDroppedCount()
+{
+    return droppedCount_.exchange(0, std::memory_order_relaxed);
+}
+
+bool AsyncLogger::IsEnable()
+{
+    if (!GetAsyncLogConfig().enable) {
+        return false;
+    }
+    int state = g_writerState.load(std::memory_order_acquire);
+    if (state == WRITER_INIT) {
+        (void)GetAsyncLogWriter();
+        state = g_writerState.load(std::memory_order_acquire);
+    }
+    return state == WRITER_RUNNING;
+}
+
+bool AsyncLogger::Accept(LogSite &site)
+{
+    if (!IsEnable()) {
+        return true;
+    }
+    uint32_t rateLimit = GetAsyncLogConfig().rateLimit;
+    if (rateLimit == 0) {
+        return true;
+    }
+    return AcceptSite(site, static_cast<uint64_t>(GetTimeNs() / NS_PER_SECOND), rateLimit);
+}
+
+bool AsyncLogger::AcceptSite(LogSite &site, uint64_t nowSecond, uint32_t rateLimit)
+{
+    uint64_t windowSecond = site.windowSecond.load(std::memory_order_relaxed);
+    if (windowSecond != nowSecond &&
+        site.windowSecond.compare_exchange_strong(windowSecond, nowSecond, std::memory_order_relaxed)) {
+        site.windowCount.store(0, std::memory_order_relaxed);
+    }
+    if (site.windowCount.fetch_add(1, std::memory_order_relaxed) < rateLimit) {
+        return true;
+    }
+    site.suppressedCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void AsyncLogger::Write(LogRecordHeader &header, const LogArgBuffer &args)
+{
+    header.threadId = GetThreadId();
+    header.payloadSize = args.GetSize();
+    header.truncated = args.IsTruncated() ? 1 : 0;
+    if (g_writerState.load(std::memory_order_acquire) != WRITER_RUNNING) {
+        OutputRecord(header, args.GetData());
+        return;
+    }
+    AsyncLogWriter &writer = GetAsyncLogWriter();
+    LogRing &ring = writer.GetThreadRing();
+    if (ring.Write(header, args.GetData()) && ring.GetUsedSize() > ring.GetCapacity() / 2) {
+        writer.Notify();
+    }
+}
+
+void AsyncLogger::Flush()
+{
+    if (g_writerState.load(std::memory_order_acquire) == WRITER_RUNNING) {
+        (void)GetAsyncLogWriter().DrainRings();
+    }
+}
+
+int64_t AsyncLogger::GetTimeNs()
+{
+    return static_cast<int64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count());
+}
+
+LogRecordStream::LogRecordStream(LogSite &site, const char *funcName) : site_(site), funcName_(funcName)
+{
+    if (!AsyncLogger::IsEnable()) {
+        syncStream_.emplace(site.fileName, site.line, funcName, site.level);
+        return;
+    }
+    timeNs_ = AsyncLogger::GetTimeNs();
+    if (site.suppressedCount.load(std::memory_order_relaxed) != 0) {
+        suppressedCount_ = site.suppressedCount.exchange(0, std::memory_order_relaxed);
+    }
+}
+
+LogRecordStream::~LogRecordStream()
+{
+    if (syncStream_) {
+        return;
+    }
+    LogRecordHeader header;
+    header.site = &site_;
+    header.funcName = funcName_;
+    header.timeNs = timeNs_;
+    header.suppressedCount = suppressedCount_;
+    AsyncLogger::Write(header, args_);
+}
+
+LogRecordStream &LogRecordStream::operator<<(std::ostream &(*manipulator)(std::ostream &))
+{
+    if (syncStream_) {
+        *syncStream_ << manipulator;
+    } else {
+        AppendValue(LOG_ARG_MANIPULATOR, manipulator);
+    }
+    return *this;
+}
+
+LogRecordStream &LogRecordStream::operator<<(std::ios_base &(*manipulator)(std::ios_base &))
+{
+    if (syncStream_) {
+        *syncStream_ << manipulator;
+    } else {
+        AppendValue(LOG_ARG_BASE_MANIPULATOR, manipulator);
+    }
+    return *this;
+}
+
+std::ostringstream &LogRecordStream::GetFormatStream()
+{
+    static thread_local std::ostringstream ss;
+    ss.str("");
+    ss.clear();
+    return ss;
+}
+} // namespace atb
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_ASYNC_LOGGER_H
+#define ATB_ASYNC_LOGGER_H
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <mki/utils/log/log_stream.h>
+#include <mki/utils/log/log_core.h>
+
+namespace atb {
+// 日志调用点，ATB_LOG宏在每个调用点定义一个常量初始化的静态对象，异步日志以其地址作为调用点id
+struct LogSite {
+    constexpr LogSite(const char *filePath, int fileLine, Mki::LogLevel logLevel)
+        : fileName(filePath), line(fileLine), level(logLevel)
+    {
+    }
+    const char *fileName = nullptr;
+    int line = 0;
+    Mki::LogLevel level = Mki::LogLevel::INFO;
+    // 按秒限流的计数，只在开启异步日志时使用
+    std::atomic<uint64_t> windowSecond{0};
+    std::atomic<uint32_t> windowCount{0};
+    std::atomic<uint32_t> suppressedCount{0};
+};
+
+enum LogArgType : uint8_t {
+    LOG_ARG_INT = 0,
+    LOG_ARG_UINT,
+    LOG_ARG_DOUBLE,
+    LOG_ARG_BOOL,
+    LOG_ARG_CHAR,
+    LOG_ARG_STRING,
+    LOG_ARG_POINTER,
+    LOG_ARG_MANIPULATOR,      // std::endl等作用于ostream的操纵符
+    LOG_ARG_BASE_MANIPULATOR, // std::hex等作用于ios_base的操纵符
+};
+
+// 按参数类型记录原始值，格式化推迟到后台线程；无法直接记录的类型在调用线程上格式化为字符串
+class LogArgBuffer {
+public:
+    static constexpr uint32_t MAX_SIZE = 2048;
+    void AppendValue(LogArgType type, const void *value, uint32_t size);
+    void AppendString(const char *str, size_t len);
+    const uint8_t *GetData() const;
+    uint32_t GetSize() const;
+    bool IsTruncated() const;
+    // 将AppendValue/AppendString写入的数据格式化输出，与直接写入ostream的结果一致
+    static void Format(const uint8_t *data, uint32_t size, std::ostream &os);
+
+private:
+    uint8_t data_[MAX_SIZE];
+    uint32_t size_ = 0;
+    bool truncated_ = false;
+};
+
+struct LogRecordHeader {
+    const LogSite *site = nullptr;
+    const char *funcName = nullptr;
+    int64_t timeNs = 0; // system_clock时间
+    int32_t threadId = 0;
+    uint32_t payloadSize = 0;
+    uint32_t suppressedCount = 0;
+    uint32_t truncated = 0;
+};
+
+// 单生产者单消费者的字节环形缓冲，生产者为所属线程，消费者为后台写日志线程，写满时丢弃新日志
+class LogRing {
+public:
+    explicit LogRing(uint64_t capacity);
+    bool Write(const LogRecordHeader &header, const uint8_t *payload);
+    // 依次取出所有已写入的日志，返回取出的条数
+    template <typename Func> size_t Read(Func &&func);
+    uint64_t GetUsedSize() const;
+    uint64_t GetCapacity() const;
+    uint64_t TakeDroppedCount();
+
+private:
+    std::unique_ptr<uint8_t[]> buffer_;
+    uint64_t capacity_ = 0;
+    std::atomic<uint64_t> writePos_{0};
+    std::atomic<uint64_t> readPos_{0};
+    std::atomic<uint64_t> droppedCount_{0};
+};
+
+// 异步日志后端：日志调用只把调用点与原始参数写入本线程的无锁环形缓冲，由后台线程格式化后交给Mki的日志sink。
+// 只有TRACE/DEBUG/INFO级别走异步，WARN及以上仍同步输出，保证进程异常退出前的错误日志不丢失。
+class AsyncLogger {
+public:
+    static bool IsEnable();
+    // 按调用点限流，未开启异步日志时始终返回true
+    static bool Accept(LogSite &site);
+    static bool AcceptSite(LogSite &site, uint64_t nowSecond, uint32_t rateLimit);
+    static void Write(LogRecordHeader &header, const LogArgBuffer &args);
+    // 同步写出所有线程缓冲中已记录的日志
+    static void Flush();
+    static int64_t GetTimeNs();
+};
+
+// ATB_LOG(TRACE/DEBUG/INFO)展开后的日志流，未开启异步日志时直接转交给Mki::LogStream
+class LogRecordStream {
+public:
+    LogRecordStream(LogSite &site, const char *funcName);
+    ~LogRecordStream();
+    LogRecordStream(const LogRecordStream &other) = delete;
+    LogRecordStream &operator=(const LogRecordStream &other) = delete;
+
+    template <typename T> LogRecordStream &operator<<(const T &value)
+    {
+        if (syncStream_) {
+            *syncStream_ << value;
+        } else {
+            AppendArg(value);
+        }
+        return *this;
+    }
+
+    LogRecordStream &operator<<(std::ostream &(*manipulator)(std::ostream &));
+    LogRecordStream &operator<<(std::ios_base &(*manipulator)(std::ios_base &));
+
+private:
+    template <typename T> void AppendArg(const T &value)
+    {
+        using Type = std::decay_t<T>;
+        if constexpr (std::is_same_v<Type, bool>) {
+            AppendValue(LOG_ARG_BOOL, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_same_v<Type, char> || std::is_same_v<Type, signed char> ||
+                             std::is_same_v<Type, unsigned char>) {
+            AppendValue(LOG_ARG_CHAR, static_cast<uint64_t>(static_cast<unsigned char>(value)));
+        } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+            AppendValue(LOG_ARG_INT, static_cast<int64_t>(value));
+        } else if constexpr (std::is_integral_v<Type>) {
+            AppendValue(LOG_ARG_UINT, static_cast<uint64_t>(value));
+        } else if constexpr (std::is_same_v<Type, float> || std::is_same_v<Type, double>) {
+            AppendValue(LOG_ARG_DOUBLE, static_cast<double>(value));
+        } else if constexpr (std::is_same_v<Type, const char *> || std::is_same_v<Type, char *>) {
+            const char *str = value;
+            args_.AppendString(str == nullptr ? "(null)" : str, str == nullptr ? strlen("(null)") : strlen(str));
+        } else if constexpr (std::is_same_v<Type, std::string> || std::is_same_v<Type, std::string_view>) {
+            args_.AppendString(value.data(), value.size());
+        } else if constexpr (std::is_pointer_v<Type> && !std::is_function_v<std::remove_pointer_t<Type>>) {
+            AppendValue(LOG_ARG_POINTER, reinterpret_cast<uintptr_t>(value));
+        } else {
+            std::ostringstream &ss = GetFormatStream();
+            ss << value;
+            std::string str = ss.str();
+            args_.AppendString(str.data(), str.size());
+        }
+    }
+    template <typename V> void AppendValue(LogArgType type, V value)
+    {
+        args_.AppendValue(type, &value, sizeof(V));
+    }
+    static std::ostringstream &GetFormatStream();
+
+private:
+    std::optional<Mki::LogStream> syncStream_;
+    LogSite &site_;
+    const char *funcName_ = nullptr;
+    int64_t timeNs_ = 0;
+    uint32_t suppressedCount_ = 0;
+    LogArgBuffer args_;
+};
+
+template <typename Func> size_t LogRing::Read(Func &&func)
+{
+    uint64_t readPos = readPos_.load(std::memory_order_relaxed);
+    uint64_t writePos = writePos_.load(std::memory_order_acquire);
+    size_t count = 0;
+    while (readPos < writePos) {
+        uint8_t *record = buffer_.get() + (readPos & (capacity_ - 1));
+        uint64_t recordSize = 0;
+        (void)memcpy(&recordSize, record, sizeof(recordSize));
+        // 记录大小的最低位标记尾部填充
+        if ((recordSize & 1) == 0) {
+            LogRecordHeader header;
+            (void)memcpy(&header, record + sizeof(recordSize), sizeof(header));
+            func(header, record + sizeof(recordSize) + sizeof(header));
+            count++;
+        }
+        readPos += recordSize & ~static_cast<uint64_t>(1);
+        readPos_.store(readPos, std::memory_order_release);
+    }
+    return count;
+}
+} // namespace atb
+
+#define ATB_LOG_SITE(level)                                                                                            \
+    ([]() -> atb::LogSite & {                                                                                          \
+        static atb::LogSite atbLogSite(__FILE__, __LINE__, Mki::LogLevel::level);                                      \
+        return atbLogSite;                                                                                             \
+    }())
+
+// 未开启异步日志时与原有的Mki::LogStream行为一致
+#define ATB_LOG_ASYNC(level)                                                                                           \
+    if (Mki::LogLevel::level >= Mki::LogCore::Instance().GetLogLevel())                                                \
+    if (atb::LogSite &atbLogSite = ATB_LOG_SITE(level); atb::AsyncLogger::Accept(atbLogSite))                          \
+    atb::LogRecordStream(atbLogSite, __FUNCTION__)
+#endif
@@ -17,77 +17,10 @@
 #include <mki/utils/share_memory/share_memory.h>
 #include "atb/utils/singleton.h"
 #include "atb/utils/comm_pool.h"
+#include "atb/utils/shm_rendezvous.h"
 
 namespace atb {
-struct CommInitInfo {
-    int signal = 0;
-    HcclRootInfo hcclRootInfo = {};
-    bool barrier[1]; // Flexible array member
-};
-void ShmGetHcclRootInfo(Mki::ShareMemory &shm, const CommInitInfo &shmInfo, HcclRootInfo &hcclRootInfo)
-{
-    bool commIdReady = false;
-    while (true) {
-        shm.SemLock();
-        if (shmInfo.signal != 0) {
-            hcclRootInfo = shmInfo.hcclRootInfo;
-            commIdReady = true;
-        }
-        shm.SemUnLock();
-        if (commIdReady) {
-            break;
-        }
-    }
-}
-
-void ShmSetHcclRootInfo(Mki::ShareMemory &shm, CommInitInfo &shmInfo, HcclRootInfo hcclRootInfo)
-{
-    shm.SemLock();
-    shmInfo.hcclRootInfo = hcclRootInfo;
-    shmInfo.signal = 1;
-    shm.SemUnLock();
-}
-
-void ShmSetReady(Mki::ShareMemory &shm, CommInitInfo &shmInfo, int32_t rank)
-{
-    shm.SemLock();
-    shmInfo.barrier[rank] = true;
-    shm.SemUnLock();
-}
-
-bool ShmBarrier(Mki::ShareMemory &shm, CommInitInfo &shmInfo, int32_t rank, int32_t rankSize)
-{
-    ATB_LOG(INFO) << "barrier start, rank:" << rank;
-    ShmSetReady(shm, shmInfo, rank);
-
-    ATB_LOG(INFO) << "check all ready start";
-    const double timeout = 600; // 600: 10 minutes timeout
-    time_t startTime = time(nullptr);
-    while (true) {
-        time_t currentTime = time(nullptr);
-        if (difftime(currentTime, startTime) > timeout) {
-            ATB_LOG(ERROR) << "barrier fail, check all ready timeout";
-            return false;
-        }
-
-        bool allReady = true;
-        shm.SemLock();
-        for (int i = 0; i < rankSize; i++) {
-            if (!shmInfo.barrier[i]) {
-                allReady = false;
-                break;
-            }
-        }
-        shm.SemUnLock();
-        if (allReady) {
-            ATB_LOG(INFO) << "check all ready success";
-            break;
-        }
-    }
-
-    ATB_LOG(INFO) << "barrier success, rank:" << rank;
-    return true;
-}
+static constexpr uint64_t SHM_RENDEZVOUS_TIMEOUT_MS = 600000; // 600000: 10 minutes timeout
 
 bool CreateHcclRootInfo(HcclRootInfo &hcclRootInfo, int32_t rank, int32_t rankRoot, int32_t rankSize)
 {
@@ -113,9 +46,9 @@ bool CreateHcclRootInfo(HcclRootInfo &hcclRootInfo, int32_t rank, int32_t rankRo
         return false;
     }
     std::string shmName = "hcclShareMem";
-    Mki::ShareMemory shm(shmName, sizeof(atb::CommInitInfo) + rankSize * sizeof(bool));
-    auto *shmInfo = static_cast<atb::CommInitInfo *>(shm.GetShm());
-    if (!shmInfo) {
+    Mki::ShareMemory shm(shmName, ShmRendezvous::GetShmSize(rankSize, sizeof(HcclRootInfo)));
+    void *shmAddr = shm.GetShm();
+    if (!shmAddr) {
         ATB_LOG(ERROR) << "create share memory fail, rank:" << rank;
         return false;
     }
@@ -123,6 +56,7 @@ bool CreateHcclRootInfo(HcclRootInfo &hcclRootInfo, int32_t rank, int32_t rankRo
     // 主进程通过HcclGetRootInfo获取到hcclRootInfo_(包含HostIP信息), 写到共享内存，其他进程读取RoortInfo
     // 等所有的进程都准备好时，再一起往下执行CreateHcclComm
     ATB_LOG(INFO) << "create share memory success, rank:" << rank;
+    ShmRendezvous rendezvous(shmAddr, rank, rankSize, sizeof(HcclRootInfo));
     if (rank == rankRoot) {
         ATB_LOG(INFO) << "rankRoot:" << rankRoot;
         auto hcclResult = HcclGetRootInfo(&hcclRootInfo);
@@ -131,13 +65,22 @@ bool CreateHcclRootInfo(HcclRootInfo &hcclRootInfo, int32_t rank, int32_t rankRo
             return false;
         }
         ATB_LOG(INFO) << "HcclGetRootInfo success, write to share memory";
-        ShmSetHcclRootInfo(shm, *shmInfo, hcclRootInfo);
+        rendezvous.Publish(&hcclRootInfo);
     } else {
         ATB_LOG(INFO) << "get root info from share memory";
-        ShmGetHcclRootInfo(shm, *shmInfo, hcclRootInfo);
+        if (!rendezvous.WaitPublished(&hcclRootInfo, SHM_RENDEZVOUS_TIMEOUT_MS)) {
+            ATB_LOG(ERROR) << "get root info from share memory timeout, rank:" << rank;
+            return false;
+        }
     }
 
-    return ShmBarrier(shm, *shmInfo, rank, rankSize);
+    ATB_LOG(INFO) << "barrier start, rank:" << rank;
+    if (!rendezvous.Barrier(SHM_RENDEZVOUS_TIMEOUT_MS)) {
+        ATB_LOG(ERROR) << "barrier fail, check all ready timeout";
+        return false;
+    }
+    ATB_LOG(INFO) << "barrier success, rank:" << rank;
+    return true;
 }
 
 HcclComm Comm::CreateHcclComm(int32_t rank, int32_t rankRoot, int32_t rankSize, char *commName)
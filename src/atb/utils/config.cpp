@@ -31,6 +31,12 @@ Config::Config()
     InitSocVersion();
     InitKernelCache();
     InitShareMemoryNameSuffix();
+    InitTilingFillParallel();
+    InitTrace();
+    InitAsyncDump();
+    InitMemAccounting();
+    InitDeferredOverflowCheck();
+    InitGraphCaptureCache();
     isStreamSyncEveryKernelEnable_ = IsEnable("ATB_STREAM_SYNC_EVERY_KERNEL_ENABLE");
     isStreamSyncEveryRunnerEnable_ = IsEnable("ATB_STREAM_SYNC_EVERY_RUNNER_ENABLE");
     isStreamSyncEveryOperationEnable_ = IsEnable("ATB_STREAM_SYNC_EVERY_OPERATION_ENABLE");
@@ -39,18 +45,35 @@ Config::Config()
                                                     DEFAULT_WORKSPACE_MEM_ALLOC_ALG_TYPE;
     isCompareTilingEveryKernelEnable_ = IsEnable("ATB_COMPARE_TILING_EVERY_KERNEL");
     isMatmulShuffleKEnable_ = IsEnable("ATB_MATMUL_SHUFFLE_K_ENABLE", true);
+    isInferShapeCacheEnable_ = IsEnable("ATB_INFER_SHAPE_CACHE_ENABLE", true);
     ATB_LOG(INFO) << "AtbHomePath: " << atbHomePath_
                   << ", IsStreamSyncEveryRunnerEnable: " << isStreamSyncEveryRunnerEnable_
                   << ", IsStreamSyncEveryKernelEnable: " << isStreamSyncEveryKernelEnable_
                   << ", IsStreamSyncEveryOperationEnable: " << isStreamSyncEveryOperationEnable_;
     ATB_LOG(INFO) << ", LocalKernelCacheCount: " << localKernelCacheCount_
-                  << ", GlobalKernelCacheCount: " << globalKernelCacheCount_;
+                  << ", GlobalKernelCacheCount: " << globalKernelCacheCount_
+                  << ", SharedKernelCacheCount: " << sharedKernelCacheCount_;
     ATB_LOG(INFO) << "ProfilingLevel0Status: " << GetSingleton<Mki::ProfilingFuncs>().GetProfilingLevel0Status()
                   << ", ProfilingLevel1Status: " << GetSingleton<Mki::ProfilingFuncs>().GetProfilingLevel1Status()
                   << ", IsCompareTilingEveryKernelEnable: " << isCompareTilingEveryKernelEnable_;
     ATB_LOG(INFO) << "WorkspaceMemAllocAlgType: " << workspaceMemAllocAlgType_
                   << ", ShareMemoryNameSuffix:" << shareMemoryNameSuffix_
                   << ", IsMatmulShuffleKEnable:" << isMatmulShuffleKEnable_;
+    ATB_LOG(INFO) << "TilingFillThreadNum: " << tilingFillThreadNum_
+                  << ", TilingFillParallelMinNodeNum: " << tilingFillParallelMinNodeNum_;
+    ATB_LOG(INFO) << "IsTraceEnable: " << isTraceEnable_ << ", TraceBufferSize: " << traceBufferSize_
+                  << ", TraceFilePath: " << traceFilePath_;
+    ATB_LOG(INFO) << "IsAsyncDumpEnable: " << isAsyncDumpEnable_ << ", AsyncDumpBufferSize: " << asyncDumpBufferSize_
+                  << ", AsyncDumpSampleRate: " << asyncDumpSampleRate_
+                  << ", IsAsyncDumpCompressEnable: " << isAsyncDumpCompressEnable_
+                  << ", AsyncDumpFilePath: " << asyncDumpFilePath_;
+    ATB_LOG(INFO) << "IsMemAccountingEnable: " << isMemAccountingEnable_
+                  << ", MemAccountingBufferSize: " << memAccountingBufferSize_
+                  << ", MemAccountingFilePath: " << memAccountingFilePath_;
+    ATB_LOG(INFO) << "IsDeferredOverflowCheckEnable: " << isDeferredOverflowCheckEnable_
+                  << ", DeferredOverflowCheckMaxPending: " << deferredOverflowCheckMaxPending_;
+    ATB_LOG(INFO) << "IsInferShapeCacheEnable: " << isInferShapeCacheEnable_
+                  << ", GraphCaptureCacheSize: " << graphCaptureCacheSize_;
 }
 
 Config::~Config() {}
@@ -193,6 +216,15 @@ void Config::InitKernelCache()
     if (globalKernelCacheCount_ > maxKernelCacheCount) {
         globalKernelCacheCount_ = maxKernelCacheCount;
     }
+
+    const uint32_t maxSharedKernelCacheCount = 1048576;
+    envStr = std::getenv("ATB_OPSRUNNER_KERNEL_CACHE_SHARED_COUNT");
+    if (envStr != nullptr) {
+        sharedKernelCacheCount_ = static_cast<uint32_t>(strtol(envStr, nullptr, DECIMAL));
+    }
+    if (sharedKernelCacheCount_ > maxSharedKernelCacheCount) {
+        sharedKernelCacheCount_ = maxSharedKernelCacheCount;
+    }
 }
 
 uint32_t Config::GetLocalKernelCacheCount() const
@@ -205,6 +237,11 @@ uint32_t Config::GetGlobalKernelCacheCount() const
     return globalKernelCacheCount_;
 }
 
+uint32_t Config::GetSharedKernelCacheCount() const
+{
+    return sharedKernelCacheCount_;
+}
+
 bool Config::IsCompareTilingEveryKernelEnable() const
 {
     return isCompareTilingEveryKernelEnable_;
@@ -239,4 +276,176 @@ bool Config::IsMatmulShuffleKEnable() const
     return isMatmulShuffleKEnable_;
 }
 
+void Config::InitTilingFillParallel()
+{
+    const uint32_t maxTilingFillThreadNum = 32;
+    const uint32_t maxTilingFillParallelMinNodeNum = 2048;
+    const uint32_t minTilingFillParallelMinNodeNum = 2;
+    // 线程数为0时不创建线程池，tiling始终串行填充
+    InitVariable("ATB_TILING_FILL_THREAD_NUM", 0, maxTilingFillThreadNum, tilingFillThreadNum_);
+    InitVariable("ATB_TILING_FILL_PARALLEL_MIN_NODE_NUM", minTilingFillParallelMinNodeNum,
+                 maxTilingFillParallelMinNodeNum, tilingFillParallelMinNodeNum_);
+}
+
+uint32_t Config::GetTilingFillThreadNum() const
+{
+    return tilingFillThreadNum_;
+}
+
+uint32_t Config::GetTilingFillParallelMinNodeNum() const
+{
+    return tilingFillParallelMinNodeNum_;
+}
+
+void Config::InitTrace()
+{
+    const uint32_t minTraceBufferSize = 1024;
+    const uint32_t maxTraceBufferSize = 4194304;
+    isTraceEnable_ = IsEnable("ATB_TRACE_ENABLE");
+    // 每个线程的环形缓冲可容纳的事件个数，写满后覆盖最旧的事件
+    InitVariable("ATB_TRACE_BUFFER_SIZE", minTraceBufferSize, maxTraceBufferSize, traceBufferSize_);
+    const char *envStr = std::getenv("ATB_TRACE_FILE_PATH");
+    if (!envStr) {
+        return;
+    }
+    if (strlen(envStr) > MAX_ENV_STRING_LEN) {
+        ATB_LOG(ERROR) << "ATB_TRACE_FILE_PATH length is more than " << MAX_ENV_STRING_LEN;
+        return;
+    }
+    traceFilePath_ = std::string(envStr);
+}
+
+bool Config::IsTraceEnable() const
+{
+    return isTraceEnable_;
+}
+
+uint32_t Config::GetTraceBufferSize() const
+{
+    return traceBufferSize_;
+}
+
+std::string Config::GetTraceFilePath() const
+{
+    return traceFilePath_;
+}
+
+void Config::InitAsyncDump()
+{
+    const uint32_t minAsyncDumpBufferSize = 1;
+    const uint32_t maxAsyncDumpBufferSize = 16384;
+    const uint32_t maxAsyncDumpSampleRate = 1000000;
+    isAsyncDumpEnable_ = IsEnable("ATB_ASYNC_DUMP_ENABLE");
+    // pinned环形缓冲大小，单位MB，写满后新的dump直接丢弃
+    InitVariable("ATB_ASYNC_DUMP_BUFFER_SIZE", minAsyncDumpBufferSize, maxAsyncDumpBufferSize, asyncDumpBufferSize_);
+    InitVariable("ATB_ASYNC_DUMP_SAMPLE_RATE", 1, maxAsyncDumpSampleRate, asyncDumpSampleRate_);
+    isAsyncDumpCompressEnable_ = IsEnable("ATB_ASYNC_DUMP_COMPRESS");
+    const char *envStr = std::getenv("ATB_ASYNC_DUMP_FILE_PATH");
+    if (!envStr) {
+        return;
+    }
+    if (strlen(envStr) > MAX_ENV_STRING_LEN) {
+        ATB_LOG(ERROR) << "ATB_ASYNC_DUMP_FILE_PATH length is more than " << MAX_ENV_STRING_LEN;
+        return;
+    }
+    asyncDumpFilePath_ = std::string(envStr);
+}
+
+bool Config::IsAsyncDumpEnable() const
+{
+    return isAsyncDumpEnable_;
+}
+
+uint32_t Config::GetAsyncDumpBufferSize() const
+{
+    return asyncDumpBufferSize_;
+}
+
+uint32_t Config::GetAsyncDumpSampleRate() const
+{
+    return asyncDumpSampleRate_;
+}
+
+bool Config::IsAsyncDumpCompressEnable() const
+{
+    return isAsyncDumpCompressEnable_;
+}
+
+std::string Config::GetAsyncDumpFilePath() const
+{
+    return asyncDumpFilePath_;
+}
+
+void Config::InitMemAccounting()
+{
+    const uint32_t minMemAccountingBufferSize = 1024;
+    const uint32_t maxMemAccountingBufferSize = 4194304;
+    isMemAccountingEnable_ = IsEnable("ATB_MEM_ACCOUNTING_ENABLE");
+    // 按执行顺序保留的内存记录条数，写满后覆盖最旧的记录，按算子的汇总统计不受影响
+    InitVariable("ATB_MEM_ACCOUNTING_BUFFER_SIZE", minMemAccountingBufferSize, maxMemAccountingBufferSize,
+                 memAccountingBufferSize_);
+    const char *envStr = std::getenv("ATB_MEM_ACCOUNTING_FILE_PATH");
+    if (!envStr) {
+        return;
+    }
+    if (strlen(envStr) > MAX_ENV_STRING_LEN) {
+        ATB_LOG(ERROR) << "ATB_MEM_ACCOUNTING_FILE_PATH length is more than " << MAX_ENV_STRING_LEN;
+        return;
+    }
+    memAccountingFilePath_ = std::string(envStr);
+}
+
+bool Config::IsMemAccountingEnable() const
+{
+    return isMemAccountingEnable_;
+}
+
+uint32_t Config::GetMemAccountingBufferSize() const
+{
+    return memAccountingBufferSize_;
+}
+
+std::string Config::GetMemAccountingFilePath() const
+{
+    return memAccountingFilePath_;
+}
+
+void Config::InitDeferredOverflowCheck()
+{
+    const uint32_t minDeferredOverflowCheckMaxPending = 1;
+    const uint32_t maxDeferredOverflowCheckMaxPending = 1024;
+    isDeferredOverflowCheckEnable_ = IsEnable("ATB_DEFERRED_OVERFLOW_CHECK_ENABLE");
+    // 未读回的检测数达到上限时，提交新检测前需同步等待最旧的检测完成
+    InitVariable("ATB_DEFERRED_OVERFLOW_CHECK_MAX_PENDING", minDeferredOverflowCheckMaxPending,
+                 maxDeferredOverflowCheckMaxPending, deferredOverflowCheckMaxPending_);
+}
+
+bool Config::IsDeferredOverflowCheckEnable() const
+{
+    return isDeferredOverflowCheckEnable_;
+}
+
+uint32_t Config::GetDeferredOverflowCheckMaxPending() const
+{
+    return deferredOverflowCheckMaxPending_;
+}
+
+bool Config::IsInferShapeCacheEnable() const
+{
+    return isInferShapeCacheEnable_;
+}
+
+void Config::InitGraphCaptureCache()
+{
+    const uint32_t minGraphCaptureCacheSize = 1;
+    const uint32_t maxGraphCaptureCacheSize = 64;
+    // 整图下发模式下每个Operation最多保留的已捕获模型个数，即支持的shape档位数
+    InitVariable("ATB_GRAPH_CAPTURE_CACHE_SIZE", minGraphCaptureCacheSize, maxGraphCaptureCacheSize,
+                 graphCaptureCacheSize_);
+}
+
+uint32_t Config::GetGraphCaptureCacheSize() const
+{
+    return graphCaptureCacheSize_;
+}
 } // namespace atb
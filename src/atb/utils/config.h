@@ -37,9 +37,27 @@ public:
     uint32_t GetWorkspaceMemAllocAlgType() const;
     uint32_t GetLocalKernelCacheCount() const;
     uint32_t GetGlobalKernelCacheCount() const;
+    uint32_t GetSharedKernelCacheCount() const;
     bool IsCompareTilingEveryKernelEnable() const;
     std::string GetShareMemoryNameSuffix() const;
     bool IsMatmulShuffleKEnable() const;
+    uint32_t GetTilingFillThreadNum() const;
+    uint32_t GetTilingFillParallelMinNodeNum() const;
+    bool IsTraceEnable() const;
+    uint32_t GetTraceBufferSize() const;
+    std::string GetTraceFilePath() const;
+    bool IsAsyncDumpEnable() const;
+    uint32_t GetAsyncDumpBufferSize() const;
+    uint32_t GetAsyncDumpSampleRate() const;
+    bool IsAsyncDumpCompressEnable() const;
+    std::string GetAsyncDumpFilePath() const;
+    bool IsMemAccountingEnable() const;
+    uint32_t GetMemAccountingBufferSize() const;
+    std::string GetMemAccountingFilePath() const;
+    bool IsDeferredOverflowCheckEnable() const;
+    uint32_t GetDeferredOverflowCheckMaxPending() const;
+    bool IsInferShapeCacheEnable() const;
+    uint32_t GetGraphCaptureCacheSize() const;
 
 private:
     static bool IsEnable(const char *env, bool enable = false);
@@ -49,6 +67,12 @@ private:
     void InitKernelCache();
     void InitVariable(const char *envName, uint32_t min, uint32_t max, uint32_t &value) const;
     void InitShareMemoryNameSuffix();
+    void InitTilingFillParallel();
+    void InitTrace();
+    void InitAsyncDump();
+    void InitMemAccounting();
+    void InitDeferredOverflowCheck();
+    void InitGraphCaptureCache();
 
 private:
     std::string atbHomePath_;
@@ -63,9 +87,27 @@ private:
     uint32_t workspaceMemAllocAlgType_ = 1;
     uint32_t localKernelCacheCount_ = 1;
     uint32_t globalKernelCacheCount_ = 1;
+    uint32_t sharedKernelCacheCount_ = 4096; // 进程级共享tiling缓存项上限，0表示关闭
     bool isCompareTilingEveryKernelEnable_ = false;
     std::string shareMemoryNameSuffix_;
     bool isMatmulShuffleKEnable_ = false;
+    uint32_t tilingFillThreadNum_ = 0;
+    uint32_t tilingFillParallelMinNodeNum_ = 16;
+    bool isTraceEnable_ = false;
+    uint32_t traceBufferSize_ = 65536;
+    std::string traceFilePath_;
+    bool isAsyncDumpEnable_ = false;
+    uint32_t asyncDumpBufferSize_ = 256;
+    uint32_t asyncDumpSampleRate_ = 1;
+    bool isAsyncDumpCompressEnable_ = false;
+    std::string asyncDumpFilePath_;
+    bool isMemAccountingEnable_ = false;
+    uint32_t memAccountingBufferSize_ = 65536;
+    std::string memAccountingFilePath_;
+    bool isDeferredOverflowCheckEnable_ = false;
+    uint32_t deferredOverflowCheckMaxPending_ = 16;
+    bool isInferShapeCacheEnable_ = true;
+    uint32_t graphCaptureCacheSize_ = 8;
 };
 } // namespace atb
 #endif
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include <mki/utils/log/log_sink.h>
 #include <mki/utils/log/log_entity.h>
 #include "atb/types.h"
+#include "atb/utils/async_logger.h"
 
 #define ATB_CHECK(condition, logExpr, handleExpr)                                                                      \
     MKI_CHECK(condition, logExpr, handleExpr)
@@ -28,15 +29,10 @@
     if (condition)                                                                                                     \
     ATB_LOG(level)
 
-#define ATB_LOG_TRACE                                                                                                  \
-    if (Mki::LogLevel::TRACE >= Mki::LogCore::Instance().GetLogLevel())                                                \
-    Mki::LogStream(__FILE__, __LINE__, __FUNCTION__, Mki::LogLevel::TRACE)
-#define ATB_LOG_DEBUG                                                                                                  \
-    if (Mki::LogLevel::DEBUG >= Mki::LogCore::Instance().GetLogLevel())                                                \
-    Mki::LogStream(__FILE__, __LINE__, __FUNCTION__, Mki::LogLevel::DEBUG)
-#define ATB_LOG_INFO                                                                                                   \
-    if (Mki::LogLevel::INFO >= Mki::LogCore::Instance().GetLogLevel())                                                 \
-    Mki::LogStream(__FILE__, __LINE__, __FUNCTION__, Mki::LogLevel::INFO)
+// 开启ATB_ASYNC_LOG_ENABLE后TRACE/DEBUG/INFO日志走异步后端
+#define ATB_LOG_TRACE ATB_LOG_ASYNC(TRACE)
+#define ATB_LOG_DEBUG ATB_LOG_ASYNC(DEBUG)
+#define ATB_LOG_INFO ATB_LOG_ASYNC(INFO)
 #define ATB_LOG_WARN                                                                                                   \
     if (Mki::LogLevel::WARN >= Mki::LogCore::Instance().GetLogLevel())                                                 \
     Mki::LogStream(__FILE__, __LINE__, __FUNCTION__, Mki::LogLevel::WARN)
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/utils/mem_accounting.h"
+#include <algorithm>
+#include <fstream>
+#include "atb/utils/config.h"
+#include "atb/utils/log.h"
+#include "atb/utils/singleton.h"
+
+namespace atb {
+static const std::string CSV_SUFFIX = ".csv";
+
+static void WriteJsonString(std::ostream &os, const std::string &str)
+{
+    os << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            os << ' ';
+        } else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+static void WriteCsvString(std::ostream &os, const std::string &str)
+{
+    os << '"';
+    for (char c : str) {
+        if (c == '"') {
+            os << '"';
+        }
+        os << c;
+    }
+    os << '"';
+}
+
+static bool IsCsvFile(const std::string &filePath)
+{
+    return filePath.size() >= CSV_SUFFIX.size() &&
+           filePath.compare(filePath.size() - CSV_SUFFIX.size(), CSV_SUFFIX.size(), CSV_SUFFIX) == 0;
+}
+
+MemAccounting::MemAccounting()
+{
+    const Config &config = GetSingleton<Config>();
+    capacity_ = std::max<size_t>(config.GetMemAccountingBufferSize(), 1);
+    exitFilePath_ = config.GetMemAccountingFilePath();
+    statistics_.resize(1);
+    enable_.store(config.IsMemAccountingEnable(), std::memory_order_relaxed);
+}
+
+MemAccounting::~MemAccounting()
+{
+    bool enable = enable_.exchange(false);
+    // 只有显式配置了导出路径才在退出时导出，不向当前目录写文件
+    if (!enable || executeCount_ == 0 || exitFilePath_.empty()) {
+        return;
+    }
+    Dump(exitFilePath_);
+}
+
+bool MemAccounting::IsEnable() const
+{
+    return enable_.load(std::memory_order_relaxed);
+}
+
+void MemAccounting::SetEnable(bool enable)
+{
+    enable_.store(enable, std::memory_order_relaxed);
+}
+
+uint32_t MemAccounting::RegisterName(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = nameIds_.find(name);
+    if (it != nameIds_.end()) {
+        return it->second;
+    }
+    uint32_t nameId = static_cast<uint32_t>(statistics_.size());
+    statistics_.emplace_back();
+    statistics_.back().opName = name;
+    nameIds_[name] = nameId;
+    return nameId;
+}
+
+void MemAccounting::Record(uint32_t nameId, uint64_t workspaceSize, uint64_t intermediateSize, uint64_t tilingSize)
+{
+    uint64_t totalSize = workspaceSize + intermediateSize + tilingSize;
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (nameId == 0 || nameId >= statistics_.size()) {
+        return;
+    }
+    OpMemStatistic &statistic = statistics_.at(nameId);
+    statistic.executeCount++;
+    statistic.workspaceSize = workspaceSize;
+    statistic.intermediateSize = intermediateSize;
+    statistic.tilingSize = tilingSize;
+    statistic.maxWorkspaceSize = std::max(statistic.maxWorkspaceSize, workspaceSize);
+    statistic.maxIntermediateSize = std::max(statistic.maxIntermediateSize, intermediateSize);
+    statistic.maxTilingSize = std::max(statistic.maxTilingSize, tilingSize);
+    statistic.maxTotalSize = std::max(statistic.maxTotalSize, totalSize);
+    peakSize_ = std::max(peakSize_, totalSize);
+
+    RecordSlot slot = {executeCount_, nameId, workspaceSize, intermediateSize, tilingSize, peakSize_};
+    if (records_.size() < capacity_) {
+        records_.push_back(slot);
+    } else {
+        records_.at(executeCount_ % capacity_) = slot;
+    }
+    executeCount_++;
+}
+
+std::vector<OpMemStatistic> MemAccounting::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<OpMemStatistic> statistics;
+    for (size_t nameId = 1; nameId < statistics_.size(); ++nameId) {
+        if (statistics_.at(nameId).executeCount != 0) {
+            statistics.push_back(statistics_.at(nameId));
+        }
+    }
+    return statistics;
+}
+
+std::vector<OpMemRecord> MemAccounting::GetRecordsLocked() const
+{
+    // 环形缓冲写满后，最旧的记录位于下一次写入的位置
+    size_t beginPos = records_.size() < capacity_ ? 0 : static_cast<size_t>(executeCount_ % capacity_);
+    std::vector<OpMemRecord> records;
+    records.reserve(records_.size());
+    for (size_t i = 0; i < records_.size(); ++i) {
+        const RecordSlot &slot = records_.at((beginPos + i) % records_.size());
+        records.push_back({slot.executeIndex, statistics_.at(slot.nameId).opName, slot.workspaceSize,
+                           slot.intermediateSize, slot.tilingSize, slot.peakSize});
+    }
+    return records;
+}
+
+std::vector<OpMemRecord> MemAccounting::GetRecords()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return GetRecordsLocked();
+}
+
+uint64_t MemAccounting::GetPeakSize()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return peakSize_;
+}
+
+void MemAccounting::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 保留名称与id的映射，各算子缓存的名称id在重置后仍然有效
+    for (size_t nameId = 1; nameId < statistics_.size(); ++nameId) {
+        std::string opName = statistics_.at(nameId).opName;
+        statistics_.at(nameId) = OpMemStatistic();
+        statistics_.at(nameId).opName = opName;
+    }
+    records_.clear();
+    executeCount_ = 0;
+    peakSize_ = 0;
+}
+
+void MemAccounting::DumpCsv(std::ostream &os)
+{
+    std::vector<OpMemStatistic> statistics = GetStatistics();
+    os << "opName,executeCount,workspaceSize,intermediateSize,tilingSize,maxWorkspaceSize,maxIntermediateSize,"
+          "maxTilingSize,maxTotalSize\n";
+    for (const OpMemStatistic &statistic : statistics) {
+        WriteCsvString(os, statistic.opName);
+        os << ',' << statistic.executeCount << ',' << statistic.workspaceSize << ',' << statistic.intermediateSize
+           << ',' << statistic.tilingSize << ',' << statistic.maxWorkspaceSize << ','
+           << statistic.maxIntermediateSize << ',' << statistic.maxTilingSize << ',' << statistic.maxTotalSize
+           << '\n';
+    }
+}
+
+void MemAccounting::DumpJson(std::ostream &os)
+{
+    std::vector<OpMemRecord> records;
+    uint64_t executeCount = 0;
+    uint64_t peakSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        records = GetRecordsLocked();
+        executeCount = executeCount_;
+        peakSize = peakSize_;
+    }
+    std::vector<OpMemStatistic> statistics = GetStatistics();
+    os << "{\"executeCount\":" << executeCount << ",\"peakSize\":" << peakSize << ",\n\"operations\":[";
+    for (size_t i = 0; i < statistics.size(); ++i) {
+        const OpMemStatistic &statistic = statistics.at(i);
+        os << (i == 0 ? "\n" : ",\n") << "{\"opName\":";
+        WriteJsonString(os, statistic.opName);
+        os << ",\"executeCount\":" << statistic.executeCount << ",\"workspaceSize\":" << statistic.workspaceSize
+           << ",\"intermediateSize\":" << statistic.intermediateSize << ",\"tilingSize\":" << statistic.tilingSize
+           << ",\"maxWorkspaceSize\":" << statistic.maxWorkspaceSize
+           << ",\"maxIntermediateSize\":" << statistic.maxIntermediateSize
+           << ",\"maxTilingSize\":" << statistic.maxTilingSize << ",\"maxTotalSize\":" << statistic.maxTotalSize
+           << "}";
+    }
+    os << "],\n\"timeline\":[";
+    for (size_t i = 0; i < records.size(); ++i) {
+        const OpMemRecord &record = records.at(i);
+        os << (i == 0 ? "\n" : ",\n") << "{\"executeIndex\":" << record.executeIndex << ",\"opName\":";
+        WriteJsonString(os, record.opName);
+        os << ",\"workspaceSize\":" << record.workspaceSize << ",\"intermediateSize\":" << record.intermediateSize
+           << ",\"tilingSize\":" << record.tilingSize << ",\"peakSize\":" << record.peakSize << "}";
+    }
+    os << "]}\n";
+}
+
+Status MemAccounting::Dump(const std::string &filePath)
+{
+    if (filePath.empty()) {
+        ATB_LOG(ERROR) << "mem accounting file path is empty";
+        return ERROR_INVALID_PARAM;
+    }
+    std::ofstream ofs(filePath, std::ios::out | std::ios::trunc);
+    if (!ofs.is_open()) {
+        ATB_LOG(ERROR) << "open mem accounting file " << filePath << " fail";
+        return ERROR_INVALID_PARAM;
+    }
+    if (IsCsvFile(filePath)) {
+        DumpCsv(ofs);
+    } else {
+        DumpJson(ofs);
+    }
+    ofs.close();
+    if (ofs.fail()) {
+        ATB_LOG(ERROR) << "write mem accounting file " << filePath << " fail";
+        return ERROR_INTERNAL_ERROR;
+    }
+    ATB_LOG(INFO) << "dump mem accounting to " << filePath << " success";
+    return NO_ERROR;
+}
+} // namespace atb
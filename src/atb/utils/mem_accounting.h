@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_MEM_ACCOUNTING_H
+#define ATB_MEM_ACCOUNTING_H
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "atb/types.h"
+#include "atb/utils.h"
+
+namespace atb {
+// 按算子名称记录每次执行申请的workspace、中间tensor与tiling内存。
+// 汇总统计按算子名称累计；逐次执行的记录保存在定长环形缓冲中，写满后覆盖最旧记录。
+// 未开启时只有一次原子读的开销。配置了ATB_MEM_ACCOUNTING_FILE_PATH时在进程退出时导出到该路径。
+class MemAccounting {
+public:
+    MemAccounting();
+    ~MemAccounting();
+    bool IsEnable() const;
+    void SetEnable(bool enable);
+    // 注册算子名称并返回名称id，同名返回同一id，调用方应缓存返回值，0表示未注册
+    uint32_t RegisterName(const std::string &name);
+    void Record(uint32_t nameId, uint64_t workspaceSize, uint64_t intermediateSize, uint64_t tilingSize);
+    std::vector<OpMemStatistic> GetStatistics();
+    std::vector<OpMemRecord> GetRecords();
+    uint64_t GetPeakSize();
+    void Reset();
+    // 文件名以.csv结尾时导出按算子汇总的csv表格，否则导出包含汇总与时间线的json
+    Status Dump(const std::string &filePath);
+    void DumpJson(std::ostream &os);
+    void DumpCsv(std::ostream &os);
+
+private:
+    struct RecordSlot {
+        uint64_t executeIndex = 0;
+        uint32_t nameId = 0;
+        uint64_t workspaceSize = 0;
+        uint64_t intermediateSize = 0;
+        uint64_t tilingSize = 0;
+        uint64_t peakSize = 0;
+    };
+    std::vector<OpMemRecord> GetRecordsLocked() const;
+
+private:
+    std::atomic<bool> enable_{false};
+    std::string exitFilePath_;
+    std::mutex mutex_;
+    std::vector<OpMemStatistic> statistics_; // 下标为名称id，0号不使用
+    std::unordered_map<std::string, uint32_t> nameIds_;
+    std::vector<RecordSlot> records_;
+    size_t capacity_ = 0;
+    uint64_t executeCount_ = 0;
+    uint64_t peakSize_ = 0;
+};
+} // namespace atb
+#endif
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/utils/numa_util.h"
+#include <cerrno>
+#include <climits>
+#include <fstream>
+#include <string>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "atb/utils/log.h"
+
+namespace atb {
+// 与<numaif.h>中的定义一致，避免引入libnuma依赖
+static constexpr int MPOL_MODE_DEFAULT = 0;
+static constexpr int MPOL_MODE_PREFERRED = 1;
+static constexpr size_t MAX_NUMA_NODE_NUM = 1024;
+static constexpr size_t NODE_MASK_BITS = sizeof(unsigned long) * CHAR_BIT;
+static constexpr size_t NODE_MASK_LEN = MAX_NUMA_NODE_NUM / NODE_MASK_BITS;
+static const char *NODE_ONLINE_PATH = "/sys/devices/system/node/online";
+
+int32_t NumaUtil::GetCurrentNode()
+{
+    unsigned int cpu = 0;
+    unsigned int node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        ATB_LOG(WARN) << "getcpu fail, errno: " << errno;
+        return -1;
+    }
+    return static_cast<int32_t>(node);
+}
+
+int32_t NumaUtil::GetNodeNum()
+{
+    // online文件内容形如"0"或"0-1"或"0,2-3"，取最大节点号+1
+    std::ifstream file(NODE_ONLINE_PATH);
+    std::string content;
+    if (!file.is_open() || !std::getline(file, content)) {
+        return 1;
+    }
+    int32_t maxNode = 0;
+    int32_t value = 0;
+    bool hasValue = false;
+    for (char c : content) {
+        if (c >= '0' && c <= '9') {
+            value = value * 10 + (c - '0'); // 10: 十进制
+            hasValue = true;
+            continue;
+        }
+        if (hasValue && value > maxNode) {
+            maxNode = value;
+        }
+        value = 0;
+        hasValue = false;
+    }
+    if (hasValue && value > maxNode) {
+        maxNode = value;
+    }
+    return maxNode + 1;
+}
+
+ScopedNumaMemPolicy::ScopedNumaMemPolicy(int32_t numaNode)
+{
+    if (numaNode < 0 || static_cast<size_t>(numaNode) >= MAX_NUMA_NODE_NUM) {
+        return;
+    }
+    oldNodeMask_.resize(NODE_MASK_LEN, 0);
+    if (syscall(SYS_get_mempolicy, &oldMode_, oldNodeMask_.data(), MAX_NUMA_NODE_NUM, nullptr, 0) != 0) {
+        ATB_LOG(WARN) << "get_mempolicy fail, errno: " << errno << ", numa node " << numaNode << " is ignored";
+        return;
+    }
+    std::vector<unsigned long> nodeMask(NODE_MASK_LEN, 0);
+    nodeMask.at(static_cast<size_t>(numaNode) / NODE_MASK_BITS) |= 1UL << (static_cast<size_t>(numaNode) %
+                                                                           NODE_MASK_BITS);
+    // 内核会将maxnode减一后使用，因此传入位数+1
+    if (syscall(SYS_set_mempolicy, MPOL_MODE_PREFERRED, nodeMask.data(), MAX_NUMA_NODE_NUM + 1) != 0) {
+        ATB_LOG(WARN) << "set_mempolicy fail, errno: " << errno << ", numa node " << numaNode << " is ignored";
+        return;
+    }
+    applied_ = true;
+}
+
+ScopedNumaMemPolicy::~ScopedNumaMemPolicy()
+{
+    if (!applied_) {
+        return;
+    }
+    long ret = oldMode_ == MPOL_MODE_DEFAULT ?
+                   syscall(SYS_set_mempolicy, MPOL_MODE_DEFAULT, nullptr, 0) :
+                   syscall(SYS_set_mempolicy, oldMode_, oldNodeMask_.data(), MAX_NUMA_NODE_NUM + 1);
+    if (ret != 0) {
+        ATB_LOG(WARN) << "restore mempolicy fail, errno: " << errno;
+    }
+}
+
+bool ScopedNumaMemPolicy::IsApplied() const
+{
+    return applied_;
+}
+} // namespace atb
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_NUMA_UTIL_H
+#define ATB_NUMA_UTIL_H
+#include <cstdint>
+#include <vector>
+
+namespace atb {
+class NumaUtil {
+public:
+    // 调用线程当前运行CPU所在的NUMA节点，获取失败返回-1
+    static int32_t GetCurrentNode();
+    // 系统中可用的NUMA节点数，非NUMA系统返回1
+    static int32_t GetNodeNum();
+};
+
+// 在作用域内将调用线程的内存策略设置为优先在numaNode上分配物理页，析构时恢复原策略。
+// numaNode小于0时不做任何处理。
+class ScopedNumaMemPolicy {
+public:
+    explicit ScopedNumaMemPolicy(int32_t numaNode);
+    ~ScopedNumaMemPolicy();
+    ScopedNumaMemPolicy(const ScopedNumaMemPolicy &other) = delete;
+    ScopedNumaMemPolicy &operator=(const ScopedNumaMemPolicy &other) = delete;
+    bool IsApplied() const;
+
+private:
+    bool applied_ = false;
+    int oldMode_ = 0;
+    std::vector<unsigned long> oldNodeMask_;
+};
+} // namespace atb
+#endif
@@ -28,8 +28,11 @@ bool IsLaunchParamEqual(const Mki::LaunchParam &launchParam1, const Mki::LaunchP
         }
     }
 
-    const Mki::Any &specificParam1 = launchParam1.GetParam();
-    const Mki::Any &specificParam2 = launchParam2.GetParam();
+    return IsSpecificParamEqual(launchParam1.GetParam(), launchParam2.GetParam());
+}
+
+bool IsSpecificParamEqual(const Mki::Any &specificParam1, const Mki::Any &specificParam2)
+{
     auto &opParamCompareMap = OpParamRegister::GetOpParamCompareMap();
     auto it = opParamCompareMap.find(specificParam1.Type().hash_code());
     if (it != opParamCompareMap.end()) {
@@ -16,6 +16,7 @@
 
 namespace atb {
 bool IsLaunchParamEqual(const Mki::LaunchParam &launchParam1, const Mki::LaunchParam &launchParam2);
+bool IsSpecificParamEqual(const Mki::Any &specificParam1, const Mki::Any &specificParam2);
 using ParamCompareFunc = std::function<bool(const Mki::Any &, const Mki::Any &)>;
 
 template <typename T> bool ParamCompareFuncImpl(const Mki::Any &any1, const Mki::Any &any2)
@@ -0,0 +1,749 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "atb/utils/param_from_json.h"
+#include "atb/infer_op_params.h"
+#include "atb/train_op_params.h"
+#include "atb/common_op_params.h"
+#include "atb/svector.h"
+
+namespace atb {
+template <typename T> static void JsonToValue(const nlohmann::json &json, T &value)
+{
+    json.get_to(value);
+}
+
+template <typename T> static void JsonToValue(const nlohmann::json &json, SVector<T> &value)
+{
+    value.clear();
+    for (const nlohmann::json &item : json) {
+        T element{};
+        JsonToValue(item, element);
+        value.push_back(element);
+    }
+}
+
+template <typename T> static void JsonToField(const nlohmann::json &json, const char *key, T &field)
+{
+    auto it = json.find(key);
+    if (it != json.end() && !it->is_null()) {
+        JsonToValue(*it, field);
+    }
+}
+
+static const nlohmann::json &GetChildJson(const nlohmann::json &json, const char *key)
+{
+    static const nlohmann::json emptyJson = nlohmann::json::object();
+    auto it = json.find(key);
+    return it == json.end() ? emptyJson : *it;
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::ActivationParam &opParam)
+{
+    JsonToField(paramsJson, "activationType", opParam.activationType);
+    JsonToField(paramsJson, "scale", opParam.scale);
+    JsonToField(paramsJson, "dim", opParam.dim);
+    JsonToField(paramsJson, "geluMode", opParam.geluMode);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::AllGatherParam &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::AllGatherVParam &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::AllReduceParam &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "allReduceType", opParam.allReduceType);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+    JsonToField(paramsJson, "quantType", opParam.quantType);
+    JsonToField(paramsJson, "outDataType", opParam.outDataType);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::AsStridedParam &opParam)
+{
+    JsonToField(paramsJson, "size", opParam.size);
+    JsonToField(paramsJson, "stride", opParam.stride);
+    JsonToField(paramsJson, "offset", opParam.offset);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::BroadcastParam &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::ReduceScatterParam &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "reduceType", opParam.reduceType);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::ReduceScatterVParam &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "sendCounts", opParam.sendCounts);
+    JsonToField(paramsJson, "sdispls", opParam.sdispls);
+    JsonToField(paramsJson, "recvCount", opParam.recvCount);
+    JsonToField(paramsJson, "reduceType", opParam.reduceType);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::ConcatParam &opParam)
+{
+    JsonToField(paramsJson, "concatDim", opParam.concatDim);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::CumsumParam &opParam)
+{
+    JsonToField(paramsJson, "axes", opParam.axes);
+    JsonToField(paramsJson, "exclusive", opParam.exclusive);
+    JsonToField(paramsJson, "reverse", opParam.reverse);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::DynamicNTKParam &opParam)
+{
+    JsonToField(paramsJson, "outputType", opParam.outDataType);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::ElewiseParam &opParam)
+{
+    JsonToField(paramsJson, "elewiseType", opParam.elewiseType);
+    JsonToField(paramsJson, "outTensorType", opParam.outTensorType);
+
+    const nlohmann::json &quantParamsJson = GetChildJson(paramsJson, "quantParam");
+    JsonToField(quantParamsJson, "inputOffset", opParam.quantParam.inputOffset);
+    JsonToField(quantParamsJson, "inputScale", opParam.quantParam.inputScale);
+    JsonToField(quantParamsJson, "asymmetric", opParam.quantParam.asymmetric);
+
+    const nlohmann::json &mulsParamJson = GetChildJson(paramsJson, "mulsParam");
+    JsonToField(mulsParamJson, "varAttr", opParam.mulsParam.varAttr);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, train::FastSoftMaxParam &opParam)
+{
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "qSeqLen", opParam.qSeqLen);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, train::FastSoftMaxGradParam &opParam)
+{
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "qSeqLen", opParam.qSeqLen);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::FillParam &opParam)
+{
+    JsonToField(paramsJson, "outDim", opParam.outDim);
+    JsonToField(paramsJson, "value", opParam.value);
+    JsonToField(paramsJson, "withMask", opParam.withMask);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::GatherParam &opParam)
+{
+    JsonToField(paramsJson, "axis", opParam.axis);
+    JsonToField(paramsJson, "batchDims", opParam.batchDims);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, train::GenAttentionMaskParam &opParam)
+{
+    JsonToField(paramsJson, "seqLen", opParam.seqLen);
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::GroupedMatmulInplaceAddParam &opParam)
+{
+    JsonToField(paramsJson, "transposeA", opParam.transposeA);
+    JsonToField(paramsJson, "transposeB", opParam.transposeB);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::LayerNormParam &opParam)
+{
+    JsonToField(paramsJson, "layerType", opParam.layerType);
+
+    const nlohmann::json &normParam = GetChildJson(paramsJson, "normParam");
+    JsonToField(normParam, "quantType", opParam.normParam.quantType);
+    JsonToField(normParam, "epsilon", opParam.normParam.epsilon);
+    JsonToField(normParam, "beginNormAxis", opParam.normParam.beginNormAxis);
+    JsonToField(normParam, "beginParamsAxis", opParam.normParam.beginParamsAxis);
+    JsonToField(normParam, "dynamicQuantType", opParam.normParam.dynamicQuantType);
+
+    const nlohmann::json &preNormParam = GetChildJson(paramsJson, "preNormParam");
+    JsonToField(preNormParam, "quantType", opParam.preNormParam.quantType);
+    JsonToField(preNormParam, "epsilon", opParam.preNormParam.epsilon);
+    JsonToField(preNormParam, "opMode", opParam.preNormParam.opMode);
+    JsonToField(preNormParam, "zoomScaleValue", opParam.preNormParam.zoomScaleValue);
+
+    const nlohmann::json &postNormParam = GetChildJson(paramsJson, "postNormParam");
+    JsonToField(postNormParam, "quantType", opParam.postNormParam.quantType);
+    JsonToField(postNormParam, "epsilon", opParam.postNormParam.epsilon);
+    JsonToField(postNormParam, "opMode", opParam.postNormParam.opMode);
+    JsonToField(postNormParam, "zoomScaleValue", opParam.postNormParam.zoomScaleValue);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::LayerNormWithStrideParam &opParam)
+{
+    JsonToField(paramsJson, "layerType", opParam.layerType);
+
+    const nlohmann::json &normParam = GetChildJson(paramsJson, "normParam");
+    JsonToField(normParam, "quantType", opParam.normParam.quantType);
+    JsonToField(normParam, "epsilon", opParam.normParam.epsilon);
+    JsonToField(normParam, "beginNormAxis", opParam.normParam.beginNormAxis);
+    JsonToField(normParam, "beginParamsAxis", opParam.normParam.beginParamsAxis);
+    JsonToField(normParam, "dynamicQuantType", opParam.normParam.dynamicQuantType);
+
+    const nlohmann::json &preNormParam = GetChildJson(paramsJson, "preNormParam");
+    JsonToField(preNormParam, "quantType", opParam.preNormParam.quantType);
+    JsonToField(preNormParam, "epsilon", opParam.preNormParam.epsilon);
+    JsonToField(preNormParam, "opMode", opParam.preNormParam.opMode);
+    JsonToField(preNormParam, "zoomScaleValue", opParam.preNormParam.zoomScaleValue);
+
+    const nlohmann::json &postNormParam = GetChildJson(paramsJson, "postNormParam");
+    JsonToField(postNormParam, "quantType", opParam.postNormParam.quantType);
+    JsonToField(postNormParam, "epsilon", opParam.postNormParam.epsilon);
+    JsonToField(postNormParam, "opMode", opParam.postNormParam.opMode);
+    JsonToField(postNormParam, "zoomScaleValue", opParam.postNormParam.zoomScaleValue);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::LinearParam &opParam)
+{
+    JsonToField(paramsJson, "transposeA", opParam.transposeA);
+    JsonToField(paramsJson, "transposeB", opParam.transposeB);
+    JsonToField(paramsJson, "hasBias", opParam.hasBias);
+    JsonToField(paramsJson, "outDataType", opParam.outDataType);
+    JsonToField(paramsJson, "enAccum", opParam.enAccum);
+    JsonToField(paramsJson, "matmulType", opParam.matmulType);
+    JsonToField(paramsJson, "quantMode", opParam.quantMode);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::LinearParallelParam &opParam)
+{
+    JsonToField(paramsJson, "transWeight", opParam.transWeight);
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "hasResidual", opParam.hasResidual);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "type", opParam.type);
+    JsonToField(paramsJson, "keepIntermediate", opParam.keepIntermediate);
+    JsonToField(paramsJson, "quantType", opParam.quantType);
+    JsonToField(paramsJson, "quantGroupSize", opParam.quantGroupSize);
+    JsonToField(paramsJson, "outDataType", opParam.outDataType);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+    JsonToField(paramsJson, "local_expert_nums", opParam.moeInfo.localExpertNums);
+    JsonToField(paramsJson, "epSize", opParam.moeInfo.epSize);
+    JsonToField(paramsJson, "tpSize", opParam.moeInfo.tpSize);
+    const nlohmann::json &twoDimTPInfoJson = GetChildJson(paramsJson, "twoDimTPInfo");
+    JsonToField(twoDimTPInfoJson, "agDim", opParam.twoDimTPInfo.agDim);
+    JsonToField(twoDimTPInfoJson, "rsDim", opParam.twoDimTPInfo.rsDim);
+    JsonToField(twoDimTPInfoJson, "innerDimIsAg", opParam.twoDimTPInfo.innerDimIsAg);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::LinearSparseParam &opParam)
+{
+    JsonToField(paramsJson, "transposeA", opParam.transposeA);
+    JsonToField(paramsJson, "transposeB", opParam.transposeB);
+    JsonToField(paramsJson, "tilingK", opParam.tilingK);
+    JsonToField(paramsJson, "tilingN", opParam.tilingN);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::SwigluQuantParam &opParam)
+{
+    JsonToField(paramsJson, "quantType", opParam.quantType);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::MultinomialParam &opParam)
+{
+    JsonToField(paramsJson, "numSamples", opParam.numSamples);
+    JsonToField(paramsJson, "randSeed", opParam.randSeed);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::OnehotParam &opParam)
+{
+    JsonToField(paramsJson, "axis", opParam.axis);
+    JsonToField(paramsJson, "depth", opParam.depth);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::IndexAddParam &opParam)
+{
+    JsonToField(paramsJson, "indexType", opParam.indexType);
+    JsonToField(paramsJson, "axis", opParam.axis);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::PagedAttentionParam &opParam)
+{
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "qkScale", opParam.qkScale);
+    JsonToField(paramsJson, "kvHeadNum", opParam.kvHeadNum);
+    JsonToField(paramsJson, "maskType", opParam.maskType);
+    JsonToField(paramsJson, "batchRunStatusEnable", opParam.batchRunStatusEnable);
+    JsonToField(paramsJson, "quantType", opParam.quantType);
+    JsonToField(paramsJson, "outDataType", opParam.outDataType);
+    JsonToField(paramsJson, "hasQuantOffset", opParam.hasQuantOffset);
+    JsonToField(paramsJson, "compressType", opParam.compressType);
+    JsonToField(paramsJson, "calcType", opParam.calcType);
+    JsonToField(paramsJson, "scaleType", opParam.scaleType);
+    JsonToField(paramsJson, "inputLayout", opParam.inputLayout);
+    JsonToField(paramsJson, "mlaVHeadSize", opParam.mlaVHeadSize);
+    JsonToField(paramsJson, "qScale", opParam.qScale);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::ReduceParam &opParam)
+{
+    JsonToField(paramsJson, "axis", opParam.axis);
+    JsonToField(paramsJson, "reduceType", opParam.reduceType);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::RelayAttentionParam &opParam)
+{
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "qkScale", opParam.qkScale);
+    JsonToField(paramsJson, "kvHeadNum", opParam.kvHeadNum);
+    JsonToField(paramsJson, "maskType", opParam.maskType);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::RepeatParam &opParam)
+{
+    JsonToField(paramsJson, "multiples", opParam.multiples);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::RmsNormParam &opParam)
+{
+    JsonToField(paramsJson, "layerType", opParam.layerType);
+
+    const nlohmann::json &normParamJson = GetChildJson(paramsJson, "normParam");
+    JsonToField(normParamJson, "quantType", opParam.normParam.quantType);
+    JsonToField(normParamJson, "epsilon", opParam.normParam.epsilon);
+    JsonToField(normParamJson, "layerNormEps", opParam.normParam.layerNormEps);
+    JsonToField(normParamJson, "rstd", opParam.normParam.rstd);
+    JsonToField(normParamJson, "precisionMode", opParam.normParam.precisionMode);
+    JsonToField(normParamJson, "modelType", opParam.normParam.modelType);
+    JsonToField(normParamJson, "dynamicQuantType", opParam.normParam.dynamicQuantType);
+
+    const nlohmann::json &preNormParamJson = GetChildJson(paramsJson, "preNormParam");
+    JsonToField(preNormParamJson, "quantType", opParam.preNormParam.quantType);
+    JsonToField(preNormParamJson, "epsilon", opParam.preNormParam.epsilon);
+    JsonToField(preNormParamJson, "hasBias", opParam.preNormParam.hasBias);
+
+    const nlohmann::json &postNormParamJson = GetChildJson(paramsJson, "postNormParam");
+    JsonToField(postNormParamJson, "quantType", opParam.postNormParam.quantType);
+    JsonToField(postNormParamJson, "epsilon", opParam.postNormParam.epsilon);
+    JsonToField(postNormParamJson, "hasBias", opParam.postNormParam.hasBias);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::RmsNormWithStrideParam &opParam)
+{
+    JsonToField(paramsJson, "layerType", opParam.layerType);
+
+    const nlohmann::json &normParamJson = GetChildJson(paramsJson, "normParam");
+    JsonToField(normParamJson, "quantType", opParam.normParam.quantType);
+    JsonToField(normParamJson, "epsilon", opParam.normParam.epsilon);
+    JsonToField(normParamJson, "layerNormEps", opParam.normParam.layerNormEps);
+    JsonToField(normParamJson, "rstd", opParam.normParam.rstd);
+    JsonToField(normParamJson, "precisionMode", opParam.normParam.precisionMode);
+    JsonToField(normParamJson, "modelType", opParam.normParam.modelType);
+    JsonToField(normParamJson, "dynamicQuantType", opParam.normParam.dynamicQuantType);
+
+    const nlohmann::json &preNormParamJson = GetChildJson(paramsJson, "preNormParam");
+    JsonToField(preNormParamJson, "quantType", opParam.preNormParam.quantType);
+    JsonToField(preNormParamJson, "epsilon", opParam.preNormParam.epsilon);
+    JsonToField(preNormParamJson, "hasBias", opParam.preNormParam.hasBias);
+
+    const nlohmann::json &postNormParamJson = GetChildJson(paramsJson, "postNormParam");
+    JsonToField(postNormParamJson, "quantType", opParam.postNormParam.quantType);
+    JsonToField(postNormParamJson, "epsilon", opParam.postNormParam.epsilon);
+    JsonToField(postNormParamJson, "hasBias", opParam.postNormParam.hasBias);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::RopeParam &opParam)
+{
+    JsonToField(paramsJson, "rotaryCoeff", opParam.rotaryCoeff);
+    JsonToField(paramsJson, "cosFormat", opParam.cosFormat);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, train::RopeGradParam &opParam)
+{
+    JsonToField(paramsJson, "c_qSeqLen", opParam.qSeqLen);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::SelfAttentionParam &opParam)
+{
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "isTriuMask", opParam.isTriuMask);
+    JsonToField(paramsJson, "qScale", opParam.qScale);
+    JsonToField(paramsJson, "qkScale", opParam.qkScale);
+    JsonToField(paramsJson, "batchRunStatusEnable", opParam.batchRunStatusEnable);
+    JsonToField(paramsJson, "kvHeadNum", opParam.kvHeadNum);
+    JsonToField(paramsJson, "calcType", opParam.calcType);
+    JsonToField(paramsJson, "maskType", opParam.maskType);
+    JsonToField(paramsJson, "kernelType", opParam.kernelType);
+    JsonToField(paramsJson, "clampType", opParam.clampType);
+    JsonToField(paramsJson, "clampMin", opParam.clampMin);
+    JsonToField(paramsJson, "clampMax", opParam.clampMax);
+    JsonToField(paramsJson, "kvcacheCfg", opParam.kvcacheCfg);
+    JsonToField(paramsJson, "inputLayout", opParam.inputLayout);
+    JsonToField(paramsJson, "scaleType", opParam.scaleType);
+    JsonToField(paramsJson, "quantType", opParam.quantType);
+    JsonToField(paramsJson, "outDataType", opParam.outDataType);
+    JsonToField(paramsJson, "mlaVHeadSize", opParam.mlaVHeadSize);
+    JsonToField(paramsJson, "windowSize", opParam.windowSize);
+    JsonToField(paramsJson, "cacheType", opParam.cacheType);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::SetValueParam &opParam)
+{
+    JsonToField(paramsJson, "starts", opParam.starts);
+    JsonToField(paramsJson, "ends", opParam.ends);
+    JsonToField(paramsJson, "strides", opParam.strides);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::SliceParam &opParam)
+{
+    JsonToField(paramsJson, "offsets", opParam.offsets);
+    JsonToField(paramsJson, "size", opParam.size);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::SoftmaxParam &opParam)
+{
+    JsonToField(paramsJson, "axes", opParam.axes);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::SortParam &opParam)
+{
+    JsonToField(paramsJson, "num", opParam.num);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::SplitParam &opParam)
+{
+    JsonToField(paramsJson, "splitNum", opParam.splitNum);
+    JsonToField(paramsJson, "splitDim", opParam.splitDim);
+    JsonToField(paramsJson, "splitSizes", opParam.splitSizes);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, train::StridedBatchMatmulParam &opParam)
+{
+    JsonToField(paramsJson, "transposeA", opParam.transposeA);
+    JsonToField(paramsJson, "transposeB", opParam.transposeB);
+    JsonToField(paramsJson, "batch", opParam.batch);
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "m", opParam.m);
+    JsonToField(paramsJson, "n", opParam.n);
+    JsonToField(paramsJson, "k", opParam.k);
+    JsonToField(paramsJson, "lda", opParam.lda);
+    JsonToField(paramsJson, "ldb", opParam.ldb);
+    JsonToField(paramsJson, "ldc", opParam.ldc);
+    JsonToField(paramsJson, "strideA", opParam.strideA);
+    JsonToField(paramsJson, "strideB", opParam.strideB);
+    JsonToField(paramsJson, "strideC", opParam.strideC);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::TopkToppSamplingParam &opParam)
+{
+    JsonToField(paramsJson, "topkToppSamplingType", opParam.topkToppSamplingType);
+    JsonToField(paramsJson, "randSeeds", opParam.randSeeds);
+    JsonToField(paramsJson, "randSeed", opParam.randSeed);
+    JsonToField(paramsJson, "topk", opParam.topk);
+    JsonToField(paramsJson, "logProbsSize", opParam.logProbsSize);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::TransdataParam &opParam)
+{
+    JsonToField(paramsJson, "transdataType", opParam.transdataType);
+    JsonToField(paramsJson, "outCrops", opParam.outCrops);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::TransposeParam &opParam)
+{
+    JsonToField(paramsJson, "perm", opParam.perm);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::ReshapeAndCacheParam &opParam)
+{
+    JsonToField(paramsJson, "compressType", opParam.compressType);
+    JsonToField(paramsJson, "kvCacheCfg", opParam.kvCacheCfg);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::GatingParam &opParam)
+{
+    JsonToField(paramsJson, "topkExpertNum", opParam.topkExpertNum);
+    JsonToField(paramsJson, "cumSumNum", opParam.cumSumNum);
+    JsonToField(paramsJson, "deviceExpert", opParam.deviceExpert);
+    JsonToField(paramsJson, "cumSumInt64", opParam.cumSumInt64);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::SendParam &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "destRank", opParam.destRank);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::RecvParam &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "srcRank", opParam.srcRank);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::AllToAllParam &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+    JsonToField(paramsJson, "transpose", opParam.transpose);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::AllToAllVParam &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "sendCounts", opParam.sendCounts);
+    JsonToField(paramsJson, "sdispls", opParam.sdispls);
+    JsonToField(paramsJson, "recvCounts", opParam.recvCounts);
+    JsonToField(paramsJson, "rdispls", opParam.rdispls);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::AllToAllVV2Param &opParam)
+{
+    JsonToField(paramsJson, "rank", opParam.rank);
+    JsonToField(paramsJson, "rankSize", opParam.rankSize);
+    JsonToField(paramsJson, "rankRoot", opParam.rankRoot);
+    JsonToField(paramsJson, "backend", opParam.backend);
+    JsonToField(paramsJson, "commMode", opParam.commMode);
+    JsonToField(paramsJson, "rankTableFile", opParam.rankTableFile);
+    JsonToField(paramsJson, "commDomain", opParam.commDomain);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, train::LaserAttentionParam &opParam)
+{
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "inputLayout", opParam.inputLayout);
+    JsonToField(paramsJson, "scaleValue", opParam.scaleValue);
+    JsonToField(paramsJson, "keepProb", opParam.keepProb);
+    JsonToField(paramsJson, "preTokens", opParam.preTokens);
+    JsonToField(paramsJson, "nextTokens", opParam.nextTokens);
+    JsonToField(paramsJson, "sparseMode", opParam.sparseMode);
+    JsonToField(paramsJson, "innerPrecise", opParam.innerPrecise);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, train::LaserAttentionGradParam &opParam)
+{
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "inputLayout", opParam.inputLayout);
+    JsonToField(paramsJson, "scaleValue", opParam.scaleValue);
+    JsonToField(paramsJson, "keepProb", opParam.keepProb);
+    JsonToField(paramsJson, "preTokens", opParam.preTokens);
+    JsonToField(paramsJson, "nextTokens", opParam.nextTokens);
+    JsonToField(paramsJson, "sparseMode", opParam.sparseMode);
+    JsonToField(paramsJson, "innerPrecise", opParam.innerPrecise);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::GroupTopkParam &opParam)
+{
+    JsonToField(paramsJson, "groupNum", opParam.groupNum);
+    JsonToField(paramsJson, "k", opParam.k);
+    JsonToField(paramsJson, "groupMultiFlag", opParam.groupMultiFlag);
+    JsonToField(paramsJson, "n", opParam.n);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::GroupedMatmulWithRoutingParam &opParam)
+{
+    JsonToField(paramsJson, "transposeB", opParam.transposeB);
+    JsonToField(paramsJson, "topK", opParam.topK);
+    JsonToField(paramsJson, "moeType", opParam.groupedMatmulType);
+    JsonToField(paramsJson, "outDataType", opParam.outDataType);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::CohereLayerNormParam &opParam)
+{
+    JsonToField(paramsJson, "epsilon", opParam.epsilon);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::GatherPreRmsNormParam &opParam)
+{
+    JsonToField(paramsJson, "epsilon", opParam.epsilon);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::MlaPreprocessParam &opParam)
+{
+    JsonToField(paramsJson, "wdqDim", opParam.wdqDim);
+    JsonToField(paramsJson, "qRopeDim", opParam.qRopeDim);
+    JsonToField(paramsJson, "kRopeDim", opParam.kRopeDim);
+    JsonToField(paramsJson, "epsilon", opParam.epsilon);
+    JsonToField(paramsJson, "qRotaryCoeff", opParam.qRotaryCoeff);
+    JsonToField(paramsJson, "kRotaryCoeff", opParam.kRotaryCoeff);
+    JsonToField(paramsJson, "transposeWdq", opParam.transposeWdq);
+    JsonToField(paramsJson, "transposeWuq", opParam.transposeWuq);
+    JsonToField(paramsJson, "transposeWuk", opParam.transposeWuk);
+    JsonToField(paramsJson, "cacheMode", opParam.cacheMode);
+    JsonToField(paramsJson, "quantMode", opParam.quantMode);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::MultiLatentAttentionParam &opParam)
+{
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "qkScale", opParam.qkScale);
+    JsonToField(paramsJson, "kvHeadNum", opParam.kvHeadNum);
+    JsonToField(paramsJson, "maskType", opParam.maskType);
+    JsonToField(paramsJson, "calcType", opParam.calcType);
+    JsonToField(paramsJson, "cacheMode", opParam.cacheMode);
+    JsonToField(paramsJson, "windowSize", opParam.windowSize);
+    JsonToField(paramsJson, "maskUseStatusType", opParam.maskUseStatusType);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, common::EventParam &opParam)
+{
+    JsonToField(paramsJson, "operatorType", opParam.operatorType);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::NormRopeReshapeParam &opParam)
+{
+    JsonToField(paramsJson, "precisionMode", opParam.precisionMode);
+    JsonToField(paramsJson, "epsilon", opParam.epsilon);
+    JsonToField(paramsJson, "rotaryCoeff", opParam.rotaryCoeff);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::RopeQConcatParam &opParam)
+{
+    (void)paramsJson;
+    (void)opParam;
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::FusedAddTopkDivParam &opParam)
+{
+    JsonToField(paramsJson, "groupNum", opParam.groupNum);
+    JsonToField(paramsJson, "groupTopk", opParam.groupTopk);
+    JsonToField(paramsJson, "n", opParam.n);
+    JsonToField(paramsJson, "k", opParam.k);
+    JsonToField(paramsJson, "activationType", opParam.activationType);
+    JsonToField(paramsJson, "isNorm", opParam.isNorm);
+    JsonToField(paramsJson, "scale", opParam.scale);
+    JsonToField(paramsJson, "enableExpertMapping", opParam.enableExpertMapping);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::ReshapeAndCacheWithStrideParam &opParam)
+{
+    JsonToField(paramsJson, "compressType", opParam.compressType);
+    JsonToField(paramsJson, "kvCacheCfg", opParam.kvCacheCfg);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::RazorFusionAttentionParam &opParam)
+{
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "kvHeadNum", opParam.kvHeadNum);
+    JsonToField(paramsJson, "qkScale", opParam.qkScale);
+    JsonToField(paramsJson, "razorLen", opParam.razorLen);
+    JsonToField(paramsJson, "preTokens", opParam.preTokens);
+    JsonToField(paramsJson, "nextTokens", opParam.nextTokens);
+    JsonToField(paramsJson, "tileQ", opParam.tileQ);
+    JsonToField(paramsJson, "tileKv", opParam.tileKv);
+    JsonToField(paramsJson, "textQLen", opParam.textQLen);
+    JsonToField(paramsJson, "textKvLen", opParam.textKvLen);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::FaUpdateParam &opParam)
+{
+    JsonToField(paramsJson, "faUpdateType", opParam.faUpdateType);
+    JsonToField(paramsJson, "sp", opParam.sp);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::ScatterElementsV2Param &opParam)
+{
+    JsonToField(paramsJson, "axis", opParam.axis);
+    JsonToField(paramsJson, "reduction", opParam.reduction);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::GmmDeqSwigluQuantGmmDeqParam &opParam)
+{
+    JsonToField(paramsJson, "outputType", opParam.outputType);
+    JsonToField(paramsJson, "groupListType", opParam.groupListType);
+    JsonToField(paramsJson, "weightUpPermuteType", opParam.weightUpPermuteType);
+    JsonToField(paramsJson, "transposeWeightUp", opParam.transposeWeightUp);
+    JsonToField(paramsJson, "transposeWeightDown", opParam.transposeWeightDown);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::MmDeqSwigluQuantMmDeqParam &opParam)
+{
+    JsonToField(paramsJson, "outputType", opParam.outputType);
+    JsonToField(paramsJson, "weightUpPermuteType", opParam.weightUpPermuteType);
+    JsonToField(paramsJson, "transposeWeightUp", opParam.transposeWeightUp);
+    JsonToField(paramsJson, "transposeWeightDown", opParam.transposeWeightDown);
+}
+
+template <> void OpParamFromJson(const nlohmann::json &paramsJson, infer::RingMLAParam &opParam)
+{
+    JsonToField(paramsJson, "calcType", opParam.calcType);
+    JsonToField(paramsJson, "headNum", opParam.headNum);
+    JsonToField(paramsJson, "kvHeadNum", opParam.kvHeadNum);
+    JsonToField(paramsJson, "qkScale", opParam.qkScale);
+    JsonToField(paramsJson, "kernelType", opParam.kernelType);
+    JsonToField(paramsJson, "maskType", opParam.maskType);
+    JsonToField(paramsJson, "inputLayout", opParam.inputLayout);
+}
+} // namespace atb
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_PARAM_FROM_JSON_H
+#define ATB_PARAM_FROM_JSON_H
+#include <nlohmann/json.hpp>
+namespace atb {
+// OpParamToJson的逆过程，与param_to_json.cpp中的字段一一对应。
+// json中缺失的字段保持opParam原值，字段类型不匹配时抛出nlohmann::json::exception。
+// hcclComm、event等进程内句柄无法跨进程恢复，不做反序列化。
+template <typename OpParam> void OpParamFromJson(const nlohmann::json &paramsJson, OpParam &opParam);
+}
+#endif
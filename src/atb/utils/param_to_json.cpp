@@ -21,6 +21,7 @@ template <> nlohmann::json OpParamToJson(const infer::ActivationParam &opParam)
     paramsJson["activationType"] = opParam.activationType;
     paramsJson["scale"] = opParam.scale;
     paramsJson["dim"] = opParam.dim;
+    paramsJson["geluMode"] = opParam.geluMode;
 
     return paramsJson;
 }
@@ -237,6 +238,7 @@ template <> nlohmann::json OpParamToJson(const infer::LayerNormParam &opParam)
     normParam["epsilon"] = opParam.normParam.epsilon;
     normParam["beginNormAxis"] = opParam.normParam.beginNormAxis;
     normParam["beginParamsAxis"] = opParam.normParam.beginParamsAxis;
+    normParam["dynamicQuantType"] = opParam.normParam.dynamicQuantType;
 
     nlohmann::json preNormParam;
     preNormParam["quantType"] = opParam.preNormParam.quantType;
@@ -266,6 +268,7 @@ template <> nlohmann::json OpParamToJson(const infer::LayerNormWithStrideParam &
     normParam["epsilon"] = opParam.normParam.epsilon;
     normParam["beginNormAxis"] = opParam.normParam.beginNormAxis;
     normParam["beginParamsAxis"] = opParam.normParam.beginParamsAxis;
+    normParam["dynamicQuantType"] = opParam.normParam.dynamicQuantType;
 
     nlohmann::json preNormParam;
     preNormParam["quantType"] = opParam.preNormParam.quantType;
@@ -321,6 +324,11 @@ template <> nlohmann::json OpParamToJson(const infer::LinearParallelParam &opPar
     paramsJson["local_expert_nums"] = opParam.moeInfo.localExpertNums;
     paramsJson["epSize"] = opParam.moeInfo.epSize;
     paramsJson["tpSize"] = opParam.moeInfo.tpSize;
+    nlohmann::json twoDimTPInfoJson;
+    twoDimTPInfoJson["agDim"] = opParam.twoDimTPInfo.agDim;
+    twoDimTPInfoJson["rsDim"] = opParam.twoDimTPInfo.rsDim;
+    twoDimTPInfoJson["innerDimIsAg"] = opParam.twoDimTPInfo.innerDimIsAg;
+    paramsJson["twoDimTPInfo"] = twoDimTPInfoJson;
 
     return paramsJson;
 }
@@ -378,11 +386,14 @@ template <> nlohmann::json OpParamToJson(const infer::PagedAttentionParam &opPar
     paramsJson["maskType"] = opParam.maskType;
     paramsJson["batchRunStatusEnable"] = opParam.batchRunStatusEnable;
     paramsJson["quantType"] = opParam.quantType;
+    paramsJson["outDataType"] = opParam.outDataType;
     paramsJson["hasQuantOffset"] = opParam.hasQuantOffset;
     paramsJson["compressType"] = opParam.compressType;
     paramsJson["calcType"] = opParam.calcType;
-
+    paramsJson["scaleType"] = opParam.scaleType;
+    paramsJson["inputLayout"] = opParam.inputLayout;
     paramsJson["mlaVHeadSize"] = opParam.mlaVHeadSize;
+    paramsJson["qScale"] = opParam.qScale;
     return paramsJson;
 }
 
@@ -452,6 +463,7 @@ template <> nlohmann::json OpParamToJson(const infer::RmsNormWithStrideParam &op
     normParamJson["rstd"] = opParam.normParam.rstd;
     normParamJson["precisionMode"] = opParam.normParam.precisionMode;
     normParamJson["modelType"] = opParam.normParam.modelType;
+    normParamJson["dynamicQuantType"] = opParam.normParam.dynamicQuantType;
 
     nlohmann::json preNormParamJson;
     preNormParamJson["quantType"] = opParam.preNormParam.quantType;
@@ -623,6 +635,7 @@ template <> nlohmann::json OpParamToJson(const infer::GatingParam &opParam)
     gatingParamsJson["topkExpertNum"] = opParam.topkExpertNum;
     gatingParamsJson["cumSumNum"] = opParam.cumSumNum;
     gatingParamsJson["deviceExpert"] = opParam.deviceExpert;
+    gatingParamsJson["cumSumInt64"] = opParam.cumSumInt64;
 
     return gatingParamsJson;
 }
@@ -668,6 +681,7 @@ template <> nlohmann::json OpParamToJson(const infer::AllToAllParam &opParam)
     paramsJson["commMode"] = opParam.commMode;
     paramsJson["rankTableFile"] = opParam.rankTableFile;
     paramsJson["commDomain"] = opParam.commDomain;
+    paramsJson["transpose"] = opParam.transpose;
 
     return paramsJson;
 }
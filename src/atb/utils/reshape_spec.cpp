@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/utils/reshape_spec.h"
+#include <sstream>
+#include <stdexcept>
+#include "atb/utils/log.h"
+
+namespace atb {
+static constexpr int64_t INFER_DIM = -1;
+static const char *TYPE_NAMES[] = {"merge_dims", "split_dim", "view", "squeeze", "unsqueeze"};
+
+static void CheckSizes(const std::vector<int64_t> &sizes, bool allowZero, const std::string &name)
+{
+    if (sizes.empty() || sizes.size() > MAX_DIM) {
+        throw std::runtime_error(name + " sizes num should be in [1, " + std::to_string(MAX_DIM) + "], but get " +
+                                 std::to_string(sizes.size()));
+    }
+    size_t inferDimNum = 0;
+    for (int64_t size : sizes) {
+        if (size == INFER_DIM) {
+            inferDimNum++;
+        } else if (size < 0 || (size == 0 && !allowZero)) {
+            throw std::runtime_error(name + " get invalid size " + std::to_string(size));
+        }
+    }
+    if (inferDimNum > 1) {
+        throw std::runtime_error(name + " only one size can be -1");
+    }
+}
+
+// 将负数下标按维数归一化，越界返回false
+static bool NormalizeDim(int64_t dim, uint64_t dimNum, uint64_t &normalized)
+{
+    int64_t realDim = dim < 0 ? dim + static_cast<int64_t>(dimNum) : dim;
+    if (realDim < 0 || realDim >= static_cast<int64_t>(dimNum)) {
+        return false;
+    }
+    normalized = static_cast<uint64_t>(realDim);
+    return true;
+}
+
+// 将sizes中的-1按元素总数推导出来，写入newShape.dims[offset...]
+static bool FillSizes(const std::vector<int64_t> &sizes, int64_t numel, Dims &newShape, uint64_t offset)
+{
+    int64_t knownNumel = 1;
+    size_t inferIndex = sizes.size();
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        if (sizes[i] == INFER_DIM) {
+            inferIndex = i;
+        } else {
+            knownNumel *= newShape.dims[offset + i];
+        }
+    }
+    if (inferIndex != sizes.size()) {
+        if (knownNumel == 0 || numel % knownNumel != 0) {
+            return false;
+        }
+        newShape.dims[offset + inferIndex] = numel / knownNumel;
+        return true;
+    }
+    return knownNumel == numel;
+}
+
+ReshapeSpec::ReshapeSpec(Type type, int64_t dim, int64_t endDim, const std::vector<int64_t> &sizes)
+    : type_(type), dim_(dim), endDim_(endDim), sizes_(sizes)
+{
+}
+
+ReshapeSpec ReshapeSpec::MergeDims(int64_t start, int64_t end)
+{
+    if ((start >= 0) == (end >= 0) && start > end) {
+        throw std::runtime_error("merge_dims start should be <= end, but get start " + std::to_string(start) +
+                                 ", end " + std::to_string(end));
+    }
+    return ReshapeSpec(Type::MERGE_DIMS, start, end, {});
+}
+
+ReshapeSpec ReshapeSpec::SplitDim(int64_t dim, const std::vector<int64_t> &sizes)
+{
+    CheckSizes(sizes, false, "split_dim");
+    return ReshapeSpec(Type::SPLIT_DIM, dim, dim, sizes);
+}
+
+ReshapeSpec ReshapeSpec::View(const std::vector<int64_t> &shape)
+{
+    CheckSizes(shape, true, "view");
+    return ReshapeSpec(Type::VIEW, 0, 0, shape);
+}
+
+ReshapeSpec ReshapeSpec::Squeeze(int64_t dim)
+{
+    return ReshapeSpec(Type::SQUEEZE, dim, dim, {});
+}
+
+ReshapeSpec ReshapeSpec::Unsqueeze(int64_t dim)
+{
+    return ReshapeSpec(Type::UNSQUEEZE, dim, dim, {});
+}
+
+bool ReshapeSpec::Apply(const Dims &oldShape, Dims &newShape) const
+{
+    if (oldShape.dimNum > MAX_DIM) {
+        return false;
+    }
+    switch (type_) {
+        case Type::MERGE_DIMS:
+            return ApplyMergeDims(oldShape, newShape);
+        case Type::SPLIT_DIM:
+            return ApplySplitDim(oldShape, newShape);
+        case Type::VIEW:
+            return ApplyView(oldShape, newShape);
+        case Type::SQUEEZE:
+            return ApplySqueeze(oldShape, newShape);
+        case Type::UNSQUEEZE:
+            return ApplyUnsqueeze(oldShape, newShape);
+        default:
+            return false;
+    }
+}
+
+bool ReshapeSpec::ApplyMergeDims(const Dims &oldShape, Dims &newShape) const
+{
+    uint64_t start = 0;
+    uint64_t end = 0;
+    if (!NormalizeDim(dim_, oldShape.dimNum, start) || !NormalizeDim(endDim_, oldShape.dimNum, end) || start > end) {
+        return false;
+    }
+    newShape.dimNum = oldShape.dimNum - (end - start);
+    for (uint64_t i = 0; i < start; ++i) {
+        newShape.dims[i] = oldShape.dims[i];
+    }
+    newShape.dims[start] = 1;
+    for (uint64_t i = start; i <= end; ++i) {
+        newShape.dims[start] *= oldShape.dims[i];
+    }
+    for (uint64_t i = end + 1; i < oldShape.dimNum; ++i) {
+        newShape.dims[i - (end - start)] = oldShape.dims[i];
+    }
+    return true;
+}
+
+bool ReshapeSpec::ApplySplitDim(const Dims &oldShape, Dims &newShape) const
+{
+    uint64_t dim = 0;
+    if (!NormalizeDim(dim_, oldShape.dimNum, dim) || oldShape.dimNum - 1 + sizes_.size() > MAX_DIM) {
+        return false;
+    }
+    newShape.dimNum = oldShape.dimNum - 1 + sizes_.size();
+    for (uint64_t i = 0; i < dim; ++i) {
+        newShape.dims[i] = oldShape.dims[i];
+    }
+    for (size_t i = 0; i < sizes_.size(); ++i) {
+        newShape.dims[dim + i] = sizes_[i];
+    }
+    for (uint64_t i = dim + 1; i < oldShape.dimNum; ++i) {
+        newShape.dims[i - 1 + sizes_.size()] = oldShape.dims[i];
+    }
+    return FillSizes(sizes_, oldShape.dims[dim], newShape, dim);
+}
+
+bool ReshapeSpec::ApplyView(const Dims &oldShape, Dims &newShape) const
+{
+    int64_t numel = 1;
+    for (uint64_t i = 0; i < oldShape.dimNum; ++i) {
+        numel *= oldShape.dims[i];
+    }
+    newShape.dimNum = sizes_.size();
+    for (size_t i = 0; i < sizes_.size(); ++i) {
+        if (sizes_[i] == 0) {
+            if (i >= oldShape.dimNum) {
+                return false;
+            }
+            newShape.dims[i] = oldShape.dims[i];
+        } else {
+            newShape.dims[i] = sizes_[i];
+        }
+    }
+    return FillSizes(sizes_, numel, newShape, 0);
+}
+
+bool ReshapeSpec::ApplySqueeze(const Dims &oldShape, Dims &newShape) const
+{
+    uint64_t dim = 0;
+    if (!NormalizeDim(dim_, oldShape.dimNum, dim) || oldShape.dims[dim] != 1 || oldShape.dimNum == 1) {
+        return false;
+    }
+    newShape.dimNum = oldShape.dimNum - 1;
+    for (uint64_t i = 0; i < oldShape.dimNum; ++i) {
+        if (i != dim) {
+            newShape.dims[i < dim ? i : i - 1] = oldShape.dims[i];
+        }
+    }
+    return true;
+}
+
+bool ReshapeSpec::ApplyUnsqueeze(const Dims &oldShape, Dims &newShape) const
+{
+    uint64_t dim = 0;
+    if (oldShape.dimNum >= MAX_DIM || !NormalizeDim(dim_, oldShape.dimNum + 1, dim)) {
+        return false;
+    }
+    newShape.dimNum = oldShape.dimNum + 1;
+    for (uint64_t i = 0; i < newShape.dimNum; ++i) {
+        newShape.dims[i] = i < dim ? oldShape.dims[i] : (i == dim ? 1 : oldShape.dims[i - 1]);
+    }
+    return true;
+}
+
+void ReshapeSpec::operator()(const Dims &oldShape, Dims &newShape) const
+{
+    if (!Apply(oldShape, newShape)) {
+        // 置为空shape，由GraphRunner的元素个数校验报错
+        ATB_LOG(ERROR) << "reshape spec " << ToString() << " can not apply to shape with dimNum " << oldShape.dimNum;
+        newShape.dimNum = 0;
+    }
+}
+
+ReshapeFunc ReshapeSpec::ToReshapeFunc() const
+{
+    return ReshapeFunc(*this);
+}
+
+const ReshapeSpec *ReshapeSpec::FromReshapeFunc(const ReshapeFunc &reshapeFunc)
+{
+    return reshapeFunc.target<ReshapeSpec>();
+}
+
+nlohmann::json ReshapeSpec::ToJson() const
+{
+    nlohmann::json specJson;
+    specJson["type"] = TYPE_NAMES[static_cast<int>(type_)];
+    specJson["dim"] = dim_;
+    specJson["endDim"] = endDim_;
+    specJson["sizes"] = sizes_;
+    return specJson;
+}
+
+ReshapeSpec ReshapeSpec::FromJson(const nlohmann::json &specJson)
+{
+    std::string typeName = specJson.at("type").get<std::string>();
+    int64_t dim = specJson.at("dim").get<int64_t>();
+    if (typeName == TYPE_NAMES[static_cast<int>(Type::MERGE_DIMS)]) {
+        return MergeDims(dim, specJson.at("endDim").get<int64_t>());
+    } else if (typeName == TYPE_NAMES[static_cast<int>(Type::SPLIT_DIM)]) {
+        return SplitDim(dim, specJson.at("sizes").get<std::vector<int64_t>>());
+    } else if (typeName == TYPE_NAMES[static_cast<int>(Type::VIEW)]) {
+        return View(specJson.at("sizes").get<std::vector<int64_t>>());
+    } else if (typeName == TYPE_NAMES[static_cast<int>(Type::SQUEEZE)]) {
+        return Squeeze(dim);
+    } else if (typeName == TYPE_NAMES[static_cast<int>(Type::UNSQUEEZE)]) {
+        return Unsqueeze(dim);
+    }
+    throw std::runtime_error("unknown reshape spec type " + typeName);
+}
+
+std::string ReshapeSpec::ToString() const
+{
+    std::stringstream ss;
+    ss << TYPE_NAMES[static_cast<int>(type_)] << "(";
+    switch (type_) {
+        case Type::MERGE_DIMS:
+            ss << dim_ << ", " << endDim_;
+            break;
+        case Type::SPLIT_DIM:
+            ss << dim_ << ", ";
+            break;
+        case Type::SQUEEZE:
+        case Type::UNSQUEEZE:
+            ss << dim_;
+            break;
+        default:
+            break;
+    }
+    if (!sizes_.empty()) {
+        ss << "[";
+        for (size_t i = 0; i < sizes_.size(); ++i) {
+            ss << (i == 0 ? "" : ", ") << sizes_[i];
+        }
+        ss << "]";
+    }
+    ss << ")";
+    return ss.str();
+}
+} // namespace atb
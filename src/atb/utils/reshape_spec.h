@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_RESHAPE_SPEC_H
+#define ATB_RESHAPE_SPEC_H
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "atb/types.h"
+
+namespace atb {
+// 声明式的reshape规则，在C++侧直接计算新shape，Setup时无需回调Python，也不需要持有GIL。
+// 规则本身可序列化，图算子保存时据此还原Node的inTensorReshapeFuncs。dim均支持负数下标，按原shape的维数归一化。
+class ReshapeSpec {
+public:
+    enum class Type : int {
+        MERGE_DIMS = 0, // 合并[start, end]闭区间内的维度
+        SPLIT_DIM,      // 将dim拆分为sizes，sizes中最多一个-1
+        VIEW,           // 直接指定新shape，最多一个-1，0表示沿用原shape同位置的维度
+        SQUEEZE,        // 去掉大小为1的dim
+        UNSQUEEZE,      // 在dim处插入大小为1的维度，dim按新shape的维数归一化
+    };
+
+    static ReshapeSpec MergeDims(int64_t start, int64_t end);
+    static ReshapeSpec SplitDim(int64_t dim, const std::vector<int64_t> &sizes);
+    static ReshapeSpec View(const std::vector<int64_t> &shape);
+    static ReshapeSpec Squeeze(int64_t dim);
+    static ReshapeSpec Unsqueeze(int64_t dim);
+
+    // 由ToJson的结果重建规则，json非法时抛出异常
+    static ReshapeSpec FromJson(const nlohmann::json &specJson);
+    // reshapeFunc由ToReshapeFunc生成时返回对应的规则，否则返回nullptr
+    static const ReshapeSpec *FromReshapeFunc(const ReshapeFunc &reshapeFunc);
+
+    // 计算新shape，规则不适用于oldShape时返回false
+    bool Apply(const Dims &oldShape, Dims &newShape) const;
+    // 作为ReshapeFunc调用，规则不适用时将newShape置为空shape
+    void operator()(const Dims &oldShape, Dims &newShape) const;
+    ReshapeFunc ToReshapeFunc() const;
+    nlohmann::json ToJson() const;
+    std::string ToString() const;
+
+private:
+    ReshapeSpec(Type type, int64_t dim, int64_t endDim, const std::vector<int64_t> &sizes);
+    bool ApplyMergeDims(const Dims &oldShape, Dims &newShape) const;
+    bool ApplySplitDim(const Dims &oldShape, Dims &newShape) const;
+    bool ApplyView(const Dims &oldShape, Dims &newShape) const;
+    bool ApplySqueeze(const Dims &oldShape, Dims &newShape) const;
+    bool ApplyUnsqueeze(const Dims &oldShape, Dims &newShape) const;
+
+private:
+    Type type_ = Type::VIEW;
+    int64_t dim_ = 0;
+    int64_t endDim_ = 0;
+    std::vector<int64_t> sizes_;
+};
+} // namespace atb
+#endif
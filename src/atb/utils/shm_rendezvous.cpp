@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/utils/shm_rendezvous.h"
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <ctime>
+#include <csignal>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "atb/utils/log.h"
+
+namespace atb {
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be 32 bit");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "futex word must be lock free");
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "arrival time must be lock free");
+static constexpr uint64_t NS_PER_MS = 1000000;
+static constexpr uint64_t NS_PER_SECOND = 1000000000;
+
+static uint64_t GetMonotonicNs()
+{
+    struct timespec ts = {};
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * NS_PER_SECOND + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// 共享内存跨进程使用，不能用FUTEX_PRIVATE_FLAG
+static long FutexWait(std::atomic<uint32_t> &word, uint32_t value, const struct timespec *timeout)
+{
+    return syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, value, timeout, nullptr, 0);
+}
+
+static void FutexWakeAll(std::atomic<uint32_t> &word)
+{
+    (void)syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+static bool IsProcessAlive(uint32_t pid)
+{
+    if (pid == 0) {
+        return false;
+    }
+    // EPERM表示进程存在但无权发送信号
+    return kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+}
+
+size_t ShmRendezvous::GetShmSize(int32_t rankSize, size_t payloadSize)
+{
+    return sizeof(ShmRendezvousHeader) + static_cast<size_t>(rankSize) * sizeof(std::atomic<uint64_t>) +
+           payloadSize;
+}
+
+ShmRendezvous::ShmRendezvous(void *shm, int32_t rank, int32_t rankSize, size_t payloadSize)
+    : header_(static_cast<ShmRendezvousHeader *>(shm)), rank_(rank), rankSize_(rankSize), payloadSize_(payloadSize)
+{
+    uint8_t *base = static_cast<uint8_t *>(shm);
+    arrivalTimes_ = reinterpret_cast<std::atomic<uint64_t> *>(base + sizeof(ShmRendezvousHeader));
+    payload_ = base + sizeof(ShmRendezvousHeader) + static_cast<size_t>(rankSize) * sizeof(std::atomic<uint64_t>);
+    // 上一轮的barrier只有在所有rank到达后才会推进轮次，因此进入本轮时读到的一定是本轮轮次
+    generation_ = header_->barrierGeneration.load(std::memory_order_acquire);
+}
+
+void ShmRendezvous::Publish(const void *payload)
+{
+    // 其他rank需等到本次发布后才进入Barrier，此时的到达计数只可能是崩溃的建链残留的
+    header_->arrivedNum.store(0, std::memory_order_relaxed);
+    if (payloadSize_ > 0) {
+        (void)memcpy(payload_, payload, payloadSize_);
+    }
+    header_->publisherPid.store(static_cast<uint32_t>(getpid()), std::memory_order_release);
+    header_->publishGeneration.store(generation_ + 1, std::memory_order_release);
+    FutexWakeAll(header_->publisherPid);
+    FutexWakeAll(header_->publishGeneration);
+}
+
+bool ShmRendezvous::WaitPublished(void *payload, uint64_t timeoutMs)
+{
+    uint64_t deadlineNs = GetMonotonicNs() + timeoutMs * NS_PER_MS;
+    while (true) {
+        uint32_t published = header_->publishGeneration.load(std::memory_order_acquire);
+        std::atomic<uint32_t> *waitWord = &header_->publishGeneration;
+        uint32_t waitValue = published;
+        if (published == generation_ + 1) {
+            uint32_t publisherPid = header_->publisherPid.load(std::memory_order_acquire);
+            if (IsProcessAlive(publisherPid)) {
+                break;
+            }
+            // 发布者已退出，是崩溃的建链留下的标记，本轮root重新发布时会改写publisherPid
+            ATB_LOG(WARN) << "rendezvous ignore stale publish of exited process:" << publisherPid << ", rank:" << rank_;
+            waitWord = &header_->publisherPid;
+            waitValue = publisherPid;
+        }
+        if (!WaitWhileEqual(*waitWord, waitValue, deadlineNs)) {
+            ATB_LOG(ERROR) << "rendezvous wait published timeout, rank:" << rank_ << ", generation:" << generation_;
+            return false;
+        }
+    }
+    if (payloadSize_ > 0) {
+        (void)memcpy(payload, payload_, payloadSize_);
+    }
+    return true;
+}
+
+bool ShmRendezvous::Barrier(uint64_t timeoutMs)
+{
+    uint64_t deadlineNs = GetMonotonicNs() + timeoutMs * NS_PER_MS;
+    arrivalTimes_[rank_].store(GetMonotonicNs(), std::memory_order_relaxed);
+    uint32_t arrivedNum = header_->arrivedNum.fetch_add(1, std::memory_order_acq_rel) + 1;
+    if (arrivedNum == static_cast<uint32_t>(rankSize_)) {
+        // 最后一个到达的rank复位计数并推进轮次，复位必须发生在推进轮次之前
+        header_->arrivedNum.store(0, std::memory_order_relaxed);
+        header_->barrierGeneration.store(generation_ + 1, std::memory_order_release);
+        FutexWakeAll(header_->barrierGeneration);
+    } else {
+        while (header_->barrierGeneration.load(std::memory_order_acquire) == generation_) {
+            if (!WaitWhileEqual(header_->barrierGeneration, generation_, deadlineNs)) {
+                ATB_LOG(ERROR) << "rendezvous barrier timeout, rank:" << rank_ << ", arrived:"
+                               << header_->arrivedNum.load(std::memory_order_relaxed) << "/" << rankSize_;
+                return false;
+            }
+        }
+    }
+    generation_++;
+    return true;
+}
+
+bool ShmRendezvous::WaitWhileEqual(std::atomic<uint32_t> &word, uint32_t value, uint64_t deadlineNs) const
+{
+    uint64_t nowNs = GetMonotonicNs();
+    if (nowNs >= deadlineNs) {
+        return false;
+    }
+    uint64_t leftNs = deadlineNs - nowNs;
+    struct timespec timeout = {};
+    timeout.tv_sec = static_cast<time_t>(leftNs / NS_PER_SECOND);
+    timeout.tv_nsec = static_cast<long>(leftNs % NS_PER_SECOND);
+    // EAGAIN表示值已变化，EINTR与虚假唤醒由调用方重新检查
+    if (FutexWait(word, value, &timeout) != 0 && errno != EAGAIN && errno != EINTR && errno != ETIMEDOUT) {
+        ATB_LOG(ERROR) << "futex wait fail, errno:" << errno;
+        return false;
+    }
+    return true;
+}
+
+std::vector<uint64_t> ShmRendezvous::GetArrivalTimes() const
+{
+    std::vector<uint64_t> arrivalTimes(static_cast<size_t>(rankSize_));
+    for (int32_t i = 0; i < rankSize_; ++i) {
+        arrivalTimes.at(static_cast<size_t>(i)) = arrivalTimes_[i].load(std::memory_order_relaxed);
+    }
+    return arrivalTimes;
+}
+
+uint32_t ShmRendezvous::GetGeneration() const
+{
+    return generation_;
+}
+} // namespace atb
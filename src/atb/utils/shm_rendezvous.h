@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_SHM_RENDEZVOUS_H
+#define ATB_SHM_RENDEZVOUS_H
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace atb {
+struct ShmRendezvousHeader {
+    std::atomic<uint32_t> publishGeneration; // futex字，root发布payload后置为当前轮次+1
+    std::atomic<uint32_t> barrierGeneration; // futex字，所有rank到达barrier后加1，即当前轮次
+    std::atomic<uint32_t> arrivedNum;        // 当前轮次已到达barrier的rank数
+    std::atomic<uint32_t> publisherPid;      // futex字，发布payload的root进程号，用于识别崩溃进程留下的发布标记
+};
+
+// 基于进程间共享futex的多进程汇合原语，用于通信域建立时root下发payload以及全体barrier。
+// 共享内存布局为：ShmRendezvousHeader | 各rank到达barrier的时间 | payload，要求共享内存初始全0。
+// 同一块共享内存可被多轮复用：每轮开始时从barrierGeneration读取轮次，已完成轮次留下的标记不会被误认。
+// 建链中途崩溃时，barrierGeneration未推进，残留的发布标记与本轮轮次相同：等待方发现发布者进程已退出时不采用该标记，
+// 继续等待本轮root重新发布；root发布前清零残留的到达计数。发布者进程号被复用时仍可能误认，此时需删除该共享内存。
+// 等待方阻塞在futex上，不占用CPU也不争抢锁。
+class ShmRendezvous {
+public:
+    static size_t GetShmSize(int32_t rankSize, size_t payloadSize);
+    ShmRendezvous(void *shm, int32_t rank, int32_t rankSize, size_t payloadSize);
+    ShmRendezvous(const ShmRendezvous &other) = delete;
+    ShmRendezvous &operator=(const ShmRendezvous &other) = delete;
+    // root写入payload并唤醒所有等待的rank，调用时本轮其他rank尚未进入Barrier
+    void Publish(const void *payload);
+    // 阻塞等待root发布本轮payload并拷贝到payload中，超时返回false
+    bool WaitPublished(void *payload, uint64_t timeoutMs);
+    // 阻塞等待所有rank到达，超时返回false；成功后进入下一轮
+    bool Barrier(uint64_t timeoutMs);
+    // 最近一次Barrier中各rank的到达时间，CLOCK_MONOTONIC纳秒
+    std::vector<uint64_t> GetArrivalTimes() const;
+    uint32_t GetGeneration() const;
+
+private:
+    bool WaitWhileEqual(std::atomic<uint32_t> &word, uint32_t value, uint64_t deadlineNs) const;
+
+private:
+    ShmRendezvousHeader *header_ = nullptr;
+    std::atomic<uint64_t> *arrivalTimes_ = nullptr;
+    uint8_t *payload_ = nullptr;
+    int32_t rank_ = 0;
+    int32_t rankSize_ = 0;
+    size_t payloadSize_ = 0;
+    uint32_t generation_ = 0;
+};
+} // namespace atb
+#endif
@@ -26,10 +26,28 @@ std::string OpSetupStatistic::ToString() const
            ", tilingCacheMissCount:" + std::to_string(tilingCacheMissCount) +
            ", tilingLocalCacheHitCount:" + std::to_string(tilingLocalCacheHitCount) +
            ", tilingGlobalCacheHitCount:" + std::to_string(tilingGlobalCacheHitCount) +
+           ", tilingSharedCacheHitCount:" + std::to_string(tilingSharedCacheHitCount) +
            ", kernelCacheGetTilingTime:" + std::to_string(kernelCacheGetTilingTime) +
            ", kernelCacheAddTilingTime:" + std::to_string(kernelCacheAddTilingTime) +
            ", kernelCacheCompareRunInfoTime:" + std::to_string(kernelCacheCompareRunInfoTime) +
-           ", kernelCacheGetRunInfoTime:" + std::to_string(kernelCacheGetRunInfoTime);
+           ", kernelCacheGetRunInfoTime:" + std::to_string(kernelCacheGetRunInfoTime) +
+           ", kernelCacheLocalMemorySize:" + std::to_string(kernelCacheLocalMemorySize) +
+           ", kernelCacheGlobalMemorySize:" + std::to_string(kernelCacheGlobalMemorySize) +
+           ", kernelCacheInternedKernelCount:" + std::to_string(kernelCacheInternedKernelCount) +
+           ", tilingParallelFillCount:" + std::to_string(tilingParallelFillCount) +
+           ", tilingParallelFillTime:" + std::to_string(tilingParallelFillTime) +
+           ", tilingParallelFillSerialTime:" + std::to_string(tilingParallelFillSerialTime) +
+           ", tilingParallelFillSpeedup:" + std::to_string(GetTilingParallelFillSpeedup()) +
+           ", inferShapeCacheHitCount:" + std::to_string(inferShapeCacheHitCount) +
+           ", inferShapeCacheMissCount:" + std::to_string(inferShapeCacheMissCount);
+}
+
+double OpSetupStatistic::GetTilingParallelFillSpeedup() const
+{
+    if (tilingParallelFillTime == 0) {
+        return 0;
+    }
+    return static_cast<double>(tilingParallelFillSerialTime) / static_cast<double>(tilingParallelFillTime);
 }
 
 void OpSetupStatistic::Reset()
@@ -43,6 +61,7 @@ void OpSetupStatistic::Reset()
     setupCacheMissCount = 0;
     tilingLocalCacheHitCount = 0;
     tilingGlobalCacheHitCount = 0;
+    tilingSharedCacheHitCount = 0;
     opsInitLuanchBufferTime = 0;
     tilingCacheHitCount = 0;
     tilingCacheMissCount = 0;
@@ -50,6 +69,14 @@ void OpSetupStatistic::Reset()
     kernelCacheAddTilingTime = 0;
     kernelCacheCompareRunInfoTime = 0;
     kernelCacheGetRunInfoTime = 0;
+    kernelCacheLocalMemorySize = 0;
+    kernelCacheGlobalMemorySize = 0;
+    kernelCacheInternedKernelCount = 0;
+    tilingParallelFillCount = 0;
+    tilingParallelFillTime = 0;
+    tilingParallelFillSerialTime = 0;
+    inferShapeCacheHitCount = 0;
+    inferShapeCacheMissCount = 0;
 }
 
 
@@ -72,6 +99,12 @@ void OpExecuteStatistic::Reset()
     preLaunchTime = 0;
 }
 
+std::string GraphCaptureStatistic::ToString() const
+{
+    return "captureCount:" + std::to_string(captureCount) + ", replayCount:" + std::to_string(replayCount) +
+           ", evictCount:" + std::to_string(evictCount);
+}
+
 OpSetupStatistic &GetOpSetupStatistic()
 {
     return g_opSetupStatistic;
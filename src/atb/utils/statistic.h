@@ -25,13 +25,23 @@ struct OpSetupStatistic {
     uint64_t tilingCacheHitCount = 0;
     uint64_t tilingCacheMissCount = 0;
     uint64_t tilingLocalCacheHitCount = 0;
-    uint64_t tilingGlobalCacheHitCount = 0;
+    uint64_t tilingGlobalCacheHitCount = 0;      // 当前线程的全局缓存(L1)命中次数
+    uint64_t tilingSharedCacheHitCount = 0;      // 进程级共享缓存(L2)命中次数
     uint64_t kernelCacheGetTilingTime = 0;
     uint64_t kernelCacheAddTilingTime = 0;
     uint64_t kernelCacheCompareRunInfoTime = 0;
     uint64_t kernelCacheGetRunInfoTime = 0;
+    uint64_t kernelCacheLocalMemorySize = 0;     // 最近一次更新的runner的本地kernel cache内存占用(字节)
+    uint64_t kernelCacheGlobalMemorySize = 0;    // 最近一次更新的runner的全局kernel cache内存占用(字节)
+    uint64_t kernelCacheInternedKernelCount = 0; // 进程内驻留的共享kernel个数
+    uint64_t tilingParallelFillCount = 0;      // 并行填充tiling的次数
+    uint64_t tilingParallelFillTime = 0;       // 并行填充tiling的墙上时间
+    uint64_t tilingParallelFillSerialTime = 0; // 并行填充中各节点耗时之和，即串行填充的估计耗时
+    uint64_t inferShapeCacheHitCount = 0;      // InferShape命中Operation结果缓存的次数
+    uint64_t inferShapeCacheMissCount = 0;     // InferShape未命中缓存、完整执行校验与推导的次数
 
     std::string ToString() const;
+    double GetTilingParallelFillSpeedup() const;
     void Reset();
 };
 
@@ -46,6 +56,14 @@ struct OpExecuteStatistic {
     void Reset();
 };
 
+// 整图下发模式下单个Operation的模型捕获统计
+struct GraphCaptureStatistic {
+    uint64_t captureCount = 0; // 捕获模型的次数
+    uint64_t replayCount = 0;  // 重放已捕获模型的次数
+    uint64_t evictCount = 0;   // 超出缓存个数淘汰模型的次数
+    std::string ToString() const;
+};
+
 OpSetupStatistic &GetOpSetupStatistic();
 OpExecuteStatistic &GetOpExecuteStatistic();
 } // namespace atb
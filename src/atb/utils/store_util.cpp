@@ -17,6 +17,8 @@
 #include "atb/utils/probe.h"
 #include "atb/utils/disk_util.h"
 #include "atb/utils/tensor_util.h"
+#include "atb/utils/async_dumper.h"
+#include "atb/utils/singleton.h"
 
 namespace atb {
 static const char *TENSOR_FILE_NAME_EXT = ".bin";
@@ -52,9 +54,14 @@ void StoreUtil::WriteFile(const uint8_t *data, uint64_t dataLen, const std::stri
     ATB_LOG(INFO) << "write filePath:" << filePath << " success";
 }
 
-void StoreUtil::SaveVariantPack(aclrtStream stream, const VariantPack &variantPack, const std::string &dirPath)
+void StoreUtil::SaveVariantPack(aclrtStream stream, const VariantPack &variantPack, const std::string &dirPath,
+                                bool sampled)
 {
-    if (Probe::IsSaveTensorData()) {
+    if (!sampled) {
+        return;
+    }
+    bool asyncDump = GetSingleton<AsyncDumper>().IsEnable();
+    if (!asyncDump && Probe::IsSaveTensorData()) {
         int ret = aclrtSynchronizeStream(stream);
         ATB_LOG_IF(ret != 0, ERROR) << "aclrtSynchronizeStream fail, ret:" << ret;
     }
@@ -62,20 +69,24 @@ void StoreUtil::SaveVariantPack(aclrtStream stream, const VariantPack &variantPa
     for (size_t i = 0; i < variantPack.inTensors.size(); ++i) {
         std::string fileName = "intensor" + std::to_string(i) + TENSOR_FILE_NAME_EXT;
         std::string filePath = Mki::FileSystem::Join({dirPath, fileName});
-        SaveTensor(variantPack.inTensors.at(i), filePath);
+        SaveTensor(stream, asyncDump, variantPack.inTensors.at(i), filePath);
     }
 
     for (size_t i = 0; i < variantPack.outTensors.size(); ++i) {
         std::string fileName = "outtensor" + std::to_string(i) + TENSOR_FILE_NAME_EXT;
         std::string filePath = Mki::FileSystem::Join({dirPath, fileName});
-        SaveTensor(variantPack.outTensors.at(i), filePath);
+        SaveTensor(stream, asyncDump, variantPack.outTensors.at(i), filePath);
     }
 }
 
 void StoreUtil::SaveVariantPack(aclrtStream stream, const RunnerVariantPack &runnerVariantPack,
-                                const std::string &dirPath)
+                                const std::string &dirPath, bool sampled)
 {
-    if (Probe::IsSaveTensorData()) {
+    if (!sampled) {
+        return;
+    }
+    bool asyncDump = GetSingleton<AsyncDumper>().IsEnable();
+    if (!asyncDump && Probe::IsSaveTensorData()) {
         int ret = aclrtSynchronizeStream(stream);
         ATB_LOG_IF(ret != 0, ERROR) << "aclrtSynchronizeStream fail, ret:" << ret;
     }
@@ -83,46 +94,55 @@ void StoreUtil::SaveVariantPack(aclrtStream stream, const RunnerVariantPack &run
     for (size_t i = 0; i < runnerVariantPack.inTensors.size(); ++i) {
         std::string fileName = "intensor" + std::to_string(i) + TENSOR_FILE_NAME_EXT;
         std::string filePath = Mki::FileSystem::Join({dirPath, fileName});
-        SaveTensor(runnerVariantPack.inTensors.at(i), filePath);
+        SaveTensor(stream, asyncDump, runnerVariantPack.inTensors.at(i), filePath);
     }
 
     for (size_t i = 0; i < runnerVariantPack.outTensors.size(); ++i) {
         std::string fileName = "outtensor" + std::to_string(i) + TENSOR_FILE_NAME_EXT;
         std::string filePath = Mki::FileSystem::Join({dirPath, fileName});
-        SaveTensor(runnerVariantPack.outTensors.at(i), filePath);
+        SaveTensor(stream, asyncDump, runnerVariantPack.outTensors.at(i), filePath);
     }
 }
 
 void StoreUtil::SaveVariantPack(aclrtStream stream, const RunnerVariantPack &runnerVariantPack,
-                                const std::string &dirPath, const Mki::OperationIr *operationIr)
+                                const std::string &dirPath, const OperationIr *operationIr, bool sampled)
 {
     if (!operationIr) {
-        SaveVariantPack(stream, runnerVariantPack, dirPath);
+        SaveVariantPack(stream, runnerVariantPack, dirPath, sampled);
         return;
     }
-    if (Probe::IsSaveTensorData()) {
+    if (!sampled) {
+        return;
+    }
+    bool asyncDump = GetSingleton<AsyncDumper>().IsEnable();
+    if (!asyncDump && Probe::IsSaveTensorData()) {
         int ret = aclrtSynchronizeStream(stream);
         ATB_LOG_IF(ret != 0, ERROR) << "aclrtSynchronizeStream fail, ret:" << ret;
     }
 
-    const Mki::SVector<Mki::TensorInfoIr> inTensorInfoIrs = operationIr->GetInTensorInfoIrs();
-    const Mki::SVector<Mki::TensorInfoIr> outTensorInfoIrs = operationIr->GetOutTensorInfoIrs();
     for (size_t i = 0; i < runnerVariantPack.inTensors.size(); ++i) {
-        std::string fileName = "intensor" + std::to_string(i) + "_" + inTensorInfoIrs.at(i).name + TENSOR_FILE_NAME_EXT;
+        std::string tensorName = i < operationIr->GetInTensorNum() ? operationIr->GetInTensorInfoIr(i).name : "";
+        std::string fileName = "intensor" + std::to_string(i) + "_" + tensorName + TENSOR_FILE_NAME_EXT;
         std::string filePath = Mki::FileSystem::Join({dirPath, fileName});
-        SaveTensor(runnerVariantPack.inTensors.at(i), filePath);
+        SaveTensor(stream, asyncDump, runnerVariantPack.inTensors.at(i), filePath);
     }
 
     for (size_t i = 0; i < runnerVariantPack.outTensors.size(); ++i) {
-        std::string fileName = "outtensor" + std::to_string(i) + "_" + outTensorInfoIrs.at(i).name + TENSOR_FILE_NAME_EXT;
+        std::string tensorName = i < operationIr->GetOutTensorNum() ? operationIr->GetOutTensorInfoIr(i).name : "";
+        std::string fileName = "outtensor" + std::to_string(i) + "_" + tensorName + TENSOR_FILE_NAME_EXT;
         std::string filePath = Mki::FileSystem::Join({dirPath, fileName});
-        SaveTensor(runnerVariantPack.outTensors.at(i), filePath);
+        SaveTensor(stream, asyncDump, runnerVariantPack.outTensors.at(i), filePath);
     }
 }
 
-void StoreUtil::SaveLaunchParam(aclrtStream stream, const Mki::LaunchParam &launchParam, const std::string &dirPath)
+void StoreUtil::SaveLaunchParam(aclrtStream stream, const Mki::LaunchParam &launchParam, const std::string &dirPath,
+                                bool sampled)
 {
-    if (Probe::IsSaveTensorData()) {
+    if (!sampled) {
+        return;
+    }
+    bool asyncDump = GetSingleton<AsyncDumper>().IsEnable();
+    if (!asyncDump && Probe::IsSaveTensorData()) {
         int ret = aclrtSynchronizeStream(stream);
         ATB_LOG_IF(ret != 0, ERROR) << "aclrtSynchronizeStream fail, ret:" << ret;
     }
@@ -130,14 +150,37 @@ void StoreUtil::SaveLaunchParam(aclrtStream stream, const Mki::LaunchParam &laun
     for (size_t i = 0; i < launchParam.GetInTensorCount(); ++i) {
         std::string fileName = "intensor" + std::to_string(i) + TENSOR_FILE_NAME_EXT;
         std::string filePath = Mki::FileSystem::Join({dirPath, fileName});
-        SaveTensor(launchParam.GetInTensor(i), filePath);
+        SaveTensor(stream, asyncDump, launchParam.GetInTensor(i), filePath);
     }
 
     for (size_t i = 0; i < launchParam.GetOutTensorCount(); ++i) {
         std::string fileName = "outtensor" + std::to_string(i) + TENSOR_FILE_NAME_EXT;
         std::string filePath = Mki::FileSystem::Join({dirPath, fileName});
-        SaveTensor(launchParam.GetOutTensor(i), filePath);
+        SaveTensor(stream, asyncDump, launchParam.GetOutTensor(i), filePath);
+    }
+}
+
+void StoreUtil::SaveTensor(aclrtStream stream, bool asyncDump, const Mki::Tensor &tensor,
+                           const std::string &filePath)
+{
+    if (!asyncDump) {
+        SaveTensor(tensor, filePath);
+        return;
+    }
+    std::string meta = "format:" + std::to_string(tensor.desc.format) + ";dtype:" +
+                       std::to_string(tensor.desc.dtype) + ";dims:" + TensorUtil::AsdOpsDimsToString(tensor.desc.dims);
+    GetSingleton<AsyncDumper>().DumpTensor(stream, filePath, meta, tensor.data, tensor.dataSize);
+}
+
+void StoreUtil::SaveTensor(aclrtStream stream, bool asyncDump, const Tensor &tensor, const std::string &filePath)
+{
+    if (!asyncDump) {
+        SaveTensor(tensor, filePath);
+        return;
     }
+    std::string meta = "format:" + std::to_string(tensor.desc.format) + ";dtype:" +
+                       std::to_string(tensor.desc.dtype) + ";dims:" + TensorUtil::ShapeToString(tensor.desc.shape);
+    GetSingleton<AsyncDumper>().DumpTensor(stream, filePath, meta, tensor.deviceData, tensor.dataSize);
 }
 
 void StoreUtil::SaveTensor(const Mki::Tensor &tensor, const std::string &filePath)
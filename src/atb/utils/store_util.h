@@ -13,23 +13,29 @@
 #include <string>
 #include <mki/tensor.h>
 #include <mki/utils/bin_file/bin_file.h>
-#include <mki/utils/operationir/operation_ir.h>
 #include <mki/launch_param.h>
 #include "atb/types.h"
 #include "atb/utils/runner_variant_pack.h"
+#include "atb/operation/operation_ir.h"
 
 namespace atb {
 class StoreUtil {
 public:
     static void WriteFile(const uint8_t *data, uint64_t dataLen, const std::string &filePath);
-    static void SaveVariantPack(aclrtStream stream, const VariantPack &variantPack, const std::string &dirPath);
+    // sampled为本次执行的异步dump采样结果，同一次执行的各处保存需传入同一个值，为false时不保存
+    static void SaveVariantPack(aclrtStream stream, const VariantPack &variantPack, const std::string &dirPath,
+                                bool sampled);
     static void SaveVariantPack(aclrtStream stream, const RunnerVariantPack &runnerVariantPack,
-                                const std::string &dirPath);
+                                const std::string &dirPath, bool sampled);
     static void SaveVariantPack(aclrtStream stream, const RunnerVariantPack &runnerVariantPack,
-                                const std::string &dirPath, const Mki::OperationIr *operationIr);
-    static void SaveLaunchParam(aclrtStream stream, const Mki::LaunchParam &launchParam, const std::string &dirPath);
+                                const std::string &dirPath, const OperationIr *operationIr, bool sampled);
+    static void SaveLaunchParam(aclrtStream stream, const Mki::LaunchParam &launchParam, const std::string &dirPath,
+                                bool sampled);
 
 private:
+    // 开启异步dump时拷贝到pinned缓冲后由后台线程写入容器文件，否则同步保存
+    static void SaveTensor(aclrtStream stream, bool asyncDump, const Mki::Tensor &tensor, const std::string &filePath);
+    static void SaveTensor(aclrtStream stream, bool asyncDump, const Tensor &tensor, const std::string &filePath);
     static void CopyTensorData(Mki::BinFile &binFile, const void *deviceData, uint64_t dataSize);
     static void SaveTensor(const Mki::Tensor &tensor, const std::string &filePath) __attribute__((weak));
     static void SaveTensor(const Tensor &tensor, const std::string &filePath) __attribute__((weak));
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/utils/thread_pool.h"
+#include "atb/utils/log.h"
+
+namespace atb {
+ThreadPool::ThreadPool(uint32_t threadNum)
+{
+    workers_.reserve(threadNum);
+    for (uint32_t i = 0; i < threadNum; ++i) {
+        workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+    ATB_LOG(INFO) << "ThreadPool init success, threadNum:" << threadNum;
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    taskCond_.notify_all();
+    for (auto &worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+uint32_t ThreadPool::GetThreadNum() const
+{
+    return static_cast<uint32_t>(workers_.size());
+}
+
+void ThreadPool::ParallelFor(size_t taskNum, const std::function<void(size_t)> &func)
+{
+    if (taskNum == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> parallelForLock(parallelForMutex_);
+    std::shared_ptr<Batch> batch = std::make_shared<Batch>();
+    batch->func = &func;
+    batch->taskNum = taskNum;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch_ = batch;
+        ++generation_;
+    }
+    taskCond_.notify_all();
+
+    RunBatch(*batch);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCond_.wait(lock, [&batch]() { return batch->finishedTaskNum.load() == batch->taskNum; });
+    batch_.reset();
+}
+
+void ThreadPool::WorkerLoop()
+{
+    uint64_t lastGeneration = 0;
+    while (true) {
+        std::shared_ptr<Batch> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            taskCond_.wait(lock, [this, &lastGeneration]() { return stop_ || generation_ != lastGeneration; });
+            if (stop_) {
+                return;
+            }
+            lastGeneration = generation_;
+            batch = batch_;
+        }
+        if (batch) {
+            RunBatch(*batch);
+        }
+    }
+}
+
+void ThreadPool::RunBatch(Batch &batch)
+{
+    // 任务下标只增不减，晚到的工作线程拿到已耗尽的batch时不会再访问func
+    while (true) {
+        size_t taskId = batch.nextTask.fetch_add(1);
+        if (taskId >= batch.taskNum) {
+            return;
+        }
+        try {
+            (*batch.func)(taskId);
+        } catch (const std::exception &e) {
+            ATB_LOG(ERROR) << "ThreadPool task " << taskId << " throw an exception: " << e.what();
+        }
+        if (batch.finishedTaskNum.fetch_add(1) + 1 == batch.taskNum) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+            }
+            doneCond_.notify_all();
+        }
+    }
+}
+} // namespace atb
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_THREAD_POOL_H
+#define ATB_THREAD_POOL_H
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace atb {
+class ThreadPool {
+public:
+    explicit ThreadPool(uint32_t threadNum);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool &other) = delete;
+    ThreadPool &operator=(const ThreadPool &other) = delete;
+    uint32_t GetThreadNum() const;
+    // 将[0, taskNum)个任务分发给工作线程和调用线程共同执行，所有任务执行完成后返回
+    void ParallelFor(size_t taskNum, const std::function<void(size_t)> &func);
+
+private:
+    struct Batch {
+        const std::function<void(size_t)> *func = nullptr;
+        size_t taskNum = 0;
+        std::atomic<size_t> nextTask{0};
+        std::atomic<size_t> finishedTaskNum{0};
+    };
+    void WorkerLoop();
+    void RunBatch(Batch &batch);
+
+private:
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::mutex parallelForMutex_; // 同一context可能被多个线程共用，ParallelFor调用需串行
+    std::condition_variable taskCond_;
+    std::condition_variable doneCond_;
+    std::shared_ptr<Batch> batch_;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+};
+} // namespace atb
+#endif
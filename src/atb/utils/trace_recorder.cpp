@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include "atb/utils/trace_recorder.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "atb/utils/config.h"
+#include "atb/utils/log.h"
+#include "atb/utils/singleton.h"
+
+namespace atb {
+constexpr uint64_t TRACE_META_NAME_SHIFT = 32;
+constexpr uint64_t TRACE_META_TYPE_MASK = 0xFFFFFFFFULL;
+constexpr uint64_t NS_PER_US = 1000;
+constexpr uint64_t TRACE_INSTANT_DUR = UINT64_MAX;
+
+static const char *TRACE_EVENT_TYPE_NAMES[TRACE_EVENT_TYPE_MAX] = {
+    "Setup",          "PreLaunch",     "Launch",     "RunnerSetup", "TilingFill",
+    "TilingCacheHit", "TilingCacheMiss", "TilingCopy", "StreamSync",
+};
+
+const char *GetTraceEventTypeName(TraceEventType type)
+{
+    if (type >= TRACE_EVENT_TYPE_MAX) {
+        return "Unknown";
+    }
+    return TRACE_EVENT_TYPE_NAMES[type];
+}
+
+static uint64_t RoundUpPowerOfTwo(uint64_t value)
+{
+    uint64_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+static void WriteJsonString(std::ostream &os, const std::string &str)
+{
+    os << '"';
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            os << ' ';
+        } else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+static void WriteTimeUs(std::ostream &os, uint64_t timeNs)
+{
+    os << timeNs / NS_PER_US << '.' << std::setw(3) << std::setfill('0') << timeNs % NS_PER_US
+       << std::setfill(' ');
+}
+
+TraceRecorder::ThreadRing::ThreadRing(uint64_t capacity, uint64_t threadId)
+    : tid(threadId), mask(capacity - 1), slots(new TraceSlot[capacity])
+{
+}
+
+TraceRecorder::TraceRecorder()
+{
+    const Config &config = GetSingleton<Config>();
+    ringCapacity_ = RoundUpPowerOfTwo(config.GetTraceBufferSize());
+    exitFilePath_ = config.GetTraceFilePath();
+    names_.push_back("");
+    enable_.store(config.IsTraceEnable(), std::memory_order_relaxed);
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    bool enable = enable_.exchange(false);
+    if (!enable || rings_.empty()) {
+        return;
+    }
+    std::string filePath = exitFilePath_;
+    if (filePath.empty()) {
+        filePath = "atb_trace_" + std::to_string(getpid()) + ".json";
+    }
+    Dump(filePath);
+}
+
+bool TraceRecorder::IsEnable() const
+{
+    return enable_.load(std::memory_order_relaxed);
+}
+
+void TraceRecorder::SetEnable(bool enable)
+{
+    enable_.store(enable, std::memory_order_relaxed);
+}
+
+uint64_t TraceRecorder::GetTimeNs()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+uint32_t TraceRecorder::RegisterName(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = nameIds_.find(name);
+    if (it != nameIds_.end()) {
+        return it->second;
+    }
+    uint32_t nameId = static_cast<uint32_t>(names_.size());
+    names_.push_back(name);
+    nameIds_[name] = nameId;
+    return nameId;
+}
+
+TraceRecorder::ThreadRing &TraceRecorder::GetThreadRing()
+{
+    // 线程退出后缓冲由rings_继续持有，导出时仍可见该线程的事件
+    static thread_local std::shared_ptr<ThreadRing> threadRing;
+    if (!threadRing) {
+        threadRing = std::make_shared<ThreadRing>(ringCapacity_, static_cast<uint64_t>(syscall(SYS_gettid)));
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings_.push_back(threadRing);
+    }
+    return *threadRing;
+}
+
+void TraceRecorder::Record(uint64_t beginNs, uint64_t durNs, uint64_t meta)
+{
+    ThreadRing &ring = GetThreadRing();
+    uint64_t index = ring.writeIndex.load(std::memory_order_relaxed);
+    TraceSlot &slot = ring.slots[index & ring.mask];
+    // 槽位以release写入，导出线程读到新数据时必然也能看到更新后的writeIndex
+    slot.beginNs.store(beginNs, std::memory_order_release);
+    slot.durNs.store(durNs, std::memory_order_release);
+    slot.meta.store(meta, std::memory_order_release);
+    ring.writeIndex.store(index + 1, std::memory_order_release);
+}
+
+void TraceRecorder::RecordComplete(TraceEventType type, uint32_t nameId, uint64_t beginNs, uint64_t endNs)
+{
+    uint64_t meta = (static_cast<uint64_t>(nameId) << TRACE_META_NAME_SHIFT) | static_cast<uint64_t>(type);
+    Record(beginNs, endNs > beginNs ? endNs - beginNs : 0, meta);
+}
+
+void TraceRecorder::RecordInstant(TraceEventType type, uint32_t nameId)
+{
+    uint64_t meta = (static_cast<uint64_t>(nameId) << TRACE_META_NAME_SHIFT) | static_cast<uint64_t>(type);
+    Record(GetTimeNs(), TRACE_INSTANT_DUR, meta);
+}
+
+void TraceRecorder::CollectEvents(ThreadRing &ring, std::vector<TraceEvent> &events, uint64_t &droppedCount) const
+{
+    uint64_t capacity = ring.mask + 1;
+    uint64_t endIndex = ring.writeIndex.load(std::memory_order_acquire);
+    uint64_t beginIndex = endIndex > capacity ? endIndex - capacity : 0;
+    std::vector<TraceEvent> ringEvents;
+    ringEvents.reserve(endIndex - beginIndex);
+    for (uint64_t i = beginIndex; i < endIndex; ++i) {
+        const TraceSlot &slot = ring.slots[i & ring.mask];
+        ringEvents.push_back({slot.beginNs.load(std::memory_order_acquire), slot.durNs.load(std::memory_order_acquire),
+                              slot.meta.load(std::memory_order_acquire)});
+    }
+    // 拷贝期间所属线程可能继续写入，丢弃可能已被覆盖的槽位
+    uint64_t latestIndex = ring.writeIndex.load(std::memory_order_acquire);
+    uint64_t validBeginIndex = latestIndex >= capacity ? latestIndex - capacity + 1 : 0;
+    uint64_t skipCount = validBeginIndex > beginIndex ? validBeginIndex - beginIndex : 0;
+    skipCount = std::min<uint64_t>(skipCount, ringEvents.size());
+    droppedCount += beginIndex + skipCount;
+    events.insert(events.end(), ringEvents.begin() + static_cast<std::ptrdiff_t>(skipCount), ringEvents.end());
+}
+
+uint64_t TraceRecorder::GetDroppedEventCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t droppedCount = 0;
+    for (auto &ring : rings_) {
+        uint64_t writeIndex = ring->writeIndex.load(std::memory_order_acquire);
+        uint64_t capacity = ring->mask + 1;
+        droppedCount += writeIndex > capacity ? writeIndex - capacity : 0;
+    }
+    return droppedCount;
+}
+
+void TraceRecorder::Dump(std::ostream &os)
+{
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    std::vector<std::string> names;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings = rings_;
+        names = names_;
+    }
+    uint64_t pid = static_cast<uint64_t>(getpid());
+    uint64_t droppedCount = 0;
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"args\":{\"name\":\"atb\"}}";
+    for (auto &ring : rings) {
+        os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << ring->tid
+           << ",\"args\":{\"name\":\"atb thread " << ring->tid << "\"}}";
+        std::vector<TraceEvent> events;
+        CollectEvents(*ring, events, droppedCount);
+        for (const TraceEvent &event : events) {
+            TraceEventType type = static_cast<TraceEventType>(event.meta & TRACE_META_TYPE_MASK);
+            uint64_t nameId = event.meta >> TRACE_META_NAME_SHIFT;
+            const char *typeName = GetTraceEventTypeName(type);
+            os << ",\n{\"name\":";
+            if (nameId != 0 && nameId < names.size()) {
+                WriteJsonString(os, names.at(nameId));
+            } else {
+                WriteJsonString(os, typeName);
+            }
+            os << ",\"cat\":\"" << typeName << "\",\"pid\":" << pid << ",\"tid\":" << ring->tid << ",\"ts\":";
+            WriteTimeUs(os, event.beginNs);
+            if (event.durNs == TRACE_INSTANT_DUR) {
+                os << ",\"ph\":\"i\",\"s\":\"t\"}";
+            } else {
+                os << ",\"ph\":\"X\",\"dur\":";
+                WriteTimeUs(os, event.durNs);
+                os << "}";
+            }
+        }
+    }
+    os << "],\n\"otherData\":{\"droppedEventCount\":" << droppedCount << "}}\n";
+}
+
+Status TraceRecorder::Dump(const std::string &filePath)
+{
+    if (filePath.empty()) {
+        ATB_LOG(ERROR) << "trace file path is empty";
+        return ERROR_INVALID_PARAM;
+    }
+    std::ofstream ofs(filePath, std::ios::out | std::ios::trunc);
+    if (!ofs.is_open()) {
+        ATB_LOG(ERROR) << "open trace file " << filePath << " fail";
+        return ERROR_INVALID_PARAM;
+    }
+    Dump(ofs);
+    ofs.close();
+    if (ofs.fail()) {
+        ATB_LOG(ERROR) << "write trace file " << filePath << " fail";
+        return ERROR_INTERNAL_ERROR;
+    }
+    ATB_LOG(INFO) << "dump trace to " << filePath << " success";
+    return NO_ERROR;
+}
+
+TraceScope::TraceScope(TraceEventType type, uint32_t nameId) : type_(type), nameId_(nameId)
+{
+    enable_ = GetSingleton<TraceRecorder>().IsEnable();
+    if (enable_) {
+        beginNs_ = TraceRecorder::GetTimeNs();
+    }
+}
+
+TraceScope::~TraceScope()
+{
+    if (enable_) {
+        GetSingleton<TraceRecorder>().RecordComplete(type_, nameId_, beginNs_, TraceRecorder::GetTimeNs());
+    }
+}
+} // namespace atb
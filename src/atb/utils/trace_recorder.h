@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_TRACE_RECORDER_H
+#define ATB_TRACE_RECORDER_H
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "atb/types.h"
+
+namespace atb {
+enum TraceEventType : uint32_t {
+    TRACE_EVENT_OPERATION_SETUP = 0,
+    TRACE_EVENT_OPERATION_PRELAUNCH,
+    TRACE_EVENT_OPERATION_LAUNCH,
+    TRACE_EVENT_RUNNER_SETUP,
+    TRACE_EVENT_TILING_FILL,
+    TRACE_EVENT_TILING_CACHE_HIT,
+    TRACE_EVENT_TILING_CACHE_MISS,
+    TRACE_EVENT_TILING_COPY,
+    TRACE_EVENT_STREAM_SYNC,
+    TRACE_EVENT_TYPE_MAX,
+};
+
+// host侧trace记录器：每个线程独占一个无锁环形缓冲，只有导出时才加锁遍历所有线程的缓冲
+class TraceRecorder {
+public:
+    TraceRecorder();
+    ~TraceRecorder();
+    bool IsEnable() const;
+    void SetEnable(bool enable);
+    // 注册事件名称并返回名称id，同名返回同一id，调用方应缓存返回值，0表示无名称
+    uint32_t RegisterName(const std::string &name);
+    void RecordComplete(TraceEventType type, uint32_t nameId, uint64_t beginNs, uint64_t endNs);
+    void RecordInstant(TraceEventType type, uint32_t nameId);
+    // 以Chrome trace json格式导出所有线程当前缓冲中的事件，可用chrome://tracing或Perfetto打开
+    Status Dump(const std::string &filePath);
+    void Dump(std::ostream &os);
+    uint64_t GetDroppedEventCount();
+    static uint64_t GetTimeNs();
+
+private:
+    struct TraceSlot {
+        std::atomic<uint64_t> beginNs{0};
+        std::atomic<uint64_t> durNs{0};
+        std::atomic<uint64_t> meta{0}; // 低32位为事件类型, 高32位为名称id
+    };
+    struct ThreadRing {
+        ThreadRing(uint64_t capacity, uint64_t tid);
+        uint64_t tid = 0;
+        uint64_t mask = 0;
+        std::unique_ptr<TraceSlot[]> slots;
+        std::atomic<uint64_t> writeIndex{0}; // 只由所属线程写入
+    };
+    struct TraceEvent {
+        uint64_t beginNs = 0;
+        uint64_t durNs = 0;
+        uint64_t meta = 0;
+    };
+    ThreadRing &GetThreadRing();
+    void Record(uint64_t beginNs, uint64_t durNs, uint64_t meta);
+    void CollectEvents(ThreadRing &ring, std::vector<TraceEvent> &events, uint64_t &droppedCount) const;
+
+private:
+    std::atomic<bool> enable_{false};
+    uint64_t ringCapacity_ = 0;
+    std::string exitFilePath_;
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<ThreadRing>> rings_;
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, uint32_t> nameIds_;
+};
+
+// 作用域内计时，析构时记录一个完整事件；trace未开启时只有一次原子读的开销
+class TraceScope {
+public:
+    explicit TraceScope(TraceEventType type, uint32_t nameId = 0);
+    ~TraceScope();
+    TraceScope(const TraceScope &other) = delete;
+    TraceScope &operator=(const TraceScope &other) = delete;
+
+private:
+    TraceEventType type_ = TRACE_EVENT_TYPE_MAX;
+    uint32_t nameId_ = 0;
+    uint64_t beginNs_ = 0;
+    bool enable_ = false;
+};
+
+const char *GetTraceEventTypeName(TraceEventType type);
+} // namespace atb
+#endif
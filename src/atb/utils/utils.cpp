@@ -17,6 +17,9 @@
 #include <mki/utils/log/log_sink_stdout.h>
 #include <mki/utils/log/log_sink_file.h>
 #include "atb/utils/log.h"
+#include "atb/utils/singleton.h"
+#include "atb/utils/trace_recorder.h"
+#include "atb/utils/mem_accounting.h"
 
 namespace atb {
 std::string Utils::GetAtbVersion()
@@ -332,4 +335,39 @@ Status Utils::ResetLogLevel()
 
     return SetLogLevel(atbLevel);
 }
-} // namespace atb
\ No newline at end of file
+
+void Utils::SetTraceEnable(bool enable)
+{
+    GetSingleton<TraceRecorder>().SetEnable(enable);
+}
+
+Status Utils::DumpTrace(const std::string &filePath)
+{
+    return GetSingleton<TraceRecorder>().Dump(filePath);
+}
+
+void Utils::SetMemAccountingEnable(bool enable)
+{
+    GetSingleton<MemAccounting>().SetEnable(enable);
+}
+
+std::vector<OpMemStatistic> Utils::GetOpMemStatistics()
+{
+    return GetSingleton<MemAccounting>().GetStatistics();
+}
+
+std::vector<OpMemRecord> Utils::GetOpMemRecords()
+{
+    return GetSingleton<MemAccounting>().GetRecords();
+}
+
+void Utils::ResetMemAccounting()
+{
+    GetSingleton<MemAccounting>().Reset();
+}
+
+Status Utils::DumpMemAccounting(const std::string &filePath)
+{
+    return GetSingleton<MemAccounting>().Dump(filePath);
+}
+} // namespace atb
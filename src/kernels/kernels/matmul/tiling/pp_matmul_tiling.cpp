@@ -16,6 +16,7 @@
 #include "mki/utils/platform/platform_info.h"
 #include "kernels/matmul/common/common_tiling.h"
 #include "pp_matmul_info.h"
+#include "pp_matmul_tiling_table.h"
 
 namespace AsdOps {
 constexpr uint32_t L1_DESCALE_BUFFER_LEN_MAX = 6144;
@@ -130,8 +131,37 @@ uint32_t PpTilingData::End(const MatMulInfo &mmInfo)
     return blockDim;
 }
 
+// 离线表中的切分已是SetBaseOp调整后的最终结果，直接填充，不再重复调整
+static bool ApplyPpMatmulTilingEntry(const MatMulInfo &mmInfo, const HardwareInfo &hwInfo, PpTilingData &tilingData)
+{
+    const PpMatmulTilingEntry *entry =
+        FindPpMatmulTilingEntry(PlatformInfo::Instance().GetPlatformType(), hwInfo.coreNum, mmInfo);
+    if (entry == nullptr) {
+        return false;
+    }
+    if (entry->m0 == 0 || entry->n0 == 0 || entry->m0 * entry->n0 * FP32_SIZE > hwInfo.l0cSize) {
+        MKI_LOG(WARN) << "invalid tiling table entry, m0: " << entry->m0 << ", n0: " << entry->n0;
+        return false;
+    }
+    tilingData.opShape.m0 = entry->m0;
+    tilingData.opShape.n0 = entry->n0;
+    tilingData.mLoop = CeilDiv(tilingData.opShape.m, tilingData.opShape.m0);
+    tilingData.nLoop = CeilDiv(tilingData.opShape.n, tilingData.opShape.n0);
+    tilingData.coreLoop = tilingData.opShape.batchSize * tilingData.mLoop * tilingData.nLoop;
+    tilingData.blockDim = std::min(tilingData.coreLoop, hwInfo.coreNum);
+    if (entry->swizzlCount == 0 || entry->swizzlCount > tilingData.blockDim || entry->swizzlDirect > 1) {
+        MKI_LOG(WARN) << "invalid tiling table entry, swizzlCount: " << entry->swizzlCount
+                      << ", swizzlDirect: " << entry->swizzlDirect;
+        return false;
+    }
+    tilingData.swizzlCount = entry->swizzlCount;
+    tilingData.swizzlDirect = entry->swizzlDirect;
+    MKI_LOG(INFO) << "pp matmul tiling hit table, m0: " << entry->m0 << ", n0: " << entry->n0;
+    return true;
+}
+
 void GetPpMatmulTiling(const MatMulInfo &mmInfo, const HardwareInfo &hwInfo, uint32_t &blockDim,
-                       PpTilingData &tilingData)
+                       PpTilingData &tilingData, bool useTilingTable)
 {
     OpShape opShape;
     opShape.batchSize = mmInfo.batchSize;
@@ -141,6 +171,11 @@ void GetPpMatmulTiling(const MatMulInfo &mmInfo, const HardwareInfo &hwInfo, uin
     tilingData.opShape = opShape;
     tilingData.quantMode = static_cast<uint32_t>(mmInfo.quantMode);
     tilingData.SetTilingKey(mmInfo, 0, 0); // init tilingkey with transA transB.
+    if (useTilingTable && ApplyPpMatmulTilingEntry(mmInfo, hwInfo, tilingData)) {
+        blockDim = tilingData.End(mmInfo);
+        tilingData.SetTilingKey(mmInfo, tilingData.swizzlDirect, 0);
+        return;
+    }
     if (opShape.m < opShape.n) {
         TilingFunc<false, OpShape, PpTilingData, HardwareInfo, MatMulInfo>(opShape, tilingData, hwInfo, mmInfo);
     } else {
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "pp_matmul_tiling_table.h"
+#include <algorithm>
+#include <tuple>
+
+namespace AsdOps {
+uint32_t GetPpMatmulTilingFlags(const MatMulInfo &mmInfo)
+{
+    uint32_t flags = 0;
+    flags |= mmInfo.transA ? PP_TILING_FLAG_TRANS_A : 0;
+    flags |= mmInfo.transB ? PP_TILING_FLAG_TRANS_B : 0;
+    flags |= mmInfo.formatB == TENSOR_FORMAT_FRACTAL_NZ ? PP_TILING_FLAG_FORMAT_B_NZ : 0;
+    flags |= mmInfo.mmType == OpParam::MatMul::MatMulType::MATMUL_WITH_BIAS ? PP_TILING_FLAG_WITH_BIAS : 0;
+    flags |= static_cast<uint32_t>(mmInfo.inDtype) << PP_TILING_FLAG_IN_DTYPE_SHIFT;
+    return flags;
+}
+
+static inline auto EntryKey(const PpMatmulTilingEntry &entry)
+{
+    return std::tie(entry.coreNum, entry.flags, entry.batchSize, entry.m, entry.k, entry.n);
+}
+
+const PpMatmulTilingEntry *FindPpMatmulTilingEntry(PlatformType platformType, uint32_t coreNum,
+                                                   const MatMulInfo &mmInfo)
+{
+    size_t tableNum = 0;
+    const PpMatmulTilingTable *tables = GetPpMatmulTilingTables(tableNum);
+    const PpMatmulTilingTable *table = nullptr;
+    for (size_t i = 0; i < tableNum; ++i) {
+        if (tables[i].platformType == platformType) {
+            table = &tables[i];
+            break;
+        }
+    }
+    if (table == nullptr || table->entryNum == 0) {
+        return nullptr;
+    }
+    PpMatmulTilingEntry target = {};
+    target.coreNum = coreNum;
+    target.flags = GetPpMatmulTilingFlags(mmInfo);
+    target.batchSize = mmInfo.batchSize;
+    target.m = mmInfo.m;
+    target.k = mmInfo.k;
+    target.n = mmInfo.n;
+    const PpMatmulTilingEntry *end = table->entries + table->entryNum;
+    const PpMatmulTilingEntry *it = std::lower_bound(table->entries, end, target,
+        [](const PpMatmulTilingEntry &lhs, const PpMatmulTilingEntry &rhs) { return EntryKey(lhs) < EntryKey(rhs); });
+    if (it == end || EntryKey(*it) != EntryKey(target)) {
+        return nullptr;
+    }
+    return it;
+}
+} // namespace AsdOps
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef ASCEND_OPS_MATMUL_PP_TILING_TABLE_H
+#define ASCEND_OPS_MATMUL_PP_TILING_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mki/utils/platform/platform_info.h>
+#include "pp_matmul_info.h"
+
+namespace AsdOps {
+using namespace Mki;
+// 表项flags各位含义，需与scripts/build_matmul_tiling_table.py保持一致
+constexpr uint32_t PP_TILING_FLAG_TRANS_A = 1U;
+constexpr uint32_t PP_TILING_FLAG_TRANS_B = 1U << 1;
+constexpr uint32_t PP_TILING_FLAG_FORMAT_B_NZ = 1U << 2;
+constexpr uint32_t PP_TILING_FLAG_WITH_BIAS = 1U << 3;
+constexpr uint32_t PP_TILING_FLAG_IN_DTYPE_SHIFT = 4; // 高位存放输入元素字节数1/2/4
+
+// 离线搜索得到的PpMatmul切分结果，按(coreNum, flags, batchSize, m, k, n)升序排列
+struct PpMatmulTilingEntry {
+    uint32_t coreNum;
+    uint32_t flags;
+    uint32_t batchSize;
+    uint32_t m;
+    uint32_t k;
+    uint32_t n;
+    uint32_t m0;
+    uint32_t n0;
+    uint32_t swizzlCount;
+    uint32_t swizzlDirect;
+};
+
+struct PpMatmulTilingTable {
+    PlatformType platformType;
+    const PpMatmulTilingEntry *entries;
+    size_t entryNum;
+};
+
+uint32_t GetPpMatmulTilingFlags(const MatMulInfo &mmInfo);
+// 未命中时返回nullptr，调用方回退到解析搜索
+const PpMatmulTilingEntry *FindPpMatmulTilingEntry(PlatformType platformType, uint32_t coreNum,
+                                                   const MatMulInfo &mmInfo);
+// 由scripts/build_matmul_tiling_table.py生成的各芯片tiling表
+const PpMatmulTilingTable *GetPpMatmulTilingTables(size_t &tableNum);
+// 先查表，未命中再走解析搜索；useTilingTable为false时跳过查表，供校验表项与解析搜索结果一致
+void GetPpMatmulTiling(const MatMulInfo &mmInfo, const HardwareInfo &hwInfo, uint32_t &blockDim,
+                       PpTilingData &tilingData, bool useTilingTable = true);
+} // namespace AsdOps
+
+#endif // ASCEND_OPS_MATMUL_PP_TILING_TABLE_H
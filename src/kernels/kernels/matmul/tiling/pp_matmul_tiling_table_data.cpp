@@ -0,0 +1,246 @@
+/*
+* Copyright (c) 2025 Huawei Technologies Co., Ltd.
+* This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+* CANN Open Software License Agreement Version 2.0 (the "License").
+* Please refer to the License for details. You may not use this file except in compliance with the License.
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+* INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+* See LICENSE in the root of the software repository for the full text of the License.
+*/
+// generated by scripts/build_matmul_tiling_table.py, do not edit
+// cost model: analytic, socs: ascend910b1 ascend910b3, shapes: model_shapes.csv
+#include "pp_matmul_tiling_table.h"
+
+namespace AsdOps {
+namespace {
+// coreNum, flags, batchSize, m, k, n, m0, n0, swizzlCount, swizzlDirect
+const PpMatmulTilingEntry ASCEND_910B_ENTRIES[] = {
+    {20, 34, 1, 1, 1024, 8192, 16, 416, 1, 0},
+    {20, 34, 1, 1, 3584, 3584, 16, 192, 1, 0},
+    {20, 34, 1, 1, 3584, 4608, 16, 256, 1, 1},
+    {20, 34, 1, 1, 3584, 8192, 16, 416, 1, 0},
+    {20, 34, 1, 1, 3584, 37888, 16, 256, 1, 1},
+    {20, 34, 1, 1, 4096, 4096, 16, 256, 1, 1},
+    {20, 34, 1, 1, 4096, 12288, 16, 256, 1, 1},
+    {20, 34, 1, 1, 4096, 22016, 16, 256, 1, 1},
+    {20, 34, 1, 1, 8192, 1280, 16, 64, 2, 1},
+    {20, 34, 1, 1, 8192, 7168, 16, 368, 1, 0},
+    {20, 34, 1, 1, 11008, 4096, 16, 256, 1, 1},
+    {20, 34, 1, 1, 18944, 3584, 16, 192, 1, 0},
+    {20, 34, 1, 16, 1024, 8192, 16, 416, 1, 0},
+    {20, 34, 1, 16, 3584, 3584, 16, 192, 1, 0},
+    {20, 34, 1, 16, 3584, 4608, 16, 256, 1, 0},
+    {20, 34, 1, 16, 3584, 8192, 16, 416, 1, 0},
+    {20, 34, 1, 16, 3584, 37888, 16, 256, 1, 1},
+    {20, 34, 1, 16, 4096, 4096, 16, 256, 1, 0},
+    {20, 34, 1, 16, 4096, 12288, 16, 256, 1, 1},
+    {20, 34, 1, 16, 4096, 22016, 16, 256, 1, 1},
+    {20, 34, 1, 16, 8192, 1280, 16, 64, 2, 0},
+    {20, 34, 1, 16, 8192, 7168, 16, 368, 1, 0},
+    {20, 34, 1, 16, 11008, 4096, 16, 256, 1, 0},
+    {20, 34, 1, 16, 18944, 3584, 16, 192, 1, 0},
+    {20, 34, 1, 32, 1024, 8192, 32, 416, 1, 0},
+    {20, 34, 1, 32, 3584, 3584, 32, 192, 2, 0},
+    {20, 34, 1, 32, 3584, 4608, 32, 256, 2, 0},
+    {20, 34, 1, 32, 3584, 8192, 32, 416, 1, 0},
+    {20, 34, 1, 32, 3584, 37888, 32, 256, 2, 1},
+    {20, 34, 1, 32, 4096, 4096, 32, 256, 2, 0},
+    {20, 34, 1, 32, 4096, 12288, 32, 256, 2, 1},
+    {20, 34, 1, 32, 4096, 22016, 32, 256, 2, 1},
+    {20, 34, 1, 32, 8192, 1280, 32, 64, 4, 0},
+    {20, 34, 1, 32, 8192, 7168, 32, 368, 1, 0},
+    {20, 34, 1, 32, 11008, 4096, 32, 256, 2, 0},
+    {20, 34, 1, 32, 18944, 3584, 32, 192, 2, 0},
+    {20, 34, 1, 64, 1024, 8192, 64, 416, 2, 0},
+    {20, 34, 1, 64, 3584, 3584, 64, 192, 3, 0},
+    {20, 34, 1, 64, 3584, 4608, 64, 256, 2, 0},
+    {20, 34, 1, 64, 3584, 8192, 64, 416, 2, 0},
+    {20, 34, 1, 64, 3584, 37888, 64, 256, 2, 1},
+    {20, 34, 1, 64, 4096, 4096, 64, 256, 2, 0},
+    {20, 34, 1, 64, 4096, 12288, 64, 320, 2, 1},
+    {20, 34, 1, 64, 4096, 22016, 64, 368, 2, 1},
+    {20, 34, 1, 64, 8192, 1280, 64, 64, 5, 0},
+    {20, 34, 1, 64, 8192, 7168, 64, 368, 2, 0},
+    {20, 34, 1, 64, 11008, 4096, 64, 256, 2, 0},
+    {20, 34, 1, 64, 18944, 3584, 64, 192, 3, 0},
+    {20, 34, 1, 128, 1024, 8192, 128, 208, 4, 1},
+    {20, 34, 1, 128, 3584, 3584, 128, 192, 4, 0},
+    {20, 34, 1, 128, 3584, 4608, 128, 256, 3, 0},
+    {20, 34, 1, 128, 3584, 8192, 128, 208, 4, 1},
+    {20, 34, 1, 128, 3584, 37888, 128, 240, 4, 1},
+    {20, 34, 1, 128, 4096, 4096, 128, 256, 4, 0},
+    {20, 34, 1, 128, 4096, 12288, 128, 208, 4, 1},
+    {20, 34, 1, 128, 4096, 22016, 128, 224, 4, 1},
+    {20, 34, 1, 128, 8192, 1280, 128, 64, 7, 0},
+    {20, 34, 1, 128, 8192, 7168, 128, 192, 4, 1},
+    {20, 34, 1, 128, 11008, 4096, 128, 256, 4, 0},
+    {20, 34, 1, 128, 18944, 3584, 128, 192, 4, 0},
+    {20, 34, 1, 256, 1024, 8192, 256, 112, 7, 1},
+    {20, 34, 1, 256, 3584, 3584, 256, 96, 7, 1},
+    {20, 34, 1, 256, 3584, 4608, 256, 128, 7, 1},
+    {20, 34, 1, 256, 3584, 8192, 256, 112, 7, 1},
+    {20, 34, 1, 256, 3584, 37888, 256, 128, 7, 1},
+    {20, 34, 1, 256, 4096, 4096, 256, 112, 7, 1},
+    {20, 34, 1, 256, 4096, 12288, 256, 128, 7, 1},
+    {20, 34, 1, 256, 4096, 22016, 256, 128, 7, 1},
+    {20, 34, 1, 256, 8192, 1280, 256, 64, 10, 0},
+    {20, 34, 1, 256, 8192, 7168, 256, 128, 7, 1},
+    {20, 34, 1, 256, 11008, 4096, 256, 112, 7, 1},
+    {20, 34, 1, 256, 18944, 3584, 256, 96, 7, 1},
+    {20, 34, 1, 1024, 1024, 8192, 256, 128, 7, 1},
+    {20, 34, 1, 1024, 3584, 3584, 256, 128, 7, 1},
+    {20, 34, 1, 1024, 3584, 4608, 256, 128, 7, 1},
+    {20, 34, 1, 1024, 3584, 8192, 256, 128, 7, 1},
+    {20, 34, 1, 1024, 3584, 37888, 256, 128, 7, 1},
+    {20, 34, 1, 1024, 4096, 4096, 256, 128, 7, 1},
+    {20, 34, 1, 1024, 4096, 12288, 256, 128, 7, 1},
+    {20, 34, 1, 1024, 4096, 22016, 256, 128, 7, 1},
+    {20, 34, 1, 1024, 8192, 1280, 256, 128, 7, 0},
+    {20, 34, 1, 1024, 8192, 7168, 256, 128, 7, 1},
+    {20, 34, 1, 1024, 11008, 4096, 256, 128, 7, 1},
+    {20, 34, 1, 1024, 18944, 3584, 256, 128, 7, 1},
+    {20, 34, 1, 2048, 1024, 8192, 256, 128, 7, 1},
+    {20, 34, 1, 2048, 3584, 3584, 256, 128, 7, 0},
+    {20, 34, 1, 2048, 3584, 4608, 256, 128, 7, 1},
+    {20, 34, 1, 2048, 3584, 8192, 256, 128, 7, 1},
+    {20, 34, 1, 2048, 3584, 37888, 256, 128, 7, 1},
+    {20, 34, 1, 2048, 4096, 4096, 256, 128, 7, 0},
+    {20, 34, 1, 2048, 4096, 12288, 256, 128, 7, 1},
+    {20, 34, 1, 2048, 4096, 22016, 256, 128, 7, 1},
+    {20, 34, 1, 2048, 8192, 1280, 128, 256, 5, 0},
+    {20, 34, 1, 2048, 8192, 7168, 256, 128, 7, 1},
+    {20, 34, 1, 2048, 11008, 4096, 256, 128, 7, 0},
+    {20, 34, 1, 2048, 18944, 3584, 256, 128, 7, 0},
+    {20, 34, 1, 4096, 1024, 8192, 256, 128, 7, 1},
+    {20, 34, 1, 4096, 3584, 3584, 128, 256, 5, 0},
+    {20, 34, 1, 4096, 3584, 4608, 256, 128, 7, 0},
+    {20, 34, 1, 4096, 3584, 8192, 256, 128, 7, 1},
+    {20, 34, 1, 4096, 3584, 37888, 256, 128, 7, 1},
+    {20, 34, 1, 4096, 4096, 4096, 128, 256, 3, 0},
+    {20, 34, 1, 4096, 4096, 12288, 256, 128, 7, 1},
+    {20, 34, 1, 4096, 4096, 22016, 256, 128, 7, 1},
+    {20, 34, 1, 4096, 8192, 1280, 128, 256, 5, 0},
+    {20, 34, 1, 4096, 8192, 7168, 256, 128, 7, 1},
+    {20, 34, 1, 4096, 11008, 4096, 128, 256, 3, 0},
+    {20, 34, 1, 4096, 18944, 3584, 128, 256, 5, 0},
+    {24, 34, 1, 1, 1024, 8192, 16, 352, 1, 0},
+    {24, 34, 1, 1, 3584, 3584, 16, 160, 2, 0},
+    {24, 34, 1, 1, 3584, 4608, 16, 256, 1, 1},
+    {24, 34, 1, 1, 3584, 8192, 16, 352, 1, 0},
+    {24, 34, 1, 1, 3584, 37888, 16, 256, 1, 1},
+    {24, 34, 1, 1, 4096, 4096, 16, 176, 2, 0},
+    {24, 34, 1, 1, 4096, 12288, 16, 256, 1, 1},
+    {24, 34, 1, 1, 4096, 22016, 16, 256, 1, 1},
+    {24, 34, 1, 1, 8192, 1280, 16, 64, 2, 1},
+    {24, 34, 1, 1, 8192, 7168, 16, 304, 1, 0},
+    {24, 34, 1, 1, 11008, 4096, 16, 176, 2, 0},
+    {24, 34, 1, 1, 18944, 3584, 16, 160, 2, 0},
+    {24, 34, 1, 16, 1024, 8192, 16, 352, 1, 0},
+    {24, 34, 1, 16, 3584, 3584, 16, 160, 2, 0},
+    {24, 34, 1, 16, 3584, 4608, 16, 256, 1, 0},
+    {24, 34, 1, 16, 3584, 8192, 16, 352, 1, 0},
+    {24, 34, 1, 16, 3584, 37888, 16, 256, 1, 1},
+    {24, 34, 1, 16, 4096, 4096, 16, 176, 2, 0},
+    {24, 34, 1, 16, 4096, 12288, 16, 256, 1, 1},
+    {24, 34, 1, 16, 4096, 22016, 16, 256, 1, 1},
+    {24, 34, 1, 16, 8192, 1280, 16, 64, 2, 0},
+    {24, 34, 1, 16, 8192, 7168, 16, 304, 1, 0},
+    {24, 34, 1, 16, 11008, 4096, 16, 176, 2, 0},
+    {24, 34, 1, 16, 18944, 3584, 16, 160, 2, 0},
+    {24, 34, 1, 32, 1024, 8192, 32, 352, 2, 0},
+    {24, 34, 1, 32, 3584, 3584, 32, 160, 2, 0},
+    {24, 34, 1, 32, 3584, 4608, 32, 256, 2, 0},
+    {24, 34, 1, 32, 3584, 8192, 32, 352, 2, 0},
+    {24, 34, 1, 32, 3584, 37888, 32, 256, 2, 1},
+    {24, 34, 1, 32, 4096, 4096, 32, 176, 2, 0},
+    {24, 34, 1, 32, 4096, 12288, 32, 256, 2, 1},
+    {24, 34, 1, 32, 4096, 22016, 32, 256, 2, 1},
+    {24, 34, 1, 32, 8192, 1280, 32, 64, 4, 0},
+    {24, 34, 1, 32, 8192, 7168, 32, 304, 2, 0},
+    {24, 34, 1, 32, 11008, 4096, 32, 176, 2, 0},
+    {24, 34, 1, 32, 18944, 3584, 32, 160, 2, 0},
+    {24, 34, 1, 64, 1024, 8192, 64, 352, 2, 0},
+    {24, 34, 1, 64, 3584, 3584, 64, 160, 3, 0},
+    {24, 34, 1, 64, 3584, 4608, 64, 256, 2, 0},
+    {24, 34, 1, 64, 3584, 8192, 64, 352, 2, 0},
+    {24, 34, 1, 64, 3584, 37888, 64, 400, 2, 1},
+    {24, 34, 1, 64, 4096, 4096, 64, 176, 3, 0},
+    {24, 34, 1, 64, 4096, 12288, 64, 256, 3, 1},
+    {24, 34, 1, 64, 4096, 22016, 64, 256, 3, 1},
+    {24, 34, 1, 64, 8192, 1280, 64, 64, 5, 0},
+    {24, 34, 1, 64, 8192, 7168, 64, 304, 2, 0},
+    {24, 34, 1, 64, 11008, 4096, 64, 176, 3, 0},
+    {24, 34, 1, 64, 18944, 3584, 64, 160, 3, 0},
+    {24, 34, 1, 128, 1024, 8192, 128, 176, 4, 1},
+    {24, 34, 1, 128, 3584, 3584, 128, 160, 4, 0},
+    {24, 34, 1, 128, 3584, 4608, 128, 256, 3, 0},
+    {24, 34, 1, 128, 3584, 8192, 128, 176, 4, 1},
+    {24, 34, 1, 128, 3584, 37888, 128, 240, 4, 1},
+    {24, 34, 1, 128, 4096, 4096, 128, 176, 4, 0},
+    {24, 34, 1, 128, 4096, 12288, 128, 256, 4, 1},
+    {24, 34, 1, 128, 4096, 22016, 128, 240, 4, 1},
+    {24, 34, 1, 128, 8192, 1280, 128, 64, 7, 0},
+    {24, 34, 1, 128, 8192, 7168, 128, 160, 4, 1},
+    {24, 34, 1, 128, 11008, 4096, 128, 176, 4, 0},
+    {24, 34, 1, 128, 18944, 3584, 128, 160, 4, 0},
+    {24, 34, 1, 256, 1024, 8192, 256, 128, 8, 1},
+    {24, 34, 1, 256, 3584, 3584, 256, 80, 8, 1},
+    {24, 34, 1, 256, 3584, 4608, 256, 96, 8, 1},
+    {24, 34, 1, 256, 3584, 8192, 256, 128, 8, 1},
+    {24, 34, 1, 256, 3584, 37888, 256, 128, 8, 1},
+    {24, 34, 1, 256, 4096, 4096, 256, 96, 8, 1},
+    {24, 34, 1, 256, 4096, 12288, 256, 128, 8, 1},
+    {24, 34, 1, 256, 4096, 22016, 256, 128, 8, 1},
+    {24, 34, 1, 256, 8192, 1280, 256, 64, 10, 0},
+    {24, 34, 1, 256, 8192, 7168, 256, 112, 8, 1},
+    {24, 34, 1, 256, 11008, 4096, 256, 96, 8, 1},
+    {24, 34, 1, 256, 18944, 3584, 256, 80, 8, 1},
+    {24, 34, 1, 1024, 1024, 8192, 256, 128, 8, 1},
+    {24, 34, 1, 1024, 3584, 3584, 256, 128, 8, 0},
+    {24, 34, 1, 1024, 3584, 4608, 256, 128, 8, 1},
+    {24, 34, 1, 1024, 3584, 8192, 256, 128, 8, 1},
+    {24, 34, 1, 1024, 3584, 37888, 256, 128, 8, 1},
+    {24, 34, 1, 1024, 4096, 4096, 256, 128, 8, 1},
+    {24, 34, 1, 1024, 4096, 12288, 256, 128, 8, 1},
+    {24, 34, 1, 1024, 4096, 22016, 256, 128, 8, 1},
+    {24, 34, 1, 1024, 8192, 1280, 256, 128, 6, 0},
+    {24, 34, 1, 1024, 8192, 7168, 256, 128, 8, 1},
+    {24, 34, 1, 1024, 11008, 4096, 256, 128, 8, 1},
+    {24, 34, 1, 1024, 18944, 3584, 256, 128, 8, 0},
+    {24, 34, 1, 2048, 1024, 8192, 256, 128, 8, 1},
+    {24, 34, 1, 2048, 3584, 3584, 256, 128, 8, 0},
+    {24, 34, 1, 2048, 3584, 4608, 256, 128, 8, 0},
+    {24, 34, 1, 2048, 3584, 8192, 256, 128, 8, 1},
+    {24, 34, 1, 2048, 3584, 37888, 256, 128, 8, 1},
+    {24, 34, 1, 2048, 4096, 4096, 256, 128, 8, 0},
+    {24, 34, 1, 2048, 4096, 12288, 256, 128, 8, 1},
+    {24, 34, 1, 2048, 4096, 22016, 256, 128, 8, 1},
+    {24, 34, 1, 2048, 8192, 1280, 128, 256, 6, 0},
+    {24, 34, 1, 2048, 8192, 7168, 256, 128, 8, 1},
+    {24, 34, 1, 2048, 11008, 4096, 256, 128, 8, 0},
+    {24, 34, 1, 2048, 18944, 3584, 256, 128, 8, 0},
+    {24, 34, 1, 4096, 1024, 8192, 256, 128, 8, 1},
+    {24, 34, 1, 4096, 3584, 3584, 128, 256, 6, 0},
+    {24, 34, 1, 4096, 3584, 4608, 256, 128, 8, 0},
+    {24, 34, 1, 4096, 3584, 8192, 256, 128, 8, 1},
+    {24, 34, 1, 4096, 3584, 37888, 256, 128, 8, 1},
+    {24, 34, 1, 4096, 4096, 4096, 128, 256, 3, 0},
+    {24, 34, 1, 4096, 4096, 12288, 256, 128, 8, 1},
+    {24, 34, 1, 4096, 4096, 22016, 256, 128, 8, 1},
+    {24, 34, 1, 4096, 8192, 1280, 128, 256, 6, 0},
+    {24, 34, 1, 4096, 8192, 7168, 256, 128, 8, 1},
+    {24, 34, 1, 4096, 11008, 4096, 128, 256, 3, 0},
+    {24, 34, 1, 4096, 18944, 3584, 128, 256, 6, 0},
+};
+
+const PpMatmulTilingTable PP_MATMUL_TILING_TABLES[] = {
+    {PlatformType::ASCEND_910B, ASCEND_910B_ENTRIES, sizeof(ASCEND_910B_ENTRIES) / sizeof(ASCEND_910B_ENTRIES[0])},
+};
+} // namespace
+
+const PpMatmulTilingTable *GetPpMatmulTilingTables(size_t &tableNum)
+{
+    tableNum = sizeof(PP_MATMUL_TILING_TABLES) / sizeof(PP_MATMUL_TILING_TABLES[0]);
+    return PP_MATMUL_TILING_TABLES;
+}
+} // namespace AsdOps
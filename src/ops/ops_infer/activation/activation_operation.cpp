@@ -84,7 +84,7 @@ template <> Status CreateOperation(const infer::ActivationParam &opParam, Operat
     return NO_ERROR;
 }
 
-static Mki::OperationIr *GetOperationIrForActivation(const infer::ActivationType activationType)
+static const OperationIr *GetOperationIrForActivation(const infer::ActivationType activationType)
 {
     switch (activationType) {
         case atb::infer::ActivationType::ACTIVATION_RELU:
@@ -111,7 +111,7 @@ static Mki::OperationIr *GetOperationIrForActivation(const infer::ActivationType
     return nullptr;
 }
 
-static Mki::OperationIr *GetOperationIrForActivation950(const infer::ActivationType activationType)
+static const OperationIr *GetOperationIrForActivation950(const infer::ActivationType activationType)
 {
     switch (activationType) {
         case atb::infer::ActivationType::ACTIVATION_GELU:
@@ -476,6 +476,12 @@ aclnnStatus ElewiseAclnnRunner::HandleQuant(aclOpExecutor** executor)
     return aclnnAscendQuantGetWorkspaceSizeFunc_(self, scale, offset, SQRT_MODE, ROUND_MODE.c_str(), DST_TYPE, AXIS, out, &(atbVariantPack_.workspaceBufferSize), executor);
 }
 
+bool ElewiseAclnnRunner::IsAclnnVariantPackReusable() const
+{
+    // QUANT类型按输入x重建scaleTensor_/offsetTensor_及其device内存
+    return false;
+}
+
 Status ElewiseAclnnRunner::LaunchAclnnKernel()
 {
     ATB_LOG(INFO) << GetLogPrefix() << "LaunchAclnnKernel execute start.";
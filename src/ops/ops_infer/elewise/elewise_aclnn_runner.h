@@ -74,6 +74,7 @@ protected:
                                        float paramValue,
                                        std::shared_ptr<AclNNTensor>& tensorPtr);
     Status LaunchAclnnKernel() override;
+    bool IsAclnnVariantPackReusable() const override;
     aclnnStatus SetAclNNWorkspaceExecutor() override;
     aclnnStatus HandleSub(aclOpExecutor** executor);
     aclnnStatus HandleCast(aclOpExecutor** executor);
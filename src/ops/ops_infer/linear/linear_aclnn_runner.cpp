@@ -116,10 +116,7 @@ Status LinearAclnnRunner::BuildAclnnVariantPack(const RunnerVariantPack &runnerV
     ATB_LOG(INFO) << GetLogPrefix()
                   << "LinearAclnnRunner::BuildAclnnVariantPack, runnerVariantPack: " << runnerVariantPack.ToString();
     atbVariantPack_ = runnerVariantPack;
-    isWeightNz_ = runnerVariantPack.inTensors[1].desc.format == ACL_FORMAT_FRACTAL_NZ;
-    isBatch_ = runnerVariantPack.inTensors[1].desc.shape.dimNum == 3 ||
-               (runnerVariantPack.inTensors[1].desc.shape.dimNum == 4 &&
-                runnerVariantPack.inTensors[1].desc.shape.dims[0] != 1);
+    InitWeightInfo(runnerVariantPack);
     InitTensorIndex();
     aclnnVariantPack_.aclInTensors.reserve(aclInTensorNum_);
     aclnnVariantPack_.aclInTensors.resize(aclInTensorNum_);
@@ -221,6 +218,21 @@ Status LinearAclnnRunner::LaunchAclnnKernel()
     return NO_ERROR;
 }
 
+Status LinearAclnnRunner::ReuseAclnnVariantPack(const RunnerVariantPack &runnerVariantPack)
+{
+    atbVariantPack_ = runnerVariantPack;
+    InitWeightInfo(runnerVariantPack);
+    return NO_ERROR;
+}
+
+void LinearAclnnRunner::InitWeightInfo(const RunnerVariantPack &runnerVariantPack)
+{
+    isWeightNz_ = runnerVariantPack.inTensors[1].desc.format == ACL_FORMAT_FRACTAL_NZ;
+    isBatch_ = runnerVariantPack.inTensors[1].desc.shape.dimNum == 3 ||
+               (runnerVariantPack.inTensors[1].desc.shape.dimNum == 4 &&
+                runnerVariantPack.inTensors[1].desc.shape.dims[0] != 1);
+}
+
 void LinearAclnnRunner::GetTensorNum()
 {
     if (param_.hasBias) {
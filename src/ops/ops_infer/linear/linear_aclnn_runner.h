@@ -42,9 +42,11 @@ protected:
     Status BuildAclnnVariantPack(const RunnerVariantPack &runnerVariantPack) override;
     aclnnStatus SetAclNNWorkspaceExecutor() override;
     Status LaunchAclnnKernel() override;
+    Status ReuseAclnnVariantPack(const RunnerVariantPack &runnerVariantPack) override;
 
 private:
     void GetTensorNum();
+    void InitWeightInfo(const RunnerVariantPack &runnerVariantPack);
     void InitTensorIndex();
     Status CreateMatmulSelfAclnnTensor();
     Status CreateMatmulMat2AclnnTensor();
@@ -62,6 +62,13 @@ Status LinearDequantAclnnRunner::LoadAclnnFuncs()
     return NO_ERROR;
 }
 
+Status LinearDequantAclnnRunner::ReuseAclnnVariantPack(const RunnerVariantPack &runnerVariantPack)
+{
+    atbVariantPack_ = runnerVariantPack;
+    isWeightNz_ = runnerVariantPack.inTensors[1].desc.format == ACL_FORMAT_FRACTAL_NZ;
+    return NO_ERROR;
+}
+
 Status LinearDequantAclnnRunner::BuildAclnnVariantPack(const RunnerVariantPack &runnerVariantPack)
 {
     ATB_LOG(INFO) << GetLogPrefix() << "LinearDequantAclnnRunner::BuildAclnnVariantPack"
@@ -34,6 +34,7 @@ protected:
     Status BuildAclnnVariantPack(const RunnerVariantPack &runnerVariantPack) override;
     aclnnStatus SetAclNNWorkspaceExecutor() override;
     Status LaunchAclnnKernel() override;
+    Status ReuseAclnnVariantPack(const RunnerVariantPack &runnerVariantPack) override;
 
 private:
     void GetTensorNum();
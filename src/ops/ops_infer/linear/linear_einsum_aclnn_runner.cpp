@@ -71,6 +71,13 @@ Status LinearEinsumAclnnRunner::LoadAclnnFuncs()
     return NO_ERROR;
 }
 
+Status LinearEinsumAclnnRunner::ReuseAclnnVariantPack(const RunnerVariantPack &runnerVariantPack)
+{
+    atbVariantPack_ = runnerVariantPack;
+    isWeightNz_ = runnerVariantPack.inTensors[1].desc.format == ACL_FORMAT_FRACTAL_NZ;
+    return NO_ERROR;
+}
+
 Status LinearEinsumAclnnRunner::BuildAclnnVariantPack(const RunnerVariantPack &runnerVariantPack)
 {
     ATB_LOG(INFO) << GetLogPrefix() << "LinearEinsumAclnnRunner::BuildAclnnVariantPack, runnerVariantPack: "
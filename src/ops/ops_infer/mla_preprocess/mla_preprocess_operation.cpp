@@ -461,6 +461,12 @@ Status MlaPreprocessOperation::CheckAclnnKernel(const SVector<TensorDesc> &inTen
     return NO_ERROR;
 }
 
+// InferShapeCheck时选择runner类型，CreateRunner依赖该结果，不能跳过校验
+bool MlaPreprocessOperation::IsInferShapeCacheable() const
+{
+    return false;
+}
+
 std::shared_ptr<Runner> MlaPreprocessOperation::CreateRunner(Context &context) const
 {
     (void)context;
@@ -24,6 +24,7 @@ protected:
     Status InferShapeImpl(const SVector<TensorDesc> &inTensorDescs, SVector<TensorDesc> &outTensorDescs) const override;
     std::shared_ptr<Runner> CreateRunner(Context &context) const override;
     Status InferShapeCheckImpl(const SVector<TensorDesc> &inTensorDescs) const override;
+    bool IsInferShapeCacheable() const override;
     Status SetupCheckImpl(const SVector<Tensor> &inTensors, const SVector<Tensor> &outTensors) const override;
     nlohmann::json GetParamJson() const override;
 
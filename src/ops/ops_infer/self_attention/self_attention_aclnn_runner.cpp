@@ -200,6 +200,12 @@ aclnnStatus SelfAttentionAclnnRunner::SetAclNNWorkspaceExecutor()
     return ret;
 }
 
+bool SelfAttentionAclnnRunner::IsAclnnVariantPackReusable() const
+{
+    // actualSeqLengths_按输入的seqLen重建，并在LaunchAclnnKernel后释放
+    return false;
+}
+
 Status SelfAttentionAclnnRunner::LaunchAclnnKernel()
 {
     ATB_LOG(INFO) << GetLogPrefix() << "SelfAttentionAclnnRunner::LaunchAclnnKernel";
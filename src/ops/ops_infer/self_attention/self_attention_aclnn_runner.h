@@ -66,6 +66,7 @@ protected:
     Status BuildAclnnVariantPack(const RunnerVariantPack &runnerVariantPack) override;
     aclnnStatus SetAclNNWorkspaceExecutor() override;
     Status LaunchAclnnKernel() override;
+    bool IsAclnnVariantPackReusable() const override;
 
 private:
     void GetTensorNum();
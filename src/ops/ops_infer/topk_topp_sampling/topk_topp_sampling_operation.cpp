@@ -57,7 +57,7 @@ bool ParamCheck(const atb::infer::TopkToppSamplingParam &opParam)
 namespace atb {
 OPERATION_PARAM_FUNCS(TopkToppSamplingOperation, infer::TopkToppSamplingParam)
 
-static Mki::OperationIr *GetOperationIrForTopkToppSampling(const infer::TopkToppSamplingParam &param)
+static const OperationIr *GetOperationIrForTopkToppSampling(const infer::TopkToppSamplingParam &param)
 {
     switch (param.topkToppSamplingType) {
         case atbInferTopkToppSamplingType::BATCH_TOPK_EXPONENTIAL_SAMPLING:
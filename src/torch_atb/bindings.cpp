@@ -17,6 +17,7 @@
 #include <sstream>
 #include <atb/utils/param_to_json.h>
 #include "graph_operation_builder.h"
+#include "atb/utils/reshape_spec.h"
 #include "enger_graph_builder.h"
 #include "graph_node.h"
 #include "resource/memory_manager.h"
@@ -41,10 +42,45 @@ PYBIND11_MODULE(_C, m)
 
     m.def("set_buffer_size", static_cast<void(*)(uint64_t)>(&TorchAtb::MemoryManager::SetBufferSize),
           py::arg("bytes"), "Set default workspace buffer size (bytes)");
+    m.def("forward_batch", &TorchAtb::OperationWrapper::ForwardBatch, py::arg("operations"), py::arg("inputs"),
+          "Setup operations one by one, then execute them back-to-back with one tiling copy and one stream sync");
+
+    py::class_<atb::OpMemStatistic>(m, "OpMemStatistic")
+        .def_readonly("op_name", &atb::OpMemStatistic::opName)
+        .def_readonly("execute_count", &atb::OpMemStatistic::executeCount)
+        .def_readonly("workspace_size", &atb::OpMemStatistic::workspaceSize)
+        .def_readonly("intermediate_size", &atb::OpMemStatistic::intermediateSize)
+        .def_readonly("tiling_size", &atb::OpMemStatistic::tilingSize)
+        .def_readonly("max_workspace_size", &atb::OpMemStatistic::maxWorkspaceSize)
+        .def_readonly("max_intermediate_size", &atb::OpMemStatistic::maxIntermediateSize)
+        .def_readonly("max_tiling_size", &atb::OpMemStatistic::maxTilingSize)
+        .def_readonly("max_total_size", &atb::OpMemStatistic::maxTotalSize);
+
+    py::class_<atb::OpMemRecord>(m, "OpMemRecord")
+        .def_readonly("execute_index", &atb::OpMemRecord::executeIndex)
+        .def_readonly("op_name", &atb::OpMemRecord::opName)
+        .def_readonly("workspace_size", &atb::OpMemRecord::workspaceSize)
+        .def_readonly("intermediate_size", &atb::OpMemRecord::intermediateSize)
+        .def_readonly("tiling_size", &atb::OpMemRecord::tilingSize)
+        .def_readonly("peak_size", &atb::OpMemRecord::peakSize);
 
     py::class_<TorchAtb::ProfStats>(m, "Prof")
         .def_static("get_prof_stats", &TorchAtb::ProfStats::GetProfStats, py::return_value_policy::reference)
-        .def("get_run_time_stats", &TorchAtb::ProfStats::GetRunTimeStats);
+        .def("get_run_time_stats", &TorchAtb::ProfStats::GetRunTimeStats)
+        .def("set_mem_accounting_enable", &TorchAtb::ProfStats::SetMemAccountingEnable, py::arg("enable"))
+        .def("get_mem_stats", &TorchAtb::ProfStats::GetMemStats)
+        .def("get_mem_timeline", &TorchAtb::ProfStats::GetMemTimeline)
+        .def("reset_mem_stats", &TorchAtb::ProfStats::ResetMemStats)
+        .def("dump_mem_stats", &TorchAtb::ProfStats::DumpMemStats, py::arg("file_path"),
+             "Dump per-operation memory statistics, csv when file_path ends with .csv, otherwise json with timeline");
+
+    py::class_<atb::ReshapeSpec>(m, "ReshapeSpec")
+        .def_static("merge_dims", &atb::ReshapeSpec::MergeDims, py::arg("start"), py::arg("end"))
+        .def_static("split_dim", &atb::ReshapeSpec::SplitDim, py::arg("dim"), py::arg("sizes"))
+        .def_static("view", &atb::ReshapeSpec::View, py::arg("shape"))
+        .def_static("squeeze", &atb::ReshapeSpec::Squeeze, py::arg("dim"))
+        .def_static("unsqueeze", &atb::ReshapeSpec::Unsqueeze, py::arg("dim"))
+        .def("__repr__", &atb::ReshapeSpec::ToString);
 
     py::class_<TorchAtb::OperationWrapper>(m, "Operation")
         .def(py::init<const LayerNormParam &>())
@@ -84,7 +120,13 @@ PYBIND11_MODULE(_C, m)
         .def_property_readonly("name", &TorchAtb::OperationWrapper::GetName)
         .def_property_readonly("input_num", &TorchAtb::OperationWrapper::GetInputNum)
         .def_property_readonly("output_num", &TorchAtb::OperationWrapper::GetOutputNum)
-        .def("forward", &TorchAtb::OperationWrapper::Forward)
+        .def("save_graph", &TorchAtb::OperationWrapper::SaveGraph, py::arg("file_path"))
+        .def_static("load_graph", &TorchAtb::OperationWrapper::LoadGraph, py::arg("file_path"))
+        // Setup/Execute不依赖Python对象，释放GIL；Python reshape回调会由pybind11自行重新获取GIL
+        .def("forward", &TorchAtb::OperationWrapper::Forward, py::call_guard<py::gil_scoped_release>())
+        .def("warmup", &TorchAtb::OperationWrapper::Warmup, py::arg("buckets"),
+             "Run infer shape, setup and tiling for each input shape bucket without launching, "
+             "return warm-up time (us) of each bucket")
         .def("__repr__", [](const TorchAtb::OperationWrapper &opWrapper) {
             std::stringstream ss;
             ss << "op name: " << opWrapper.GetName() << ", input_num: " << opWrapper.GetInputNum()
@@ -171,7 +213,10 @@ PYBIND11_MODULE(_C, m)
                              &TorchAtb::GraphBuilder::AddNode))
         .def("add_node", py::overload_cast<const std::vector<std::string> &, TorchAtb::OperationWrapper &>(
                              &TorchAtb::GraphBuilder::AddNode))
-        .def("reshape", &TorchAtb::GraphBuilder::Reshape)
+        .def("reshape", py::overload_cast<const std::string &, const atb::ReshapeSpec &, const std::string &>(
+                            &TorchAtb::GraphBuilder::Reshape))
+        .def("reshape", py::overload_cast<const std::string &, const TorchAtb::ReshapeHandler &, const std::string &>(
+                            &TorchAtb::GraphBuilder::Reshape))
         .def("mark_output", &TorchAtb::GraphBuilder::MarkOutput)
         .def("set_execute_streams", &TorchAtb::GraphBuilder::SetExecuteStreams)
         .def("build", &TorchAtb::GraphBuilder::Build);
@@ -179,7 +224,10 @@ PYBIND11_MODULE(_C, m)
     py::class_<TorchAtb::GraphOperationBuilder>(m, "GraphBuilder")
         .def(py::init<const std::string &>())
         .def("set_input_output", &TorchAtb::GraphOperationBuilder::SetInputOutput)
-        .def("reshape", &TorchAtb::GraphOperationBuilder::Reshape)
+        .def("reshape", py::overload_cast<const std::string &, const atb::ReshapeSpec &, const std::string &>(
+                            &TorchAtb::GraphOperationBuilder::Reshape))
+        .def("reshape", py::overload_cast<const std::string &, const TorchAtb::ReshapeHandler &, const std::string &>(
+                            &TorchAtb::GraphOperationBuilder::Reshape))
         .def("add_operation", &TorchAtb::GraphOperationBuilder::AddOperation)
         .def("build", &TorchAtb::GraphOperationBuilder::Build);
 
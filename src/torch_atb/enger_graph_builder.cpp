@@ -243,6 +243,14 @@ GraphBuilder &GraphBuilder::Reshape(const std::string &srcTensorName, const Resh
     return *this;
 }
 
+GraphBuilder &GraphBuilder::Reshape(const std::string &srcTensorName, const atb::ReshapeSpec &reshapeSpec,
+                                    const std::string &reshapedTensorName)
+{
+    // 声明式规则在C++侧计算新shape，Setup时不再回调Python
+    reshapedTensorIds_[reshapedTensorName] = {srcTensorName, reshapeSpec.ToReshapeFunc()};
+    return *this;
+}
+
 void GraphBuilder::MarkOutput(const std::string &outTensor)
 {
     bool findOutput = false;
@@ -12,6 +12,7 @@
 #include "atb/atb_infer.h"
 #include "graph_node.h"
 #include "operation_wrapper.h"
+#include "atb/utils/reshape_spec.h"
  
 namespace TorchAtb {
 using ReshapeHandler = std::function<std::vector<int64_t>(const std::vector<int64_t> &oldShape)>;
@@ -57,6 +58,8 @@ public:
     GraphNode &AddNode(const std::vector<std::string> &inputs, OperationWrapper &opWrapper);
     GraphBuilder &Reshape(const std::string &srcTensorName, const ReshapeHandler &reshapeHandler,
                                 const std::string &reshapedTensorName);
+    GraphBuilder &Reshape(const std::string &srcTensorName, const atb::ReshapeSpec &reshapeSpec,
+                          const std::string &reshapedTensorName);
     void MarkOutput(const std::string &outTensor);
     void SetExecuteStreams(const std::vector<std::uintptr_t> &executeStreams);
     OperationWrapper Build();
@@ -101,6 +101,15 @@ GraphOperationBuilder &GraphOperationBuilder::Reshape(const std::string &srcTens
     return *this;
 }
 
+GraphOperationBuilder &GraphOperationBuilder::Reshape(const std::string &srcTensorName,
+                                                      const atb::ReshapeSpec &reshapeSpec,
+                                                      const std::string &reshapedTensorName)
+{
+    // 声明式规则在C++侧计算新shape，Setup时不再回调Python
+    reshapedTensorIds_[reshapedTensorName] = {GetTensorId(srcTensorName), reshapeSpec.ToReshapeFunc()};
+    return *this;
+}
+
 OperationWrapper GraphOperationBuilder::Build()
 {
     graphParam_.internalTensorNum = internalTensorNum_;
@@ -11,6 +11,7 @@
 #define TORCH_ATB_GRAPH_OPERATION_BUILDER_H
 #include "atb/atb_infer.h"
 #include "operation_wrapper.h"
+#include "atb/utils/reshape_spec.h"
 
 namespace TorchAtb {
 using ReshapeHandler = std::function<std::vector<int64_t>(const std::vector<int64_t> &oldShape)>;
@@ -24,6 +25,8 @@ public:
                                         const std::vector<std::string> &outTensorNames);
     GraphOperationBuilder &Reshape(const std::string &srcTensorName, const ReshapeHandler &reshapeHandler,
                                    const std::string &reshapedTensorName);
+    GraphOperationBuilder &Reshape(const std::string &srcTensorName, const atb::ReshapeSpec &reshapeSpec,
+                                   const std::string &reshapedTensorName);
     OperationWrapper Build();
 
 private:
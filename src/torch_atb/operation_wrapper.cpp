@@ -8,7 +8,9 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 #include "operation_wrapper.h"
+#include <algorithm>
 #include <stdexcept>
+#include <unordered_set>
 #include <mki/utils/time/timer.h>
 #include "atb/utils/log.h"
 #include "resource/utils.h"
@@ -20,6 +22,10 @@ namespace TorchAtb {
 using namespace atb;
 using namespace atb::infer;
 
+// 每个Operation的Setup从Context的host tiling环形内存池(默认128块)取一块，ExecuteBatch汇总tiling时还需额外的块，
+// 一次Setup过多的Operation会使先Setup的tiling被覆盖，因此按段Setup并下发
+constexpr size_t FORWARD_BATCH_CHUNK_SIZE = 64;
+
 OperationWrapper &OperationWrapper::operator=(OperationWrapper &&other) noexcept
 {
     if (this != &other) {
@@ -213,6 +219,26 @@ OperationWrapper::OperationWrapper(const GraphParam &param)
     CreateOpUniquePtr(param);
 }
 
+OperationWrapper::OperationWrapper(Operation *operation) : operation_(operation) {}
+
+void OperationWrapper::SaveGraph(const std::string &filePath) const
+{
+    Status st = SaveGraphOperation(operation_.get(), filePath);
+    if (st != NO_ERROR) {
+        throw std::runtime_error("Failed to save graph operation to " + filePath + ", error: " + std::to_string(st));
+    }
+}
+
+OperationWrapper OperationWrapper::LoadGraph(const std::string &filePath)
+{
+    Operation *operation = nullptr;
+    Status st = LoadGraphOperation(filePath, &operation);
+    if (st != NO_ERROR) {
+        throw std::runtime_error("Failed to load graph operation from " + filePath + ", error: " + std::to_string(st));
+    }
+    return OperationWrapper(operation);
+}
+
 std::string OperationWrapper::GetName() const
 {
     return operation_->GetName();
@@ -241,6 +267,105 @@ std::vector<torch::Tensor> OperationWrapper::Forward(std::vector<torch::Tensor>
     return outTensors;
 }
 
+std::vector<uint64_t> OperationWrapper::Warmup(std::vector<std::vector<torch::Tensor>> &buckets)
+{
+    if (!operation_) {
+        throw std::runtime_error("call Warmup fail, operation is nullptr");
+    }
+    std::vector<atb::SVector<atb::TensorDesc>> bucketDescs(buckets.size());
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        bucketDescs.at(i).resize(buckets.at(i).size());
+        for (size_t j = 0; j < buckets.at(i).size(); ++j) {
+            bucketDescs.at(i).at(j) = Utils::ConvertToAtbTensor(buckets.at(i).at(j)).desc;
+        }
+    }
+    std::vector<atb::WarmupBucketResult> results;
+    Status st = atb::Warmup(operation_.get(), bucketDescs, Utils::GetAtbContext(), results);
+    if (st != NO_ERROR) {
+        throw std::runtime_error("call atb::Warmup fail, error: " + std::to_string(st));
+    }
+    std::vector<uint64_t> costTimeUs(results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        costTimeUs.at(i) = results.at(i).costTimeUs;
+    }
+    return costTimeUs;
+}
+
+std::vector<std::vector<torch::Tensor>> OperationWrapper::ForwardBatch(
+    std::vector<OperationWrapper *> &operations, std::vector<std::vector<torch::Tensor>> &inTensors)
+{
+    Mki::Timer runTimer;
+    if (operations.size() != inTensors.size()) {
+        throw std::runtime_error("call ForwardBatch fail, operations size is not equal to inputs size");
+    }
+    for (size_t i = 0; i < operations.size(); ++i) {
+        if (operations.at(i) == nullptr || !operations.at(i)->operation_) {
+            throw std::runtime_error("call ForwardBatch fail, operation is nullptr");
+        }
+    }
+    std::vector<std::vector<torch::Tensor>> outTensors(operations.size());
+    std::vector<atb::ExecuteBatchItem> items;
+    std::unordered_set<const OperationWrapper *> pendingOperations;
+    for (size_t i = 0; i < operations.size(); ++i) {
+        OperationWrapper *operation = operations.at(i);
+        // 再次Setup会覆盖Operation内部的runner与tiling状态，同一Operation重复出现时先下发已Setup的部分
+        if (items.size() == FORWARD_BATCH_CHUNK_SIZE || pendingOperations.count(operation) != 0) {
+            ExecuteBatchItems(items);
+            items.clear();
+            pendingOperations.clear();
+        }
+        operation->Setup(inTensors.at(i), outTensors.at(i));
+        atb::ExecuteBatchItem item;
+        item.operation = operation->operation_.get();
+        item.variantPack = operation->variantPack_;
+        item.workspaceSize = operation->workspaceSize_;
+        items.push_back(item);
+        pendingOperations.insert(operation);
+    }
+    ExecuteBatchItems(items);
+    if (!Utils::IsTaskQueueEnable()) {
+        int ret = aclrtSynchronizeStream(Utils::GetAtbContext()->GetExecuteStream());
+        if (ret != 0) {
+            throw std::runtime_error("call aclrtSynchronizeStream fail");
+        }
+    }
+    ProfStats::GetProfStats().SetRunTime("ExecuteBatch", runTimer.ElapsedMicroSecond());
+    return outTensors;
+}
+
+void OperationWrapper::ExecuteBatchItems(std::vector<atb::ExecuteBatchItem> &items)
+{
+    if (items.empty()) {
+        return;
+    }
+    uint64_t totalWorkspaceSize = 0;
+    for (const atb::ExecuteBatchItem &item : items) {
+        totalWorkspaceSize += item.workspaceSize;
+    }
+    uint8_t *workspace = nullptr;
+    if (totalWorkspaceSize > 0) {
+        workspace = (uint8_t *)MemoryManager::GetMemoryManager().GetWorkspaceBuffer(totalWorkspaceSize);
+    }
+    uint64_t workspaceOffset = 0;
+    for (atb::ExecuteBatchItem &item : items) {
+        item.workspace = item.workspaceSize > 0 ? workspace + workspaceOffset : nullptr;
+        workspaceOffset += item.workspaceSize;
+    }
+    atb::Context *context = Utils::GetAtbContext();
+    if (Utils::IsTaskQueueEnable()) {
+        ATB_LOG(DEBUG) << "IsTaskQueueEnable";
+        at_npu::native::OpCommand cmd;
+        cmd.Name("ExecuteBatch");
+        cmd.SetCustomHandler([=]() { return atb::ExecuteBatch(items, context); });
+        cmd.Run();
+    } else {
+        Status st = atb::ExecuteBatch(items, context);
+        if (st != NO_ERROR) {
+            throw std::runtime_error("call atb::ExecuteBatch fail");
+        }
+    }
+}
+
 atb::SVector<atb::TensorDesc> OperationWrapper::InferShape()
 {
     if (!operation_) {
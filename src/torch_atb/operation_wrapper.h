@@ -65,18 +65,29 @@ public:
     explicit OperationWrapper(const atb::infer::AllToAllParam &param);
     explicit OperationWrapper(const atb::GraphParam &param);
     atb::Operation *ReleaseOperation();
+    // 图算子保存为文件，之后可由LoadGraph直接在C++侧创建，无需再经Python构图
+    void SaveGraph(const std::string &filePath) const;
+    static OperationWrapper LoadGraph(const std::string &filePath);
     std::string GetName() const;
     uint32_t GetInputNum() const;
     uint32_t GetOutputNum() const;
     std::vector<torch::Tensor> Forward(std::vector<torch::Tensor> &inTensors);
+    // 按各档位示例输入的描述信息预热，不下发；返回各档位预热耗时(us)
+    std::vector<uint64_t> Warmup(std::vector<std::vector<torch::Tensor>> &buckets);
+    // 批量执行：分段依次Setup后共用一块workspace，通过atb::ExecuteBatch下发，只做一次流同步；
+    // 同一Operation在一段内重复出现时从该处分段
+    static std::vector<std::vector<torch::Tensor>> ForwardBatch(std::vector<OperationWrapper *> &operations,
+                                                                std::vector<std::vector<torch::Tensor>> &inTensors);
 
 private:
+    explicit OperationWrapper(atb::Operation *operation);
     template <typename OpParam> void CreateOpUniquePtr(const OpParam &param);
     atb::SVector<atb::TensorDesc> InferShape();
     void Setup(std::vector<torch::Tensor> &inTensors, std::vector<torch::Tensor> &outTensors);
     void Execute();
     void BuildInTensorVariantPack(std::vector<torch::Tensor> &inTensors);
     void BuildOutTensorVariantPack();
+    static void ExecuteBatchItems(std::vector<atb::ExecuteBatchItem> &items);
 
 private:
     std::unique_ptr<atb::Operation> operation_;
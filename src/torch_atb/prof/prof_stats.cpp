@@ -8,6 +8,7 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 #include "prof_stats.h"
+#include <stdexcept>
 #include <thread>
 
 namespace TorchAtb {
@@ -40,4 +41,31 @@ std::vector<uint64_t> ProfStats::GetRunTimeStats(const std::string &opName)
     }
 }
 
+void ProfStats::SetMemAccountingEnable(bool enable)
+{
+    atb::Utils::SetMemAccountingEnable(enable);
+}
+
+std::vector<atb::OpMemStatistic> ProfStats::GetMemStats()
+{
+    return atb::Utils::GetOpMemStatistics();
+}
+
+std::vector<atb::OpMemRecord> ProfStats::GetMemTimeline()
+{
+    return atb::Utils::GetOpMemRecords();
+}
+
+void ProfStats::ResetMemStats()
+{
+    atb::Utils::ResetMemAccounting();
+}
+
+void ProfStats::DumpMemStats(const std::string &filePath)
+{
+    atb::Status st = atb::Utils::DumpMemAccounting(filePath);
+    if (st != atb::NO_ERROR) {
+        throw std::runtime_error("Failed to dump mem stats to " + filePath + ", error: " + std::to_string(st));
+    }
+}
 } // namespace TorchAtb
\ No newline at end of file
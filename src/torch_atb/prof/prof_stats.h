@@ -14,6 +14,7 @@
 #include <string>
 #include <map>
 #include <vector>
+#include "atb/utils.h"
 
 namespace TorchAtb {
 constexpr size_t MAX_RUN_TIMES = 1000;
@@ -25,6 +26,12 @@ public:
     static ProfStats &GetProfStats();
     void SetRunTime(const std::string &opName, uint64_t runTime);
     std::vector<uint64_t> GetRunTimeStats(const std::string &opName);
+    // device内存记录为进程级数据，转发到atb::Utils
+    void SetMemAccountingEnable(bool enable);
+    std::vector<atb::OpMemStatistic> GetMemStats();
+    std::vector<atb::OpMemRecord> GetMemTimeline();
+    void ResetMemStats();
+    void DumpMemStats(const std::string &filePath);
 
 private:
     std::map<std::string, std::vector<uint64_t>> runTimeStatsMap;
@@ -0,0 +1,56 @@
+import torch
+import torch_atb
+import unittest
+import logging
+
+def run_test():
+    print("----------- forward_batch test begin ------------")
+    elewise_param = torch_atb.ElewiseParam()
+    elewise_param.elewise_type = torch_atb.ElewiseParam.ElewiseType.ELEWISE_ADD
+    operations = [torch_atb.Operation(elewise_param) for _ in range(4)]
+    inputs = []
+    for i in range(len(operations)):
+        x = torch.full((16, 1024), float(i), dtype=torch.float16).npu()
+        y = torch.ones(16, 1024, dtype=torch.float16).npu()
+        inputs.append([x, y])
+    outputs = torch_atb.forward_batch(operations, inputs)
+    logging.info("outputs: %s", outputs)
+    assert len(outputs) == len(operations)
+    for i, output in enumerate(outputs):
+        golden = inputs[i][0] + inputs[i][1]
+        assert torch.allclose(output[0].cpu(), golden.cpu(), rtol=1e-3, atol=1e-3)
+    print("----------- forward_batch test success ------------")
+
+class TestForwardBatch(unittest.TestCase):
+    def test_forward_batch(self):
+        run_test()
+
+    def test_repeated_operation(self):
+        # 同一operation在一次forward_batch中多次出现，且各次输入shape不同，每次的输出都应对应各自的输入
+        elewise_param = torch_atb.ElewiseParam()
+        elewise_param.elewise_type = torch_atb.ElewiseParam.ElewiseType.ELEWISE_ADD
+        op_a = torch_atb.Operation(elewise_param)
+        op_b = torch_atb.Operation(elewise_param)
+        operations = [op_a, op_b, op_a, op_a]
+        shapes = [(16, 1024), (16, 1024), (16, 1024), (8, 512)]
+        inputs = []
+        for i, shape in enumerate(shapes):
+            x = torch.full(shape, float(i + 1), dtype=torch.float16).npu()
+            y = torch.full(shape, 2.0, dtype=torch.float16).npu()
+            inputs.append([x, y])
+        outputs = torch_atb.forward_batch(operations, inputs)
+        self.assertEqual(len(outputs), len(operations))
+        for i, output in enumerate(outputs):
+            golden = inputs[i][0] + inputs[i][1]
+            self.assertEqual(output[0].shape, golden.shape)
+            self.assertTrue(torch.allclose(output[0].cpu(), golden.cpu(), rtol=1e-3, atol=1e-3))
+
+    def test_size_mismatch(self):
+        elewise_param = torch_atb.ElewiseParam()
+        elewise_param.elewise_type = torch_atb.ElewiseParam.ElewiseType.ELEWISE_ADD
+        operations = [torch_atb.Operation(elewise_param)]
+        with self.assertRaises(RuntimeError):
+            torch_atb.forward_batch(operations, [])
+
+if __name__ == "__main__":
+    unittest.main()
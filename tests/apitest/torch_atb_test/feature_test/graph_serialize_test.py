@@ -0,0 +1,93 @@
+#
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+#
+
+import os
+import tempfile
+import time
+import unittest
+import logging
+import torch
+import torch_atb
+
+LAYER_NUM = 32
+
+
+def build_layer_graph(use_spec=True):
+    # x[1, 2, 3] -> add -> [1, 6] -> mul -> [1, 2, 3] ... 共LAYER_NUM层
+    builder = torch_atb.Builder("LayerGraph")
+    add_param = torch_atb.ElewiseParam()
+    add_param.elewise_type = torch_atb.ElewiseParam.ElewiseType.ELEWISE_ADD
+    mul_param = torch_atb.ElewiseParam()
+    mul_param.elewise_type = torch_atb.ElewiseParam.ElewiseType.ELEWISE_MUL
+    current = builder.add_input("x")
+    for i in range(LAYER_NUM):
+        y = builder.add_input("y" + str(i))
+        z = builder.add_input("z" + str(i))
+        add_node = builder.add_node([current, y], add_param)
+        mul_in = "add_out_" + str(i)
+        if use_spec:
+            builder.reshape(add_node.get_output(0), torch_atb.ReshapeSpec.merge_dims(1, 2), mul_in)
+        else:
+            builder.reshape(add_node.get_output(0), lambda shape: [shape[0], shape[1] * shape[2]], mul_in)
+        mul_node = builder.add_node([mul_in, z], mul_param)
+        current = "out_" + str(i)
+        builder.reshape(mul_node.get_output(0), torch_atb.ReshapeSpec.split_dim(1, [2, -1]), current)
+    builder.mark_output(mul_node.get_output(0))
+    return builder.build()
+
+
+def make_inputs():
+    inputs = [torch.ones(1, 2, 3, dtype=torch.float16).npu()]
+    for _ in range(LAYER_NUM):
+        inputs.append(torch.ones(1, 2, 3, dtype=torch.float16).npu())
+        inputs.append(torch.full((1, 6), 0.5, dtype=torch.float16).npu())
+    return inputs
+
+
+class TestGraphSerialize(unittest.TestCase):
+    def setUp(self):
+        self.file_path = os.path.join(tempfile.gettempdir(), "torch_atb_graph_{}.json".format(os.getpid()))
+
+    def tearDown(self):
+        if os.path.exists(self.file_path):
+            os.remove(self.file_path)
+
+    def test_save_and_load(self):
+        graph = build_layer_graph()
+        graph.save_graph(self.file_path)
+        load_graph = torch_atb.Operation.load_graph(self.file_path)
+        self.assertEqual(load_graph.input_num, graph.input_num)
+        self.assertEqual(load_graph.output_num, graph.output_num)
+        inputs = make_inputs()
+        outputs = graph.forward(inputs)
+        load_outputs = load_graph.forward(inputs)
+        self.assertTrue(torch.equal(outputs[0].cpu(), load_outputs[0].cpu()))
+
+    def test_callback_reshape_not_serializable(self):
+        with self.assertRaises(RuntimeError):
+            build_layer_graph(use_spec=False).save_graph(self.file_path)
+        with self.assertRaises(RuntimeError):
+            torch_atb.Operation.load_graph(self.file_path + ".not_exist")
+
+    def test_load_latency(self):
+        # 对比经Python builder构图与从文件加载的耗时
+        start = time.perf_counter()
+        graph = build_layer_graph()
+        build_ms = (time.perf_counter() - start) * 1e3
+        graph.save_graph(self.file_path)
+        start = time.perf_counter()
+        torch_atb.Operation.load_graph(self.file_path)
+        load_ms = (time.perf_counter() - start) * 1e3
+        logging.info("%d layers graph, build: %.2f ms, load: %.2f ms", LAYER_NUM, build_ms, load_ms)
+        print("{} layers graph, build: {:.2f} ms, load: {:.2f} ms".format(LAYER_NUM, build_ms, load_ms))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,72 @@
+#
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+#
+
+import csv
+import json
+import os
+import tempfile
+import unittest
+import torch
+import torch_atb
+
+
+def create_add_op():
+    param = torch_atb.ElewiseParam()
+    param.elewise_type = torch_atb.ElewiseParam.ElewiseType.ELEWISE_ADD
+    return torch_atb.Operation(param)
+
+
+def make_inputs(batch):
+    return [torch.rand(batch, 1024, dtype=torch.float16).npu() for _ in range(2)]
+
+
+class TestMemAccounting(unittest.TestCase):
+    def setUp(self):
+        self.prof = torch_atb.Prof.get_prof_stats()
+        self.prof.set_mem_accounting_enable(True)
+        self.prof.reset_mem_stats()
+
+    def tearDown(self):
+        self.prof.set_mem_accounting_enable(False)
+        self.prof.reset_mem_stats()
+
+    def test_mem_stats(self):
+        op = create_add_op()
+        for batch in [1, 16, 4]:
+            op.forward(make_inputs(batch))
+        stats = self.prof.get_mem_stats()
+        self.assertEqual(len(stats), 1)
+        self.assertEqual(stats[0].op_name, op.name)
+        self.assertEqual(stats[0].execute_count, 3)
+        self.assertGreaterEqual(stats[0].max_total_size, stats[0].workspace_size + stats[0].tiling_size)
+        timeline = self.prof.get_mem_timeline()
+        self.assertEqual([record.execute_index for record in timeline], [0, 1, 2])
+        peaks = [record.peak_size for record in timeline]
+        self.assertEqual(peaks, sorted(peaks))
+
+    def test_dump(self):
+        create_add_op().forward(make_inputs(2))
+        prefix = os.path.join(tempfile.gettempdir(), "torch_atb_mem_{}".format(os.getpid()))
+        self.prof.dump_mem_stats(prefix + ".csv")
+        with open(prefix + ".csv") as csv_file:
+            rows = list(csv.DictReader(csv_file))
+        self.assertEqual(len(rows), 1)
+        self.assertEqual(int(rows[0]["executeCount"]), 1)
+        self.prof.dump_mem_stats(prefix + ".json")
+        with open(prefix + ".json") as json_file:
+            content = json.load(json_file)
+        self.assertEqual(content["executeCount"], 1)
+        self.assertEqual(len(content["timeline"]), 1)
+        os.remove(prefix + ".csv")
+        os.remove(prefix + ".json")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,129 @@
+#
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+#
+
+import os
+import threading
+import time
+import unittest
+import logging
+import torch
+import torch_atb
+
+RESHAPE_PAIR_NUM = 10 # 每层2次reshape，共20次
+BENCH_ITERATIONS = int(os.getenv("ATB_RESHAPE_BENCH_ITERATIONS", "200"))
+
+
+def build_layer_graph(use_spec):
+    # x[1, 2, 3] -> add -> [1, 6] -> mul -> [1, 2, 3] ... 共RESHAPE_PAIR_NUM层
+    builder = torch_atb.Builder("Graph")
+    add_param = torch_atb.ElewiseParam()
+    add_param.elewise_type = torch_atb.ElewiseParam.ElewiseType.ELEWISE_ADD
+    mul_param = torch_atb.ElewiseParam()
+    mul_param.elewise_type = torch_atb.ElewiseParam.ElewiseType.ELEWISE_MUL
+    current = builder.add_input("x")
+    for i in range(RESHAPE_PAIR_NUM):
+        y = builder.add_input("y" + str(i))
+        z = builder.add_input("z" + str(i))
+        add_node = builder.add_node([current, y], add_param)
+        mul_in = "add_out_" + str(i)
+        if use_spec:
+            builder.reshape(add_node.get_output(0), torch_atb.ReshapeSpec.merge_dims(1, 2), mul_in)
+        else:
+            builder.reshape(add_node.get_output(0), lambda shape: [shape[0], shape[1] * shape[2]], mul_in)
+        mul_node = builder.add_node([mul_in, z], mul_param)
+        current = "out_" + str(i)
+        if use_spec:
+            builder.reshape(mul_node.get_output(0), torch_atb.ReshapeSpec.split_dim(1, [2, -1]), current)
+        else:
+            builder.reshape(mul_node.get_output(0), lambda shape: [shape[0], 2, shape[1] // 2], current)
+    builder.mark_output(mul_node.get_output(0))
+    return builder.build()
+
+
+def make_inputs():
+    inputs = [torch.ones(1, 2, 3, dtype=torch.float16).npu()]
+    for _ in range(RESHAPE_PAIR_NUM):
+        inputs.append(torch.ones(1, 2, 3, dtype=torch.float16).npu())
+        inputs.append(torch.full((1, 6), 0.5, dtype=torch.float16).npu())
+    return inputs
+
+
+def golden():
+    result = torch.ones(1, 2, 3, dtype=torch.float16)
+    for _ in range(RESHAPE_PAIR_NUM):
+        result = ((result + 1).view(1, 6) * 0.5).view(1, 2, 3)
+    return result.view(1, 6)
+
+
+def measure_forward_us(graph, inputs):
+    graph.forward(inputs)
+    torch.npu.synchronize()
+    start = time.perf_counter()
+    for _ in range(BENCH_ITERATIONS):
+        graph.forward(inputs)
+    torch.npu.synchronize()
+    return (time.perf_counter() - start) * 1e6 / BENCH_ITERATIONS
+
+
+class GilContender:
+    # 纯Python死循环线程，持续争抢GIL
+    def __init__(self):
+        self.stop = False
+        self.thread = threading.Thread(target=self.run)
+
+    def __enter__(self):
+        self.thread.start()
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.stop = True
+        self.thread.join()
+
+    def run(self):
+        count = 0
+        while not self.stop:
+            count += 1
+
+
+class TestReshapeSpec(unittest.TestCase):
+    def test_spec_matches_golden(self):
+        outputs = build_layer_graph(True).forward(make_inputs())
+        self.assertTrue(torch.allclose(outputs[0].cpu(), golden()))
+
+    def test_spec_matches_callback(self):
+        inputs = make_inputs()
+        spec_outputs = build_layer_graph(True).forward(inputs)
+        callback_outputs = build_layer_graph(False).forward(inputs)
+        self.assertTrue(torch.equal(spec_outputs[0].cpu(), callback_outputs[0].cpu()))
+
+    def test_invalid_spec(self):
+        with self.assertRaises(RuntimeError):
+            torch_atb.ReshapeSpec.view([-1, -1])
+        with self.assertRaises(RuntimeError):
+            torch_atb.ReshapeSpec.split_dim(0, [])
+        with self.assertRaises(RuntimeError):
+            torch_atb.ReshapeSpec.merge_dims(2, 1)
+
+    def test_setup_latency(self):
+        # 20次reshape的层图，对比Python回调与声明式规则在有无GIL竞争时的单次forward耗时
+        inputs = make_inputs()
+        graphs = {"callback": build_layer_graph(False), "spec": build_layer_graph(True)}
+        results = {}
+        for name, graph in graphs.items():
+            results[(name, "idle")] = measure_forward_us(graph, inputs)
+            with GilContender():
+                results[(name, "gil_contended")] = measure_forward_us(graph, inputs)
+        for (name, mode), cost in results.items():
+            logging.info("reshape %s, %s: %.1f us/forward", name, mode, cost)
+            print("reshape {}, {}: {:.1f} us/forward".format(name, mode, cost))
+
+
+if __name__ == "__main__":
+    unittest.main()
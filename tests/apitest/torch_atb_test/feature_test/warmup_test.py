@@ -0,0 +1,54 @@
+#
+# Copyright (c) 2025 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+#
+
+import unittest
+import torch
+import torch_atb
+
+BATCH_BUCKETS = [1, 2, 4, 8, 16]
+HIDDEN_SIZE = 1024
+
+
+def create_add_op():
+    param = torch_atb.ElewiseParam()
+    param.elewise_type = torch_atb.ElewiseParam.ElewiseType.ELEWISE_ADD
+    return torch_atb.Operation(param)
+
+
+def make_inputs(batch):
+    return [torch.rand(batch, HIDDEN_SIZE, dtype=torch.float16).npu() for _ in range(2)]
+
+
+class TestWarmup(unittest.TestCase):
+    def test_warmup_result(self):
+        op = create_add_op()
+        costs = op.warmup([make_inputs(batch) for batch in BATCH_BUCKETS])
+        self.assertEqual(len(costs), len(BATCH_BUCKETS))
+        inputs = make_inputs(BATCH_BUCKETS[-1])
+        outputs = op.forward(inputs)
+        self.assertTrue(torch.equal(outputs[0].cpu(), (inputs[0] + inputs[1]).cpu()))
+
+    def test_invalid_bucket(self):
+        with self.assertRaises(RuntimeError):
+            create_add_op().warmup([[torch.rand(2, 2, dtype=torch.float16).npu()]])
+
+    def test_first_forward_after_warmup(self):
+        # 预热后各batch档位的首次forward结果正确；首次Setup命中缓存由C++用例TestWarmupThenSetupHitsCache校验
+        op = create_add_op()
+        op.warmup([make_inputs(batch) for batch in BATCH_BUCKETS])
+        for batch in BATCH_BUCKETS:
+            inputs = make_inputs(batch)
+            outputs = op.forward(inputs)
+            self.assertEqual(outputs[0].shape, inputs[0].shape)
+            self.assertTrue(torch.equal(outputs[0].cpu(), (inputs[0] + inputs[1]).cpu()))
+
+
+if __name__ == "__main__":
+    unittest.main()
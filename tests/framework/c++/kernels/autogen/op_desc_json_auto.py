@@ -113,7 +113,7 @@ def get_operation_json_func(operation_param_file):
     code_lines.append(
         f"void {struct_name}Json(const nlohmann::json &opDescJson, Mki::LaunchParam &launchParam)")
     code_lines.append("{")
-    code_lines.append(f"    {NAMESPACE}::OpParam::{struct_name} param;")
+    code_lines.append(f"    {NAMESPACE}::OpParam::{struct_name} param{{}};")
     for mem in mem_list:
         mem_type = mem[0]
         mem_name = mem[1]
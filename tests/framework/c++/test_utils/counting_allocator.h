@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef ATB_UNIT_TEST_COUNTING_ALLOCATOR_H
+#define ATB_UNIT_TEST_COUNTING_ALLOCATOR_H
+
+#include <cstdlib>
+#include "atb/context/allocator/allocator.h"
+
+namespace atb {
+// 使用malloc模拟底层Allocator，记录底层申请与释放次数
+class CountingAllocator : public Allocator {
+public:
+    CountingAllocator(size_t &allocNum, size_t &freeNum) : allocNum_(allocNum), freeNum_(freeNum) {}
+    void *Allocate(size_t bufferSize) override
+    {
+        allocNum_++;
+        return malloc(bufferSize);
+    }
+    Status Deallocate(void *addr) override
+    {
+        freeNum_++;
+        free(addr);
+        return NO_ERROR;
+    }
+
+private:
+    size_t &allocNum_;
+    size_t &freeNum_;
+};
+} // namespace atb
+#endif
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <acl/acl.h>
+#include "atb/context.h"
+#include "atb/context/tiling_buffer_pool/host_tiling_buffer_pool.h"
+#include "atb/utils/numa_util.h"
+
+using namespace atb;
+
+namespace {
+constexpr uint64_t BENCH_BLOCK_NUM = 16;
+constexpr uint64_t BENCH_BLOCK_SIZE = 1024 * 1024 * 3;
+constexpr uint64_t BENCH_FILL_SIZE = 4096; // 单个算子tiling数据的典型大小
+constexpr int DEFAULT_ITERATIONS = 2000;
+constexpr double BYTES_PER_GB = 1024.0 * 1024.0 * 1024.0;
+
+struct PlacementCase {
+    std::string name;
+    bool pinned = false;
+    int32_t numaNode = NUMA_NODE_ANY;
+};
+
+int GetIterations()
+{
+    const char *env = std::getenv("ATB_HOST_TILING_BENCH_ITERATIONS");
+    int iterations = env == nullptr ? DEFAULT_ITERATIONS : std::atoi(env);
+    return iterations > 0 ? iterations : DEFAULT_ITERATIONS;
+}
+
+std::vector<PlacementCase> GetPlacementCases()
+{
+    std::vector<PlacementCase> cases = {{"pageable", false, NUMA_NODE_ANY}, {"pinned", true, NUMA_NODE_ANY}};
+    int32_t currentNode = NumaUtil::GetCurrentNode();
+    if (currentNode < 0) {
+        return cases;
+    }
+    cases.push_back({"pageable_local", false, currentNode});
+    cases.push_back({"pinned_local", true, currentNode});
+    int32_t nodeNum = NumaUtil::GetNodeNum();
+    if (nodeNum > 1) {
+        int32_t remoteNode = (currentNode + 1) % nodeNum;
+        cases.push_back({"pageable_remote", false, remoteNode});
+        cases.push_back({"pinned_remote", true, remoteNode});
+    }
+    return cases;
+}
+} // namespace
+
+TEST(BenchmarkHostTilingMemory, Placement)
+{
+    /*
+        测试场景：不同锁页/NUMA放置方式下，逐块写入tiling数据并异步H2D拷贝到device
+        结果：输出每种放置方式的填充与拷贝吞吐，拷贝结果与源数据一致
+    */
+    ASSERT_EQ(aclrtSetDevice(0), ACL_SUCCESS);
+    aclrtStream stream = nullptr;
+    ASSERT_EQ(aclrtCreateStream(&stream), ACL_SUCCESS);
+    void *deviceBuffer = nullptr;
+    ASSERT_EQ(aclrtMalloc(&deviceBuffer, BENCH_BLOCK_NUM * BENCH_FILL_SIZE, ACL_MEM_MALLOC_HUGE_FIRST), ACL_SUCCESS);
+    std::vector<uint8_t> checkBuffer(BENCH_FILL_SIZE);
+
+    const int iterations = GetIterations();
+    std::cout << std::left << std::setw(18) << "placement" << std::setw(14) << "fill GB/s" << std::setw(14)
+              << "copy GB/s" << "copy us/op" << std::endl;
+    for (const PlacementCase &placement : GetPlacementCases()) {
+        HostTilingBufferPool pool(BENCH_BLOCK_NUM, BENCH_BLOCK_SIZE, placement.pinned, placement.numaNode);
+        ASSERT_EQ(pool.Init(), NO_ERROR) << placement.name;
+
+        auto fillStart = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            (void)memset(pool.GetBuffer(), i & 0xFF, BENCH_FILL_SIZE);
+        }
+        double fillSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - fillStart).count();
+
+        // 模拟下发流程：每次取一块tiling内存，写入后异步拷贝到device并记录拷贝事件，最后统一同步
+        auto copyStart = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            uint8_t *hostBuffer = pool.GetBuffer();
+            (void)memset(hostBuffer, i & 0xFF, BENCH_FILL_SIZE);
+            uint8_t *dst = static_cast<uint8_t *>(deviceBuffer) + (i % BENCH_BLOCK_NUM) * BENCH_FILL_SIZE;
+            ASSERT_EQ(aclrtMemcpyAsync(dst, BENCH_FILL_SIZE, hostBuffer, BENCH_FILL_SIZE,
+                                       ACL_MEMCPY_HOST_TO_DEVICE, stream),
+                      ACL_SUCCESS);
+            ASSERT_EQ(pool.RecordBufferCopy(hostBuffer, BENCH_FILL_SIZE, stream), NO_ERROR);
+        }
+        ASSERT_EQ(aclrtSynchronizeStream(stream), ACL_SUCCESS);
+        double copySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - copyStart).count();
+
+        int lastIndex = iterations - 1;
+        uint8_t *lastDst = static_cast<uint8_t *>(deviceBuffer) + (lastIndex % BENCH_BLOCK_NUM) * BENCH_FILL_SIZE;
+        ASSERT_EQ(aclrtMemcpy(checkBuffer.data(), BENCH_FILL_SIZE, lastDst, BENCH_FILL_SIZE,
+                              ACL_MEMCPY_DEVICE_TO_HOST),
+                  ACL_SUCCESS);
+        EXPECT_EQ(checkBuffer.at(0), static_cast<uint8_t>(lastIndex & 0xFF)) << placement.name;
+        EXPECT_EQ(checkBuffer.at(BENCH_FILL_SIZE - 1), static_cast<uint8_t>(lastIndex & 0xFF)) << placement.name;
+        pool.Destroy();
+
+        double totalGb = static_cast<double>(BENCH_FILL_SIZE) * iterations / BYTES_PER_GB;
+        std::cout << std::left << std::setw(18) << placement.name << std::setw(14) << std::fixed
+                  << std::setprecision(3) << totalGb / fillSeconds << std::setw(14) << totalGb / copySeconds
+                  << copySeconds * 1e6 / iterations << std::endl;
+    }
+
+    aclrtFree(deviceBuffer);
+    aclrtDestroyStream(stream);
+}
+
+TEST(BenchmarkHostTilingMemory, CreateContextWithOptions)
+{
+    /*
+        测试场景：通过CreateContext指定锁页与NUMA放置
+        结果：合法节点创建成功，非法节点返回ERROR_INVALID_PARAM
+    */
+    ASSERT_EQ(aclrtSetDevice(0), ACL_SUCCESS);
+    HostTilingMemoryOptions options;
+    options.pinned = true;
+    options.numaNode = NUMA_NODE_CURRENT;
+    Context *context = nullptr;
+    ASSERT_EQ(CreateContext(&context, 128, 32, options), NO_ERROR);
+    ASSERT_NE(context, nullptr);
+    EXPECT_EQ(DestroyContext(context), NO_ERROR);
+
+    options.numaNode = NumaUtil::GetNodeNum();
+    context = nullptr;
+    EXPECT_EQ(CreateContext(&context, 128, 32, options), ERROR_INVALID_PARAM);
+    EXPECT_EQ(context, nullptr);
+}
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+// host侧tiling性能与确定性基准，结果输出到日志，ATB_TILING_BENCH_REPORT指定路径时另写csv：
+// 枚举已注册的算子，按shape扫描调用tiling函数，统计单次耗时与tiling字节数，
+// 同一LaunchParam两次tiling结果不一致时用例失败(KernelCache按LaunchParam复用tiling，结果必须确定)
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <mki/launch_param.h>
+#include <mki/utils/log/log.h>
+#include "asdops/ops.h"
+#include "asdops/params/params.h"
+#include "atbops/ops.h"
+#include "atbops/params/params.h"
+#include "op_desc_json.h"
+
+using namespace Mki;
+
+namespace {
+constexpr uint32_t DEFAULT_ITERATIONS = 20;
+constexpr uint8_t FILL_ZERO = 0;
+constexpr uint8_t FILL_ONES = 0xFF;
+constexpr int64_t PA_BLOCK_SIZE = 128;
+constexpr int64_t HEAD_DIM = 128;
+constexpr int64_t NUM_HEADS = 32;
+constexpr int64_t KV_HEADS = 8;
+constexpr int64_t MAX_DEFAULT_IN_TENSOR_NUM = 32;
+
+using AxisValues = std::map<std::string, int64_t>;
+using SweepAxes = std::vector<std::pair<std::string, std::vector<int64_t>>>;
+
+// 一组shape扫描：axes的笛卡尔积逐个交给build生成param与输入tensor
+struct TilingSweep {
+    std::string opName;
+    SweepAxes axes;
+    std::function<void(const AxisValues &, LaunchParam &)> build;
+};
+
+struct TilingStat {
+    uint64_t caseNum = 0;
+    uint64_t mismatchNum = 0;
+    double totalUs = 0;
+    double maxUs = 0;
+    uint64_t maxTilingBytes = 0;
+    uint64_t maxUnwrittenBytes = 0;
+};
+
+const TensorDType SWEEP_DTYPES[] = {TENSOR_DTYPE_FLOAT16, TENSOR_DTYPE_BF16, TENSOR_DTYPE_FLOAT};
+
+uint32_t GetIterations()
+{
+    const char *env = std::getenv("ATB_TILING_BENCH_ITERATIONS");
+    if (env == nullptr) {
+        return DEFAULT_ITERATIONS;
+    }
+    int iterations = std::atoi(env);
+    return iterations > 0 ? static_cast<uint32_t>(iterations) : DEFAULT_ITERATIONS;
+}
+
+void AddInTensor(LaunchParam &launchParam, TensorDType dtype, const SVector<int64_t> &dims)
+{
+    Tensor tensor = {{dtype, TENSOR_FORMAT_ND, dims}, nullptr, 0};
+    launchParam.AddInTensor(tensor);
+}
+
+void ForEachAxisValue(const SweepAxes &axes, size_t axisIdx, AxisValues &values,
+                      const std::function<void(const AxisValues &)> &func)
+{
+    if (axisIdx == axes.size()) {
+        func(values);
+        return;
+    }
+    for (int64_t value : axes[axisIdx].second) {
+        values[axes[axisIdx].first] = value;
+        ForEachAxisValue(axes, axisIdx + 1, values, func);
+    }
+}
+
+std::vector<TilingSweep> GetTilingSweeps()
+{
+    std::vector<TilingSweep> sweeps;
+    sweeps.push_back({"MatMulOperation",
+                      {{"dtype", {0, 1}}, {"m", {1, 16, 128, 1024, 4096}}, {"k", {4096, 11008}}, {"n", {4096, 12288}}},
+                      [](const AxisValues &v, LaunchParam &launchParam) {
+                          AsdOps::OpParam::MatMul param{};
+                          param.transposeB = true;
+                          launchParam.SetParam(param);
+                          TensorDType dtype = SWEEP_DTYPES[v.at("dtype")];
+                          AddInTensor(launchParam, dtype, {v.at("m"), v.at("k")});
+                          AddInTensor(launchParam, dtype, {v.at("n"), v.at("k")});
+                      }});
+    sweeps.push_back({"NormOperation",
+                      {{"dtype", {0, 1}}, {"s", {1, 128, 4096, 16384}}, {"h", {4096, 8192}}},
+                      [](const AxisValues &v, LaunchParam &launchParam) {
+                          AsdOps::OpParam::Norm param{};
+                          param.normType = AsdOps::OpParam::Norm::RMS_NORM;
+                          param.inGamma = true;
+                          param.epsilon = 1e-5f;
+                          launchParam.SetParam(param);
+                          TensorDType dtype = SWEEP_DTYPES[v.at("dtype")];
+                          AddInTensor(launchParam, dtype, {v.at("s"), v.at("h")});
+                          AddInTensor(launchParam, dtype, {v.at("h")});
+                      }});
+    sweeps.push_back({"PagedAttentionOperation",
+                      {{"batch", {1, 16, 64}}, {"kvSeqLen", {128, 1024, 4096}}},
+                      [](const AxisValues &v, LaunchParam &launchParam) {
+                          int64_t batch = v.at("batch");
+                          int64_t kvSeqLen = v.at("kvSeqLen");
+                          int64_t blockNum = (kvSeqLen + PA_BLOCK_SIZE - 1) / PA_BLOCK_SIZE;
+                          AtbOps::OpParam::PagedAttention param{};
+                          param.type = AtbOps::OpParam::PagedAttention::PAGED_ATTENTION_MASK_ND;
+                          param.headSize = NUM_HEADS;
+                          param.kvHead = KV_HEADS;
+                          param.tor = 1.0f / std::sqrt(static_cast<float>(HEAD_DIM));
+                          param.maskType = AtbOps::OpParam::PagedAttention::MASK_TYPE_NONE;
+                          param.kvSeqLen.assign(batch, static_cast<int32_t>(kvSeqLen));
+                          launchParam.SetParam(param);
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT16, {batch, NUM_HEADS, HEAD_DIM});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT16,
+                                      {batch * blockNum, PA_BLOCK_SIZE, KV_HEADS, HEAD_DIM});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT16,
+                                      {batch * blockNum, PA_BLOCK_SIZE, KV_HEADS, HEAD_DIM});
+                          AddInTensor(launchParam, TENSOR_DTYPE_INT32, {batch, blockNum});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT16, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_UINT64, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_INT32, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_UINT64, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_INT32, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT, {batch});
+                      }});
+    sweeps.push_back({"UnpadFlashAttentionOperation",
+                      {{"batch", {1, 4}}, {"seqLen", {128, 1024, 4096}}},
+                      [](const AxisValues &v, LaunchParam &launchParam) {
+                          int64_t batch = v.at("batch");
+                          int64_t seqLen = v.at("seqLen");
+                          AtbOps::OpParam::UnpadFlashAttention param{};
+                          param.type = AtbOps::OpParam::UnpadFlashAttention::UNPAD_FLASH_ATTENTION_ENCODER_ND;
+                          param.qSeqLen.assign(batch, static_cast<int32_t>(seqLen));
+                          param.kvSeqLen.assign(batch, static_cast<int32_t>(seqLen));
+                          param.headSize = NUM_HEADS;
+                          param.kvHead = KV_HEADS;
+                          param.tor = 1.0f / std::sqrt(static_cast<float>(HEAD_DIM));
+                          param.maskType = AtbOps::OpParam::UnpadFlashAttention::MASK_TYPE_NORM;
+                          launchParam.SetParam(param);
+                          int64_t tokens = batch * seqLen;
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT16, {tokens, NUM_HEADS, HEAD_DIM});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT16, {tokens, KV_HEADS, HEAD_DIM});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT16, {tokens, KV_HEADS, HEAD_DIM});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT16, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT16, {seqLen, seqLen});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_INT32, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_INT32, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT, {});
+                          AddInTensor(launchParam, TENSOR_DTYPE_FLOAT, {tokens});
+                      }});
+    return sweeps;
+}
+
+// 没有专门扫描的算子使用默认param，所有输入取相同的[s, h]
+TilingSweep GetDefaultSweep(Operation *op)
+{
+    std::string opName = op->GetName();
+    return {opName,
+            {{"dtype", {0, 1, 2}}, {"s", {1, 4096}}, {"h", {128, 8192}}},
+            [op, opName](const AxisValues &v, LaunchParam &launchParam) {
+                nlohmann::json opDescJson = {{"opName", opName}, {"specificParam", nlohmann::json::object()}};
+                AutoGen::JsonToOpParam(opDescJson, launchParam);
+                int64_t inTensorNum = std::min(op->GetInputNum(launchParam.GetParam()), MAX_DEFAULT_IN_TENSOR_NUM);
+                for (int64_t i = 0; i < inTensorNum; ++i) {
+                    AddInTensor(launchParam, SWEEP_DTYPES[v.at("dtype")], {v.at("s"), v.at("h")});
+                }
+            }};
+}
+
+class TilingBenchmark {
+public:
+    void Run(Operation *op, const TilingSweep &sweep)
+    {
+        AxisValues values;
+        ForEachAxisValue(sweep.axes, 0, values, [&](const AxisValues &axisValues) {
+            LaunchParam launchParam;
+            // 默认param可能不满足算子要求，构造或校验阶段抛出的异常按不支持的case处理
+            try {
+                sweep.build(axisValues, launchParam);
+                RunCase(op, launchParam);
+            } catch (const std::exception &e) {
+                MKI_LOG(WARN) << sweep.opName << " skip case, error: " << e.what();
+                ++rejectedNum_;
+            }
+        });
+    }
+
+    void Report(const std::vector<Operation *> &ops) const
+    {
+        for (const auto &it : stats_) {
+            const TilingStat &stat = it.second;
+            MKI_LOG(INFO) << it.first.first << " kernel " << it.first.second << " cases: " << stat.caseNum
+                          << ", avg(us): " << stat.totalUs / stat.caseNum << ", max(us): " << stat.maxUs
+                          << ", bytes: " << stat.maxTilingBytes << ", unwritten: " << stat.maxUnwrittenBytes;
+        }
+        for (Operation *op : ops) {
+            for (const auto *kernel : op->GetKernelList()) {
+                if (kernel != nullptr && selectedKernels_.count(kernel->GetName()) == 0) {
+                    MKI_LOG(INFO) << op->GetName() << " kernel " << kernel->GetName() << " not covered by sweeps";
+                }
+            }
+        }
+        MKI_LOG(INFO) << "tiling cases: " << caseNum_ << ", rejected launch params: " << rejectedNum_;
+        const char *reportPath = std::getenv("ATB_TILING_BENCH_REPORT");
+        if (reportPath != nullptr) {
+            WriteCsv(reportPath);
+        }
+    }
+
+    uint64_t GetCaseNum() const
+    {
+        return caseNum_;
+    }
+
+private:
+    void RunCase(Operation *op, LaunchParam &launchParam)
+    {
+        int64_t outTensorNum = op->GetOutputNum(launchParam.GetParam());
+        for (int64_t i = 0; i < outTensorNum; ++i) {
+            launchParam.AddOutTensor(Tensor());
+        }
+        if (!op->InferShape(launchParam).Ok()) {
+            ++rejectedNum_;
+            return;
+        }
+        std::unique_ptr<Kernel> kernel(op->GetBestKernel(launchParam));
+        if (kernel == nullptr) {
+            ++rejectedNum_;
+            return;
+        }
+        uint64_t tilingSize = kernel->GetTilingSize(launchParam);
+        std::vector<uint8_t> first(tilingSize);
+        std::vector<uint8_t> second(tilingSize);
+        std::vector<uint8_t> filled(tilingSize);
+        if (!Tiling(*kernel, launchParam, first, FILL_ZERO)) {
+            ++rejectedNum_;
+            return;
+        }
+        double totalUs = 0;
+        double maxUs = 0;
+        for (uint32_t i = 0; i < iterations_; ++i) {
+            auto begin = std::chrono::steady_clock::now();
+            Tiling(*kernel, launchParam, second, FILL_ZERO);
+            double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+            totalUs += us;
+            maxUs = std::max(maxUs, us);
+        }
+        Tiling(*kernel, launchParam, filled, FILL_ONES);
+        // 两次相同初值的结果必须一致；不同初值下不一致的字节是tiling函数未写入的部分，仅统计
+        uint64_t unwrittenBytes = 0;
+        for (uint64_t i = 0; i < tilingSize; ++i) {
+            unwrittenBytes += first[i] != filled[i] ? 1 : 0;
+        }
+        std::string kernelName = kernel->GetName();
+        TilingStat &stat = stats_[{op->GetName(), kernelName}];
+        bool deterministic = first == second;
+        EXPECT_TRUE(deterministic) << op->GetName() << " " << kernelName
+                                   << " tiling is not deterministic, launchParam:\n" << launchParam.ToString();
+        stat.mismatchNum += deterministic ? 0 : 1;
+        stat.caseNum++;
+        stat.totalUs += totalUs / iterations_;
+        stat.maxUs = std::max(stat.maxUs, maxUs);
+        stat.maxTilingBytes = std::max(stat.maxTilingBytes, tilingSize);
+        stat.maxUnwrittenBytes = std::max(stat.maxUnwrittenBytes, unwrittenBytes);
+        selectedKernels_.insert(kernelName);
+        ++caseNum_;
+    }
+
+    static bool Tiling(Kernel &kernel, const LaunchParam &launchParam, std::vector<uint8_t> &buffer, uint8_t fill)
+    {
+        std::fill(buffer.begin(), buffer.end(), fill);
+        kernel.SetLaunchWithTiling(false);
+        kernel.SetTilingHostAddr(buffer.data(), buffer.size());
+        return kernel.Init(launchParam).Ok();
+    }
+
+    void WriteCsv(const std::string &reportPath) const
+    {
+        std::ofstream ofs(reportPath);
+        ofs << "operation,kernel,cases,avg_us,max_us,tiling_bytes,unwritten_bytes,mismatch\n";
+        for (const auto &it : stats_) {
+            const TilingStat &stat = it.second;
+            ofs << it.first.first << "," << it.first.second << "," << stat.caseNum << ","
+                << stat.totalUs / stat.caseNum << "," << stat.maxUs << "," << stat.maxTilingBytes << ","
+                << stat.maxUnwrittenBytes << "," << stat.mismatchNum << "\n";
+        }
+    }
+
+    uint32_t iterations_ = GetIterations();
+    uint64_t caseNum_ = 0;
+    uint64_t rejectedNum_ = 0;
+    std::map<std::pair<std::string, std::string>, TilingStat> stats_;
+    std::set<std::string> selectedKernels_;
+};
+} // namespace
+
+TEST(BenchmarkKernelTiling, AllOperations)
+{
+    std::vector<Operation *> ops = AsdOps::Ops::Instance().GetAllOperations();
+    std::vector<Operation *> atbOps = AtbOps::Ops::Instance().GetAllOperations();
+    ops.insert(ops.end(), atbOps.begin(), atbOps.end());
+    ASSERT_FALSE(ops.empty());
+
+    std::map<std::string, std::vector<TilingSweep>> sweepMap;
+    for (auto &sweep : GetTilingSweeps()) {
+        sweepMap[sweep.opName].push_back(sweep);
+    }
+    TilingBenchmark benchmark;
+    for (Operation *op : ops) {
+        if (op == nullptr) {
+            continue;
+        }
+        auto it = sweepMap.find(op->GetName());
+        if (it == sweepMap.end()) {
+            benchmark.Run(op, GetDefaultSweep(op));
+            continue;
+        }
+        for (const auto &sweep : it->second) {
+            benchmark.Run(op, sweep);
+        }
+    }
+    benchmark.Report(ops);
+    EXPECT_GT(benchmark.GetCaseNum(), 0U);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include "atb/operation/atb_operation_ir_cfg.h"
+#include "atb/operation/operation_ir.h"
+#include "atb/utils/singleton.h"
+
+using namespace atb;
+
+// 逐个支持组合比较dtype与format，作为位图匹配的参照
+static bool NaiveMatch(const OperationIr &operationIr, const SVector<TensorDesc> &inTensorDescs)
+{
+    for (size_t supportIdx = 0; supportIdx < operationIr.GetSupportSize(); ++supportIdx) {
+        bool matched = true;
+        for (size_t i = 0; i < inTensorDescs.size() && matched; ++i) {
+            if (inTensorDescs[i].shape.dimNum == 0) {
+                continue;
+            }
+            const TensorInfoIr &tensorInfoIr = operationIr.GetInTensorInfoIr(i);
+            matched = inTensorDescs[i].dtype == tensorInfoIr.supportedDtypes[supportIdx] &&
+                      inTensorDescs[i].format == tensorInfoIr.supportedFormats[supportIdx];
+        }
+        if (matched) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void MakeRandomInTensorDescs(const OperationIr &operationIr, std::mt19937 &rng,
+                                    SVector<TensorDesc> &inTensorDescs)
+{
+    inTensorDescs.resize(operationIr.GetInTensorNum());
+    for (size_t i = 0; i < operationIr.GetInTensorNum(); ++i) {
+        const TensorInfoIr &tensorInfoIr = operationIr.GetInTensorInfoIr(i);
+        size_t supportIdx = rng() % operationIr.GetSupportSize();
+        inTensorDescs[i].dtype = tensorInfoIr.supportedDtypes[supportIdx];
+        inTensorDescs[i].format = tensorInfoIr.supportedFormats[supportIdx];
+        inTensorDescs[i].shape.dimNum = (rng() % 8 == 0) ? 0 : 1; // 部分tensor为空
+        inTensorDescs[i].shape.dims[0] = 1;
+        if (rng() % 5 == 0) {
+            inTensorDescs[i].dtype = ACL_DOUBLE;
+        }
+    }
+}
+
+TEST(BenchmarkOperationIr, IniMatch)
+{
+    auto begin = std::chrono::steady_clock::now();
+    const OperationIr *operationIr = GetSingleton<AtbOperationIrCfg>().GetOperationIr("GatherOperation");
+    auto firstLookupNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+    ASSERT_NE(operationIr, nullptr);
+
+    std::mt19937 rng(0);
+    const int caseNum = 256;
+    const int loopNum = 2000;
+    std::vector<SVector<TensorDesc>> cases(caseNum);
+    for (auto &inTensorDescs : cases) {
+        MakeRandomInTensorDescs(*operationIr, rng, inTensorDescs);
+    }
+    uint64_t matchCount = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < loopNum; ++i) {
+        for (const auto &inTensorDescs : cases) {
+            matchCount += operationIr->MatchInTensors(inTensorDescs) != 0 ? 1 : 0;
+        }
+    }
+    auto maskNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+    uint64_t naiveMatchCount = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < loopNum; ++i) {
+        for (const auto &inTensorDescs : cases) {
+            naiveMatchCount += NaiveMatch(*operationIr, inTensorDescs) ? 1 : 0;
+        }
+    }
+    auto naiveNs =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+    EXPECT_EQ(matchCount, naiveMatchCount);
+    double checkNum = static_cast<double>(caseNum) * loopNum;
+    std::cout << "first operation ir lookup: " << firstLookupNs << " ns, supportSize: "
+              << operationIr->GetSupportSize() << ", inTensorNum: " << operationIr->GetInTensorNum()
+              << ", bitmask match: " << maskNs / checkNum << " ns/check, naive match: " << naiveNs / checkNum
+              << " ns/check" << std::endl;
+}
@@ -116,4 +116,74 @@ TEST(TestOverflow, TestOverflowByAdd2)
     ASSERT_EQ(status.Ok(), true);
     ASSERT_EQ(g_isOverflowedVar, true);
     (void)aclFinalize();
-}
\ No newline at end of file
+}
+bool IsDeferredOverflowCheckEnableStub(void *)
+{
+    return true;
+}
+
+static atb::Tensor CreateFp16DeviceTensor(uint16_t value)
+{
+    atb::Tensor tensor;
+    tensor.desc.dtype = ACL_FLOAT16;
+    tensor.desc.format = ACL_FORMAT_ND;
+    tensor.desc.shape.dimNum = 1;
+    tensor.desc.shape.dims[0] = 1;
+    tensor.dataSize = sizeof(uint16_t);
+    (void)aclrtMalloc(&tensor.deviceData, tensor.dataSize, ACL_MEM_MALLOC_HUGE_FIRST);
+    (void)aclrtMemcpy(tensor.deviceData, tensor.dataSize, &value, sizeof(value), ACL_MEMCPY_HOST_TO_DEVICE);
+    return tensor;
+}
+
+// 测试场景：开启延迟溢出检测，同一context上多次执行会溢出的add
+// 测试结果：首次执行只提交检测不同步，检测读回后在重新执行中定位到溢出kernel并上报
+TEST(TestOverflow, TestDeferredOverflowByAdd)
+{
+    aclrtSetDeviceSatMode(ACL_RT_OVERFLOW_MODE_SATURATION);
+    bool is910B = GetSingleton<Config>().Is910B();
+    if (!is910B) {
+        return;
+    }
+    g_isOverflowedVar = false;
+    Stub stub;
+    stub.set(ADDR(Config, IsDeferredOverflowCheckEnable), IsDeferredOverflowCheckEnableStub);
+    stub.set(ADDR(Probe, ReportOverflowKernel), ReportOverflowKernelStub);
+    aclrtSetDevice(0);
+    atb::Context *context = nullptr;
+    ASSERT_EQ(atb::CreateContext(&context), atb::NO_ERROR);
+    aclrtStream stream = nullptr;
+    aclrtCreateStream(&stream);
+    context->SetExecuteStream(stream);
+    atb::infer::ElewiseParam param;
+    param.elewiseType = atb::infer::ElewiseParam::ElewiseType::ELEWISE_ADD;
+    atb::Operation *op = nullptr;
+    atb::CreateOperation<atb::infer::ElewiseParam>(param, &op);
+    ASSERT_NE(op, nullptr);
+    const uint16_t fp16Max = 0x7BFF;
+    atb::VariantPack variantPack;
+    variantPack.inTensors = {CreateFp16DeviceTensor(fp16Max), CreateFp16DeviceTensor(fp16Max)};
+    variantPack.outTensors = {CreateFp16DeviceTensor(0)};
+    const uint32_t runTimes = 4;
+    for (uint32_t i = 0; i < runTimes; ++i) {
+        uint64_t workspaceSize = 0;
+        ASSERT_EQ(op->Setup(variantPack, workspaceSize, context), atb::NO_ERROR);
+        void *workspace = nullptr;
+        if (workspaceSize > 0) {
+            aclrtMalloc(&workspace, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST);
+        }
+        EXPECT_EQ(op->Execute(variantPack, static_cast<uint8_t *>(workspace), workspaceSize, context),
+                  atb::NO_ERROR);
+        aclrtSynchronizeStream(stream);
+        if (workspace != nullptr) {
+            aclrtFree(workspace);
+        }
+    }
+    atb::DestroyOperation(op);
+    atb::DestroyContext(context);
+    aclrtDestroyStream(stream);
+    for (atb::Tensor &tensor : variantPack.inTensors) {
+        aclrtFree(tensor.deviceData);
+    }
+    aclrtFree(variantPack.outTensors.at(0).deviceData);
+    EXPECT_EQ(g_isOverflowedVar, true);
+}
@@ -45,4 +45,36 @@ TEST(TESTRUNNER, UNCOVEREDFUNCTIONS)
     runnerVariantPack.inTensors.at(0).desc = { ACL_INT32, ACL_FORMAT_ND, {1} };
     st = runner.Execute(runnerVariantPack);
     setenv("ATB_PROFILING_ENABLE", "0", 1);
-}
\ No newline at end of file
+}
+class DumpSampleRunner : public atb::Runner {
+public:
+    DumpSampleRunner() : atb::Runner("DumpSampleRunner") {}
+    bool GetDumpSampled() const
+    {
+        return IsDumpSampled();
+    }
+    std::vector<bool> sampledInExecute;
+
+private:
+    atb::Status ExecuteImpl(atb::RunnerVariantPack &runnerVariantPack) override
+    {
+        (void)runnerVariantPack;
+        sampledInExecute.push_back(IsDumpSampled());
+        return atb::NO_ERROR;
+    }
+};
+
+// 测试场景：多次Execute，每次执行中kernel级保存读取的采样结果与执行前后保存使用的结果一致
+// 测试结果：ExecuteImpl内读取的采样结果与Execute返回后的结果相同，未开启异步dump时恒为true
+TEST(TESTRUNNER, DumpSampledOncePerExecute)
+{
+    DumpSampleRunner runner;
+    atb::RunnerVariantPack runnerVariantPack;
+    const size_t executeNum = 4;
+    for (size_t i = 0; i < executeNum; ++i) {
+        runner.Execute(runnerVariantPack);
+        ASSERT_EQ(runner.sampledInExecute.size(), i + 1);
+        EXPECT_EQ(runner.sampledInExecute.back(), runner.GetDumpSampled());
+        EXPECT_TRUE(runner.GetDumpSampled());
+    }
+}
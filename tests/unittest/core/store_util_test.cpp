@@ -13,6 +13,7 @@
 #include <cstdlib>
 #include <gtest/gtest.h>
 #include "atb/utils/store_util.h"
+#include "atb/utils/runner_variant_pack.h"
 #include <atb/utils/log.h>
 #include <mki/utils/file_system/file_system.h>
 #include <mki/launch_param.h>
@@ -37,3 +38,22 @@ TEST(TestStoreUtil, TestWriteFile)
     EXPECT_EQ(isExist, true);
     Mki::FileSystem::DeleteFile(filePath);
 }
+
+// 测试场景：同一次执行采样结果为false时，执行前后的保存均被跳过
+// 测试结果：before与after目录均不生成，且未访问tensor数据与stream
+TEST(TestStoreUtil, TestSaveSkippedWhenNotSampled)
+{
+    std::vector<float> hostData(4, 1.0f);
+    atb::RunnerVariantPack runnerVariantPack;
+    runnerVariantPack.inTensors.resize(1);
+    runnerVariantPack.inTensors.at(0).desc = {ACL_FLOAT, ACL_FORMAT_ND, {1, {4}}};
+    runnerVariantPack.inTensors.at(0).deviceData = hostData.data();
+    runnerVariantPack.inTensors.at(0).dataSize = hostData.size() * sizeof(float);
+    runnerVariantPack.outTensors = runnerVariantPack.inTensors;
+    std::string dirPath = "store_util_sample_test";
+    bool sampled = false;
+    atb::StoreUtil::SaveVariantPack(nullptr, runnerVariantPack, dirPath + "/before", sampled);
+    atb::StoreUtil::SaveVariantPack(nullptr, runnerVariantPack, dirPath + "/after", sampled);
+    EXPECT_FALSE(Mki::FileSystem::Exists(dirPath + "/before"));
+    EXPECT_FALSE(Mki::FileSystem::Exists(dirPath + "/after"));
+}
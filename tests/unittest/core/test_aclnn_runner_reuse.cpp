@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include "atb/runner/aclnn_runner.h"
+#include "atb/utils/operation_register.h"
+#include "atb/utils.h"
+
+using namespace atb;
+
+namespace {
+// 与aclnn_runner.cpp中MAX_REUSABLE_ACLNN_VARIANT_PACK_NUM一致
+constexpr size_t REUSABLE_PACK_NUM = 16;
+
+// 只验证variant pack的保存、查找与淘汰，不创建真实的aclTensor和executor
+class FakeAclnnRunner : public AclnnRunner {
+public:
+    FakeAclnnRunner() : AclnnRunner("FakeAclnnRunner") {}
+
+    void SavePack(const RunnerVariantPack &runnerVariantPack, const std::shared_ptr<aclOpExecutor> &executor)
+    {
+        std::shared_ptr<AclNNTensor> aclnnTensor = std::make_shared<AclNNTensor>();
+        aclnnTensor->atbTensor = runnerVariantPack.inTensors.at(0);
+        aclnnVariantPack_.aclInTensors = {aclnnTensor};
+        aclnnVariantPack_.aclOutTensors.clear();
+        SaveReusableAclnnVariantPack(executor);
+    }
+
+    bool FetchPack(const RunnerVariantPack &runnerVariantPack)
+    {
+        return FetchReusableAclnnVariantPack(runnerVariantPack);
+    }
+
+    const AclNNVariantPack &GetAclnnVariantPack() const
+    {
+        return aclnnVariantPack_;
+    }
+
+protected:
+    Status BuildAclnnVariantPack(const RunnerVariantPack &runnerVariantPack) override
+    {
+        (void)runnerVariantPack;
+        return NO_ERROR;
+    }
+    aclnnStatus SetAclNNWorkspaceExecutor() override
+    {
+        return ACL_SUCCESS;
+    }
+    Status LaunchAclnnKernel() override
+    {
+        return NO_ERROR;
+    }
+};
+
+REG_RUNNER_TYPE(FakeAclnnRunner);
+
+// 以第一维区分签名的单输入variant pack
+RunnerVariantPack CreateRunnerVariantPack(int64_t dim0)
+{
+    Tensor tensor;
+    tensor.desc.dtype = ACL_FLOAT16;
+    tensor.desc.format = ACL_FORMAT_ND;
+    tensor.desc.shape.dimNum = 2;
+    tensor.desc.shape.dims[0] = dim0;
+    tensor.desc.shape.dims[1] = 16;
+    tensor.dataSize = Utils::GetTensorSize(tensor);
+    RunnerVariantPack runnerVariantPack;
+    runnerVariantPack.inTensors = {tensor};
+    return runnerVariantPack;
+}
+
+std::shared_ptr<aclOpExecutor> CreateFakeExecutor(size_t idx)
+{
+    aclOpExecutor *rawPtr = reinterpret_cast<aclOpExecutor *>(0x100 + idx);
+    return std::shared_ptr<aclOpExecutor>(rawPtr, [](aclOpExecutor *) {});
+}
+} // namespace
+
+// 测试场景：保存一个签名的variant pack后，分别以相同签名和不同签名查找
+// 测试结果：相同签名命中并换回保存的variant pack，不同签名未命中且不改动当前variant pack
+TEST(TestAclnnRunnerReuse, SignatureHitAndMiss)
+{
+    FakeAclnnRunner runner;
+    RunnerVariantPack smallPack = CreateRunnerVariantPack(2);
+    RunnerVariantPack largePack = CreateRunnerVariantPack(4);
+    std::shared_ptr<aclOpExecutor> executor = CreateFakeExecutor(0);
+    runner.SavePack(smallPack, executor);
+    std::shared_ptr<AclNNTensor> savedTensor = runner.GetAclnnVariantPack().aclInTensors.at(0);
+
+    runner.SavePack(largePack, executor);
+    EXPECT_TRUE(runner.FetchPack(smallPack));
+    ASSERT_EQ(runner.GetAclnnVariantPack().aclInTensors.size(), 1U);
+    EXPECT_EQ(runner.GetAclnnVariantPack().aclInTensors.at(0), savedTensor);
+
+    EXPECT_FALSE(runner.FetchPack(CreateRunnerVariantPack(8)));
+    EXPECT_EQ(runner.GetAclnnVariantPack().aclInTensors.at(0), savedTensor);
+}
+
+// 测试场景：保存的签名数超过上限，最早保存的variant pack的executor已不被其他地方引用
+// 测试结果：最早的签名被淘汰后不再命中，其executor随淘汰一并释放，其余签名仍能命中
+TEST(TestAclnnRunnerReuse, EvictReleasesUnreferencedPack)
+{
+    FakeAclnnRunner runner;
+    std::vector<std::weak_ptr<aclOpExecutor>> executors;
+    for (size_t i = 0; i <= REUSABLE_PACK_NUM; ++i) {
+        std::shared_ptr<aclOpExecutor> executor = CreateFakeExecutor(i);
+        executors.push_back(executor);
+        runner.SavePack(CreateRunnerVariantPack(static_cast<int64_t>(i + 1)), executor);
+    }
+    EXPECT_FALSE(runner.FetchPack(CreateRunnerVariantPack(1)));
+    EXPECT_TRUE(executors.at(0).expired());
+    for (size_t i = 1; i <= REUSABLE_PACK_NUM; ++i) {
+        EXPECT_TRUE(runner.FetchPack(CreateRunnerVariantPack(static_cast<int64_t>(i + 1))));
+        EXPECT_FALSE(executors.at(i).expired());
+    }
+}
+
+// 测试场景：最早保存的variant pack被淘汰时，其executor仍被外部(如AclnnExecutorCache)引用，之后外部释放引用
+// 测试结果：外部引用期间挂起不释放，外部释放后在下一次淘汰时释放
+TEST(TestAclnnRunnerReuse, EvictedPackKeptWhileExecutorReferenced)
+{
+    FakeAclnnRunner runner;
+    std::shared_ptr<aclOpExecutor> cachedExecutor = CreateFakeExecutor(0);
+    std::weak_ptr<aclOpExecutor> evictedExecutor = cachedExecutor;
+    runner.SavePack(CreateRunnerVariantPack(1), cachedExecutor);
+    for (size_t i = 1; i <= REUSABLE_PACK_NUM; ++i) {
+        runner.SavePack(CreateRunnerVariantPack(static_cast<int64_t>(i + 1)), CreateFakeExecutor(i));
+    }
+    EXPECT_FALSE(runner.FetchPack(CreateRunnerVariantPack(1)));
+    EXPECT_FALSE(evictedExecutor.expired());
+
+    cachedExecutor.reset();
+    runner.SavePack(CreateRunnerVariantPack(static_cast<int64_t>(REUSABLE_PACK_NUM + 2)),
+                    CreateFakeExecutor(REUSABLE_PACK_NUM + 1));
+    EXPECT_TRUE(evictedExecutor.expired());
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024-2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <gtest/gtest.h>
+#include "atb/utils/async_dumper.h"
+
+using namespace atb;
+
+TEST(TestAsyncDumper, RingReserveAndWrap)
+{
+    const uint64_t capacity = 1024;
+    DumpRing ring(capacity);
+    uint64_t offset0 = 0;
+    uint64_t offset1 = 0;
+    uint64_t offset2 = 0;
+    uint64_t padding0 = 0;
+    uint64_t padding1 = 0;
+    uint64_t padding2 = 0;
+    ASSERT_TRUE(ring.Reserve(400, offset0, padding0));
+    ASSERT_TRUE(ring.Reserve(400, offset1, padding1));
+    EXPECT_EQ(offset0, 0U);
+    EXPECT_EQ(offset1, 448U); // 按64字节对齐
+    // 尾部剩余128字节，头部尚未释放，空间不足时直接失败
+    EXPECT_FALSE(ring.Reserve(200, offset2, padding2));
+    ring.Release(offset0, 400, padding0);
+    ASSERT_TRUE(ring.Reserve(200, offset2, padding2));
+    EXPECT_EQ(offset2, 0U);
+    EXPECT_EQ(padding2, 128U);
+    EXPECT_EQ(ring.GetUsedSize(), 448U + 256U + 128U);
+    ring.Rollback(offset2, 200, padding2);
+    EXPECT_EQ(ring.GetUsedSize(), 448U);
+    ASSERT_TRUE(ring.Reserve(100, offset2, padding2));
+    EXPECT_EQ(offset2, 896U);
+    ring.Release(offset1, 400, padding1);
+    ring.Release(offset2, 100, padding2);
+    EXPECT_EQ(ring.GetUsedSize(), 0U);
+    EXPECT_FALSE(ring.Reserve(capacity + 1, offset0, padding0));
+}
+
+TEST(TestAsyncDumper, RingFifoRandom)
+{
+    const uint64_t capacity = 4096;
+    DumpRing ring(capacity);
+    std::mt19937 rng(0);
+    struct Block {
+        uint64_t offset;
+        uint64_t size;
+        uint64_t padding;
+    };
+    std::vector<Block> blocks;
+    size_t releaseIdx = 0;
+    for (int i = 0; i < 10000; ++i) {
+        Block block = {0, rng() % 1000 + 1, 0};
+        if (ring.Reserve(block.size, block.offset, block.padding)) {
+            ASSERT_LE(block.offset + block.size, capacity);
+            // 新申请的空间不能与尚未释放的空间重叠
+            for (size_t j = releaseIdx; j < blocks.size(); ++j) {
+                bool overlap = block.offset < blocks[j].offset + blocks[j].size &&
+                               blocks[j].offset < block.offset + block.size;
+                ASSERT_FALSE(overlap);
+            }
+            blocks.push_back(block);
+        }
+        if (releaseIdx < blocks.size() && rng() % 2 == 0) {
+            ring.Release(blocks[releaseIdx].offset, blocks[releaseIdx].size, blocks[releaseIdx].padding);
+            ++releaseIdx;
+        }
+    }
+    for (; releaseIdx < blocks.size(); ++releaseIdx) {
+        ring.Release(blocks[releaseIdx].offset, blocks[releaseIdx].size, blocks[releaseIdx].padding);
+    }
+    EXPECT_EQ(ring.GetUsedSize(), 0U);
+}
+
+TEST(TestAsyncDumper, ZeroRunRoundTrip)
+{
+    std::mt19937 rng(0);
+    std::vector<std::vector<uint8_t>> cases = {{}, std::vector<uint8_t>(1000, 0), {1, 0, 0, 2}};
+    std::vector<uint8_t> sparse(100000, 0);
+    for (size_t i = 0; i < sparse.size(); i += 97) {
+        sparse[i] = static_cast<uint8_t>(rng() % 255 + 1);
+    }
+    cases.push_back(sparse);
+    std::vector<uint8_t> dense(4096);
+    for (auto &value : dense) {
+        value = static_cast<uint8_t>(rng());
+    }
+    cases.push_back(dense);
+    std::vector<uint8_t> encoded;
+    std::vector<uint8_t> decoded;
+    for (const auto &raw : cases) {
+        DumpContainerWriter::ZeroRunEncode(raw.data(), raw.size(), encoded);
+        ASSERT_TRUE(DumpContainerWriter::ZeroRunDecode(encoded.data(), encoded.size(), raw.size(), decoded));
+        EXPECT_EQ(decoded, raw);
+    }
+    DumpContainerWriter::ZeroRunEncode(sparse.data(), sparse.size(), encoded);
+    EXPECT_LT(encoded.size(), sparse.size() / 10);
+    EXPECT_FALSE(DumpContainerWriter::ZeroRunDecode(encoded.data(), encoded.size() - 1, sparse.size(), decoded));
+}
+
+TEST(TestAsyncDumper, ContainerWriteAndScan)
+{
+    const std::string filePath = "test_async_dumper.atbd";
+    std::vector<uint8_t> zeros(8192, 0);
+    std::vector<uint8_t> values = {1, 2, 3, 4, 5, 6, 7, 8};
+    {
+        DumpContainerWriter writer;
+        ASSERT_EQ(writer.Open(filePath, true), NO_ERROR);
+        ASSERT_EQ(writer.Append("0_Op/before/intensor0.bin", "format:2;dtype:1;dims:64,64", zeros.data(),
+                                zeros.size()), NO_ERROR);
+        ASSERT_EQ(writer.Append("0_Op/after/outtensor0.bin", "format:2;dtype:4;dims:8", values.data(),
+                                values.size()), NO_ERROR);
+        EXPECT_EQ(writer.GetRecordCount(), 2U);
+        ASSERT_EQ(writer.Close(), NO_ERROR);
+    }
+    std::ifstream ifs(filePath, std::ios::binary);
+    std::vector<uint8_t> content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ASSERT_GT(content.size(), 16U);
+    EXPECT_EQ(memcmp(content.data(), "ATBDUMP1", 8), 0);
+    EXPECT_LT(content.size(), zeros.size()); // 全零数据被压缩
+    EXPECT_EQ(memcmp(content.data() + content.size() - 8, "ATBINDX1", 8), 0);
+
+    // 按记录头顺序扫描，第二条记录未压缩
+    size_t pos = 16;
+    std::vector<std::string> keys;
+    std::vector<uint8_t> lastPayload;
+    uint64_t indexOffset = 0;
+    memcpy(&indexOffset, content.data() + content.size() - 24, sizeof(indexOffset));
+    while (pos < indexOffset) {
+        uint32_t keyLen = 0;
+        uint32_t metaLen = 0;
+        uint64_t storedSize = 0;
+        memcpy(&keyLen, content.data() + pos + 8, sizeof(keyLen));
+        memcpy(&metaLen, content.data() + pos + 12, sizeof(metaLen));
+        memcpy(&storedSize, content.data() + pos + 24, sizeof(storedSize));
+        size_t keyBegin = pos + 32;
+        keys.emplace_back(reinterpret_cast<const char *>(content.data() + keyBegin), keyLen);
+        size_t payloadBegin = keyBegin + keyLen + metaLen;
+        lastPayload.assign(content.begin() + payloadBegin, content.begin() + payloadBegin + storedSize);
+        pos = payloadBegin + storedSize;
+    }
+    EXPECT_EQ(pos, indexOffset);
+    ASSERT_EQ(keys.size(), 2U);
+    EXPECT_EQ(keys[0], "0_Op/before/intensor0.bin");
+    EXPECT_EQ(keys[1], "0_Op/after/outtensor0.bin");
+    EXPECT_EQ(lastPayload, values);
+    std::remove(filePath.c_str());
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "atb/utils/async_logger.h"
+
+using namespace atb;
+
+namespace {
+template <typename T> void AppendTestValue(LogArgBuffer &buffer, LogArgType type, T value)
+{
+    buffer.AppendValue(type, &value, sizeof(T));
+}
+} // namespace
+
+// 测试场景：各类型参数按原始值记录后再格式化
+// 测试结果：与直接写入ostream的结果一致
+TEST(TestAsyncLogger, FormatArgs)
+{
+    LogArgBuffer buffer;
+    std::string str = "opName";
+    int value = 12;
+    buffer.AppendString(str.data(), str.size());
+    AppendTestValue<int64_t>(buffer, LOG_ARG_INT, -3);
+    AppendTestValue<uint64_t>(buffer, LOG_ARG_UINT, 18446744073709551615ULL);
+    AppendTestValue<double>(buffer, LOG_ARG_DOUBLE, 0.1f);
+    AppendTestValue<uint64_t>(buffer, LOG_ARG_BOOL, 1);
+    AppendTestValue<uint64_t>(buffer, LOG_ARG_CHAR, 'x');
+    AppendTestValue<uintptr_t>(buffer, LOG_ARG_POINTER, reinterpret_cast<uintptr_t>(&value));
+    std::ios_base &(*manipulator)(std::ios_base &) = std::hex;
+    AppendTestValue(buffer, LOG_ARG_BASE_MANIPULATOR, manipulator);
+    AppendTestValue<uint64_t>(buffer, LOG_ARG_UINT, 255);
+    std::ostringstream expected;
+    expected << str << int64_t(-3) << 18446744073709551615ULL << 0.1f << true << 'x' << static_cast<void *>(&value)
+             << std::hex << 255;
+    std::ostringstream actual;
+    LogArgBuffer::Format(buffer.GetData(), buffer.GetSize(), actual);
+    EXPECT_EQ(actual.str(), expected.str());
+    EXPECT_FALSE(buffer.IsTruncated());
+}
+
+// 测试场景：参数总长度超过缓冲上限
+// 测试结果：超出部分被截断并打上截断标记，已记录的部分仍能格式化
+TEST(TestAsyncLogger, TruncateLongArgs)
+{
+    LogArgBuffer buffer;
+    std::string str(LogArgBuffer::MAX_SIZE * 2, 'a');
+    buffer.AppendString(str.data(), str.size());
+    AppendTestValue<int64_t>(buffer, LOG_ARG_INT, 1);
+    EXPECT_TRUE(buffer.IsTruncated());
+    EXPECT_EQ(buffer.GetSize(), LogArgBuffer::MAX_SIZE);
+    std::ostringstream actual;
+    LogArgBuffer::Format(buffer.GetData(), buffer.GetSize(), actual);
+    EXPECT_EQ(actual.str(), std::string(LogArgBuffer::MAX_SIZE - sizeof(uint8_t) - sizeof(uint32_t), 'a'));
+}
+
+// 测试场景：环形缓冲多次写满、读空，写入位置跨越缓冲末尾
+// 测试结果：读出的记录与写入顺序一致，写满时新记录被丢弃并计数
+TEST(TestAsyncLogger, RingWrapAndDrop)
+{
+    const uint64_t capacity = 1024;
+    LogRing ring(capacity);
+    static LogSite site(__FILE__, __LINE__, Mki::LogLevel::INFO);
+    std::vector<uint8_t> payload(100, 1);
+    uint32_t writeIndex = 0;
+    uint32_t readIndex = 0;
+    const uint32_t roundNum = 10;
+    for (uint32_t round = 0; round < roundNum; ++round) {
+        while (true) {
+            LogRecordHeader header;
+            header.site = &site;
+            header.threadId = static_cast<int32_t>(writeIndex);
+            header.payloadSize = static_cast<uint32_t>(payload.size());
+            if (!ring.Write(header, payload.data())) {
+                break;
+            }
+            writeIndex++;
+        }
+        EXPECT_EQ(ring.TakeDroppedCount(), 1);
+        ring.Read([&](const LogRecordHeader &header, const uint8_t *data) {
+            EXPECT_EQ(header.site, &site);
+            EXPECT_EQ(header.threadId, static_cast<int32_t>(readIndex));
+            EXPECT_EQ(header.payloadSize, payload.size());
+            EXPECT_EQ(data[0], 1);
+            readIndex++;
+        });
+        EXPECT_EQ(ring.GetUsedSize(), 0);
+    }
+    EXPECT_EQ(readIndex, writeIndex);
+    EXPECT_GT(writeIndex, roundNum);
+}
+
+// 测试场景：同一调用点在一秒内超过限流次数
+// 测试结果：超出的日志被拒绝并计入抑制数，进入下一秒后重新计数
+TEST(TestAsyncLogger, RateLimit)
+{
+    static LogSite site(__FILE__, __LINE__, Mki::LogLevel::INFO);
+    const uint32_t rateLimit = 3;
+    const uint64_t second = 100;
+    const uint32_t callNum = 5;
+    uint32_t acceptNum = 0;
+    for (uint32_t i = 0; i < callNum; ++i) {
+        acceptNum += AsyncLogger::AcceptSite(site, second, rateLimit) ? 1 : 0;
+    }
+    EXPECT_EQ(acceptNum, rateLimit);
+    EXPECT_EQ(site.suppressedCount.load(), callNum - rateLimit);
+    EXPECT_TRUE(AsyncLogger::AcceptSite(site, second + 1, rateLimit));
+}
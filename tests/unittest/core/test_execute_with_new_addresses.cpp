@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <vector>
+#include <gtest/gtest.h>
+#include <acl/acl.h>
+#include <atb/utils.h>
+#include "atb/operation.h"
+#include "atb/infer_op_params.h"
+#include "atb/context.h"
+#include "atb/utils/config.h"
+#include "atb/utils/singleton.h"
+
+using namespace atb;
+
+namespace {
+constexpr uint16_t FP16_ONE = 0x3C00;
+constexpr uint16_t FP16_TWO = 0x4000;
+constexpr uint16_t FP16_THREE = 0x4200;
+constexpr uint16_t FP16_FOUR = 0x4400;
+constexpr uint16_t FP16_FIVE = 0x4500;
+constexpr uint16_t FP16_SIX = 0x4600;
+
+Tensor CreateDeviceTensor(const std::vector<int64_t> &shape, uint16_t value)
+{
+    Tensor tensor;
+    tensor.desc.dtype = ACL_FLOAT16;
+    tensor.desc.format = ACL_FORMAT_ND;
+    tensor.desc.shape.dimNum = shape.size();
+    for (size_t i = 0; i < shape.size(); ++i) {
+        tensor.desc.shape.dims[i] = shape.at(i);
+    }
+    tensor.dataSize = Utils::GetTensorSize(tensor);
+    EXPECT_EQ(aclrtMalloc(&tensor.deviceData, tensor.dataSize, ACL_MEM_MALLOC_HUGE_FIRST), 0);
+    std::vector<uint16_t> hostData(Utils::GetTensorNumel(tensor), value);
+    EXPECT_EQ(aclrtMemcpy(tensor.deviceData, tensor.dataSize, hostData.data(), tensor.dataSize,
+                          ACL_MEMCPY_HOST_TO_DEVICE), 0);
+    return tensor;
+}
+
+// 输入为x、y两个同shape的fp16 tensor，输出为一个同shape的tensor
+VariantPack CreateBinaryVariantPack(const std::vector<int64_t> &shape, uint16_t x, uint16_t y)
+{
+    VariantPack variantPack;
+    variantPack.inTensors = {CreateDeviceTensor(shape, x), CreateDeviceTensor(shape, y)};
+    variantPack.outTensors = {CreateDeviceTensor(shape, 0)};
+    return variantPack;
+}
+
+std::vector<uint16_t> ReadDeviceTensor(const Tensor &tensor)
+{
+    std::vector<uint16_t> hostData(Utils::GetTensorNumel(tensor), 0);
+    EXPECT_EQ(aclrtMemcpy(hostData.data(), tensor.dataSize, tensor.deviceData, tensor.dataSize,
+                          ACL_MEMCPY_DEVICE_TO_HOST), 0);
+    return hostData;
+}
+
+void FreeVariantPack(VariantPack &variantPack)
+{
+    for (Tensor &tensor : variantPack.inTensors) {
+        aclrtFree(tensor.deviceData);
+    }
+    for (Tensor &tensor : variantPack.outTensors) {
+        aclrtFree(tensor.deviceData);
+    }
+}
+
+void SetupAndExecute(Operation *operation, const VariantPack &variantPack, Context *context)
+{
+    uint64_t workspaceSize = 0;
+    ASSERT_EQ(operation->Setup(variantPack, workspaceSize, context), NO_ERROR);
+    ASSERT_EQ(workspaceSize, 0U);
+    ASSERT_EQ(operation->Execute(variantPack, nullptr, 0, context), NO_ERROR);
+    ASSERT_EQ(aclrtSynchronizeStream(context->GetExecuteStream()), 0);
+}
+
+void ExecuteWithNewAddressesAndSync(Operation *operation, const VariantPack &variantPack, Context *context)
+{
+    ASSERT_EQ(ExecuteWithNewAddresses(operation, variantPack, nullptr, 0, context), NO_ERROR);
+    ASSERT_EQ(aclrtSynchronizeStream(context->GetExecuteStream()), 0);
+}
+
+Operation *CreateAddOperation()
+{
+    infer::ElewiseParam addParam;
+    addParam.elewiseType = infer::ElewiseParam::ElewiseType::ELEWISE_ADD;
+    Operation *operation = nullptr;
+    EXPECT_EQ(CreateOperation(addParam, &operation), NO_ERROR);
+    return operation;
+}
+} // namespace
+
+TEST(TestExecuteWithNewAddresses, SameResultAsSetupExecute)
+{
+    /*
+        测试场景：add算子Setup、Execute一次后，换用新地址的输入输出调用ExecuteWithNewAddresses，
+                 与另一个add算子对同一组新地址正常Setup、Execute的结果比较
+        结果：两者输出一致，且为新输入的计算结果
+    */
+    if (!GetSingleton<Config>().Is910B()) {
+        GTEST_SKIP() << "This test case only support 910B";
+    }
+    aclrtSetDevice(0);
+    aclrtStream exeStream = nullptr;
+    aclrtCreateStream(&exeStream);
+    Context *context = nullptr;
+    ASSERT_EQ(CreateContext(&context), NO_ERROR);
+    context->SetExecuteStream(exeStream);
+
+    const std::vector<int64_t> shape = {2, 16};
+    Operation *operation = CreateAddOperation();
+    Operation *refOperation = CreateAddOperation();
+    ASSERT_NE(operation, nullptr);
+    ASSERT_NE(refOperation, nullptr);
+    VariantPack firstPack = CreateBinaryVariantPack(shape, FP16_TWO, FP16_THREE);
+    SetupAndExecute(operation, firstPack, context);
+    std::vector<uint16_t> firstOut = ReadDeviceTensor(firstPack.outTensors.at(0));
+    EXPECT_EQ(firstOut, std::vector<uint16_t>(firstOut.size(), FP16_FIVE));
+
+    VariantPack newPack = CreateBinaryVariantPack(shape, FP16_THREE, FP16_THREE);
+    ExecuteWithNewAddressesAndSync(operation, newPack, context);
+    VariantPack refPack = CreateBinaryVariantPack(shape, FP16_THREE, FP16_THREE);
+    SetupAndExecute(refOperation, refPack, context);
+    std::vector<uint16_t> newOut = ReadDeviceTensor(newPack.outTensors.at(0));
+    EXPECT_EQ(newOut, ReadDeviceTensor(refPack.outTensors.at(0)));
+    EXPECT_EQ(newOut, std::vector<uint16_t>(newOut.size(), FP16_SIX));
+    // 原地址上的输出不被新的执行改写
+    EXPECT_EQ(ReadDeviceTensor(firstPack.outTensors.at(0)), firstOut);
+
+    FreeVariantPack(firstPack);
+    FreeVariantPack(newPack);
+    FreeVariantPack(refPack);
+    DestroyOperation(operation);
+    DestroyOperation(refOperation);
+    DestroyContext(context);
+    aclrtDestroyStream(exeStream);
+}
+
+TEST(TestExecuteWithNewAddresses, FallbackOnShapeOrParamChange)
+{
+    /*
+        测试场景：1. add算子Setup后，以不同shape的输入输出调用ExecuteWithNewAddresses
+                 2. fill算子Setup后，调用UpdateOperationParam修改填充值，再调用ExecuteWithNewAddresses
+        结果：均退化为先Setup再Execute，输出为新shape、新参数对应的结果
+    */
+    if (!GetSingleton<Config>().Is910B()) {
+        GTEST_SKIP() << "This test case only support 910B";
+    }
+    aclrtSetDevice(0);
+    aclrtStream exeStream = nullptr;
+    aclrtCreateStream(&exeStream);
+    Context *context = nullptr;
+    ASSERT_EQ(CreateContext(&context), NO_ERROR);
+    context->SetExecuteStream(exeStream);
+
+    Operation *addOperation = CreateAddOperation();
+    ASSERT_NE(addOperation, nullptr);
+    VariantPack smallPack = CreateBinaryVariantPack({2, 16}, FP16_TWO, FP16_THREE);
+    SetupAndExecute(addOperation, smallPack, context);
+    VariantPack largePack = CreateBinaryVariantPack({4, 16}, FP16_TWO, FP16_TWO);
+    ExecuteWithNewAddressesAndSync(addOperation, largePack, context);
+    std::vector<uint16_t> largeOut = ReadDeviceTensor(largePack.outTensors.at(0));
+    EXPECT_EQ(largeOut, std::vector<uint16_t>(Utils::GetTensorNumel(largePack.outTensors.at(0)), FP16_FOUR));
+
+    infer::FillParam fillParam;
+    fillParam.withMask = false;
+    fillParam.value = {1.0f};
+    fillParam.outDim = {2, 16};
+    Operation *fillOperation = nullptr;
+    ASSERT_EQ(CreateOperation(fillParam, &fillOperation), NO_ERROR);
+    VariantPack fillPack;
+    fillPack.outTensors = {CreateDeviceTensor({2, 16}, 0)};
+    SetupAndExecute(fillOperation, fillPack, context);
+    std::vector<uint16_t> fillOut = ReadDeviceTensor(fillPack.outTensors.at(0));
+    EXPECT_EQ(fillOut, std::vector<uint16_t>(fillOut.size(), FP16_ONE));
+    fillParam.value = {4.0f};
+    ASSERT_EQ(UpdateOperationParam(fillOperation, fillParam), NO_ERROR);
+    VariantPack newFillPack;
+    newFillPack.outTensors = {CreateDeviceTensor({2, 16}, 0)};
+    ExecuteWithNewAddressesAndSync(fillOperation, newFillPack, context);
+    std::vector<uint16_t> newFillOut = ReadDeviceTensor(newFillPack.outTensors.at(0));
+    EXPECT_EQ(newFillOut, std::vector<uint16_t>(newFillOut.size(), FP16_FOUR));
+
+    FreeVariantPack(smallPack);
+    FreeVariantPack(largePack);
+    FreeVariantPack(fillPack);
+    FreeVariantPack(newFillPack);
+    DestroyOperation(addOperation);
+    DestroyOperation(fillOperation);
+    DestroyContext(context);
+    aclrtDestroyStream(exeStream);
+}
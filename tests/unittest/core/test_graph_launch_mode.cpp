@@ -23,6 +23,7 @@
 #include <cpp-stub/src/stub.h>
 #include <atb/utils/config.h>
 #include "atb/utils/singleton.h"
+#include "atb/operation/operation_base.h"
 #include <mki/utils/time/timer.h>
  
 // 设置各个intensor的属性
@@ -708,4 +709,108 @@ TEST(TestGraphLaunchMode, CapturedByUserAndChangeWorkspace)
     aclrtFree(workSpace3);
     aclrtDestroyStream(exeStream);
     aclrtResetDevice(deviceId);
-}
\ No newline at end of file
+}
+
+// 各轮输入取值1~6，add结果为2~12，均为fp16可精确表示的整数
+static const uint16_t SWITCH_SHAPE_IN_VALUES[] = {0x3C00, 0x4000, 0x4200, 0x4400, 0x4500, 0x4600};
+static const uint16_t SWITCH_SHAPE_OUT_VALUES[] = {0x4000, 0x4400, 0x4600, 0x4800, 0x4900, 0x4A00};
+
+static void FillTensor(atb::Tensor &tensor, uint16_t value)
+{
+    std::vector<uint16_t> hostData(atb::Utils::GetTensorNumel(tensor), value);
+    ASSERT_EQ(aclrtMemcpy(tensor.deviceData, tensor.dataSize, hostData.data(), hostData.size() * sizeof(uint16_t),
+                          ACL_MEMCPY_HOST_TO_DEVICE), 0);
+}
+
+static std::vector<uint16_t> ReadTensor(const atb::Tensor &tensor)
+{
+    std::vector<uint16_t> hostData(atb::Utils::GetTensorNumel(tensor), 0);
+    EXPECT_EQ(aclrtMemcpy(hostData.data(), hostData.size() * sizeof(uint16_t), tensor.deviceData, tensor.dataSize,
+                          ACL_MEMCPY_DEVICE_TO_HOST), 0);
+    return hostData;
+}
+
+// 测试场景：ATB捕获模式下单算子在两种shape间交替执行，每轮执行前改写输入的值并清零输出
+// 测试结果：每种shape只捕获一次，之后切换shape时重放已捕获的模型，不再重新捕获；每轮输出均为本轮输入的计算结果
+TEST(TestGraphLaunchMode, CapturedByAtbAndSwitchShape)
+{
+    if (!atb::GetSingleton<atb::Config>().Is910B()) {
+        return;
+    }
+    uint32_t deviceId = 1;
+    aclrtSetDevice(deviceId);
+    aclrtStream exeStream = nullptr;
+    aclrtCreateStream(&exeStream);
+    atb::Context *context = nullptr;
+    atb::CreateContext(&context);
+    context->SetExecuteStream(exeStream);
+    context->SetLaunchMode(atb::GRAPH_LAUNCH_MODE);
+
+    atb::infer::ElewiseParam addParam;
+    addParam.elewiseType = atb::infer::ElewiseParam::ElewiseType::ELEWISE_ADD;
+    atb::Operation *operation = nullptr;
+    ASSERT_EQ(atb::CreateOperation(addParam, &operation), 0);
+
+    const size_t shapeNum = 2;
+    const size_t loopNum = sizeof(SWITCH_SHAPE_IN_VALUES) / sizeof(SWITCH_SHAPE_IN_VALUES[0]);
+    atb::VariantPack packs[shapeNum];
+    for (size_t shapeId = 0; shapeId < shapeNum; shapeId++) {
+        atb::SVector<atb::TensorDesc> intensorDescs;
+        atb::SVector<atb::TensorDesc> outtensorDescs;
+        intensorDescs.resize(operation->GetInputNum());
+        CreateInTensorDescs(intensorDescs);
+        for (size_t i = 0; i < intensorDescs.size(); i++) {
+            intensorDescs.at(i).shape.dims[0] = 2 * (shapeId + 1); // 2: 两种shape的第0维分别为2和4
+        }
+        outtensorDescs.resize(operation->GetOutputNum());
+        operation->InferShape(intensorDescs, outtensorDescs);
+        packs[shapeId].inTensors.resize(intensorDescs.size());
+        packs[shapeId].outTensors.resize(outtensorDescs.size());
+        CreateInTensors(packs[shapeId].inTensors, intensorDescs, 1);
+        CreateOutTensors(packs[shapeId].outTensors, outtensorDescs);
+    }
+
+    void *workSpace = nullptr;
+    uint64_t workSpaceCapacity = 0;
+    for (size_t i = 0; i < loopNum; i++) {
+        atb::VariantPack &pack = packs[i % shapeNum];
+        for (atb::Tensor &inTensor : pack.inTensors) {
+            FillTensor(inTensor, SWITCH_SHAPE_IN_VALUES[i]);
+        }
+        FillTensor(pack.outTensors.at(0), 0);
+        uint64_t workspaceSize = 0;
+        ASSERT_EQ(operation->Setup(pack, workspaceSize, context), 0);
+        if (workspaceSize > workSpaceCapacity) {
+            aclrtFree(workSpace);
+            ASSERT_EQ(aclrtMalloc(&workSpace, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST), 0);
+            workSpaceCapacity = workspaceSize;
+        }
+        context->SetExecuteType(atb::EXECUTE_PRELAUNCH);
+        EXPECT_EQ(operation->Execute(pack, (uint8_t *)workSpace, workspaceSize, context), 0);
+        context->SetExecuteType(atb::EXECUTE_LAUNCH);
+        EXPECT_EQ(operation->Execute(pack, (uint8_t *)workSpace, workspaceSize, context), 0);
+        context->SetExecuteType(atb::EXECUTE_NORMAL);
+        ASSERT_EQ(aclrtSynchronizeStream(exeStream), 0);
+        std::vector<uint16_t> outData = ReadTensor(pack.outTensors.at(0));
+        EXPECT_EQ(outData, std::vector<uint16_t>(outData.size(), SWITCH_SHAPE_OUT_VALUES[i])) << "loop " << i;
+    }
+    const atb::GraphCaptureStatistic &statistic =
+        dynamic_cast<atb::OperationBase *>(operation)->GetGraphCaptureStatistic();
+    EXPECT_EQ(statistic.captureCount, shapeNum);
+    EXPECT_EQ(statistic.replayCount, loopNum - shapeNum);
+    EXPECT_EQ(statistic.evictCount, 0U);
+
+    atb::DestroyOperation(operation);
+    atb::DestroyContext(context);
+    for (size_t shapeId = 0; shapeId < shapeNum; shapeId++) {
+        for (size_t i = 0; i < packs[shapeId].inTensors.size(); i++) {
+            aclrtFree(packs[shapeId].inTensors.at(i).deviceData);
+        }
+        for (size_t i = 0; i < packs[shapeId].outTensors.size(); i++) {
+            aclrtFree(packs[shapeId].outTensors.at(i).deviceData);
+        }
+    }
+    aclrtFree(workSpace);
+    aclrtDestroyStream(exeStream);
+    aclrtResetDevice(deviceId);
+}
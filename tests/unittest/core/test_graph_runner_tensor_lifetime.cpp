@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <gtest/gtest.h>
+#include "atb/runner/graph_runner.h"
+
+using namespace atb;
+
+namespace {
+constexpr uint32_t WEIGHT_NUM = 8;
+constexpr uint32_t SKIP_DISTANCE = 4;
+constexpr int DEFAULT_ITERATIONS = 2000;
+
+int GetIterations()
+{
+    const char *env = std::getenv("ATB_GRAPH_RUNNER_BENCH_ITERATIONS");
+    int iterations = env ? std::atoi(env) : DEFAULT_ITERATIONS;
+    return iterations > 0 ? iterations : DEFAULT_ITERATIONS;
+}
+
+// 构造nodeNum个节点的链式图：node[i]读取上一个节点输出、一个共享权重以及SKIP_DISTANCE之前的中间tensor
+void BuildChainGraph(GraphRunner::Graph &graph, uint32_t nodeNum)
+{
+    graph.inTensors.resize(1 + WEIGHT_NUM + 1); // x、权重、一个图内未使用的intensor
+    graph.outTensors.resize(1);
+    graph.internalTensors.resize(nodeNum - 1);
+    graph.nodes.resize(nodeNum);
+    for (uint32_t i = 0; i < nodeNum; ++i) {
+        auto &node = graph.nodes.at(i);
+        Tensor *input = i == 0 ? &graph.inTensors.at(0) : &graph.internalTensors.at(i - 1);
+        node.inTensors = {input, &graph.inTensors.at(1 + i % WEIGHT_NUM)};
+        if (i > SKIP_DISTANCE) {
+            node.inTensors.push_back(&graph.internalTensors.at(i - 1 - SKIP_DISTANCE));
+        }
+        node.outTensors = {i + 1 == nodeNum ? &graph.outTensors.at(0) : &graph.internalTensors.at(i)};
+    }
+    graph.isInTensorCanFree.assign(graph.inTensors.size(), 1);
+    graph.isOutTensorNeedMalloc.assign(graph.outTensors.size(), 1);
+}
+
+// 重构前基于std::map/std::set的生命周期记录，作为正确性与耗时的对照
+struct MapBasedLifetime {
+    std::map<Tensor *, uint64_t> tensorMaxNodeIdMap;
+    std::map<uint64_t, std::set<Tensor *>> maxNodeIdTensorMap;
+    std::set<Tensor *> tensorMalloced;
+
+    void Init(GraphRunner::Graph &graph)
+    {
+        tensorMaxNodeIdMap.clear();
+        maxNodeIdTensorMap.clear();
+        auto record = [this, &graph](Tensor *tensor, bool searchOutTensor) {
+            uint64_t maxNodeId = 0;
+            uint64_t dependNodeCount = 0;
+            for (size_t nodeId = 0; nodeId < graph.nodes.size(); ++nodeId) {
+                for (auto inTensor : graph.nodes.at(nodeId).inTensors) {
+                    if (inTensor == tensor) {
+                        maxNodeId = nodeId;
+                        dependNodeCount++;
+                    }
+                }
+            }
+            if (dependNodeCount == 0) {
+                if (!searchOutTensor) {
+                    return;
+                }
+                bool found = false;
+                for (size_t nodeId = 0; nodeId < graph.nodes.size() && !found; ++nodeId) {
+                    for (auto outTensor : graph.nodes.at(nodeId).outTensors) {
+                        if (outTensor == tensor) {
+                            maxNodeId = nodeId;
+                            found = true;
+                            break;
+                        }
+                    }
+                }
+                if (!found) {
+                    return;
+                }
+            }
+            tensorMaxNodeIdMap[tensor] = maxNodeId;
+            maxNodeIdTensorMap[maxNodeId].insert(tensor);
+        };
+        for (auto &tensor : graph.inTensors) {
+            record(&tensor, false);
+        }
+        for (auto &tensor : graph.internalTensors) {
+            record(&tensor, true);
+        }
+    }
+
+    // 模拟一次setup中的逐节点查询，返回释放的tensor数
+    size_t Setup(GraphRunner::Graph &graph)
+    {
+        size_t freeNum = 0;
+        tensorMalloced.clear();
+        for (size_t nodeId = 0; nodeId < graph.nodes.size(); ++nodeId) {
+            auto &node = graph.nodes.at(nodeId);
+            for (auto inTensor : node.inTensors) {
+                auto it = tensorMaxNodeIdMap.find(inTensor);
+                freeNum += (it != tensorMaxNodeIdMap.end() && it->second == nodeId) ? 1 : 0;
+            }
+            for (auto outTensor : node.outTensors) {
+                if (tensorMalloced.find(outTensor) == tensorMalloced.end()) {
+                    tensorMalloced.insert(outTensor);
+                }
+            }
+            auto it = maxNodeIdTensorMap.find(nodeId);
+            if (it != maxNodeIdTensorMap.end()) {
+                freeNum += it->second.size();
+            }
+        }
+        return freeNum;
+    }
+};
+
+// 与MapBasedLifetime::Setup相同的逐节点查询，改为按tensor id访问数组
+size_t DenseSetup(GraphRunner::Graph &graph)
+{
+    size_t freeNum = 0;
+    std::fill(graph.tensorMalloced.begin(), graph.tensorMalloced.end(), 0);
+    for (size_t nodeId = 0; nodeId < graph.nodes.size(); ++nodeId) {
+        auto &node = graph.nodes.at(nodeId);
+        for (uint32_t tensorId : node.inTensorIds) {
+            freeNum += (tensorId != GraphRunner::Graph::INVALID_TENSOR_ID &&
+                        graph.tensorLastUseNodeIds.at(tensorId) == nodeId) ? 1 : 0;
+        }
+        for (uint32_t tensorId : node.outTensorIds) {
+            if (!graph.tensorMalloced.at(tensorId)) {
+                graph.tensorMalloced.at(tensorId) = 1;
+            }
+        }
+        freeNum += node.lastUseTensors.size();
+    }
+    return freeNum;
+}
+
+template <typename Func> double MeasureUs(int iterations, Func &&func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        func();
+    }
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+} // namespace
+
+TEST(TestGraphRunnerTensorLifetime, MatchMapBasedLifetime)
+{
+    /*
+        测试场景：带跳连的链式图，包含一个图内未使用的intensor
+        结果：每个节点的释放列表与按std::map/std::set记录的结果一致，未使用的intensor在setup开始时释放
+    */
+    constexpr uint32_t nodeNum = 32;
+    GraphRunner::Graph graph;
+    BuildChainGraph(graph, nodeNum);
+    graph.Init();
+    MapBasedLifetime reference;
+    reference.Init(graph);
+
+    ASSERT_EQ(graph.uselessInTensors.size(), 1U);
+    EXPECT_EQ(graph.uselessInTensors.at(0), &graph.inTensors.at(graph.inTensors.size() - 1));
+    ASSERT_EQ(graph.tensorLastUseNodeIds.size(), graph.GetTensorNum());
+    EXPECT_EQ(graph.tensorMalloced.size(), graph.GetTensorNum());
+    for (size_t nodeId = 0; nodeId < graph.nodes.size(); ++nodeId) {
+        auto &node = graph.nodes.at(nodeId);
+        std::set<Tensor *> lastUseTensors(node.lastUseTensors.begin(), node.lastUseTensors.end());
+        EXPECT_EQ(lastUseTensors.size(), node.lastUseTensors.size()) << "node[" << nodeId << "]";
+        auto it = reference.maxNodeIdTensorMap.find(nodeId);
+        std::set<Tensor *> expected = it == reference.maxNodeIdTensorMap.end() ? std::set<Tensor *>() : it->second;
+        EXPECT_EQ(lastUseTensors, expected) << "node[" << nodeId << "]";
+        ASSERT_EQ(node.inTensorIds.size(), node.inTensors.size());
+        for (size_t i = 0; i < node.inTensors.size(); ++i) {
+            auto refIt = reference.tensorMaxNodeIdMap.find(node.inTensors.at(i));
+            bool expectCanFree = refIt != reference.tensorMaxNodeIdMap.end() && refIt->second == nodeId;
+            EXPECT_EQ(graph.tensorLastUseNodeIds.at(node.inTensorIds.at(i)) == nodeId, expectCanFree);
+        }
+    }
+    EXPECT_EQ(graph.nodes.at(0).inTensorTypes.at(0), GraphRunner::NOT_INTERMEDIATE_TENSOR);
+    EXPECT_EQ(graph.nodes.at(1).inTensorTypes.at(0), GraphRunner::INTERMEDIATE_TENSOR);
+    EXPECT_EQ(graph.nodes.at(nodeNum - 1).outTensorTypes.at(0), GraphRunner::NOT_INTERMEDIATE_TENSOR);
+    EXPECT_TRUE(graph.IsOutTensorId(graph.nodes.at(nodeNum - 1).outTensorIds.at(0)));
+}
+
+TEST(TestGraphRunnerTensorLifetime, UnknownTensor)
+{
+    /*
+        测试场景：节点引用了不属于本图的tensor
+        结果：分配INVALID_TENSOR_ID，不参与释放与malloc记录
+    */
+    Tensor externalTensor;
+    GraphRunner::Graph graph;
+    BuildChainGraph(graph, SKIP_DISTANCE);
+    graph.nodes.at(0).inTensors.push_back(&externalTensor);
+    graph.Init();
+    size_t externalIdx = graph.nodes.at(0).inTensors.size() - 1;
+    EXPECT_EQ(graph.nodes.at(0).inTensorIds.at(externalIdx), GraphRunner::Graph::INVALID_TENSOR_ID);
+    EXPECT_EQ(graph.nodes.at(0).inTensorTypes.at(externalIdx), GraphRunner::NOT_INTERMEDIATE_TENSOR);
+    for (auto &node : graph.nodes) {
+        for (auto tensor : node.lastUseTensors) {
+            EXPECT_NE(tensor, &externalTensor);
+        }
+    }
+}
+
+TEST(TestGraphRunnerTensorLifetime, SetupBenchmark)
+{
+    /*
+        测试场景：64~256节点的链式图，分别用std::map/std::set与稠密tensor id记录生命周期
+        结果：两种方式释放的tensor数一致；输出初始化与单次setup逐节点查询的耗时
+    */
+    int iterations = GetIterations();
+    std::cout << std::left << std::setw(10) << "nodeNum" << std::setw(16) << "map init(us)" << std::setw(18)
+              << "dense init(us)" << std::setw(16) << "map setup(us)" << "dense setup(us)" << std::endl;
+    for (uint32_t nodeNum : {64, 128, 200, 256}) {
+        GraphRunner::Graph graph;
+        BuildChainGraph(graph, nodeNum);
+        MapBasedLifetime reference;
+        int initIterations = iterations / 10 > 0 ? iterations / 10 : 1;
+        double mapInitUs = MeasureUs(initIterations, [&]() { reference.Init(graph); });
+        double denseInitUs = MeasureUs(initIterations, [&]() { graph.Init(); });
+
+        size_t mapFreeNum = 0;
+        size_t denseFreeNum = 0;
+        double mapSetupUs = MeasureUs(iterations, [&]() { mapFreeNum = reference.Setup(graph); });
+        double denseSetupUs = MeasureUs(iterations, [&]() { denseFreeNum = DenseSetup(graph); });
+        EXPECT_EQ(mapFreeNum, denseFreeNum) << "nodeNum:" << nodeNum;
+        std::cout << std::left << std::setw(10) << nodeNum << std::fixed << std::setprecision(3) << std::setw(16)
+                  << mapInitUs << std::setw(18) << denseInitUs << std::setw(16) << mapSetupUs << denseSetupUs
+                  << std::endl;
+    }
+}
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include "atb/operation.h"
+#include "atb/infer_op_params.h"
+#include "atb/operation/graph_serializer.h"
+#include "atb/utils/param_from_json.h"
+#include "atb/utils/param_to_json.h"
+#include "atb/utils/reshape_spec.h"
+
+using namespace atb;
+
+namespace {
+constexpr uint32_t LAYER_NUM = 4;
+constexpr uint32_t STREAM_ID = 1;
+
+std::string GetTestFilePath(const std::string &name)
+{
+    return "/tmp/atb_graph_serializer_" + std::to_string(getpid()) + "_" + name + ".json";
+}
+
+nlohmann::json ReadJsonFile(const std::string &filePath)
+{
+    std::ifstream ifs(filePath);
+    return nlohmann::json::parse(ifs, nullptr, false);
+}
+
+// 将参数json的每个字段改为非默认值，进程内句柄不参与序列化
+void MutateParamJson(nlohmann::json &json)
+{
+    if (json.is_object()) {
+        for (auto it = json.begin(); it != json.end(); ++it) {
+            if (it.key() != "hcclComm" && it.key() != "event") {
+                MutateParamJson(it.value());
+            }
+        }
+    } else if (json.is_array()) {
+        if (json.empty()) {
+            json.push_back(1);
+            return;
+        }
+        for (nlohmann::json &item : json) {
+            MutateParamJson(item);
+        }
+    } else if (json.is_boolean()) {
+        json = !json.get<bool>();
+    } else if (json.is_number_float()) {
+        double value = json.get<double>();
+        json = value == 0 ? 0.5 : value * 2;
+    } else if (json.is_number_unsigned()) {
+        json = json.get<uint64_t>() ^ 1U;
+    } else if (json.is_number_integer()) {
+        json = json.get<int64_t>() ^ 1;
+    } else if (json.is_string()) {
+        json = json.get<std::string>() + "_x";
+    }
+}
+
+// 子图：x + y -> merge_dims(0, 1) -> mul z
+Operation *CreateAddMulGraph()
+{
+    GraphParam graphParam;
+    graphParam.name = "AddMulGraph";
+    graphParam.inTensorNum = 3;
+    graphParam.outTensorNum = 1;
+    graphParam.internalTensorNum = 1;
+    graphParam.nodes.resize(2);
+    infer::ElewiseParam addParam;
+    addParam.elewiseType = infer::ElewiseParam::ElewiseType::ELEWISE_ADD;
+    infer::ElewiseParam mulParam;
+    mulParam.elewiseType = infer::ElewiseParam::ElewiseType::ELEWISE_MUL;
+    EXPECT_EQ(CreateOperation(addParam, &graphParam.nodes.at(0).operation), NO_ERROR);
+    graphParam.nodes.at(0).inTensorIds = {0, 1};
+    graphParam.nodes.at(0).outTensorIds = {4};
+    EXPECT_EQ(CreateOperation(mulParam, &graphParam.nodes.at(1).operation), NO_ERROR);
+    graphParam.nodes.at(1).inTensorIds = {4, 2};
+    graphParam.nodes.at(1).outTensorIds = {3};
+    graphParam.nodes.at(1).inTensorReshapeFuncs = {ReshapeSpec::MergeDims(0, 1).ToReshapeFunc(), nullptr};
+    Operation *operation = nullptr;
+    EXPECT_EQ(CreateOperation(graphParam, &operation), NO_ERROR);
+    return operation;
+}
+
+// 多层图：每层一个嵌套子图加一个RmsNorm，最后一层的RmsNorm在另一条stream上执行
+Operation *CreateLayerGraph()
+{
+    GraphParam graphParam;
+    graphParam.name = "LayerGraph";
+    graphParam.inTensorNum = 1 + LAYER_NUM * 3;
+    graphParam.outTensorNum = 1;
+    graphParam.internalTensorNum = LAYER_NUM * 2 - 1;
+    uint32_t current = 0;
+    uint32_t internalId = graphParam.inTensorNum + graphParam.outTensorNum;
+    for (uint32_t i = 0; i < LAYER_NUM; ++i) {
+        Node layerNode;
+        layerNode.operation = CreateAddMulGraph();
+        layerNode.inTensorIds = {current, 1 + i * 3, 2 + i * 3};
+        layerNode.outTensorIds = {internalId};
+        graphParam.nodes.push_back(layerNode);
+
+        Node normNode;
+        infer::RmsNormParam normParam;
+        normParam.layerType = infer::RmsNormParam::RmsNormType::RMS_NORM_NORM;
+        normParam.normParam.epsilon = 1e-6;
+        EXPECT_EQ(CreateOperation(normParam, &normNode.operation), NO_ERROR);
+        normNode.inTensorIds = {internalId, 3 + i * 3};
+        current = i + 1 == LAYER_NUM ? graphParam.inTensorNum : internalId + 1;
+        normNode.outTensorIds = {current};
+        normNode.inTensorReshapeFuncs = {ReshapeSpec::SplitDim(0, {2, -1}).ToReshapeFunc(), nullptr};
+        if (i + 1 == LAYER_NUM) {
+            SetExecuteStreamId(normNode.operation, STREAM_ID);
+        }
+        graphParam.nodes.push_back(normNode);
+        internalId += 2;
+    }
+    Operation *operation = nullptr;
+    EXPECT_EQ(CreateOperation(graphParam, &operation), NO_ERROR);
+    return operation;
+}
+} // namespace
+
+TEST(TestGraphSerializer, ReshapeSpecJson)
+{
+    ReshapeSpec spec = ReshapeSpec::SplitDim(-1, {4, -1});
+    ReshapeSpec loadSpec = ReshapeSpec::FromJson(spec.ToJson());
+    EXPECT_EQ(loadSpec.ToString(), spec.ToString());
+    Dims oldShape = {{2, 3, 16}, 3};
+    Dims newShape;
+    ASSERT_TRUE(loadSpec.Apply(oldShape, newShape));
+    EXPECT_EQ(newShape.dimNum, 4U);
+    EXPECT_EQ(newShape.dims[3], 4);
+
+    ReshapeFunc specFunc = spec.ToReshapeFunc();
+    ASSERT_NE(ReshapeSpec::FromReshapeFunc(specFunc), nullptr);
+    EXPECT_EQ(ReshapeSpec::FromReshapeFunc(specFunc)->ToString(), spec.ToString());
+    ReshapeFunc lambdaFunc = [](const Dims &oldDims, Dims &newDims) { newDims = oldDims; };
+    EXPECT_EQ(ReshapeSpec::FromReshapeFunc(lambdaFunc), nullptr);
+    nlohmann::json invalidSpecJson = {{"type", "flatten"}, {"dim", 0}};
+    EXPECT_THROW(ReshapeSpec::FromJson(invalidSpecJson), std::runtime_error);
+}
+
+TEST(TestGraphSerializer, OpParamJsonRoundTrip)
+{
+    /*
+        测试场景：遍历所有可序列化的参数类型，将默认参数json的每个字段改为非默认值后解析再转回json
+        结果：转回的json与修改后的json相等，没有字段在保存加载时丢失
+    */
+    std::vector<std::string> paramTypes = GraphSerializer::GetSupportedParamTypes();
+    ASSERT_FALSE(paramTypes.empty());
+    for (const std::string &paramType : paramTypes) {
+        nlohmann::json defaultJson;
+        ASSERT_EQ(GraphSerializer::ParamJsonRoundTrip(paramType, nlohmann::json::object(), defaultJson), NO_ERROR);
+        nlohmann::json mutatedJson = defaultJson;
+        MutateParamJson(mutatedJson);
+        nlohmann::json resultJson;
+        ASSERT_EQ(GraphSerializer::ParamJsonRoundTrip(paramType, mutatedJson, resultJson), NO_ERROR);
+        EXPECT_EQ(resultJson, mutatedJson) << paramType;
+    }
+
+    nlohmann::json pagedAttentionJson;
+    GraphSerializer::ParamJsonRoundTrip("infer::PagedAttentionParam", nlohmann::json::object(), pagedAttentionJson);
+    for (const char *key : {"outDataType", "scaleType", "inputLayout", "qScale"}) {
+        EXPECT_TRUE(pagedAttentionJson.contains(key)) << key;
+    }
+    nlohmann::json activationJson;
+    GraphSerializer::ParamJsonRoundTrip("infer::ActivationParam", nlohmann::json::object(), activationJson);
+    EXPECT_TRUE(activationJson.contains("geluMode"));
+    nlohmann::json gatingJson;
+    GraphSerializer::ParamJsonRoundTrip("infer::GatingParam", nlohmann::json::object(), gatingJson);
+    EXPECT_TRUE(gatingJson.contains("cumSumInt64"));
+    nlohmann::json allToAllJson;
+    GraphSerializer::ParamJsonRoundTrip("infer::AllToAllParam", nlohmann::json::object(), allToAllJson);
+    EXPECT_TRUE(allToAllJson.contains("transpose"));
+    nlohmann::json linearParallelJson;
+    GraphSerializer::ParamJsonRoundTrip("infer::LinearParallelParam", nlohmann::json::object(), linearParallelJson);
+    EXPECT_TRUE(linearParallelJson.contains("twoDimTPInfo"));
+
+    nlohmann::json unknownJson;
+    EXPECT_EQ(GraphSerializer::ParamJsonRoundTrip("infer::UnknownParam", nlohmann::json::object(), unknownJson),
+              ERROR_INVALID_PARAM);
+}
+
+TEST(TestGraphSerializer, SaveAndLoad)
+{
+    /*
+        测试场景：多层嵌套图算子保存后重新加载，再次保存
+        结果：两次保存的文件内容一致，加载的图算子输入输出个数与streamId与原图一致
+    */
+    Operation *operation = CreateLayerGraph();
+    ASSERT_NE(operation, nullptr);
+    std::string filePath = GetTestFilePath("save");
+    std::string reloadFilePath = GetTestFilePath("reload");
+    ASSERT_EQ(SaveGraphOperation(operation, filePath), NO_ERROR);
+
+    Operation *loadOperation = nullptr;
+    ASSERT_EQ(LoadGraphOperation(filePath, &loadOperation), NO_ERROR);
+    ASSERT_NE(loadOperation, nullptr);
+    EXPECT_EQ(loadOperation->GetName(), operation->GetName());
+    EXPECT_EQ(loadOperation->GetInputNum(), operation->GetInputNum());
+    EXPECT_EQ(loadOperation->GetOutputNum(), operation->GetOutputNum());
+    ASSERT_EQ(SaveGraphOperation(loadOperation, reloadFilePath), NO_ERROR);
+
+    nlohmann::json fileJson = ReadJsonFile(filePath);
+    EXPECT_EQ(fileJson, ReadJsonFile(reloadFilePath));
+    EXPECT_EQ(fileJson["version"], GraphSerializer::FORMAT_VERSION);
+    const nlohmann::json &nodesJson = fileJson["graph"]["nodes"];
+    ASSERT_EQ(nodesJson.size(), LAYER_NUM * 2);
+    EXPECT_EQ(nodesJson[0]["paramType"], "GraphParam");
+    EXPECT_EQ(nodesJson[0]["graph"]["nodes"][1]["inTensorReshapes"][0]["type"], "merge_dims");
+    EXPECT_EQ(nodesJson[1]["paramType"], "infer::RmsNormParam");
+    EXPECT_EQ(nodesJson[LAYER_NUM * 2 - 1]["streamId"], STREAM_ID);
+
+    EXPECT_EQ(DestroyOperation(operation), NO_ERROR);
+    EXPECT_EQ(DestroyOperation(loadOperation), NO_ERROR);
+    std::remove(filePath.c_str());
+    std::remove(reloadFilePath.c_str());
+}
+
+TEST(TestGraphSerializer, SameOperationName)
+{
+    /*
+        测试场景：RmsNormParam与RmsNormWithStrideParam创建的算子同名
+        结果：保存时按算子实际类型区分出各自的参数类型
+    */
+    GraphParam graphParam;
+    graphParam.inTensorNum = 4;
+    graphParam.outTensorNum = 2;
+    graphParam.nodes.resize(2);
+    infer::RmsNormParam normParam;
+    normParam.layerType = infer::RmsNormParam::RmsNormType::RMS_NORM_NORM;
+    infer::RmsNormWithStrideParam strideNormParam;
+    strideNormParam.layerType = infer::RmsNormWithStrideParam::RmsNormType::RMS_NORM_NORM;
+    ASSERT_EQ(CreateOperation(normParam, &graphParam.nodes.at(0).operation), NO_ERROR);
+    graphParam.nodes.at(0).inTensorIds = {0, 1};
+    graphParam.nodes.at(0).outTensorIds = {4};
+    ASSERT_EQ(CreateOperation(strideNormParam, &graphParam.nodes.at(1).operation), NO_ERROR);
+    graphParam.nodes.at(1).inTensorIds = {2, 3, 0, 1};
+    graphParam.nodes.at(1).outTensorIds = {5};
+    EXPECT_EQ(graphParam.nodes.at(0).operation->GetName(), graphParam.nodes.at(1).operation->GetName());
+
+    nlohmann::json graphJson;
+    ASSERT_EQ(GraphSerializer::GraphParamToJson(graphParam, graphJson), NO_ERROR);
+    EXPECT_EQ(graphJson["nodes"][0]["paramType"], "infer::RmsNormParam");
+    EXPECT_EQ(graphJson["nodes"][1]["paramType"], "infer::RmsNormWithStrideParam");
+    for (Node &node : graphParam.nodes) {
+        DestroyOperation(node.operation);
+    }
+}
+
+TEST(TestGraphSerializer, UnsupportedGraph)
+{
+    /*
+        测试场景：节点使用不可序列化的reshape回调，或文件版本高于当前版本
+        结果：保存与加载均返回ERROR_INVALID_PARAM
+    */
+    GraphParam graphParam;
+    graphParam.inTensorNum = 2;
+    graphParam.outTensorNum = 1;
+    graphParam.nodes.resize(1);
+    infer::ElewiseParam addParam;
+    addParam.elewiseType = infer::ElewiseParam::ElewiseType::ELEWISE_ADD;
+    ASSERT_EQ(CreateOperation(addParam, &graphParam.nodes.at(0).operation), NO_ERROR);
+    graphParam.nodes.at(0).inTensorIds = {0, 1};
+    graphParam.nodes.at(0).outTensorIds = {2};
+    graphParam.nodes.at(0).inTensorReshapeFuncs = {[](const Dims &oldDims, Dims &newDims) { newDims = oldDims; },
+                                                   nullptr};
+    Operation *operation = nullptr;
+    ASSERT_EQ(CreateOperation(graphParam, &operation), NO_ERROR);
+    std::string filePath = GetTestFilePath("unsupported");
+    EXPECT_EQ(SaveGraphOperation(operation, filePath), ERROR_INVALID_PARAM);
+    EXPECT_EQ(SaveGraphOperation(graphParam.nodes.at(0).operation, filePath), ERROR_INVALID_PARAM);
+    EXPECT_EQ(DestroyOperation(operation), NO_ERROR);
+
+    nlohmann::json fileJson = {{"format", "atb_graph"},
+                               {"version", GraphSerializer::FORMAT_VERSION + 1},
+                               {"graph", nlohmann::json::object()}};
+    std::ofstream(filePath) << fileJson.dump();
+    Operation *loadOperation = nullptr;
+    EXPECT_EQ(LoadGraphOperation(filePath, &loadOperation), ERROR_INVALID_PARAM);
+    EXPECT_EQ(loadOperation, nullptr);
+    std::remove(filePath.c_str());
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <gtest/gtest.h>
+#include "atb/infer_op_params.h"
+#include "atb/operation.h"
+#include "atb/operation/infer_shape_cache.h"
+#include "atb/utils/statistic.h"
+
+using namespace atb;
+
+namespace {
+TensorDesc MakeDesc(int64_t dim0, int64_t dim1)
+{
+    TensorDesc desc;
+    desc.dtype = ACL_FLOAT16;
+    desc.format = ACL_FORMAT_ND;
+    desc.shape.dimNum = 2; // 2: 二维
+    desc.shape.dims[0] = dim0;
+    desc.shape.dims[1] = dim1;
+    return desc;
+}
+} // namespace
+
+// 测试场景：相同输入描述与参数版本重复查询，改变shape或参数版本后查询
+// 测试结果：前者命中并返回缓存的输出描述，后者均未命中
+TEST(TestInferShapeCache, HitAndMiss)
+{
+    InferShapeCache cache;
+    SVector<TensorDesc> inTensorDescs = {MakeDesc(2, 3)};
+    SVector<TensorDesc> outTensorDescs = {MakeDesc(3, 2)};
+    SVector<TensorDesc> cachedTensorDescs;
+    EXPECT_FALSE(cache.Get(inTensorDescs, 0, cachedTensorDescs));
+    cache.Add(inTensorDescs, 0, outTensorDescs);
+    ASSERT_TRUE(cache.Get(inTensorDescs, 0, cachedTensorDescs));
+    ASSERT_EQ(cachedTensorDescs.size(), 1);
+    EXPECT_EQ(cachedTensorDescs.at(0).shape.dims[0], 3);
+    EXPECT_EQ(cachedTensorDescs.at(0).shape.dims[1], 2);
+
+    SVector<TensorDesc> otherTensorDescs = {MakeDesc(2, 4)};
+    EXPECT_FALSE(cache.Get(otherTensorDescs, 0, cachedTensorDescs));
+    EXPECT_FALSE(cache.Get(inTensorDescs, 1, cachedTensorDescs));
+    otherTensorDescs.at(0) = MakeDesc(2, 3);
+    otherTensorDescs.at(0).dtype = ACL_BF16;
+    EXPECT_FALSE(cache.Get(otherTensorDescs, 0, cachedTensorDescs));
+    cache.Clear();
+    EXPECT_FALSE(cache.Get(inTensorDescs, 0, cachedTensorDescs));
+}
+
+// 测试场景：写入超过缓存项数的不同shape
+// 测试结果：缓存项数不超过上限，最早写入的项被替换，最近写入的项仍可命中
+TEST(TestInferShapeCache, ReplaceOldest)
+{
+    InferShapeCache cache;
+    const int64_t shapeNum = InferShapeCache::CACHE_ITEM_COUNT + 1;
+    for (int64_t i = 1; i <= shapeNum; ++i) {
+        SVector<TensorDesc> inTensorDescs = {MakeDesc(i, 1)};
+        cache.Add(inTensorDescs, 0, inTensorDescs);
+    }
+    EXPECT_EQ(cache.GetSize(), InferShapeCache::CACHE_ITEM_COUNT);
+    SVector<TensorDesc> cachedTensorDescs;
+    SVector<TensorDesc> firstTensorDescs = {MakeDesc(1, 1)};
+    EXPECT_FALSE(cache.Get(firstTensorDescs, 0, cachedTensorDescs));
+    for (int64_t i = 2; i <= shapeNum; ++i) {
+        SVector<TensorDesc> inTensorDescs = {MakeDesc(i, 1)};
+        ASSERT_TRUE(cache.Get(inTensorDescs, 0, cachedTensorDescs));
+        EXPECT_EQ(cachedTensorDescs.at(0).shape.dims[0], i);
+    }
+}
+
+// 测试场景：Operation重复InferShape，之后通过UpdateOperationParam修改输出shape相关的参数
+// 测试结果：第二次InferShape命中缓存；参数更新后缓存失效，推导出新参数对应的shape
+TEST(TestInferShapeCache, InvalidateOnUpdateParam)
+{
+    infer::FillParam param;
+    param.withMask = false;
+    param.value = {1.0f};
+    param.outDim = {2, 3};
+    Operation *op = nullptr;
+    ASSERT_EQ(CreateOperation(param, &op), NO_ERROR);
+    SVector<TensorDesc> inTensorDescs;
+    SVector<TensorDesc> outTensorDescs;
+    GetOpSetupStatistic().Reset();
+    EXPECT_EQ(op->InferShape(inTensorDescs, outTensorDescs), NO_ERROR);
+    EXPECT_EQ(op->InferShape(inTensorDescs, outTensorDescs), NO_ERROR);
+    EXPECT_EQ(GetOpSetupStatistic().inferShapeCacheMissCount, 1);
+    EXPECT_EQ(GetOpSetupStatistic().inferShapeCacheHitCount, 1);
+    ASSERT_EQ(outTensorDescs.size(), 1);
+    EXPECT_EQ(outTensorDescs.at(0).shape.dimNum, 2);
+
+    param.outDim = {4, 5, 6};
+    ASSERT_EQ(UpdateOperationParam(op, param), NO_ERROR);
+    EXPECT_EQ(op->InferShape(inTensorDescs, outTensorDescs), NO_ERROR);
+    EXPECT_EQ(GetOpSetupStatistic().inferShapeCacheMissCount, 2);
+    ASSERT_EQ(outTensorDescs.size(), 1);
+    EXPECT_EQ(outTensorDescs.at(0).shape.dimNum, 3);
+    EXPECT_EQ(outTensorDescs.at(0).shape.dims[0], 4);
+    GetOpSetupStatistic().Reset();
+    EXPECT_EQ(DestroyOperation(op), NO_ERROR);
+}
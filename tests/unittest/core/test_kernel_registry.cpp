@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <memory>
+#include <gtest/gtest.h>
+#include <mki/launch_param.h>
+#include <asdops/ops.h>
+#include <asdops/params/params.h>
+#include "atb/kernel_cache/kernel_registry.h"
+#include "atb/utils/config.h"
+#include "atb/utils/singleton.h"
+
+using namespace atb;
+
+namespace {
+Mki::LaunchParam MakeLaunchParam(int64_t dim, AsdOps::OpParam::Elewise::ElewiseType elewiseType)
+{
+    Mki::LaunchParam launchParam;
+    Mki::SVector<int64_t> dims{2, dim};
+    launchParam.AddInTensor({{Mki::TENSOR_DTYPE_FLOAT16, Mki::TENSOR_FORMAT_ND, dims}});
+    launchParam.AddInTensor({{Mki::TENSOR_DTYPE_FLOAT16, Mki::TENSOR_FORMAT_ND, dims}});
+    launchParam.AddOutTensor({{Mki::TENSOR_DTYPE_FLOAT16, Mki::TENSOR_FORMAT_ND, dims}});
+    launchParam.SetParam(AsdOps::OpParam::Elewise({elewiseType}));
+    return launchParam;
+}
+
+LaunchParamKey MakeLaunchParamKey(const Mki::LaunchParam &launchParam)
+{
+    LaunchParamKey launchParamKey;
+    launchParamKey.Init(launchParam, LaunchParamKey::CalcFingerprint(launchParam));
+    return launchParamKey;
+}
+
+std::unique_ptr<Mki::Kernel> GetBestKernel(const Mki::LaunchParam &launchParam)
+{
+    Mki::Operation *operation = AsdOps::Ops::Instance().GetOperationByName("ElewiseOperation");
+    if (operation == nullptr) {
+        return nullptr;
+    }
+    return std::unique_ptr<Mki::Kernel>(operation->GetBestKernel(launchParam));
+}
+} // namespace
+
+TEST(TestLaunchParamKey, FingerprintCollision)
+{
+    /*
+        测试场景：两个输入shape不同的LaunchParamKey，人为改成相同的fingerprint后比较
+        结果：fingerprint相同时仍逐项比较tensor描述，判定为不相等；与自身LaunchParam比较相等
+    */
+    Mki::LaunchParam launchParam = MakeLaunchParam(16, AsdOps::OpParam::Elewise::ELEWISE_ADD);
+    Mki::LaunchParam otherLaunchParam = MakeLaunchParam(32, AsdOps::OpParam::Elewise::ELEWISE_ADD);
+    LaunchParamKey launchParamKey = MakeLaunchParamKey(launchParam);
+    LaunchParamKey collidedKey = MakeLaunchParamKey(otherLaunchParam);
+    EXPECT_NE(launchParamKey.fingerprint, collidedKey.fingerprint);
+    collidedKey.fingerprint = launchParamKey.fingerprint;
+    EXPECT_FALSE(launchParamKey.IsEqual(collidedKey));
+    EXPECT_FALSE(launchParamKey.IsEqual(otherLaunchParam, launchParamKey.fingerprint));
+    EXPECT_TRUE(launchParamKey.IsEqual(launchParam, launchParamKey.fingerprint));
+    EXPECT_TRUE(launchParamKey.IsEqual(MakeLaunchParamKey(launchParam)));
+}
+
+TEST(TestLaunchParamKey, DifferOnlyInParamAttribute)
+{
+    /*
+        测试场景：输入tensor描述相同，仅算子参数的elewiseType不同
+        结果：fingerprint只区分参数类型，两者相同；IsEqual比较参数内容，判定为不相等
+    */
+    Mki::LaunchParam addLaunchParam = MakeLaunchParam(16, AsdOps::OpParam::Elewise::ELEWISE_ADD);
+    Mki::LaunchParam mulLaunchParam = MakeLaunchParam(16, AsdOps::OpParam::Elewise::ELEWISE_MUL);
+    LaunchParamKey addKey = MakeLaunchParamKey(addLaunchParam);
+    LaunchParamKey mulKey = MakeLaunchParamKey(mulLaunchParam);
+    EXPECT_EQ(addKey.fingerprint, mulKey.fingerprint);
+    EXPECT_FALSE(addKey.IsEqual(mulKey));
+    EXPECT_FALSE(addKey.IsEqual(mulLaunchParam, mulKey.fingerprint));
+}
+
+TEST(TestKernelRegistry, InternSameKernelTwice)
+{
+    /*
+        测试场景：同一kernel以相同LaunchParamKey驻留两次，再以另一个同名kernel对象驻留，之后释放全部引用再驻留
+        结果：前三次返回同一份副本且只记一项；引用全部释放后重新驻留生成新副本，过期项被清理，计数仍为1
+    */
+    if (!GetSingleton<Config>().Is910B()) {
+        GTEST_SKIP() << "This test case only support 910B";
+    }
+    Mki::LaunchParam launchParam = MakeLaunchParam(16, AsdOps::OpParam::Elewise::ELEWISE_ADD);
+    std::unique_ptr<Mki::Kernel> kernel = GetBestKernel(launchParam);
+    std::unique_ptr<Mki::Kernel> otherKernel = GetBestKernel(launchParam);
+    ASSERT_NE(kernel, nullptr);
+    ASSERT_NE(otherKernel, nullptr);
+    LaunchParamKey launchParamKey = MakeLaunchParamKey(launchParam);
+
+    KernelRegistry registry;
+    std::shared_ptr<const Mki::Kernel> interned = registry.Intern(kernel.get(), launchParamKey);
+    ASSERT_NE(interned, nullptr);
+    EXPECT_NE(interned.get(), kernel.get());
+    EXPECT_EQ(registry.Intern(kernel.get(), launchParamKey), interned);
+    EXPECT_EQ(registry.Intern(otherKernel.get(), MakeLaunchParamKey(launchParam)), interned);
+    EXPECT_EQ(registry.GetInternedKernelCount(), 1U);
+
+    std::weak_ptr<const Mki::Kernel> expired = interned;
+    interned.reset();
+    EXPECT_TRUE(expired.expired());
+    std::shared_ptr<const Mki::Kernel> reinterned = registry.Intern(kernel.get(), launchParamKey);
+    ASSERT_NE(reinterned, nullptr);
+    EXPECT_EQ(registry.GetInternedKernelCount(), 1U);
+}
+
+TEST(TestKernelRegistry, DistinctKeysNotShared)
+{
+    /*
+        测试场景：同一kernel分别以fingerprint碰撞但shape不同的key、仅elewiseType不同的key驻留
+        结果：每个key各得到一份独立副本，驻留数为3
+    */
+    if (!GetSingleton<Config>().Is910B()) {
+        GTEST_SKIP() << "This test case only support 910B";
+    }
+    Mki::LaunchParam launchParam = MakeLaunchParam(16, AsdOps::OpParam::Elewise::ELEWISE_ADD);
+    std::unique_ptr<Mki::Kernel> kernel = GetBestKernel(launchParam);
+    ASSERT_NE(kernel, nullptr);
+    LaunchParamKey launchParamKey = MakeLaunchParamKey(launchParam);
+    LaunchParamKey collidedKey = MakeLaunchParamKey(MakeLaunchParam(32, AsdOps::OpParam::Elewise::ELEWISE_ADD));
+    collidedKey.fingerprint = launchParamKey.fingerprint;
+    LaunchParamKey mulKey = MakeLaunchParamKey(MakeLaunchParam(16, AsdOps::OpParam::Elewise::ELEWISE_MUL));
+
+    KernelRegistry registry;
+    std::shared_ptr<const Mki::Kernel> interned = registry.Intern(kernel.get(), launchParamKey);
+    std::shared_ptr<const Mki::Kernel> collidedInterned = registry.Intern(kernel.get(), collidedKey);
+    std::shared_ptr<const Mki::Kernel> mulInterned = registry.Intern(kernel.get(), mulKey);
+    ASSERT_NE(interned, nullptr);
+    ASSERT_NE(collidedInterned, nullptr);
+    ASSERT_NE(mulInterned, nullptr);
+    EXPECT_NE(interned, collidedInterned);
+    EXPECT_NE(interned, mulInterned);
+    EXPECT_NE(collidedInterned, mulInterned);
+    EXPECT_EQ(registry.GetInternedKernelCount(), 3U);
+}
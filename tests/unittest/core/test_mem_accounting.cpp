@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include "atb/utils/mem_accounting.h"
+
+using namespace atb;
+
+namespace {
+constexpr uint64_t WORKSPACE_SIZE = 1024;
+constexpr uint64_t INTERMEDIATE_SIZE = 4096;
+constexpr uint64_t TILING_SIZE = 512;
+} // namespace
+
+TEST(TestMemAccounting, StatisticAndPeak)
+{
+    /*
+        测试场景：两个算子交替执行，第二次执行layer的workspace变大
+        结果：按算子汇总最近一次与最大值，时间线中的峰值单调不减
+    */
+    MemAccounting memAccounting;
+    memAccounting.SetEnable(true);
+    uint32_t layerId = memAccounting.RegisterName("Layer");
+    uint32_t lmHeadId = memAccounting.RegisterName("LmHead");
+    EXPECT_EQ(memAccounting.RegisterName("Layer"), layerId);
+    memAccounting.Record(layerId, WORKSPACE_SIZE * 2, INTERMEDIATE_SIZE, TILING_SIZE);
+    memAccounting.Record(lmHeadId, WORKSPACE_SIZE, 0, TILING_SIZE);
+    memAccounting.Record(layerId, WORKSPACE_SIZE, INTERMEDIATE_SIZE, TILING_SIZE);
+
+    std::vector<OpMemStatistic> statistics = memAccounting.GetStatistics();
+    ASSERT_EQ(statistics.size(), 2U);
+    EXPECT_EQ(statistics.at(0).opName, "Layer");
+    EXPECT_EQ(statistics.at(0).executeCount, 2U);
+    EXPECT_EQ(statistics.at(0).workspaceSize, WORKSPACE_SIZE);
+    EXPECT_EQ(statistics.at(0).maxWorkspaceSize, WORKSPACE_SIZE * 2);
+    EXPECT_EQ(statistics.at(0).maxTotalSize, WORKSPACE_SIZE * 2 + INTERMEDIATE_SIZE + TILING_SIZE);
+    EXPECT_EQ(statistics.at(1).opName, "LmHead");
+    EXPECT_EQ(statistics.at(1).maxIntermediateSize, 0U);
+    EXPECT_EQ(memAccounting.GetPeakSize(), WORKSPACE_SIZE * 2 + INTERMEDIATE_SIZE + TILING_SIZE);
+
+    std::vector<OpMemRecord> records = memAccounting.GetRecords();
+    ASSERT_EQ(records.size(), 3U);
+    for (size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(records.at(i).executeIndex, i);
+        EXPECT_EQ(records.at(i).peakSize, memAccounting.GetPeakSize());
+    }
+    EXPECT_EQ(records.at(1).opName, "LmHead");
+
+    memAccounting.Reset();
+    EXPECT_TRUE(memAccounting.GetStatistics().empty());
+    EXPECT_TRUE(memAccounting.GetRecords().empty());
+    memAccounting.Record(lmHeadId, WORKSPACE_SIZE, 0, 0);
+    ASSERT_EQ(memAccounting.GetStatistics().size(), 1U);
+    EXPECT_EQ(memAccounting.GetStatistics().at(0).opName, "LmHead");
+    memAccounting.SetEnable(false);
+}
+
+TEST(TestMemAccounting, Dump)
+{
+    /*
+        测试场景：分别导出csv与json
+        结果：csv为表头加每个算子一行；json包含算子汇总与时间线
+    */
+    MemAccounting memAccounting;
+    uint32_t nameId = memAccounting.RegisterName("Layer\"0\"");
+    memAccounting.Record(nameId, WORKSPACE_SIZE, INTERMEDIATE_SIZE, TILING_SIZE);
+
+    std::string csvPath = "atb_mem_test_" + std::to_string(getpid()) + ".csv";
+    ASSERT_EQ(memAccounting.Dump(csvPath), NO_ERROR);
+    std::ifstream csvFile(csvPath);
+    std::string header;
+    std::string row;
+    std::getline(csvFile, header);
+    std::getline(csvFile, row);
+    EXPECT_EQ(header.find("opName,executeCount"), 0U);
+    EXPECT_EQ(row.find("\"Layer\"\"0\"\"\",1,1024,4096,512"), 0U);
+    std::remove(csvPath.c_str());
+
+    std::stringstream json;
+    memAccounting.DumpJson(json);
+    EXPECT_NE(json.str().find("\"operations\":["), std::string::npos);
+    EXPECT_NE(json.str().find("\"timeline\":["), std::string::npos);
+    EXPECT_NE(json.str().find("\"opName\":\"Layer\\\"0\\\"\""), std::string::npos);
+    EXPECT_EQ(memAccounting.Dump(""), ERROR_INVALID_PARAM);
+}
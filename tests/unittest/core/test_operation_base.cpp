@@ -17,10 +17,37 @@
 #include "atb/infer_op_params.h"
 #include "atb/operation.h"
 #include "atb/operation/operation_base.h"
+#include "atb/utils/config.h"
+#include "atb/utils/singleton.h"
 #include "atb/utils/tensor_util.h"
+#include "atb/utils/statistic.h"
+#include "atb/utils.h"
 
 using namespace atb;
 
+namespace {
+Operation *CreateSplitOperation()
+{
+    atb::infer::SplitParam param;
+    param.splitDim = 0;
+    param.splitNum = 2;
+    atb::Operation *op = nullptr;
+    EXPECT_EQ(atb::CreateOperation<atb::infer::SplitParam>(param, &op), NO_ERROR);
+    return op;
+}
+
+atb::TensorDesc CreateFp16Desc(int64_t dim0, int64_t dim1)
+{
+    atb::TensorDesc desc;
+    desc.dtype = ACL_FLOAT16;
+    desc.format = ACL_FORMAT_ND;
+    desc.shape.dimNum = 2;
+    desc.shape.dims[0] = dim0;
+    desc.shape.dims[1] = dim1;
+    return desc;
+}
+} // namespace
+
 TEST(TestOperationBase, TestGetName)
 {
     setenv("ATB_PROFILING_ENABLE", "1", 1);
@@ -56,4 +83,74 @@ TEST(TestOperationBase, TestGetName)
     setenv("ATB_PROFILING_ENABLE", "0", 1);
     setenv("ATB_SAVE_TENSOR", "0", 1);
     setenv("ATB_LOG_LEVEL", "FATAL", 1);
-}
\ No newline at end of file
+}
+TEST(TestOperationBase, TestExecuteWithNewAddressesInvalidParam)
+{
+    atb::Operation *op = CreateSplitOperation();
+    ASSERT_NE(op, nullptr);
+    VariantPack variantPack;
+    EXPECT_EQ(atb::ExecuteWithNewAddresses(nullptr, variantPack, nullptr, 0, nullptr), ERROR_INVALID_OPERATION_ADDR);
+    EXPECT_EQ(atb::ExecuteWithNewAddresses(op, variantPack, nullptr, 0, nullptr), ERROR_INVALID_PARAM);
+    DestroyOperation(op);
+}
+
+TEST(TestOperationBase, TestWarmupInvalidParam)
+{
+    atb::Operation *op = CreateSplitOperation();
+    ASSERT_NE(op, nullptr);
+    std::vector<atb::WarmupBucketResult> results;
+    EXPECT_EQ(atb::Warmup(nullptr, {}, nullptr, results), ERROR_INVALID_OPERATION_ADDR);
+    EXPECT_EQ(atb::Warmup(op, {}, nullptr, results), NO_ERROR);
+    EXPECT_TRUE(results.empty());
+    atb::TensorDesc desc = CreateFp16Desc(2, 2);
+    std::vector<atb::SVector<atb::TensorDesc>> buckets = {{desc}, {desc, desc}};
+    // context为空时第一个档位Setup失败，不再预热后续档位
+    EXPECT_EQ(atb::Warmup(op, buckets, nullptr, results), ERROR_INVALID_PARAM);
+    EXPECT_EQ(results.size(), buckets.size());
+    EXPECT_EQ(results.at(0).costTimeUs, 0U);
+    DestroyOperation(op);
+}
+
+TEST(TestOperationBase, TestWarmupThenSetupHitsCache)
+{
+    /*
+        测试场景：按一个真实档位预热add算子，再以相同描述信息的tensor调用Setup；Setup只校验shape，不需要device内存
+        结果：预热成功，之后的Setup命中runner的setup缓存，返回的workspaceSize与预热结果一致
+    */
+    if (!GetSingleton<Config>().Is910B()) {
+        GTEST_SKIP() << "This test case only support 910B";
+    }
+    atb::infer::ElewiseParam addParam;
+    addParam.elewiseType = atb::infer::ElewiseParam::ElewiseType::ELEWISE_ADD;
+    atb::Operation *op = nullptr;
+    ASSERT_EQ(atb::CreateOperation(addParam, &op), NO_ERROR);
+    atb::Context *context = nullptr;
+    ASSERT_EQ(atb::CreateContext(&context), NO_ERROR);
+
+    atb::TensorDesc desc = CreateFp16Desc(4, 16);
+    std::vector<atb::SVector<atb::TensorDesc>> buckets = {{desc, desc}};
+    std::vector<atb::WarmupBucketResult> results;
+    GetOpSetupStatistic().Reset();
+    ASSERT_EQ(atb::Warmup(op, buckets, context, results), NO_ERROR);
+    ASSERT_EQ(results.size(), buckets.size());
+    EXPECT_EQ(GetOpSetupStatistic().setupCacheMissCount, 1U);
+    EXPECT_EQ(GetOpSetupStatistic().setupCacheHitCount, 0U);
+
+    VariantPack variantPack;
+    variantPack.inTensors.resize(op->GetInputNum());
+    variantPack.outTensors.resize(op->GetOutputNum());
+    for (atb::Tensor &tensor : variantPack.inTensors) {
+        tensor.desc = desc;
+        tensor.dataSize = atb::Utils::GetTensorSize(tensor);
+    }
+    variantPack.outTensors.at(0) = variantPack.inTensors.at(0);
+    uint64_t workspaceSize = 0;
+    ASSERT_EQ(op->Setup(variantPack, workspaceSize, context), NO_ERROR);
+    EXPECT_EQ(GetOpSetupStatistic().setupCacheHitCount, 1U);
+    EXPECT_EQ(GetOpSetupStatistic().setupCacheMissCount, 1U);
+    EXPECT_EQ(workspaceSize, results.at(0).workspaceSize);
+    GetOpSetupStatistic().Reset();
+
+    DestroyOperation(op);
+    atb::DestroyContext(context);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024-2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <random>
+#include <gtest/gtest.h>
+#include "atb/operation/atb_operation_ir_cfg.h"
+#include "atb/operation/operation_ir.h"
+#include "atb/utils/singleton.h"
+
+using namespace atb;
+
+// 逐个支持组合比较dtype与format，作为位图匹配的参照
+static bool NaiveMatch(const OperationIr &operationIr, const SVector<TensorDesc> &inTensorDescs)
+{
+    for (size_t supportIdx = 0; supportIdx < operationIr.GetSupportSize(); ++supportIdx) {
+        bool matched = true;
+        for (size_t i = 0; i < inTensorDescs.size() && matched; ++i) {
+            if (inTensorDescs[i].shape.dimNum == 0) {
+                continue;
+            }
+            const TensorInfoIr &tensorInfoIr = operationIr.GetInTensorInfoIr(i);
+            matched = inTensorDescs[i].dtype == tensorInfoIr.supportedDtypes[supportIdx] &&
+                      inTensorDescs[i].format == tensorInfoIr.supportedFormats[supportIdx];
+        }
+        if (matched) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void MakeRandomInTensorDescs(const OperationIr &operationIr, std::mt19937 &rng,
+                                    SVector<TensorDesc> &inTensorDescs)
+{
+    inTensorDescs.resize(operationIr.GetInTensorNum());
+    for (size_t i = 0; i < operationIr.GetInTensorNum(); ++i) {
+        const TensorInfoIr &tensorInfoIr = operationIr.GetInTensorInfoIr(i);
+        size_t supportIdx = rng() % operationIr.GetSupportSize();
+        inTensorDescs[i].dtype = tensorInfoIr.supportedDtypes[supportIdx];
+        inTensorDescs[i].format = tensorInfoIr.supportedFormats[supportIdx];
+        inTensorDescs[i].shape.dimNum = (rng() % 8 == 0) ? 0 : 1; // 部分tensor为空
+        inTensorDescs[i].shape.dims[0] = 1;
+        if (rng() % 5 == 0) {
+            inTensorDescs[i].dtype = ACL_DOUBLE;
+        }
+    }
+}
+
+TEST(TestOperationIr, FindAllOperationIr)
+{
+    size_t operationIrNum = 0;
+    const OperationIr *operationIrs = GetAtbOperationIrs(operationIrNum);
+    ASSERT_NE(operationIrs, nullptr);
+    ASSERT_GT(operationIrNum, 0U);
+    for (size_t i = 0; i < operationIrNum; ++i) {
+        EXPECT_TRUE(operationIrs[i].IsValid()) << operationIrs[i].opKey;
+        EXPECT_EQ(GetSingleton<AtbOperationIrCfg>().GetOperationIr(operationIrs[i].opKey), &operationIrs[i]);
+    }
+    EXPECT_EQ(GetSingleton<AtbOperationIrCfg>().GetOperationIr("NotExistOperation"), nullptr);
+}
+
+TEST(TestOperationIr, MatchSameAsNaive)
+{
+    size_t operationIrNum = 0;
+    const OperationIr *operationIrs = GetAtbOperationIrs(operationIrNum);
+    std::mt19937 rng(0);
+    SVector<TensorDesc> inTensorDescs;
+    const int caseNum = 64;
+    for (size_t i = 0; i < operationIrNum; ++i) {
+        for (int j = 0; j < caseNum; ++j) {
+            MakeRandomInTensorDescs(operationIrs[i], rng, inTensorDescs);
+            EXPECT_EQ(operationIrs[i].MatchInTensors(inTensorDescs) != 0, NaiveMatch(operationIrs[i], inTensorDescs))
+                << operationIrs[i].opKey;
+        }
+    }
+}
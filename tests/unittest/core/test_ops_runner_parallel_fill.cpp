@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <vector>
+#include <gtest/gtest.h>
+#include <asdops/params/params.h>
+#include "atb/context.h"
+#include "atb/context/context_base.h"
+#include "atb/runner/ops_runner.h"
+#include "atb/utils/config.h"
+#include "atb/utils/operation_register.h"
+#include "atb/utils/singleton.h"
+#include "atb/utils/statistic.h"
+#include "atb/utils.h"
+
+using namespace atb;
+
+namespace {
+constexpr uint32_t TEST_THREAD_NUM = 4;
+
+// 由nodeNum个add kernel串联组成：out = x + y + y + ... + y
+class ChainAddOpsRunner : public OpsRunner {
+public:
+    explicit ChainAddOpsRunner(size_t nodeNum) : OpsRunner("ChainAddOpsRunner")
+    {
+        kernelGraph_.inTensors.resize(2);
+        kernelGraph_.outTensors.resize(1);
+        kernelGraph_.internalTensors.resize(nodeNum - 1);
+        kernelGraph_.nodes.resize(nodeNum);
+        Mki::Tensor *lastTensor = &kernelGraph_.inTensors.at(0);
+        for (size_t i = 0; i < nodeNum; ++i) {
+            auto &addNode = kernelGraph_.nodes.at(i);
+            addNode.opDesc = {0, "ElewiseOperation",
+                              AsdOps::OpParam::Elewise({AsdOps::OpParam::Elewise::ELEWISE_ADD})};
+            addNode.inTensors = {lastTensor, &kernelGraph_.inTensors.at(1)};
+            lastTensor = i + 1 == nodeNum ? &kernelGraph_.outTensors.at(0) : &kernelGraph_.internalTensors.at(i);
+            addNode.outTensors = {lastTensor};
+        }
+    }
+};
+
+REG_RUNNER_TYPE(ChainAddOpsRunner);
+
+Tensor CreateFp16Tensor()
+{
+    Tensor tensor;
+    tensor.desc.dtype = ACL_FLOAT16;
+    tensor.desc.format = ACL_FORMAT_ND;
+    tensor.desc.shape.dimNum = 2;
+    tensor.desc.shape.dims[0] = 2;
+    tensor.desc.shape.dims[1] = 16;
+    tensor.dataSize = Utils::GetTensorSize(tensor);
+    return tensor;
+}
+} // namespace
+
+// 测试场景：同一个含多个kernel的OpsRunner分别在未开启和开启tiling填充线程池的Context上填充host tiling
+// 测试结果：开启线程池时走并行填充，两次填充得到的host tiling逐字节一致
+TEST(TestOpsRunnerParallelFill, SameTilingAsSerialFill)
+{
+    if (!GetSingleton<Config>().Is910B()) {
+        GTEST_SKIP() << "This test case only support 910B";
+    }
+    Context *serialContext = nullptr;
+    Context *parallelContext = nullptr;
+    ASSERT_EQ(CreateContext(&serialContext), NO_ERROR);
+    ASSERT_EQ(CreateContext(&parallelContext), NO_ERROR);
+    ContextBase *serialContextBase = dynamic_cast<ContextBase *>(serialContext);
+    ContextBase *parallelContextBase = dynamic_cast<ContextBase *>(parallelContext);
+    ASSERT_NE(serialContextBase, nullptr);
+    ASSERT_NE(parallelContextBase, nullptr);
+    serialContextBase->SetTilingFillThreadNum(0);
+    parallelContextBase->SetTilingFillThreadNum(TEST_THREAD_NUM);
+
+    ChainAddOpsRunner runner(GetSingleton<Config>().GetTilingFillParallelMinNodeNum());
+    std::vector<uint8_t> setupTilingBuffer(serialContextBase->GetTilingBufferBlockSize(), 0);
+    RunnerVariantPack runnerVariantPack;
+    runnerVariantPack.inTensors = {CreateFp16Tensor(), CreateFp16Tensor()};
+    runnerVariantPack.outTensors = {CreateFp16Tensor()};
+    runnerVariantPack.context = serialContextBase;
+    runnerVariantPack.hostTilingBuffer = setupTilingBuffer.data();
+    runnerVariantPack.tilingBufferSize = setupTilingBuffer.size();
+    ASSERT_EQ(runner.Setup(runnerVariantPack), NO_ERROR);
+    uint64_t tilingSize = runner.GetTilingBufferSize();
+    ASSERT_GT(tilingSize, 0U);
+
+    std::vector<uint8_t> serialTiling(tilingSize, 0);
+    std::vector<uint8_t> parallelTiling(tilingSize, 0xFF);
+    uint64_t parallelFillCount = GetOpSetupStatistic().tilingParallelFillCount;
+    ASSERT_EQ(runner.FillHostTilingBuffer(serialTiling.data(), tilingSize, serialContextBase), NO_ERROR);
+    EXPECT_EQ(GetOpSetupStatistic().tilingParallelFillCount, parallelFillCount);
+    ASSERT_EQ(runner.FillHostTilingBuffer(parallelTiling.data(), tilingSize, parallelContextBase), NO_ERROR);
+    EXPECT_EQ(GetOpSetupStatistic().tilingParallelFillCount, parallelFillCount + 1);
+    EXPECT_EQ(serialTiling, parallelTiling);
+
+    DestroyContext(serialContext);
+    DestroyContext(parallelContext);
+}
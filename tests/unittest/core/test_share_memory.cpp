@@ -24,8 +24,8 @@ TEST(TestShareMemory, ShareMemory)
     HcclRootInfo hcclCommId = {};
     ATB_LOG(INFO) << "HCCL Runner Init Begin";
     std::string shmName = "hcclShareMem";
-    Mki::ShareMemory shm(shmName, sizeof(atb::CommInitInfo));
-    auto *shmInfo = (atb::CommInitInfo *)shm.GetShm();
+    Mki::ShareMemory shm(shmName, atb::ShmRendezvous::GetShmSize(1, sizeof(HcclRootInfo)));
+    auto *shmInfo = shm.GetShm();
     ATB_LOG(INFO) << "create share memory success";
     EXPECT_NE(shmInfo, nullptr);
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <mki/launch_param.h>
+#include "atb/kernel_cache/shared_kernel_cache.h"
+
+using namespace atb;
+
+namespace {
+constexpr size_t THREAD_NUM = 8;
+constexpr int SHAPE_NUM = 128;
+constexpr int LOOP_NUM = 20000;
+
+Mki::LaunchParam MakeLaunchParam(int64_t dim)
+{
+    Mki::LaunchParam launchParam;
+    Mki::SVector<int64_t> dims{1, dim};
+    launchParam.AddInTensor({{Mki::TENSOR_DTYPE_FLOAT16, Mki::TENSOR_FORMAT_ND, dims}});
+    return launchParam;
+}
+} // namespace
+
+TEST(TestSharedKernelCache, HitAndMiss)
+{
+    /*
+        测试场景：写入一条tiling后按相同/不同的(runner类型, kernel序号, LaunchParam)查询
+        结果：仅完全匹配时命中，命中的缓存项内容与写入一致
+    */
+    SharedKernelCache cache(16);
+    ASSERT_TRUE(cache.IsEnable());
+    Mki::LaunchParam launchParam = MakeLaunchParam(2);
+    EXPECT_EQ(cache.GetTiling(0, 0, launchParam), nullptr);
+    uint8_t tiling[4] = {1, 2, 3, 4};
+    cache.AddTiling(0, 0, tiling, sizeof(tiling), launchParam, nullptr);
+    SharedKernelCache::EntryPtr entry = cache.GetTiling(0, 0, launchParam);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->tilingBuffer, TilingBuffer(tiling, tiling + sizeof(tiling)));
+    EXPECT_EQ(cache.GetTiling(0, 1, launchParam), nullptr);
+    EXPECT_EQ(cache.GetTiling(1, 0, launchParam), nullptr);
+    EXPECT_EQ(cache.GetTiling(0, 0, MakeLaunchParam(3)), nullptr);
+    SharedKernelCacheStatistic statistic = cache.GetStatistic();
+    EXPECT_EQ(statistic.hitCount, 1U);
+    EXPECT_EQ(statistic.missCount, 4U);
+    EXPECT_EQ(statistic.addCount, 1U);
+}
+
+TEST(TestSharedKernelCache, BoundedReplace)
+{
+    /*
+        测试场景：写入远超容量的不同shape，以及容量为0时写入
+        结果：bucket写满后替换旧缓存项；容量为0时缓存不使能，不保存任何tiling
+    */
+    SharedKernelCache cache(16);
+    uint8_t tiling = 0;
+    for (int i = 0; i < SHAPE_NUM; ++i) {
+        cache.AddTiling(0, 0, &tiling, sizeof(tiling), MakeLaunchParam(i), nullptr);
+    }
+    SharedKernelCacheStatistic statistic = cache.GetStatistic();
+    EXPECT_EQ(statistic.capacity, 16U);
+    EXPECT_EQ(statistic.addCount, static_cast<uint64_t>(SHAPE_NUM));
+    EXPECT_GE(statistic.replaceCount, static_cast<uint64_t>(SHAPE_NUM) - statistic.capacity);
+
+    SharedKernelCache disabledCache(0);
+    EXPECT_FALSE(disabledCache.IsEnable());
+    disabledCache.AddTiling(0, 0, &tiling, sizeof(tiling), MakeLaunchParam(1), nullptr);
+    EXPECT_EQ(disabledCache.GetTiling(0, 0, MakeLaunchParam(1)), nullptr);
+}
+
+TEST(TestSharedKernelCache, ConcurrentReadWrite)
+{
+    /*
+        测试场景：多个线程并发查询并在未命中时写入，shape数多于缓存容量以触发替换
+        结果：命中的tiling内容始终与shape对应，查询次数等于命中与未命中之和
+    */
+    SharedKernelCache cache(64);
+    std::vector<std::thread> threads;
+    for (size_t threadId = 0; threadId < THREAD_NUM; ++threadId) {
+        threads.emplace_back([&cache]() {
+            for (int i = 0; i < LOOP_NUM; ++i) {
+                Mki::LaunchParam launchParam = MakeLaunchParam(i % SHAPE_NUM);
+                uint8_t tiling = static_cast<uint8_t>(i % SHAPE_NUM);
+                SharedKernelCache::EntryPtr entry = cache.GetTiling(0, 0, launchParam);
+                if (entry == nullptr) {
+                    cache.AddTiling(0, 0, &tiling, sizeof(tiling), launchParam, nullptr);
+                } else {
+                    EXPECT_EQ(entry->tilingBuffer.at(0), tiling);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    SharedKernelCacheStatistic statistic = cache.GetStatistic();
+    EXPECT_EQ(statistic.hitCount + statistic.missCount, static_cast<uint64_t>(THREAD_NUM) * LOOP_NUM);
+    EXPECT_GT(statistic.hitCount, 0U);
+}
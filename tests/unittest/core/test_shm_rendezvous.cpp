@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include "atb/utils/shm_rendezvous.h"
+
+using namespace atb;
+
+namespace {
+constexpr uint64_t TEST_TIMEOUT_MS = 60000;
+constexpr int ROUND_NUM = 3;
+constexpr int ROOT_DELAY_MS = 20; // 模拟root调用HcclGetRootInfo的耗时
+constexpr int EXIT_PAYLOAD_ERROR = 2;
+constexpr int EXIT_TIMEOUT = 3;
+
+struct TestPayload {
+    uint64_t round = 0;
+    char info[120] = {0};
+};
+
+// 子进程：多轮执行root发布payload + barrier，校验每轮拿到的都是本轮payload
+int RunRank(void *shm, int32_t rank, int32_t rankSize)
+{
+    for (int round = 0; round < ROUND_NUM; ++round) {
+        ShmRendezvous rendezvous(shm, rank, rankSize, sizeof(TestPayload));
+        TestPayload payload;
+        if (rank == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(ROOT_DELAY_MS));
+            payload.round = static_cast<uint64_t>(round);
+            (void)snprintf(payload.info, sizeof(payload.info), "root info of round %d", round);
+            rendezvous.Publish(&payload);
+        } else if (!rendezvous.WaitPublished(&payload, TEST_TIMEOUT_MS)) {
+            return EXIT_TIMEOUT;
+        }
+        if (payload.round != static_cast<uint64_t>(round)) {
+            return EXIT_PAYLOAD_ERROR;
+        }
+        if (!rendezvous.Barrier(TEST_TIMEOUT_MS)) {
+            return EXIT_TIMEOUT;
+        }
+    }
+    return 0;
+}
+
+double TimevalToSeconds(const struct timeval &tv)
+{
+    return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1e6;
+}
+} // namespace
+
+TEST(TestShmRendezvous, SingleProcess)
+{
+    std::vector<uint8_t> shm(ShmRendezvous::GetShmSize(1, sizeof(TestPayload)), 0);
+    for (uint32_t round = 0; round < ROUND_NUM; ++round) {
+        ShmRendezvous rendezvous(shm.data(), 0, 1, sizeof(TestPayload));
+        EXPECT_EQ(rendezvous.GetGeneration(), round);
+        TestPayload payload;
+        payload.round = round;
+        rendezvous.Publish(&payload);
+        TestPayload result;
+        EXPECT_TRUE(rendezvous.WaitPublished(&result, TEST_TIMEOUT_MS));
+        EXPECT_EQ(result.round, round);
+        EXPECT_TRUE(rendezvous.Barrier(TEST_TIMEOUT_MS));
+        EXPECT_EQ(rendezvous.GetGeneration(), round + 1);
+        EXPECT_EQ(rendezvous.GetArrivalTimes().size(), 1U);
+    }
+}
+
+TEST(TestShmRendezvous, BarrierTimeout)
+{
+    /*
+        测试场景：2个rank中只有1个到达barrier、root未发布payload
+        结果：等待超时返回false
+    */
+    std::vector<uint8_t> shm(ShmRendezvous::GetShmSize(2, sizeof(TestPayload)), 0);
+    ShmRendezvous rendezvous(shm.data(), 1, 2, sizeof(TestPayload));
+    TestPayload payload;
+    EXPECT_FALSE(rendezvous.WaitPublished(&payload, 10));
+    EXPECT_FALSE(rendezvous.Barrier(10));
+}
+
+TEST(TestShmRendezvous, StaleSegmentFromCrashedBootstrap)
+{
+    /*
+        测试场景：上一次建链的root发布payload后崩溃，另一rank已到达barrier，共享内存残留发布标记与到达计数；
+                 新一次建链在同一共享内存上由root延迟发布payload
+        结果：非root rank不采用残留的payload，拿到本次payload；残留的到达计数不会让barrier提前放行
+    */
+    const int32_t rankSize = 2;
+    size_t shmSize = ShmRendezvous::GetShmSize(rankSize, sizeof(TestPayload));
+    void *shm = mmap(nullptr, shmSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(shm, MAP_FAILED);
+    const uint64_t staleRound = 99;
+    pid_t crashedPid = fork();
+    ASSERT_GE(crashedPid, 0);
+    if (crashedPid == 0) {
+        ShmRendezvous crashed(shm, 0, rankSize, sizeof(TestPayload));
+        TestPayload payload;
+        payload.round = staleRound;
+        crashed.Publish(&payload);
+        _exit(0);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(crashedPid, &status, 0), crashedPid);
+    static_cast<ShmRendezvousHeader *>(shm)->arrivedNum.store(1);
+
+    pid_t rankPid = fork();
+    ASSERT_GE(rankPid, 0);
+    if (rankPid == 0) {
+        ShmRendezvous rendezvous(shm, 1, rankSize, sizeof(TestPayload));
+        TestPayload payload;
+        if (!rendezvous.WaitPublished(&payload, TEST_TIMEOUT_MS) || !rendezvous.Barrier(TEST_TIMEOUT_MS)) {
+            _exit(EXIT_TIMEOUT);
+        }
+        _exit(payload.round == 0 ? 0 : EXIT_PAYLOAD_ERROR);
+    }
+    ShmRendezvous root(shm, 0, rankSize, sizeof(TestPayload));
+    std::this_thread::sleep_for(std::chrono::milliseconds(ROOT_DELAY_MS));
+    TestPayload payload;
+    root.Publish(&payload);
+    EXPECT_TRUE(root.Barrier(TEST_TIMEOUT_MS));
+    ASSERT_EQ(waitpid(rankPid, &status, 0), rankPid);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+    std::vector<uint64_t> arrivalTimes = root.GetArrivalTimes();
+    // 残留计数若未清零，root会误认为自己是最后到达者而不等待rank1
+    EXPECT_NE(arrivalTimes.at(1), 0U);
+    munmap(shm, shmSize);
+}
+
+TEST(TestShmRendezvous, MultiProcess)
+{
+    /*
+        测试场景：2~64个进程通过共享内存多轮建链，root延迟发布payload
+        结果：所有进程拿到本轮payload并通过barrier；输出各规模下的建链时延与子进程CPU时间
+    */
+    std::cout << std::left << std::setw(10) << "procNum" << std::setw(16) << "latency(ms)" << std::setw(18)
+              << "cpu total(ms)" << "cpu per proc(ms)" << std::endl;
+    for (int32_t procNum : {2, 4, 8, 16, 32, 64}) {
+        size_t shmSize = ShmRendezvous::GetShmSize(procNum, sizeof(TestPayload));
+        void *shm = mmap(nullptr, shmSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        ASSERT_NE(shm, MAP_FAILED);
+
+        struct rusage usageBefore = {};
+        ASSERT_EQ(getrusage(RUSAGE_CHILDREN, &usageBefore), 0);
+        auto start = std::chrono::steady_clock::now();
+        std::vector<pid_t> pids;
+        for (int32_t rank = 0; rank < procNum; ++rank) {
+            pid_t pid = fork();
+            ASSERT_GE(pid, 0);
+            if (pid == 0) {
+                _exit(RunRank(shm, rank, procNum));
+            }
+            pids.push_back(pid);
+        }
+        for (pid_t pid : pids) {
+            int status = 0;
+            ASSERT_EQ(waitpid(pid, &status, 0), pid);
+            EXPECT_TRUE(WIFEXITED(status)) << "procNum:" << procNum;
+            EXPECT_EQ(WEXITSTATUS(status), 0) << "procNum:" << procNum;
+        }
+        double latencyMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        struct rusage usageAfter = {};
+        ASSERT_EQ(getrusage(RUSAGE_CHILDREN, &usageAfter), 0);
+        double cpuMs = (TimevalToSeconds(usageAfter.ru_utime) + TimevalToSeconds(usageAfter.ru_stime) -
+                        TimevalToSeconds(usageBefore.ru_utime) - TimevalToSeconds(usageBefore.ru_stime)) * 1e3;
+
+        ShmRendezvous observer(shm, 0, procNum, sizeof(TestPayload));
+        EXPECT_EQ(observer.GetGeneration(), static_cast<uint32_t>(ROUND_NUM));
+        std::cout << std::left << std::setw(10) << procNum << std::setw(16) << std::fixed << std::setprecision(3)
+                  << latencyMs / ROUND_NUM << std::setw(18) << cpuMs << cpuMs / procNum << std::endl;
+        munmap(shm, shmSize);
+    }
+}
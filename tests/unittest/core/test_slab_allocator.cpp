@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <map>
+#include <random>
+#include <set>
+#include <gtest/gtest.h>
+#include "atb/context/allocator/slab_allocator.h"
+#include "test_utils/counting_allocator.h"
+
+using namespace atb;
+
+namespace {
+constexpr size_t TEST_CHUNK_SIZE = 1024 * 1024;
+} // namespace
+
+TEST(TestSlabAllocator, SizeClass)
+{
+    EXPECT_EQ(SlabAllocator::GetSizeClassIndex(1), 0U);
+    EXPECT_EQ(SlabAllocator::GetSizeClassIndex(64), 0U);
+    EXPECT_EQ(SlabAllocator::GetSizeClassIndex(65), 1U);
+    EXPECT_EQ(SlabAllocator::GetSizeClassIndex(128), 1U);
+    EXPECT_EQ(SlabAllocator::GetSizeClassIndex(1022), 4U);
+    EXPECT_EQ(SlabAllocator::GetSizeClassSize(4), 1024U);
+    EXPECT_EQ(SlabAllocator::GetSizeClassIndex(65536), 10U);
+    EXPECT_EQ(SlabAllocator::GetSizeClassIndex(65537), 11U);
+}
+
+TEST(TestSlabAllocator, ReuseAndLargeAllocate)
+{
+    /*
+        测试场景：同size class的释放后复用，超过最大size class的申请直接走底层Allocator
+        结果：小块申请只触发一次chunk申请，释放后复用同一地址；析构时底层内存全部归还
+    */
+    size_t allocNum = 0;
+    size_t freeNum = 0;
+    {
+        SlabAllocator allocator(std::make_unique<CountingAllocator>(allocNum, freeNum), TEST_CHUNK_SIZE);
+        void *first = allocator.Allocate(1022);
+        void *second = allocator.Allocate(1000);
+        ASSERT_NE(first, nullptr);
+        ASSERT_NE(second, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(first) % 64, reinterpret_cast<uintptr_t>(second) % 64);
+        EXPECT_EQ(allocNum, 1U);
+        EXPECT_EQ(allocator.Deallocate(first), NO_ERROR);
+        EXPECT_EQ(allocator.Allocate(900), first);
+        EXPECT_EQ(allocator.GetStatistic().reuseNum, 1U);
+
+        void *large = allocator.Allocate(TEST_CHUNK_SIZE * 2);
+        ASSERT_NE(large, nullptr);
+        EXPECT_EQ(allocNum, 2U);
+        EXPECT_EQ(allocator.GetStatistic().largeAllocNum, 1U);
+        EXPECT_EQ(allocator.Deallocate(large), NO_ERROR);
+        EXPECT_EQ(freeNum, 1U);
+
+        const SlabAllocatorStatistic &statistic = allocator.GetStatistic();
+        EXPECT_EQ(statistic.chunkNum, 1U);
+        EXPECT_EQ(statistic.chunkSize, TEST_CHUNK_SIZE);
+        EXPECT_EQ(statistic.liveNum, 2U);
+        EXPECT_EQ(statistic.usedSize, 2048U);
+        EXPECT_EQ(statistic.requestSize, 1900U);
+        EXPECT_EQ(statistic.peakUsedSize, 2048U + TEST_CHUNK_SIZE * 2);
+    }
+    EXPECT_EQ(allocNum, freeNum);
+}
+
+TEST(TestSlabAllocator, DeallocateError)
+{
+    /*
+        测试场景：释放非SlabAllocator分配的地址以及重复释放
+        结果：释放失败，nullptr释放成功
+    */
+    size_t allocNum = 0;
+    size_t freeNum = 0;
+    SlabAllocator allocator(std::make_unique<CountingAllocator>(allocNum, freeNum), TEST_CHUNK_SIZE);
+    int value = 0;
+    EXPECT_NE(allocator.Deallocate(&value), NO_ERROR);
+    EXPECT_EQ(allocator.Deallocate(nullptr), NO_ERROR);
+    EXPECT_EQ(allocator.Allocate(0), nullptr);
+    void *addr = allocator.Allocate(100);
+    ASSERT_NE(addr, nullptr);
+    EXPECT_EQ(allocator.Deallocate(addr), NO_ERROR);
+    EXPECT_NE(allocator.Deallocate(addr), NO_ERROR);
+    EXPECT_EQ(allocator.GetStatistic().liveNum, 0U);
+}
+
+TEST(TestSlabAllocator, RandomAllocateNoOverlap)
+{
+    /*
+        测试场景：随机大小随机顺序申请释放，跨越多个chunk
+        结果：存活的内存块两两不重叠，统计的usedSize与存活块一致
+    */
+    size_t allocNum = 0;
+    size_t freeNum = 0;
+    SlabAllocator allocator(std::make_unique<CountingAllocator>(allocNum, freeNum), TEST_CHUNK_SIZE);
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<size_t> sizeDist(1, 70000);
+    std::map<uintptr_t, size_t> liveBlocks;
+    const int loopNum = 20000;
+    for (int i = 0; i < loopNum; ++i) {
+        if (!liveBlocks.empty() && gen() % 3 == 0) {
+            auto it = liveBlocks.begin();
+            std::advance(it, gen() % liveBlocks.size());
+            ASSERT_EQ(allocator.Deallocate(reinterpret_cast<void *>(it->first)), NO_ERROR);
+            liveBlocks.erase(it);
+            continue;
+        }
+        size_t size = sizeDist(gen);
+        void *addr = allocator.Allocate(size);
+        ASSERT_NE(addr, nullptr);
+        uintptr_t begin = reinterpret_cast<uintptr_t>(addr);
+        auto next = liveBlocks.lower_bound(begin);
+        if (next != liveBlocks.end()) {
+            ASSERT_LE(begin + size, next->first);
+        }
+        if (next != liveBlocks.begin()) {
+            auto prev = std::prev(next);
+            ASSERT_LE(prev->first + prev->second, begin);
+        }
+        liveBlocks.emplace(begin, size);
+    }
+    uint64_t usedSize = 0;
+    for (auto &it : liveBlocks) {
+        size_t classIndex = SlabAllocator::GetSizeClassIndex(it.second);
+        usedSize += classIndex > 10 ? it.second : SlabAllocator::GetSizeClassSize(classIndex);
+    }
+    EXPECT_EQ(allocator.GetStatistic().liveNum, liveBlocks.size());
+    EXPECT_EQ(allocator.GetStatistic().usedSize, usedSize);
+}
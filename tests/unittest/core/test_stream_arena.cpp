@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <gtest/gtest.h>
+#include "atb/context/context_base.h"
+#include "atb/context/stream_arena.h"
+#include "atb/utils/config.h"
+#include "atb/utils/singleton.h"
+#include "test_utils/counting_allocator.h"
+
+using namespace atb;
+
+TEST(TestStreamArena, ReuseAndGrow)
+{
+    /*
+        测试场景：同一执行流上依次申请1KB、512B、4KB、2KB的workspace
+        结果：不超过当前region大小的申请复用同一地址；更大的申请扩容一次，旧region同步后立即释放
+    */
+    size_t allocNum = 0;
+    size_t freeNum = 0;
+    {
+        StreamArena arena(std::make_unique<CountingAllocator>(allocNum, freeNum));
+        EXPECT_EQ(arena.GetBuffer(nullptr, 0, true), nullptr);
+        uint8_t *first = arena.GetBuffer(nullptr, 1024, true);
+        ASSERT_NE(first, nullptr);
+        EXPECT_EQ(arena.GetBuffer(nullptr, 512, true), first);
+        EXPECT_EQ(allocNum, 1U);
+
+        uint8_t *grown = arena.GetBuffer(nullptr, 4096, true);
+        ASSERT_NE(grown, nullptr);
+        EXPECT_EQ(arena.GetBuffer(nullptr, 2048, true), grown);
+        EXPECT_EQ(allocNum, 2U);
+        EXPECT_EQ(freeNum, 1U);
+
+        const StreamArenaStatistic &statistic = arena.GetStatistic();
+        EXPECT_EQ(statistic.streamNum, 1U);
+        EXPECT_EQ(statistic.requestNum, 4U);
+        EXPECT_EQ(statistic.growNum, 1U);
+        EXPECT_EQ(statistic.arenaSize, 4096U);
+        EXPECT_EQ(statistic.retiredSize, 0U);
+        EXPECT_EQ(statistic.peakRequestSize, 4096U);
+        EXPECT_EQ(statistic.totalRequestSize, 1024U + 512U + 4096U + 2048U);
+    }
+    EXPECT_EQ(freeNum, allocNum);
+}
+
+TEST(TestStreamArena, RetireWithoutSync)
+{
+    /*
+        测试场景：分线程下发时扩容，旧region可能已被第一段下发的任务引用
+        结果：旧region挂到待释放列表，Release时统一释放
+    */
+    size_t allocNum = 0;
+    size_t freeNum = 0;
+    StreamArena arena(std::make_unique<CountingAllocator>(allocNum, freeNum));
+    ASSERT_NE(arena.GetBuffer(nullptr, 1024, false), nullptr);
+    ASSERT_NE(arena.GetBuffer(nullptr, 2048, false), nullptr);
+    ASSERT_NE(arena.GetBuffer(nullptr, 8192, false), nullptr);
+    EXPECT_EQ(allocNum, 3U);
+    EXPECT_EQ(freeNum, 0U);
+    EXPECT_EQ(arena.GetStatistic().arenaSize, 8192U);
+    EXPECT_EQ(arena.GetStatistic().retiredSize, 1024U + 2048U);
+
+    arena.Release();
+    EXPECT_EQ(freeNum, 3U);
+    EXPECT_EQ(arena.GetStatistic().streamNum, 0U);
+    EXPECT_EQ(arena.GetStatistic().arenaSize, 0U);
+    EXPECT_EQ(arena.GetStatistic().retiredSize, 0U);
+}
+
+TEST(TestStreamArena, ContextPerStreamRegion)
+{
+    /*
+        测试场景：Context开启执行流共享workspace后，在两条执行流上申请workspace
+        结果：每条流各自持有一块region；关闭后不再分配
+    */
+    if (!GetSingleton<Config>().Is910B()) {
+        return;
+    }
+    aclrtSetDevice(0);
+    aclrtStream streams[2] = {nullptr, nullptr};
+    ASSERT_EQ(aclrtCreateStream(&streams[0]), 0);
+    ASSERT_EQ(aclrtCreateStream(&streams[1]), 0);
+    ContextBase context;
+    ASSERT_EQ(context.Init(), NO_ERROR);
+    EXPECT_FALSE(context.GetStreamArenaStatus());
+    EXPECT_EQ(context.GetStreamArenaBuffer(streams[0], 1024), nullptr);
+
+    ASSERT_EQ(context.SetStreamArenaStatus(true), NO_ERROR);
+    EXPECT_TRUE(context.GetStreamArenaStatus());
+    uint8_t *buffer0 = context.GetStreamArenaBuffer(streams[0], 1024);
+    uint8_t *buffer1 = context.GetStreamArenaBuffer(streams[1], 1024);
+    ASSERT_NE(buffer0, nullptr);
+    ASSERT_NE(buffer1, nullptr);
+    EXPECT_NE(buffer0, buffer1);
+    EXPECT_EQ(context.GetStreamArenaBuffer(streams[0], 512), buffer0);
+    ASSERT_NE(context.GetStreamArenaStatistic(), nullptr);
+    EXPECT_EQ(context.GetStreamArenaStatistic()->streamNum, 2U);
+
+    ASSERT_EQ(context.SetStreamArenaStatus(false), NO_ERROR);
+    EXPECT_EQ(context.GetStreamArenaStatistic(), nullptr);
+    context.Destroy();
+    aclrtDestroyStream(streams[0]);
+    aclrtDestroyStream(streams[1]);
+}
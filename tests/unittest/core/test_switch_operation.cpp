@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <vector>
+#include <gtest/gtest.h>
+#include <torch/torch.h>
+#include <acl/acl.h>
+#include <atb/utils/log.h>
+#include <atb/utils.h>
+#include "test_utils/test_common.h"
+#include "atb/operation.h"
+#include "atb/utils/tensor_util.h"
+#include "test_utils/operation_test.h"
+#include "atb/operation/switch_operation.h"
+#include "atb/utils/config.h"
+#include "atb/utils/singleton.h"
+
+using namespace atb;
+using namespace Mki;
+
+static int32_t SelectFunction(void *userData)
+{
+    if (userData != nullptr) {
+        return *static_cast<int32_t *>(userData);
+    }
+    return -1;
+}
+
+namespace {
+constexpr uint16_t FP16_TWO = 0x4000;
+constexpr uint16_t FP16_THREE = 0x4200;
+constexpr uint16_t FP16_FIVE = 0x4500;
+constexpr uint16_t FP16_SIX = 0x4600;
+constexpr uint16_t FP16_MINUS_ONE = 0xBC00;
+constexpr uint64_t SMALL_WORKSPACE_SIZE = 100;
+constexpr uint64_t LARGE_WORKSPACE_SIZE = 300;
+
+// 返回固定workspace大小并记录调用情况的分支，不依赖device校验分支选择
+class CountingBranch : public atb::Operation {
+public:
+    explicit CountingBranch(uint64_t workspaceSize) : workspaceSize_(workspaceSize) {}
+    std::string GetName() const override
+    {
+        return "CountingBranch";
+    }
+    atb::Status InferShape(const atb::SVector<atb::TensorDesc> &inTensorDescs,
+                           atb::SVector<atb::TensorDesc> &outTensorDescs) const override
+    {
+        outTensorDescs.resize(1);
+        outTensorDescs.at(0) = inTensorDescs.at(0);
+        return atb::NO_ERROR;
+    }
+    uint32_t GetInputNum() const override
+    {
+        return 2; // 2: x, y
+    }
+    uint32_t GetOutputNum() const override
+    {
+        return 1;
+    }
+    atb::Status Setup(const atb::VariantPack &variantPack, uint64_t &workspaceSize, atb::Context *context) override
+    {
+        (void)context;
+        ++setupCount;
+        setupInTensorNum = variantPack.inTensors.size();
+        workspaceSize = workspaceSize_;
+        return atb::NO_ERROR;
+    }
+    atb::Status Execute(const atb::VariantPack &variantPack, uint8_t *workspace, uint64_t workspaceSize,
+                        atb::Context *context) override
+    {
+        (void)variantPack;
+        (void)workspace;
+        (void)context;
+        ++executeCount;
+        executeWorkspaceSize = workspaceSize;
+        return atb::NO_ERROR;
+    }
+
+    uint32_t setupCount = 0;
+    uint32_t executeCount = 0;
+    size_t setupInTensorNum = 0;
+    uint64_t executeWorkspaceSize = 0;
+
+private:
+    uint64_t workspaceSize_ = 0;
+};
+
+atb::TensorDesc CreateFp16Desc()
+{
+    atb::TensorDesc desc;
+    desc.dtype = ACL_FLOAT16;
+    desc.format = ACL_FORMAT_ND;
+    desc.shape.dimNum = 2; // 2: [2, 2]
+    desc.shape.dims[0] = 2;
+    desc.shape.dims[1] = 2;
+    return desc;
+}
+
+// selector非空时作为最后一个输入传入，对应selectByTensor
+atb::VariantPack CreateHostVariantPack(int32_t *selector)
+{
+    atb::VariantPack variantPack;
+    variantPack.inTensors.resize(2); // 2: x, y
+    variantPack.outTensors.resize(1);
+    for (atb::Tensor &tensor : variantPack.inTensors) {
+        tensor.desc = CreateFp16Desc();
+        tensor.dataSize = atb::Utils::GetTensorSize(tensor.desc);
+    }
+    variantPack.outTensors.at(0).desc = CreateFp16Desc();
+    variantPack.outTensors.at(0).dataSize = atb::Utils::GetTensorSize(variantPack.outTensors.at(0).desc);
+    if (selector != nullptr) {
+        atb::Tensor selectorTensor;
+        selectorTensor.desc.dtype = ACL_INT32;
+        selectorTensor.desc.format = ACL_FORMAT_ND;
+        selectorTensor.desc.shape.dimNum = 1;
+        selectorTensor.desc.shape.dims[0] = 1;
+        selectorTensor.hostData = selector;
+        selectorTensor.dataSize = sizeof(int32_t);
+        variantPack.inTensors.push_back(selectorTensor);
+    }
+    return variantPack;
+}
+
+// 以x=2、y=3在device上执行一次，读回输出
+void RunSwitchOnDevice(atb::Operation *switchOperation, atb::Context *context, int32_t *selector,
+                       std::vector<uint16_t> &output)
+{
+    atb::VariantPack variantPack = CreateHostVariantPack(selector);
+    const std::vector<uint16_t> inValues = {FP16_TWO, FP16_THREE};
+    for (size_t i = 0; i < inValues.size(); ++i) {
+        atb::Tensor &tensor = variantPack.inTensors.at(i);
+        std::vector<uint16_t> hostData(atb::Utils::GetTensorNumel(tensor), inValues.at(i));
+        ASSERT_EQ(aclrtMalloc(&tensor.deviceData, tensor.dataSize, ACL_MEM_MALLOC_HUGE_FIRST), 0);
+        ASSERT_EQ(aclrtMemcpy(tensor.deviceData, tensor.dataSize, hostData.data(), tensor.dataSize,
+                              ACL_MEMCPY_HOST_TO_DEVICE), 0);
+    }
+    atb::Tensor &outTensor = variantPack.outTensors.at(0);
+    ASSERT_EQ(aclrtMalloc(&outTensor.deviceData, outTensor.dataSize, ACL_MEM_MALLOC_HUGE_FIRST), 0);
+
+    uint64_t workspaceSize = 0;
+    ASSERT_EQ(switchOperation->Setup(variantPack, workspaceSize, context), NO_ERROR);
+    void *workspace = nullptr;
+    if (workspaceSize > 0) {
+        ASSERT_EQ(aclrtMalloc(&workspace, workspaceSize, ACL_MEM_MALLOC_HUGE_FIRST), 0);
+    }
+    ASSERT_EQ(switchOperation->Execute(variantPack, static_cast<uint8_t *>(workspace), workspaceSize, context),
+              NO_ERROR);
+    ASSERT_EQ(aclrtSynchronizeStream(context->GetExecuteStream()), 0);
+    output.resize(atb::Utils::GetTensorNumel(outTensor));
+    ASSERT_EQ(aclrtMemcpy(output.data(), outTensor.dataSize, outTensor.deviceData, outTensor.dataSize,
+                          ACL_MEMCPY_DEVICE_TO_HOST), 0);
+    for (size_t i = 0; i < inValues.size(); ++i) {
+        aclrtFree(variantPack.inTensors.at(i).deviceData);
+    }
+    aclrtFree(outTensor.deviceData);
+    if (workspace != nullptr) {
+        aclrtFree(workspace);
+    }
+}
+
+void CreateElewiseBranches(const std::vector<atb::infer::ElewiseParam::ElewiseType> &elewiseTypes,
+                           atb::common::SwitchParam &param)
+{
+    for (size_t i = 0; i < elewiseTypes.size(); ++i) {
+        atb::infer::ElewiseParam elewiseParam;
+        elewiseParam.elewiseType = elewiseTypes.at(i);
+        atb::Operation *branch = nullptr;
+        ASSERT_EQ(CreateOperation(elewiseParam, &branch), NO_ERROR);
+        param.branches.push_back(branch);
+    }
+}
+} // namespace
+
+// 测试场景：分支为空、分支Operation为空、未设置回调且不使用tensor选择
+// 测试结果：创建失败，返回ERROR_INVALID_PARAM
+TEST(TestSwitchOperation, InvalidParam)
+{
+    atb::Operation *switchOperation = nullptr;
+    atb::common::SwitchParam param;
+    param.handle = SelectFunction;
+    EXPECT_EQ(CreateOperation(param, &switchOperation), ERROR_INVALID_PARAM);
+
+    param.branches = {nullptr};
+    EXPECT_EQ(CreateOperation(param, &switchOperation), ERROR_INVALID_PARAM);
+
+    atb::infer::ElewiseParam addParam;
+    addParam.elewiseType = atb::infer::ElewiseParam::ElewiseType::ELEWISE_ADD;
+    atb::Operation *addOperation = nullptr;
+    ASSERT_EQ(CreateOperation(addParam, &addOperation), NO_ERROR);
+    param.branches = {addOperation};
+    param.handle = nullptr;
+    EXPECT_EQ(CreateOperation(param, &switchOperation), ERROR_INVALID_PARAM);
+    EXPECT_EQ(switchOperation, nullptr);
+    atb::DestroyOperation(addOperation);
+}
+
+// 测试场景：使用最后一个输入tensor作为选择子
+// 测试结果：输入个数比分支多1，InferShape时去掉选择子后由分支推导
+TEST(TestSwitchOperation, SelectByTensorInferShape)
+{
+    atb::infer::ElewiseParam addParam;
+    addParam.elewiseType = atb::infer::ElewiseParam::ElewiseType::ELEWISE_ADD;
+    atb::Operation *addOperation = nullptr;
+    ASSERT_EQ(CreateOperation(addParam, &addOperation), NO_ERROR);
+    atb::infer::ElewiseParam mulParam;
+    mulParam.elewiseType = atb::infer::ElewiseParam::ElewiseType::ELEWISE_MUL;
+    atb::Operation *mulOperation = nullptr;
+    ASSERT_EQ(CreateOperation(mulParam, &mulOperation), NO_ERROR);
+
+    atb::common::SwitchParam param;
+    param.selectByTensor = true;
+    param.branches = {addOperation, mulOperation};
+    atb::Operation *switchOperation = nullptr;
+    ASSERT_EQ(CreateOperation(param, &switchOperation), NO_ERROR);
+    EXPECT_EQ(switchOperation->GetInputNum(), addOperation->GetInputNum() + 1);
+    EXPECT_EQ(switchOperation->GetOutputNum(), addOperation->GetOutputNum());
+
+    Mki::SVector<Mki::TensorDesc> opsInTensorDescs = {{Mki::TENSOR_DTYPE_FLOAT16, Mki::TENSOR_FORMAT_ND, {2, 3}},
+                                                      {Mki::TENSOR_DTYPE_FLOAT16, Mki::TENSOR_FORMAT_ND, {2, 3}},
+                                                      {Mki::TENSOR_DTYPE_INT32, Mki::TENSOR_FORMAT_ND, {1}}};
+    atb::SVector<atb::TensorDesc> inTensorDescs;
+    atb::SVector<atb::TensorDesc> outTensorDescs;
+    TensorUtil::OpsTensorDescs2AtbTensorDescs(opsInTensorDescs, inTensorDescs);
+    ASSERT_EQ(switchOperation->InferShape(inTensorDescs, outTensorDescs), NO_ERROR);
+    ASSERT_EQ(outTensorDescs.size(), 1);
+    EXPECT_EQ(outTensorDescs.at(0).shape.dims[1], 3);
+
+    atb::DestroyOperation(switchOperation);
+    atb::DestroyOperation(addOperation);
+    atb::DestroyOperation(mulOperation);
+}
+
+// 测试场景：使用选择子tensor选择分支，依次选择不同分支后Setup、Execute，再传入越界或没有hostData的选择子
+// 测试结果：只有被选中的分支执行，分支收到的输入不含选择子；越界或没有hostData时Setup返回ERROR_INVALID_PARAM
+TEST(TestSwitchOperation, SelectByTensorSetupExecute)
+{
+    CountingBranch smallBranch(SMALL_WORKSPACE_SIZE);
+    CountingBranch largeBranch(LARGE_WORKSPACE_SIZE);
+    atb::common::SwitchParam param;
+    param.selectByTensor = true;
+    param.branches = {&smallBranch, &largeBranch};
+    atb::Operation *switchOperation = nullptr;
+    ASSERT_EQ(CreateOperation(param, &switchOperation), NO_ERROR);
+
+    int32_t selector = 1;
+    atb::VariantPack variantPack = CreateHostVariantPack(&selector);
+    uint64_t workspaceSize = 0;
+    ASSERT_EQ(switchOperation->Setup(variantPack, workspaceSize, nullptr), NO_ERROR);
+    EXPECT_EQ(workspaceSize, LARGE_WORKSPACE_SIZE);
+    EXPECT_EQ(largeBranch.setupInTensorNum, 2U);
+    ASSERT_EQ(switchOperation->Execute(variantPack, nullptr, workspaceSize, nullptr), NO_ERROR);
+    EXPECT_EQ(largeBranch.executeCount, 1U);
+    EXPECT_EQ(smallBranch.setupCount, 0U);
+    EXPECT_EQ(smallBranch.executeCount, 0U);
+
+    selector = 0;
+    ASSERT_EQ(switchOperation->Setup(variantPack, workspaceSize, nullptr), NO_ERROR);
+    ASSERT_EQ(switchOperation->Execute(variantPack, nullptr, workspaceSize, nullptr), NO_ERROR);
+    EXPECT_EQ(smallBranch.executeCount, 1U);
+    EXPECT_EQ(largeBranch.executeCount, 1U);
+
+    for (int32_t invalidSelector : {-1, 2}) {
+        selector = invalidSelector;
+        EXPECT_EQ(switchOperation->Setup(variantPack, workspaceSize, nullptr), ERROR_INVALID_PARAM);
+    }
+    variantPack.inTensors.at(2).hostData = nullptr;
+    EXPECT_EQ(switchOperation->Setup(variantPack, workspaceSize, nullptr), ERROR_INVALID_PARAM);
+    EXPECT_EQ(smallBranch.setupCount + largeBranch.setupCount, 2U);
+    atb::DestroyOperation(switchOperation);
+}
+
+// 测试场景：两个分支所需workspace不同，先选择小分支再切换到大分支，之后切回小分支
+// 测试结果：返回值为已Setup过的分支所需大小的最大值，切换到大分支时变大，切回后保持不变
+TEST(TestSwitchOperation, WorkspaceSizeIsMaxOfSetupBranches)
+{
+    CountingBranch smallBranch(SMALL_WORKSPACE_SIZE);
+    CountingBranch largeBranch(LARGE_WORKSPACE_SIZE);
+    int32_t index = 0;
+    atb::common::SwitchParam param;
+    param.handle = SelectFunction;
+    param.userData = &index;
+    param.branches = {&smallBranch, &largeBranch};
+    atb::Operation *switchOperation = nullptr;
+    ASSERT_EQ(CreateOperation(param, &switchOperation), NO_ERROR);
+
+    atb::VariantPack variantPack = CreateHostVariantPack(nullptr);
+    uint64_t workspaceSize = 0;
+    ASSERT_EQ(switchOperation->Setup(variantPack, workspaceSize, nullptr), NO_ERROR);
+    EXPECT_EQ(workspaceSize, SMALL_WORKSPACE_SIZE);
+    index = 1;
+    ASSERT_EQ(switchOperation->Setup(variantPack, workspaceSize, nullptr), NO_ERROR);
+    EXPECT_EQ(workspaceSize, LARGE_WORKSPACE_SIZE);
+    index = 0;
+    ASSERT_EQ(switchOperation->Setup(variantPack, workspaceSize, nullptr), NO_ERROR);
+    EXPECT_EQ(workspaceSize, LARGE_WORKSPACE_SIZE);
+    ASSERT_EQ(switchOperation->Execute(variantPack, nullptr, workspaceSize, nullptr), NO_ERROR);
+    EXPECT_EQ(smallBranch.executeWorkspaceSize, LARGE_WORKSPACE_SIZE);
+    atb::DestroyOperation(switchOperation);
+}
+
+// 测试场景：使用选择子tensor选择分支的Switch按描述信息预热，预热后再Setup第0个分支
+// 测试结果：预热不读取选择子，全部分支均被Setup，预热与之后Setup返回的workspaceSize均覆盖所有分支
+TEST(TestSwitchOperation, WarmupSelectByTensor)
+{
+    CountingBranch smallBranch(SMALL_WORKSPACE_SIZE);
+    CountingBranch largeBranch(LARGE_WORKSPACE_SIZE);
+    atb::common::SwitchParam param;
+    param.selectByTensor = true;
+    param.branches = {&smallBranch, &largeBranch};
+    atb::Operation *switchOperation = nullptr;
+    ASSERT_EQ(CreateOperation(param, &switchOperation), NO_ERROR);
+
+    int32_t selector = 0;
+    atb::VariantPack variantPack = CreateHostVariantPack(&selector);
+    atb::SVector<atb::TensorDesc> bucket;
+    for (const atb::Tensor &inTensor : variantPack.inTensors) {
+        bucket.push_back(inTensor.desc);
+    }
+    std::vector<atb::WarmupBucketResult> results;
+    ASSERT_EQ(atb::Warmup(switchOperation, {bucket}, nullptr, results), NO_ERROR);
+    ASSERT_EQ(results.size(), 1U);
+    EXPECT_EQ(results.at(0).workspaceSize, LARGE_WORKSPACE_SIZE);
+    EXPECT_EQ(smallBranch.setupCount, 1U);
+    EXPECT_EQ(largeBranch.setupCount, 1U);
+    EXPECT_EQ(smallBranch.setupInTensorNum, 2U);
+
+    uint64_t workspaceSize = 0;
+    ASSERT_EQ(switchOperation->Setup(variantPack, workspaceSize, nullptr), NO_ERROR);
+    EXPECT_EQ(workspaceSize, LARGE_WORKSPACE_SIZE);
+    EXPECT_EQ(largeBranch.setupCount, 1U);
+    atb::DestroyOperation(switchOperation);
+}
+
+// 测试场景：add、mul、sub三个分支，x=2、y=3，每次执行前通过回调切换分支
+// 测试结果：输出依次为各分支的计算结果5、6、-1
+TEST(TestSwitchOperation, SwitchBranchTest)
+{
+    if (!atb::GetSingleton<atb::Config>().Is910B()) {
+        GTEST_SKIP() << "This test case only support 910B";
+    }
+
+    atb::common::SwitchParam param;
+    CreateElewiseBranches({atb::infer::ElewiseParam::ElewiseType::ELEWISE_ADD,
+                           atb::infer::ElewiseParam::ElewiseType::ELEWISE_MUL,
+                           atb::infer::ElewiseParam::ElewiseType::ELEWISE_SUB},
+                          param);
+    ASSERT_EQ(param.branches.size(), 3U);
+    int32_t index = 0;
+    param.handle = SelectFunction;
+    param.userData = &index;
+    atb::Operation *switchOperation = nullptr;
+    ASSERT_EQ(CreateOperation(param, &switchOperation), NO_ERROR);
+
+    aclrtSetDevice(0);
+    aclrtStream exeStream = nullptr;
+    aclrtCreateStream(&exeStream);
+    atb::Context *context = nullptr;
+    ASSERT_EQ(atb::CreateContext(&context), NO_ERROR);
+    context->SetExecuteStream(exeStream);
+
+    const std::vector<uint16_t> expectValues = {FP16_FIVE, FP16_SIX, FP16_MINUS_ONE};
+    const int32_t loopNum = 6;
+    for (int32_t i = 0; i < loopNum; ++i) {
+        index = i % static_cast<int32_t>(param.branches.size());
+        std::vector<uint16_t> output;
+        RunSwitchOnDevice(switchOperation, context, nullptr, output);
+        EXPECT_EQ(output, std::vector<uint16_t>(output.size(), expectValues.at(index))) << "branch " << index;
+    }
+
+    atb::DestroyOperation(switchOperation);
+    for (atb::Operation *branch : param.branches) {
+        atb::DestroyOperation(branch);
+    }
+    atb::DestroyContext(context);
+    aclrtDestroyStream(exeStream);
+}
+
+// 测试场景：add、mul两个分支，x=2、y=3，通过选择子tensor交替选择分支
+// 测试结果：选择add时输出5，选择mul时输出6
+TEST(TestSwitchOperation, SwitchBranchByTensorTest)
+{
+    if (!atb::GetSingleton<atb::Config>().Is910B()) {
+        GTEST_SKIP() << "This test case only support 910B";
+    }
+
+    atb::common::SwitchParam param;
+    CreateElewiseBranches({atb::infer::ElewiseParam::ElewiseType::ELEWISE_ADD,
+                           atb::infer::ElewiseParam::ElewiseType::ELEWISE_MUL},
+                          param);
+    ASSERT_EQ(param.branches.size(), 2U);
+    param.selectByTensor = true;
+    atb::Operation *switchOperation = nullptr;
+    ASSERT_EQ(CreateOperation(param, &switchOperation), NO_ERROR);
+
+    aclrtSetDevice(0);
+    aclrtStream exeStream = nullptr;
+    aclrtCreateStream(&exeStream);
+    atb::Context *context = nullptr;
+    ASSERT_EQ(atb::CreateContext(&context), NO_ERROR);
+    context->SetExecuteStream(exeStream);
+
+    const std::vector<uint16_t> expectValues = {FP16_FIVE, FP16_SIX};
+    for (int32_t selector : {1, 0, 1}) {
+        std::vector<uint16_t> output;
+        RunSwitchOnDevice(switchOperation, context, &selector, output);
+        EXPECT_EQ(output, std::vector<uint16_t>(output.size(), expectValues.at(selector))) << "branch " << selector;
+    }
+
+    atb::DestroyOperation(switchOperation);
+    for (atb::Operation *branch : param.branches) {
+        atb::DestroyOperation(branch);
+    }
+    atb::DestroyContext(context);
+    aclrtDestroyStream(exeStream);
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024-2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <atomic>
+#include <vector>
+#include <gtest/gtest.h>
+#include "atb/utils/thread_pool.h"
+
+using namespace atb;
+
+TEST(TestThreadPool, ParallelForRunsEveryTaskOnce)
+{
+    ThreadPool threadPool(4);
+    EXPECT_EQ(threadPool.GetThreadNum(), 4U);
+    const size_t taskNum = 1000;
+    std::vector<uint32_t> hitCounts(taskNum, 0);
+    threadPool.ParallelFor(taskNum, [&hitCounts](size_t taskId) { hitCounts.at(taskId) += 1; });
+    for (size_t i = 0; i < taskNum; ++i) {
+        EXPECT_EQ(hitCounts.at(i), 1U);
+    }
+}
+
+TEST(TestThreadPool, ParallelForDeterministicOutput)
+{
+    ThreadPool threadPool(3);
+    const size_t taskNum = 256;
+    std::vector<uint64_t> first(taskNum, 0);
+    std::vector<uint64_t> second(taskNum, 0);
+    auto fill = [](std::vector<uint64_t> &buffer) {
+        return [&buffer](size_t taskId) { buffer.at(taskId) = taskId * taskId + 1; };
+    };
+    threadPool.ParallelFor(taskNum, fill(first));
+    threadPool.ParallelFor(taskNum, fill(second));
+    EXPECT_EQ(first, second);
+}
+
+TEST(TestThreadPool, ParallelForWithoutWorker)
+{
+    ThreadPool threadPool(0);
+    std::atomic<size_t> sum{0};
+    threadPool.ParallelFor(10, [&sum](size_t taskId) { sum += taskId; });
+    EXPECT_EQ(sum.load(), 45U);
+    threadPool.ParallelFor(0, [&sum](size_t taskId) { sum += taskId; });
+    EXPECT_EQ(sum.load(), 45U);
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <cstring>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include <acl/acl.h>
+#include "atb/context/tiling_buffer_pool/host_tiling_buffer_pool.h"
+#include "atb/utils/config.h"
+#include "atb/utils/singleton.h"
+
+using namespace atb;
+
+namespace {
+constexpr uint64_t TEST_BLOCK_NUM = 4;
+constexpr uint64_t TEST_BLOCK_SIZE = 64;
+
+// 模拟opNum个Operation依次Setup：每个Operation取一块内存并写入各不相同的tiling
+std::vector<std::pair<const uint8_t *, uint64_t>> SetupOperations(TilingBufferPool &pool, size_t opNum,
+                                                                  uint64_t tilingSize)
+{
+    std::vector<std::pair<const uint8_t *, uint64_t>> tilingBuffers;
+    for (size_t i = 0; i < opNum; ++i) {
+        uint8_t *buffer = pool.GetBuffer();
+        (void)memset(buffer, static_cast<int>(i + 1), tilingSize);
+        tilingBuffers.emplace_back(buffer, tilingSize);
+    }
+    return tilingBuffers;
+}
+
+// 记录每次分配前等待的块序号
+class WaitRecordingPool : public HostTilingBufferPool {
+public:
+    WaitRecordingPool() : HostTilingBufferPool(TEST_BLOCK_NUM, TEST_BLOCK_SIZE) {}
+    std::vector<uint64_t> waitedBlocks;
+
+protected:
+    void WaitBlockReusable(uint64_t blockIndex) override
+    {
+        waitedBlocks.push_back(blockIndex);
+    }
+};
+} // namespace
+
+// 测试场景：Operation个数小于内存池块数，汇总所需的连续内存需要从头分配
+// 测试结果：汇总成功，连续内存不与任一Operation的tiling重叠，内容与各Operation的tiling依次拼接一致
+TEST(TestTilingBufferPool, GatherTiling)
+{
+    HostTilingBufferPool pool(TEST_BLOCK_NUM, TEST_BLOCK_SIZE);
+    ASSERT_EQ(pool.Init(), NO_ERROR);
+    (void)pool.GetBuffer();
+    (void)pool.GetBuffer();
+    const uint64_t tilingSize = 40;
+    std::vector<std::pair<const uint8_t *, uint64_t>> tilingBuffers = SetupOperations(pool, 2, tilingSize);
+    uint8_t *gatherBuffer = nullptr;
+    ASSERT_EQ(pool.GatherContinuousBuffer(tilingBuffers, gatherBuffer), NO_ERROR);
+    ASSERT_NE(gatherBuffer, nullptr);
+    for (size_t i = 0; i < tilingBuffers.size(); ++i) {
+        EXPECT_EQ(memcmp(gatherBuffer + i * tilingSize, tilingBuffers.at(i).first, tilingSize), 0);
+        EXPECT_EQ(gatherBuffer[i * tilingSize], i + 1);
+    }
+    pool.Destroy();
+}
+
+// 测试场景：Operation个数等于内存池块数，汇总所需的连续内存只能覆盖第一个Operation的tiling
+// 测试结果：不分配连续内存，由调用方逐个下发，各Operation的tiling保持不变
+TEST(TestTilingBufferPool, GatherOverlapFallback)
+{
+    HostTilingBufferPool pool(TEST_BLOCK_NUM, TEST_BLOCK_SIZE);
+    ASSERT_EQ(pool.Init(), NO_ERROR);
+    const uint64_t tilingSize = 16;
+    std::vector<std::pair<const uint8_t *, uint64_t>> tilingBuffers =
+        SetupOperations(pool, TEST_BLOCK_NUM, tilingSize);
+    uint8_t *gatherBuffer = nullptr;
+    ASSERT_EQ(pool.GatherContinuousBuffer(tilingBuffers, gatherBuffer), NO_ERROR);
+    EXPECT_EQ(gatherBuffer, nullptr);
+    for (size_t i = 0; i < tilingBuffers.size(); ++i) {
+        EXPECT_EQ(tilingBuffers.at(i).first[0], i + 1);
+    }
+    // 未分配时不移动分配位置
+    EXPECT_EQ(pool.GetBuffer(), tilingBuffers.at(0).first);
+    pool.Destroy();
+}
+
+// 测试场景：Setup的Operation个数超过内存池块数，后Setup的Operation复用了先Setup的Operation的内存
+// 测试结果：汇总返回错误，不拷贝任何tiling
+TEST(TestTilingBufferPool, GatherMoreOperationsThanBlocks)
+{
+    HostTilingBufferPool pool(TEST_BLOCK_NUM, TEST_BLOCK_SIZE);
+    ASSERT_EQ(pool.Init(), NO_ERROR);
+    const uint64_t tilingSize = 16;
+    std::vector<std::pair<const uint8_t *, uint64_t>> tilingBuffers =
+        SetupOperations(pool, TEST_BLOCK_NUM + 2, tilingSize);
+    EXPECT_EQ(tilingBuffers.at(0).first[0], TEST_BLOCK_NUM + 1);
+    uint8_t *gatherBuffer = nullptr;
+    EXPECT_EQ(pool.GatherContinuousBuffer(tilingBuffers, gatherBuffer), ERROR_INVALID_PARAM);
+    EXPECT_EQ(gatherBuffer, nullptr);
+    pool.Destroy();
+}
+
+// 测试场景：依次分配单块内存，再分配跨两块的连续内存
+// 测试结果：每块在分配前都等待一次，连续内存所跨的每块都等待
+TEST(TestTilingBufferPool, WaitBlockBeforeReuse)
+{
+    WaitRecordingPool pool;
+    ASSERT_EQ(pool.Init(), NO_ERROR);
+    (void)pool.GetBuffer();
+    (void)pool.GetBuffer();
+    (void)pool.GetBuffer();
+    EXPECT_EQ(pool.waitedBlocks, std::vector<uint64_t>({0, 1, 2}));
+    pool.waitedBlocks.clear();
+    // 剩余1块不足，从头分配第0、1块
+    ASSERT_NE(pool.GetContinuousBuffer(TEST_BLOCK_SIZE + 1), nullptr);
+    EXPECT_EQ(pool.waitedBlocks, std::vector<uint64_t>({0, 1}));
+    pool.Destroy();
+}
+
+// 测试场景：锁页内存池的一块作为异步拷贝的源下发后，环形内存池转满一圈再次分配到该块并写入新内容
+// 测试结果：再次分配前等待拷贝完成，device上为拷贝下发时的内容
+TEST(TestTilingBufferPool, PinnedBlockReuseWaitsForCopy)
+{
+    if (!GetSingleton<Config>().Is910B()) {
+        GTEST_SKIP() << "This test case only support 910B";
+    }
+    aclrtSetDevice(0);
+    aclrtStream stream = nullptr;
+    ASSERT_EQ(aclrtCreateStream(&stream), 0);
+    HostTilingBufferPool pool(TEST_BLOCK_NUM, TEST_BLOCK_SIZE, true);
+    ASSERT_EQ(pool.Init(), NO_ERROR);
+    void *deviceBuffer = nullptr;
+    ASSERT_EQ(aclrtMalloc(&deviceBuffer, TEST_BLOCK_SIZE, ACL_MEM_MALLOC_HUGE_FIRST), 0);
+
+    uint8_t *hostBuffer = pool.GetBuffer();
+    (void)memset(hostBuffer, 1, TEST_BLOCK_SIZE);
+    ASSERT_EQ(aclrtMemcpyAsync(deviceBuffer, TEST_BLOCK_SIZE, hostBuffer, TEST_BLOCK_SIZE, ACL_MEMCPY_HOST_TO_DEVICE,
+                               stream), 0);
+    ASSERT_EQ(pool.RecordBufferCopy(hostBuffer, TEST_BLOCK_SIZE, stream), NO_ERROR);
+    for (uint64_t i = 1; i < TEST_BLOCK_NUM; ++i) {
+        (void)pool.GetBuffer();
+    }
+    uint8_t *reusedBuffer = pool.GetBuffer();
+    ASSERT_EQ(reusedBuffer, hostBuffer);
+    (void)memset(reusedBuffer, 2, TEST_BLOCK_SIZE);
+    ASSERT_EQ(aclrtSynchronizeStream(stream), 0);
+
+    std::vector<uint8_t> result(TEST_BLOCK_SIZE, 0);
+    ASSERT_EQ(aclrtMemcpy(result.data(), TEST_BLOCK_SIZE, deviceBuffer, TEST_BLOCK_SIZE, ACL_MEMCPY_DEVICE_TO_HOST),
+              0);
+    EXPECT_EQ(result, std::vector<uint8_t>(TEST_BLOCK_SIZE, 1));
+    aclrtFree(deviceBuffer);
+    pool.Destroy();
+    aclrtDestroyStream(stream);
+}
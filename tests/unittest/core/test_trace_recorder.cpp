@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024-2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <sstream>
+#include <string>
+#include <thread>
+#include <gtest/gtest.h>
+#include "atb/utils/singleton.h"
+#include "atb/utils/trace_recorder.h"
+
+using namespace atb;
+
+TEST(TestTraceRecorder, RegisterNameReturnSameId)
+{
+    TraceRecorder &traceRecorder = GetSingleton<TraceRecorder>();
+    uint32_t nameId = traceRecorder.RegisterName("TestTraceRecorderOperation");
+    EXPECT_NE(nameId, 0U);
+    EXPECT_EQ(traceRecorder.RegisterName("TestTraceRecorderOperation"), nameId);
+    EXPECT_NE(traceRecorder.RegisterName("TestTraceRecorderRunner"), nameId);
+}
+
+TEST(TestTraceRecorder, DumpEventsOfAllThreads)
+{
+    TraceRecorder &traceRecorder = GetSingleton<TraceRecorder>();
+    bool oldEnable = traceRecorder.IsEnable();
+    traceRecorder.SetEnable(true);
+    uint32_t nameId = traceRecorder.RegisterName("TestTraceDumpOperation");
+    {
+        TraceScope traceScope(TRACE_EVENT_OPERATION_SETUP, nameId);
+    }
+    std::thread worker([&traceRecorder, nameId]() {
+        TraceScope traceScope(TRACE_EVENT_TILING_FILL, nameId);
+        traceRecorder.RecordInstant(TRACE_EVENT_TILING_CACHE_MISS, nameId);
+    });
+    worker.join();
+    traceRecorder.SetEnable(oldEnable);
+
+    std::ostringstream os;
+    traceRecorder.Dump(os);
+    std::string trace = os.str();
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"TestTraceDumpOperation\",\"cat\":\"Setup\""), std::string::npos);
+    EXPECT_NE(trace.find("\"cat\":\"TilingFill\""), std::string::npos);
+    EXPECT_NE(trace.find("\"cat\":\"TilingCacheMiss\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"i\""), std::string::npos);
+}
+
+TEST(TestTraceRecorder, DisableNotRecord)
+{
+    TraceRecorder &traceRecorder = GetSingleton<TraceRecorder>();
+    bool oldEnable = traceRecorder.IsEnable();
+    traceRecorder.SetEnable(false);
+    uint32_t nameId = traceRecorder.RegisterName("TestTraceDisableOperation");
+    {
+        TraceScope traceScope(TRACE_EVENT_OPERATION_LAUNCH, nameId);
+    }
+    traceRecorder.SetEnable(oldEnable);
+    std::ostringstream os;
+    traceRecorder.Dump(os);
+    EXPECT_EQ(os.str().find("\"name\":\"TestTraceDisableOperation\""), std::string::npos);
+}
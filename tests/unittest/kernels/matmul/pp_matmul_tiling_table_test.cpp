@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <string>
+#include <tuple>
+#include <gtest/gtest.h>
+#include "kernels/matmul/tiling/pp_matmul_tiling_table.h"
+
+using namespace AsdOps;
+using namespace Mki;
+
+namespace {
+constexpr uint32_t L0C_SIZE = 131072;
+constexpr uint32_t IN_DTYPE_MASK = 0xF;
+
+MatMulInfo EntryToMatMulInfo(const PpMatmulTilingEntry &entry)
+{
+    MatMulInfo mmInfo;
+    mmInfo.batchSize = entry.batchSize;
+    mmInfo.m = entry.m;
+    mmInfo.k = entry.k;
+    mmInfo.n = entry.n;
+    mmInfo.transA = (entry.flags & PP_TILING_FLAG_TRANS_A) != 0;
+    mmInfo.transB = (entry.flags & PP_TILING_FLAG_TRANS_B) != 0;
+    mmInfo.formatB = (entry.flags & PP_TILING_FLAG_FORMAT_B_NZ) != 0 ? TENSOR_FORMAT_FRACTAL_NZ : TENSOR_FORMAT_ND;
+    mmInfo.mmType = (entry.flags & PP_TILING_FLAG_WITH_BIAS) != 0 ? OpParam::MatMul::MatMulType::MATMUL_WITH_BIAS
+                                                                  : OpParam::MatMul::MatMulType::MATMUL_DEFAULT;
+    mmInfo.inDtype = static_cast<float>((entry.flags >> PP_TILING_FLAG_IN_DTYPE_SHIFT) & IN_DTYPE_MASK);
+    mmInfo.isInt8 = mmInfo.inDtype == 1;
+    return mmInfo;
+}
+} // namespace
+
+TEST(PpMatmulTilingTableTest, EntriesSortedAndValid)
+{
+    size_t tableNum = 0;
+    const PpMatmulTilingTable *tables = GetPpMatmulTilingTables(tableNum);
+    ASSERT_TRUE(tableNum == 0 || tables != nullptr);
+    for (size_t i = 0; i < tableNum; ++i) {
+        const PpMatmulTilingTable &table = tables[i];
+        for (size_t j = 0; j < table.entryNum; ++j) {
+            const PpMatmulTilingEntry &entry = table.entries[j];
+            EXPECT_GT(entry.m0, 0U);
+            EXPECT_GT(entry.n0, 0U);
+            EXPECT_LE(entry.m0 * entry.n0 * sizeof(float), L0C_SIZE);
+            EXPECT_GE(entry.swizzlCount, 1U);
+            EXPECT_LE(entry.swizzlCount, entry.coreNum);
+            EXPECT_LE(entry.swizzlDirect, 1U);
+            EXPECT_EQ(GetPpMatmulTilingFlags(EntryToMatMulInfo(entry)), entry.flags);
+            if (j == 0) {
+                continue;
+            }
+            const PpMatmulTilingEntry &prev = table.entries[j - 1];
+            // 二分查找要求表项严格升序且无重复key
+            EXPECT_TRUE(std::tie(prev.coreNum, prev.flags, prev.batchSize, prev.m, prev.k, prev.n) <
+                        std::tie(entry.coreNum, entry.flags, entry.batchSize, entry.m, entry.k, entry.n));
+        }
+    }
+}
+
+TEST(PpMatmulTilingTableTest, FindEntry)
+{
+    size_t tableNum = 0;
+    const PpMatmulTilingTable *tables = GetPpMatmulTilingTables(tableNum);
+    for (size_t i = 0; i < tableNum; ++i) {
+        const PpMatmulTilingTable &table = tables[i];
+        for (size_t j = 0; j < table.entryNum; ++j) {
+            const PpMatmulTilingEntry &entry = table.entries[j];
+            MatMulInfo mmInfo = EntryToMatMulInfo(entry);
+            EXPECT_EQ(FindPpMatmulTilingEntry(table.platformType, entry.coreNum, mmInfo), &entry);
+            // 核数或shape不同都不能命中
+            EXPECT_EQ(FindPpMatmulTilingEntry(table.platformType, entry.coreNum + 1, mmInfo), nullptr);
+            mmInfo.k = entry.k + 1;
+            const PpMatmulTilingEntry *other = FindPpMatmulTilingEntry(table.platformType, entry.coreNum, mmInfo);
+            EXPECT_TRUE(other == nullptr || other->k == mmInfo.k);
+        }
+    }
+    MatMulInfo mmInfo;
+    mmInfo.batchSize = 1;
+    mmInfo.m = 3;
+    mmInfo.k = 5;
+    mmInfo.n = 7;
+    mmInfo.inDtype = 2;
+    EXPECT_EQ(FindPpMatmulTilingEntry(PlatformType::ASCEND_910B, 24, mmInfo), nullptr);
+}
+
+// 测试场景：当前芯片的每个表项，分别查表和跳过查表走解析搜索计算PpMatmul切分
+// 测试结果：解析搜索结果与表项逐字段一致，查表与解析搜索得到的tiling数据逐字段一致
+TEST(PpMatmulTilingTableTest, AnalyticTilingMatchesEntries)
+{
+    size_t tableNum = 0;
+    const PpMatmulTilingTable *tables = GetPpMatmulTilingTables(tableNum);
+    PlatformType platformType = PlatformInfo::Instance().GetPlatformType();
+    size_t checkedNum = 0;
+    for (size_t i = 0; i < tableNum; ++i) {
+        const PpMatmulTilingTable &table = tables[i];
+        if (table.platformType != platformType) {
+            continue;
+        }
+        for (size_t j = 0; j < table.entryNum; ++j) {
+            const PpMatmulTilingEntry &entry = table.entries[j];
+            MatMulInfo mmInfo = EntryToMatMulInfo(entry);
+            HardwareInfo hwInfo;
+            hwInfo.coreNum = entry.coreNum;
+            uint32_t analyticBlockDim = 0;
+            uint32_t tableBlockDim = 0;
+            PpTilingData analyticTiling;
+            PpTilingData tableTiling;
+            GetPpMatmulTiling(mmInfo, hwInfo, analyticBlockDim, analyticTiling, false);
+            GetPpMatmulTiling(mmInfo, hwInfo, tableBlockDim, tableTiling);
+            std::string entryInfo = "coreNum: " + std::to_string(entry.coreNum) +
+                                    ", flags: " + std::to_string(entry.flags) +
+                                    ", batchSize: " + std::to_string(entry.batchSize) +
+                                    ", m: " + std::to_string(entry.m) + ", k: " + std::to_string(entry.k) +
+                                    ", n: " + std::to_string(entry.n);
+            EXPECT_EQ(analyticTiling.opShape.m0, entry.m0) << entryInfo;
+            EXPECT_EQ(analyticTiling.opShape.n0, entry.n0) << entryInfo;
+            EXPECT_EQ(analyticTiling.swizzlCount, entry.swizzlCount) << entryInfo;
+            EXPECT_EQ(analyticTiling.swizzlDirect, entry.swizzlDirect) << entryInfo;
+            EXPECT_EQ(analyticBlockDim, tableBlockDim) << entryInfo;
+            EXPECT_EQ(analyticTiling.opShape.k0, tableTiling.opShape.k0) << entryInfo;
+            EXPECT_EQ(analyticTiling.mLoop, tableTiling.mLoop) << entryInfo;
+            EXPECT_EQ(analyticTiling.kLoop, tableTiling.kLoop) << entryInfo;
+            EXPECT_EQ(analyticTiling.nLoop, tableTiling.nLoop) << entryInfo;
+            EXPECT_EQ(analyticTiling.coreLoop, tableTiling.coreLoop) << entryInfo;
+            EXPECT_EQ(analyticTiling.blockDim, tableTiling.blockDim) << entryInfo;
+            EXPECT_EQ(analyticTiling.tilingKey, tableTiling.tilingKey) << entryInfo;
+            ++checkedNum;
+        }
+    }
+    if (checkedNum == 0) {
+        GTEST_SKIP() << "no tiling table for current platform";
+    }
+}